@@ -21,8 +21,9 @@ protected:
 	virtual void NativeConstruct() override;
 
 public:
+	// InCommunityId is the community the building was loaded from; empty asks the level's BuildingEnergyDisplay (GetCommunityOfBuilding)
 	UFUNCTION(BlueprintCallable, Category = "Building Attributes")
-	void SetBuildingData(const FString& GmlId, const FString& Token);
+	void SetBuildingData(const FString& GmlId, const FString& Token, const FString& InCommunityId = TEXT(""));
 
 	UFUNCTION(BlueprintCallable, Category = "Building Attributes")
 	void CloseWidget();
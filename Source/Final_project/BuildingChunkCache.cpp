@@ -0,0 +1,133 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingChunkCache.h"
+
+FBuildingChunkKey FBuildingChunkKey::FromLongitudeLatitude(double Longitude, double Latitude, int32 Level)
+{
+	const double TileSize = GetTileSize(Level);
+
+	FBuildingChunkKey Key;
+	Key.Level = Level;
+	Key.X = FMath::Clamp(FMath::FloorToInt32((Longitude + 180.0) / TileSize), 0, (2 << Level) - 1);
+	Key.Y = FMath::Clamp(FMath::FloorToInt32((Latitude + 90.0) / TileSize), 0, (1 << Level) - 1);
+	return Key;
+}
+
+void FBuildingChunkKey::GetBounds(double& OutWest, double& OutSouth, double& OutEast, double& OutNorth) const
+{
+	const double TileSize = GetTileSize(Level);
+	OutWest = -180.0 + X * TileSize;
+	OutSouth = -90.0 + Y * TileSize;
+	OutEast = OutWest + TileSize;
+	OutNorth = OutSouth + TileSize;
+}
+
+void FBuildingChunkCache::Touch(const FBuildingChunkKey& Key)
+{
+	if (FEntry* Entry = Entries.Find(Key))
+	{
+		Entry->LastUse = ++UseClock;
+	}
+}
+
+int32 FBuildingChunkCache::Add(const FBuildingChunkKey& Key, const TSharedRef<const FRecords>& Records)
+{
+	if (const FEntry* Existing = Entries.Find(Key))
+	{
+		TotalBytes -= Existing->Bytes;
+	}
+
+	const SIZE_T Bytes = GetRecordsSize(*Records);
+	Entries.Add(Key, FEntry{ Records, ++UseClock, Bytes });
+	TotalBytes += Bytes;
+
+	return Evict();
+}
+
+void FBuildingChunkCache::GetResident(TArray<TSharedRef<const FRecords>>& OutRecords) const
+{
+	TArray<const FEntry*> Sorted;
+	Sorted.Reserve(Entries.Num());
+	for (const TPair<FBuildingChunkKey, FEntry>& Pair : Entries)
+	{
+		Sorted.Add(&Pair.Value);
+	}
+	Sorted.Sort([](const FEntry& A, const FEntry& B) { return A.LastUse > B.LastUse; });
+
+	OutRecords.Reset(Sorted.Num());
+	for (const FEntry* Entry : Sorted)
+	{
+		OutRecords.Add(Entry->Records);
+	}
+}
+
+void FBuildingChunkCache::Reset()
+{
+	Entries.Reset();
+	TotalBytes = 0;
+}
+
+void FBuildingChunkCache::GatherChunksAround(double Longitude, double Latitude, double RadiusMeters, int32 Level, TArray<FBuildingChunkKey>& OutKeys)
+{
+	constexpr double MetersPerDegree = 111320.0;
+	const double CosLatitude = FMath::Max(0.01, FMath::Cos(FMath::DegreesToRadians(Latitude)));
+	const double LatitudeRadius = RadiusMeters / MetersPerDegree;
+	const double LongitudeRadius = RadiusMeters / (MetersPerDegree * CosLatitude);
+
+	const FBuildingChunkKey SouthWest = FBuildingChunkKey::FromLongitudeLatitude(Longitude - LongitudeRadius, Latitude - LatitudeRadius, Level);
+	const FBuildingChunkKey NorthEast = FBuildingChunkKey::FromLongitudeLatitude(Longitude + LongitudeRadius, Latitude + LatitudeRadius, Level);
+
+	OutKeys.Reset();
+	for (int32 Y = SouthWest.Y; Y <= NorthEast.Y; ++Y)
+	{
+		for (int32 X = SouthWest.X; X <= NorthEast.X; ++X)
+		{
+			OutKeys.Add(FBuildingChunkKey{ Level, X, Y });
+		}
+	}
+
+	// Nearest first: the buildings under the camera are requested, and survive eviction, before the rim
+	const double TileSize = FBuildingChunkKey::GetTileSize(Level);
+	auto DistanceSquared = [=](const FBuildingChunkKey& Key)
+	{
+		const double DeltaLongitude = (-180.0 + (Key.X + 0.5) * TileSize - Longitude) * CosLatitude;
+		const double DeltaLatitude = -90.0 + (Key.Y + 0.5) * TileSize - Latitude;
+		return DeltaLongitude * DeltaLongitude + DeltaLatitude * DeltaLatitude;
+	};
+	OutKeys.Sort([&DistanceSquared](const FBuildingChunkKey& A, const FBuildingChunkKey& B) { return DistanceSquared(A) < DistanceSquared(B); });
+}
+
+SIZE_T FBuildingChunkCache::GetRecordsSize(const FRecords& Records)
+{
+	SIZE_T Bytes = Records.GetAllocatedSize();
+	for (const FBuildingEnergyRecord& Record : Records)
+	{
+		Bytes += Record.ModifiedGmlId.GetAllocatedSize() + Record.ActualGmlId.GetAllocatedSize() + Record.CoordinatesText.GetAllocatedSize();
+		Bytes += Record.Begin.EnergyDemandSpecificColor.GetAllocatedSize() + Record.End.EnergyDemandSpecificColor.GetAllocatedSize();
+		Bytes += Record.Coordinates.GetAllocatedSize() + Record.RingEnds.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+int32 FBuildingChunkCache::Evict()
+{
+	int32 NumEvicted = 0;
+
+	// The most recent chunk always stays, even when it alone exceeds the byte budget
+	while (Entries.Num() > 1 && (Entries.Num() > MaxChunks || (MaxBytes > 0 && TotalBytes > MaxBytes)))
+	{
+		const TPair<FBuildingChunkKey, FEntry>* Oldest = nullptr;
+		for (const TPair<FBuildingChunkKey, FEntry>& Pair : Entries)
+		{
+			if (!Oldest || Pair.Value.LastUse < Oldest->Value.LastUse)
+			{
+				Oldest = &Pair;
+			}
+		}
+
+		TotalBytes -= Oldest->Value.Bytes;
+		Entries.Remove(FBuildingChunkKey(Oldest->Key));
+		++NumEvicted;
+	}
+	return NumEvicted;
+}
@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BuildingEnergyIngest.h"
+
+// One tile of Cesium's geographic tiling scheme: 2 x 1 root tiles, every level splits a tile in four.
+// X counts east from the antimeridian, Y north from the south pole.
+struct FBuildingChunkKey
+{
+	int32 Level = 0;
+	int32 X = 0;
+	int32 Y = 0;
+
+	// Tile edge in degrees
+	static double GetTileSize(int32 Level) { return 180.0 / double(1 << Level); }
+
+	static FBuildingChunkKey FromLongitudeLatitude(double Longitude, double Latitude, int32 Level);
+
+	void GetBounds(double& OutWest, double& OutSouth, double& OutEast, double& OutNorth) const;
+
+	FString ToString() const { return FString::Printf(TEXT("%d/%d/%d"), Level, X, Y); }
+
+	bool operator==(const FBuildingChunkKey& Other) const { return Level == Other.Level && X == Other.X && Y == Other.Y; }
+
+	friend uint32 GetTypeHash(const FBuildingChunkKey& Key)
+	{
+		return HashCombine(HashCombine(::GetTypeHash(Key.Level), ::GetTypeHash(Key.X)), ::GetTypeHash(Key.Y));
+	}
+};
+
+// Building records of the chunks around the camera, evicted least recently used first.
+// The display store is rebuilt from the resident chunks, so memory follows the view instead of the district.
+// Game thread only; the record arrays are immutable once added and can be read from a worker.
+class FINAL_PROJECT_API FBuildingChunkCache
+{
+public:
+	using FRecords = TArray<FBuildingEnergyRecord>;
+
+	// Limits enforced on Add; 0 disables the byte budget
+	int32 MaxChunks = 64;
+	SIZE_T MaxBytes = 0;
+
+	bool Contains(const FBuildingChunkKey& Key) const { return Entries.Contains(Key); }
+
+	// Marks a chunk as used by the current view
+	void Touch(const FBuildingChunkKey& Key);
+
+	// Inserts the chunk as most recently used and evicts over the limits; returns the number of evicted chunks
+	int32 Add(const FBuildingChunkKey& Key, const TSharedRef<const FRecords>& Records);
+
+	// Most recently used first
+	void GetResident(TArray<TSharedRef<const FRecords>>& OutRecords) const;
+
+	int32 Num() const { return Entries.Num(); }
+	SIZE_T GetAllocatedSize() const { return TotalBytes; }
+	void Reset();
+
+	// Chunks intersecting the square of RadiusMeters around a point, nearest first
+	static void GatherChunksAround(double Longitude, double Latitude, double RadiusMeters, int32 Level, TArray<FBuildingChunkKey>& OutKeys);
+
+private:
+	struct FEntry
+	{
+		TSharedRef<const FRecords> Records;
+		uint64 LastUse = 0;
+		SIZE_T Bytes = 0;
+	};
+
+	static SIZE_T GetRecordsSize(const FRecords& Records);
+	int32 Evict();
+
+	TMap<FBuildingChunkKey, FEntry> Entries;
+	uint64 UseClock = 0;
+	SIZE_T TotalBytes = 0;
+};
@@ -0,0 +1,437 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingEnergyApiSubsystem.h"
+#include "BuildingEnergyLog.h"
+#include "BuildingEnergyMockBackend.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Async/Async.h"
+#include "HttpModule.h"
+
+namespace BuildingEnergyApi
+{
+	static FString ApiBaseUrlOverride;
+}
+
+void UBuildingEnergyApiSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+#if !UE_BUILD_SHIPPING
+	// Offline mode: every request of this game instance goes to a local stand-in instead of the backend
+	if (FParse::Param(FCommandLine::Get(), TEXT("BuildingEnergyMockBackend")))
+	{
+		MockBackend = MakeShared<FBuildingEnergyMockBackend>(FBuildingEnergyMockBackendSettings::FromCommandLine(FCommandLine::Get()));
+		if (!MockBackend->Start())
+		{
+			MockBackend.Reset();
+		}
+	}
+#endif
+}
+
+FString UBuildingEnergyApiSubsystem::GetApiBaseUrl()
+{
+	FString BaseUrl = BuildingEnergyApi::ApiBaseUrlOverride;
+	if (BaseUrl.IsEmpty())
+	{
+		FParse::Value(FCommandLine::Get(), TEXT("BuildingEnergyApiBaseUrl="), BaseUrl);
+	}
+	if (BaseUrl.IsEmpty())
+	{
+		BaseUrl = GetDefault<UBuildingEnergyApiSubsystem>()->ApiBaseUrl;
+	}
+	while (BaseUrl.EndsWith(TEXT("/")))
+	{
+		BaseUrl.LeftChopInline(1);
+	}
+	return BaseUrl;
+}
+
+void UBuildingEnergyApiSubsystem::SetApiBaseUrlOverride(const FString& BaseUrl)
+{
+	check(IsInGameThread());
+	BuildingEnergyApi::ApiBaseUrlOverride = BaseUrl;
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🌐 API: Base URL is now %s"), *GetApiBaseUrl());
+}
+
+void UBuildingEnergyApiSubsystem::Deinitialize()
+{
+	if (MockBackend.IsValid())
+	{
+		MockBackend->Stop();
+		MockBackend.Reset();
+	}
+
+	// The owners of the callbacks are going away with the game instance; drop the requests without answering them
+	for (const TSharedRef<FCall>& Call : InFlightCalls)
+	{
+		Call->Request->OnProcessRequestComplete().Unbind();
+		Call->Request->CancelRequest();
+	}
+
+	InFlightCalls.Reset();
+	ParkedCalls.Reset();
+	Queue.Reset();
+	CallsByKey.Reset();
+	OnTokenRejected.Clear();
+
+	Super::Deinitialize();
+}
+
+UBuildingEnergyApiSubsystem* UBuildingEnergyApiSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UBuildingEnergyApiSubsystem>() : nullptr;
+}
+
+void UBuildingEnergyApiSubsystem::Send(const UObject* WorldContextObject, const FHttpRequestRef& Request, FHttpRequestCompleteDelegate OnComplete, EBuildingApiPriority Priority)
+{
+	if (UBuildingEnergyApiSubsystem* Broker = Get(WorldContextObject))
+	{
+		Broker->Submit(Request, MoveTemp(OnComplete), Priority);
+		return;
+	}
+
+	Request->OnProcessRequestComplete() = OnComplete;
+	if (!Request->ProcessRequest())
+	{
+		Request->OnProcessRequestComplete().Unbind();
+		OnComplete.ExecuteIfBound(Request, nullptr, false);
+	}
+}
+
+void UBuildingEnergyApiSubsystem::Submit(const FHttpRequestRef& Request, FHttpRequestCompleteDelegate OnComplete, EBuildingApiPriority Priority)
+{
+	// Callers that cached a token before the last rollover (e.g. the widget) would only collect another 401
+	RewriteRetiredToken(*Request);
+
+	const FString Key = MakeCallKey(*Request);
+
+	if (!Key.IsEmpty())
+	{
+		if (TSharedRef<FCall>* Existing = CallsByKey.Find(Key))
+		{
+			TSharedRef<FCall> Call = *Existing;
+			Call->Callbacks.Add(MoveTemp(OnComplete));
+			StatsByEndpoint.FindOrAdd(Call->Endpoint).Joined++;
+
+			// A user now waits on a queued background request: move it up with the other user requests
+			if (Priority > Call->Priority && Queue.Remove(Call) > 0)
+			{
+				Call->Priority = Priority;
+				Enqueue(Call);
+			}
+
+			UE_LOG(LogBuildingEnergyNet, Verbose, TEXT("🔗 API: Joined in-flight %s (%d waiting)"), *Call->Endpoint, Call->Callbacks.Num());
+			return;
+		}
+	}
+
+	TSharedRef<FCall> Call = MakeShared<FCall>(Request);
+	Call->Callbacks.Add(MoveTemp(OnComplete));
+	Call->Priority = Priority;
+	Call->Key = Key;
+	Call->Endpoint = GetEndpointName(Request->GetURL());
+	Call->SubmitTime = FPlatformTime::Seconds();
+
+	Register(Call);
+	Pump();
+}
+
+void UBuildingEnergyApiSubsystem::UpdateAccessToken(const FString& NewToken)
+{
+	if (NewToken.IsEmpty())
+	{
+		return;
+	}
+
+	if (!CurrentToken.IsEmpty() && CurrentToken != NewToken)
+	{
+		RetiredTokens.Remove(CurrentToken);
+		RetiredTokens.Add(CurrentToken);
+		if (RetiredTokens.Num() > 8)
+		{
+			RetiredTokens.RemoveAt(0);
+		}
+	}
+	RetiredTokens.Remove(NewToken);
+	CurrentToken = NewToken;
+
+	TArray<TSharedRef<FCall>> ToReplay = MoveTemp(ParkedCalls);
+	ParkedCalls.Reset();
+	if (ToReplay.Num() > 0)
+	{
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔑 API: Replaying %d request(s) parked on 401 with the new token"), ToReplay.Num());
+	}
+	for (const TSharedRef<FCall>& Call : ToReplay)
+	{
+		Replay(Call);
+	}
+	Pump();
+}
+
+void UBuildingEnergyApiSubsystem::FailParkedRequests()
+{
+	TArray<TSharedRef<FCall>> ToFail = MoveTemp(ParkedCalls);
+	ParkedCalls.Reset();
+	for (const TSharedRef<FCall>& Call : ToFail)
+	{
+		Answer(Call, Call->RejectedResponse, true);
+	}
+}
+
+void UBuildingEnergyApiSubsystem::ResetEndpointStats()
+{
+	// Keep the live counters, they describe requests that are still around
+	for (TPair<FString, FBuildingApiEndpointStats>& Pair : StatsByEndpoint)
+	{
+		const FBuildingApiEndpointStats Live = Pair.Value;
+		Pair.Value = FBuildingApiEndpointStats();
+		Pair.Value.Queued = Live.Queued;
+		Pair.Value.InFlight = Live.InFlight;
+	}
+	CompletedByEndpoint.Reset();
+}
+
+FString UBuildingEnergyApiSubsystem::GetEndpointName(const FString& Url)
+{
+	FString Path = Url;
+
+	int32 SchemeEnd = Path.Find(TEXT("://"));
+	if (SchemeEnd != INDEX_NONE)
+	{
+		Path.RightChopInline(SchemeEnd + 3);
+		int32 PathStart;
+		Path = Path.FindChar(TEXT('/'), PathStart) ? Path.RightChop(PathStart) : FString(TEXT("/"));
+	}
+
+	int32 QueryStart;
+	if (Path.FindChar(TEXT('?'), QueryStart))
+	{
+		Path.LeftInline(QueryStart);
+	}
+
+	// Building ids (DEBWL001008widf), community ids and numeric keys all carry digits; path words do not
+	TArray<FString> Segments;
+	Path.ParseIntoArray(Segments, TEXT("/"));
+
+	FString Name;
+	for (const FString& Segment : Segments)
+	{
+		const bool bIsId = Segment.FindLastCharByPredicate(FChar::IsDigit) != INDEX_NONE;
+		Name += TEXT("/");
+		Name += bIsId ? TEXT("{id}") : *Segment;
+	}
+	if (Name.IsEmpty() || Path.EndsWith(TEXT("/")))
+	{
+		Name += TEXT("/");
+	}
+	return Name;
+}
+
+FString UBuildingEnergyApiSubsystem::MakeCallKey(const IHttpRequest& Request)
+{
+	if (Request.GetVerb() != TEXT("GET"))
+	{
+		return FString();
+	}
+
+	return FString::Join(TArray<FString>{
+		Request.GetURL(),
+		Request.GetHeader(TEXT("Authorization")),
+		Request.GetHeader(TEXT("Accept")),
+		Request.GetHeader(TEXT("If-None-Match")),
+		Request.GetHeader(TEXT("If-Modified-Since")) }, TEXT("\n"));
+}
+
+FString UBuildingEnergyApiSubsystem::GetBearerToken(const IHttpRequest& Request)
+{
+	const FString Authorization = Request.GetHeader(TEXT("Authorization"));
+	return Authorization.StartsWith(TEXT("Bearer ")) ? Authorization.RightChop(7) : FString();
+}
+
+void UBuildingEnergyApiSubsystem::RewriteRetiredToken(IHttpRequest& Request) const
+{
+	if (!CurrentToken.IsEmpty() && RetiredTokens.Contains(GetBearerToken(Request)))
+	{
+		Request.SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *CurrentToken));
+	}
+}
+
+void UBuildingEnergyApiSubsystem::Replay(const TSharedRef<FCall>& Call)
+{
+	// A processed request is not resent; copy it with the current token
+	const IHttpRequest& Source = *Call->Request;
+	FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Source.GetURL());
+	Request->SetVerb(Source.GetVerb());
+	for (const FString& Header : Source.GetAllHeaders())
+	{
+		FString Name, Value;
+		if (Header.Split(TEXT(": "), &Name, &Value))
+		{
+			Request->SetHeader(Name, Value);
+		}
+	}
+	Request->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *CurrentToken));
+	if (Source.GetContent().Num() > 0)
+	{
+		Request->SetContent(Source.GetContent());
+	}
+	if (TOptional<float> Timeout = Source.GetTimeout())
+	{
+		Request->SetTimeout(Timeout.GetValue());
+	}
+
+	TSharedRef<FCall> Replayed = MakeShared<FCall>(Request);
+	Replayed->Callbacks = MoveTemp(Call->Callbacks);
+	Replayed->Priority = Call->Priority;
+	Replayed->Key = MakeCallKey(*Request);
+	Replayed->Endpoint = Call->Endpoint;
+	Replayed->SubmitTime = FPlatformTime::Seconds();
+	Replayed->bReplayed = true;
+
+	if (TSharedRef<FCall>* Existing = Replayed->Key.IsEmpty() ? nullptr : CallsByKey.Find(Replayed->Key))
+	{
+		(*Existing)->Callbacks.Append(MoveTemp(Replayed->Callbacks));
+		return;
+	}
+	Register(Replayed);
+}
+
+void UBuildingEnergyApiSubsystem::Register(const TSharedRef<FCall>& Call)
+{
+	if (!Call->Key.IsEmpty())
+	{
+		CallsByKey.Add(Call->Key, Call);
+	}
+
+	StatsByEndpoint.FindOrAdd(Call->Endpoint).Queued++;
+	Enqueue(Call);
+}
+
+void UBuildingEnergyApiSubsystem::Enqueue(const TSharedRef<FCall>& Call)
+{
+	int32 InsertAt = Queue.IndexOfByPredicate([&Call](const TSharedRef<FCall>& Queued) { return Queued->Priority < Call->Priority; });
+	Queue.Insert(Call, InsertAt == INDEX_NONE ? Queue.Num() : InsertAt);
+}
+
+void UBuildingEnergyApiSubsystem::Pump()
+{
+	while (Queue.Num() > 0 && InFlightCalls.Num() < FMath::Max(1, MaxConcurrentRequests))
+	{
+		TSharedRef<FCall> Call = Queue[0];
+		Queue.RemoveAt(0);
+		Dispatch(Call);
+	}
+}
+
+void UBuildingEnergyApiSubsystem::Dispatch(const TSharedRef<FCall>& Call)
+{
+	FBuildingApiEndpointStats& Stats = StatsByEndpoint.FindOrAdd(Call->Endpoint);
+	Stats.Queued--;
+	Stats.InFlight++;
+	Stats.Sent++;
+
+	Call->DispatchTime = FPlatformTime::Seconds();
+	const float QueueWaitMs = float((Call->DispatchTime - Call->SubmitTime) * 1000.0);
+	Stats.AverageQueueWaitMs += (QueueWaitMs - Stats.AverageQueueWaitMs) / Stats.Sent;
+
+	InFlightCalls.Add(Call);
+
+	// Weak: the request owns its delegate, and the call owns the request
+	TWeakPtr<FCall> WeakCall = Call;
+	Call->Request->OnProcessRequestComplete().BindWeakLambda(this, [this, WeakCall](FHttpRequestPtr, FHttpResponsePtr Response, bool bWasSuccessful)
+	{
+		if (TSharedPtr<FCall> Pinned = WeakCall.Pin())
+		{
+			Complete(Pinned.ToSharedRef(), Response, bWasSuccessful);
+		}
+	});
+
+	if (!Call->Request->ProcessRequest())
+	{
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("❌ API: Failed to start %s %s"), *Call->Request->GetVerb(), *Call->Endpoint);
+
+		// Answer on the next game thread tick, callers expect their handler to run after Submit returns
+		Call->Request->OnProcessRequestComplete().Unbind();
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UBuildingEnergyApiSubsystem>(this), WeakCall]()
+		{
+			TSharedPtr<FCall> Pinned = WeakCall.Pin();
+			if (WeakThis.IsValid() && Pinned.IsValid())
+			{
+				WeakThis->Complete(Pinned.ToSharedRef(), nullptr, false);
+			}
+		});
+	}
+}
+
+void UBuildingEnergyApiSubsystem::Complete(const TSharedRef<FCall>& Call, FHttpResponsePtr Response, bool bWasSuccessful)
+{
+	if (InFlightCalls.Remove(Call) == 0)
+	{
+		return;
+	}
+
+	if (!Call->Key.IsEmpty())
+	{
+		const TSharedRef<FCall>* Registered = CallsByKey.Find(Call->Key);
+		if (Registered && *Registered == Call)
+		{
+			CallsByKey.Remove(Call->Key);
+		}
+	}
+
+	FBuildingApiEndpointStats& Stats = StatsByEndpoint.FindOrAdd(Call->Endpoint);
+	Stats.InFlight--;
+	if (bWasSuccessful && Response.IsValid())
+	{
+		const float LatencyMs = float((FPlatformTime::Seconds() - Call->DispatchTime) * 1000.0);
+		const int32 Completed = ++CompletedByEndpoint.FindOrAdd(Call->Endpoint);
+		Stats.LastLatencyMs = LatencyMs;
+		Stats.MaxLatencyMs = FMath::Max(Stats.MaxLatencyMs, LatencyMs);
+		Stats.AverageLatencyMs += (LatencyMs - Stats.AverageLatencyMs) / Completed;
+	}
+	else
+	{
+		Stats.Failed++;
+	}
+
+	// Token rejected: the callers get a response once a new token arrives instead of this 401
+	const FString Token = bWasSuccessful && Response.IsValid() && Response->GetResponseCode() == EHttpResponseCodes::Denied && !Call->bReplayed
+		? GetBearerToken(*Call->Request) : FString();
+	if (!Token.IsEmpty() && !CurrentToken.IsEmpty() && Token != CurrentToken)
+	{
+		Replay(Call); // Sent before the last rollover
+		Pump();
+		return;
+	}
+	if (!Token.IsEmpty() && OnTokenRejected.IsBound())
+	{
+		Call->RejectedResponse = Response;
+		ParkedCalls.Add(Call);
+		UE_LOG(LogBuildingEnergyNet, Warning, TEXT("🔑 API: %s rejected the token, parked for replay (%d parked)"), *Call->Endpoint, ParkedCalls.Num());
+		if (ParkedCalls.Num() == 1)
+		{
+			OnTokenRejected.Broadcast();
+		}
+		Pump();
+		return;
+	}
+
+	// Free the slot before answering so callbacks that submit follow-up requests get it
+	Answer(Call, Response, bWasSuccessful);
+	Pump();
+}
+
+void UBuildingEnergyApiSubsystem::Answer(const TSharedRef<FCall>& Call, FHttpResponsePtr Response, bool bWasSuccessful)
+{
+	for (const FHttpRequestCompleteDelegate& Callback : Call->Callbacks)
+	{
+		Callback.ExecuteIfBound(Call->Request, Response, bWasSuccessful);
+	}
+	Call->Callbacks.Reset();
+}
@@ -0,0 +1,172 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "BuildingEnergyApiSubsystem.generated.h"
+
+DECLARE_MULTICAST_DELEGATE(FOnBuildingApiTokenRejected);
+
+class FBuildingEnergyMockBackend;
+
+UENUM(BlueprintType)
+enum class EBuildingApiPriority : uint8
+{
+	Background,		// Polls and refreshes nobody is waiting on
+	UserInitiated	// Clicks, form loads, login; dispatched ahead of every queued background request
+};
+
+USTRUCT(BlueprintType)
+struct FBuildingApiEndpointStats
+{
+	GENERATED_BODY()
+
+	// Requests that went out on the wire
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	int32 Sent = 0;
+
+	// Callers that joined an identical request already queued or in flight instead of sending their own
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	int32 Joined = 0;
+
+	// Connection failures and timeouts; HTTP error codes count as completed
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	int32 Failed = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	int32 Queued = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	int32 InFlight = 0;
+
+	// Dispatch to completion
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	float LastLatencyMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	float AverageLatencyMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	float MaxLatencyMs = 0.0f;
+
+	// Submit to dispatch, i.e. time spent waiting for a free connection slot
+	UPROPERTY(BlueprintReadOnly, Category = "Building Energy|API")
+	float AverageQueueWaitMs = 0.0f;
+};
+
+// Single-flight broker for every backend request of the actor and the attributes widget.
+// Identical GETs (same URL, token and validators) that are queued or in flight share one response,
+// at most MaxConcurrentRequests go out at once, and user-initiated requests jump the background polls.
+// Completion callbacks always run, on the game thread, even when the request could not be started,
+// so callers can keep their "request pending" state in plain members cleared by the handler.
+// A bearer request answered 401 is parked instead of answered while someone listens to OnTokenRejected,
+// and replayed with the token handed to UpdateAccessToken.
+UCLASS(Config = Game)
+class FINAL_PROJECT_API UBuildingEnergyApiSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Starts the local mock backend when the command line has -BuildingEnergyMockBackend (not in Shipping)
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Scheme and host every endpoint hangs off, without a trailing '/'. In order of precedence:
+	// SetApiBaseUrlOverride, -BuildingEnergyApiBaseUrl= on the command line, then ApiBaseUrl from the config
+	static FString GetApiBaseUrl();
+
+	// Redirects every request built from now on, e.g. to a mock backend in automation tests; empty restores the default
+	static void SetApiBaseUrlOverride(const FString& BaseUrl);
+
+	// Backend of every endpoint, e.g. http://127.0.0.1:8765 for a local mock. Read from the class defaults (DefaultGame.ini)
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Building Energy|API")
+	FString ApiBaseUrl = TEXT("https://backend.gisworld-tech.com");
+
+	// Mock started by -BuildingEnergyMockBackend, null otherwise
+	FBuildingEnergyMockBackend* GetMockBackend() const { return MockBackend.Get(); }
+
+	// Broker of the game instance WorldContextObject lives in, or null outside a game (commandlets, editor preview)
+	static UBuildingEnergyApiSubsystem* Get(const UObject* WorldContextObject);
+
+	// Goes through the broker when there is one, otherwise processes Request directly
+	static void Send(const UObject* WorldContextObject, const FHttpRequestRef& Request, FHttpRequestCompleteDelegate OnComplete, EBuildingApiPriority Priority);
+
+	// Request must be fully configured and not yet processed; its own completion delegate is replaced
+	void Submit(const FHttpRequestRef& Request, FHttpRequestCompleteDelegate OnComplete, EBuildingApiPriority Priority);
+
+	// Broadcast when the first request is parked on a 401; answer with UpdateAccessToken or FailParkedRequests
+	FOnBuildingApiTokenRejected OnTokenRejected;
+
+	// Replays parked requests with NewToken; later requests still carrying an older token are switched to it on submit
+	void UpdateAccessToken(const FString& NewToken);
+
+	// Answers parked requests with the 401 they got
+	void FailParkedRequests();
+
+	UFUNCTION(BlueprintCallable, Category = "Building Energy|API")
+	int32 GetNumParked() const { return ParkedCalls.Num(); }
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Building Energy|API", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 MaxConcurrentRequests = 4;
+
+	// Keyed by endpoint path with id segments collapsed, e.g. "/geospatial/buildings-energy/{id}/"
+	UFUNCTION(BlueprintCallable, Category = "Building Energy|API")
+	TMap<FString, FBuildingApiEndpointStats> GetEndpointStats() const { return StatsByEndpoint; }
+
+	UFUNCTION(BlueprintCallable, Category = "Building Energy|API")
+	int32 GetQueueDepth() const { return Queue.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Building Energy|API")
+	int32 GetNumInFlight() const { return InFlightCalls.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Building Energy|API")
+	void ResetEndpointStats();
+
+	static FString GetEndpointName(const FString& Url);
+
+private:
+	struct FCall
+	{
+		FHttpRequestRef Request;
+		TArray<FHttpRequestCompleteDelegate> Callbacks;
+		EBuildingApiPriority Priority = EBuildingApiPriority::Background;
+		FString Key; // Empty for requests that are never shared
+		FString Endpoint;
+		double SubmitTime = 0.0;
+		double DispatchTime = 0.0;
+		FHttpResponsePtr RejectedResponse; // The 401 a parked call is answered with if no new token comes
+		bool bReplayed = false; // Already resent with a new token; a second 401 goes to the callbacks
+
+		explicit FCall(const FHttpRequestRef& InRequest) : Request(InRequest) {}
+	};
+
+	// Verb, URL and the headers that select the representation; only GETs are shared
+	static FString MakeCallKey(const IHttpRequest& Request);
+
+	void Enqueue(const TSharedRef<FCall>& Call);
+	void Pump();
+	void Dispatch(const TSharedRef<FCall>& Call);
+	void Complete(const TSharedRef<FCall>& Call, FHttpResponsePtr Response, bool bWasSuccessful);
+	void Answer(const TSharedRef<FCall>& Call, FHttpResponsePtr Response, bool bWasSuccessful);
+	void Register(const TSharedRef<FCall>& Call);
+
+	static FString GetBearerToken(const IHttpRequest& Request);
+	void RewriteRetiredToken(IHttpRequest& Request) const;
+	void Replay(const TSharedRef<FCall>& Call);
+
+	TArray<TSharedRef<FCall>> Queue; // User-initiated first, FIFO within a priority
+	TMap<FString, TSharedRef<FCall>> CallsByKey; // Queued and in-flight shareable calls
+	TArray<TSharedRef<FCall>> InFlightCalls;
+	TArray<TSharedRef<FCall>> ParkedCalls; // 401s waiting for UpdateAccessToken
+
+	FString CurrentToken;
+	TArray<FString> RetiredTokens; // Most recent last, capped
+
+	TSharedPtr<FBuildingEnergyMockBackend> MockBackend; // Shared pointer so the type can stay forward declared
+
+	TMap<FString, FBuildingApiEndpointStats> StatsByEndpoint;
+	TMap<FString, int32> CompletedByEndpoint; // Sample counts behind the averages
+};
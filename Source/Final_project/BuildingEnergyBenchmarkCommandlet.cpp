@@ -0,0 +1,398 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingEnergyBenchmarkCommandlet.h"
+#include "BuildingEnergyDisplay.h"
+#include "BuildingEnergyLog.h"
+#include "BuildingEnergySyntheticCity.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+// The benchmark reports on its own category so silencing the pipeline's categories keeps its output
+DEFINE_LOG_CATEGORY_STATIC(LogBuildingEnergyBenchmark, Log, All);
+
+namespace BuildingEnergyBenchmark
+{
+	static constexpr int32 MaxBuildings = 500000;
+
+	static double ToMB(SIZE_T Bytes)
+	{
+		return Bytes / (1024.0 * 1024.0);
+	}
+
+	// Nearest-rank percentile of sorted samples
+	static double Percentile(const TArray<double>& SortedMs, double Fraction)
+	{
+		if (SortedMs.Num() == 0)
+		{
+			return 0.0;
+		}
+		const int32 Rank = FMath::Clamp(FMath::CeilToInt32(Fraction * SortedMs.Num()) - 1, 0, SortedMs.Num() - 1);
+		return SortedMs[Rank];
+	}
+
+	struct FSummary
+	{
+		double TotalMs = 0.0;
+		double MeanMs = 0.0;
+		double P50Ms = 0.0;
+		double P90Ms = 0.0;
+		double P99Ms = 0.0;
+		double MaxMs = 0.0;
+		double ThroughputPerSecond = 0.0; // Items per second over all samples
+	};
+
+	static FSummary Summarize(const TArray<double>& SampleMs, int32 NumItems)
+	{
+		FSummary Summary;
+		TArray<double> SortedMs = SampleMs;
+		SortedMs.Sort();
+		for (const double Ms : SortedMs)
+		{
+			Summary.TotalMs += Ms;
+		}
+		if (SortedMs.Num() > 0)
+		{
+			Summary.MeanMs = Summary.TotalMs / SortedMs.Num();
+			Summary.MaxMs = SortedMs.Last();
+		}
+		Summary.P50Ms = Percentile(SortedMs, 0.5);
+		Summary.P90Ms = Percentile(SortedMs, 0.9);
+		Summary.P99Ms = Percentile(SortedMs, 0.99);
+		if (Summary.TotalMs > 0.0)
+		{
+			Summary.ThroughputPerSecond = static_cast<double>(NumItems) * SortedMs.Num() / (Summary.TotalMs / 1000.0);
+		}
+		return Summary;
+	}
+}
+
+UBuildingEnergyBenchmarkCommandlet::UBuildingEnergyBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBuildingEnergyBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace BuildingEnergyBenchmark;
+
+	// === Arguments ===
+	FString SizesParam = TEXT("1000,10000,100000");
+	FParse::Value(*Params, TEXT("Sizes="), SizesParam, false);
+	TArray<FString> SizeStrings;
+	SizesParam.ParseIntoArray(SizeStrings, TEXT(","));
+	TArray<int32> Sizes;
+	for (const FString& SizeString : SizeStrings)
+	{
+		const int32 Size = FCString::Atoi(*SizeString.TrimStartAndEnd());
+		if (Size <= 0 || Size > MaxBuildings)
+		{
+			UE_LOG(LogBuildingEnergyBenchmark, Error, TEXT("❌ BENCHMARK: Size '%s' is outside 1..%d"), *SizeString, MaxBuildings);
+			return 1;
+		}
+		Sizes.Add(Size);
+	}
+	if (Sizes.Num() == 0)
+	{
+		UE_LOG(LogBuildingEnergyBenchmark, Error, TEXT("❌ BENCHMARK: No city sizes in -Sizes=%s"), *SizesParam);
+		return 1;
+	}
+
+	int32 Seed = 1;
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("Queries="), Queries);
+	FParse::Value(*Params, TEXT("Polls="), Polls);
+	FParse::Value(*Params, TEXT("ChangeFraction="), ChangeFraction);
+	Iterations = FMath::Max(1, Iterations);
+	Queries = FMath::Max(1, Queries);
+	Polls = FMath::Max(1, Polls);
+	ChangeFraction = FMath::Clamp(ChangeFraction, 0.0f, 1.0f);
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("BuildingEnergyBenchmark-%s.json"), *FDateTime::Now().ToString());
+	}
+	const bool bCsv = FPaths::GetExtension(OutputPath).Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+
+	TOptional<FBuildingLogSilenceScope> SilencedLogs;
+	if (!FParse::Param(*Params, TEXT("KeepLogs")))
+	{
+		SilencedLogs.Emplace();
+	}
+
+	// === Headless world ===
+	// The display publishes through the world's timer manager, so it needs a world but never a viewport or tileset
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("BuildingEnergyBenchmark"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	ABuildingEnergyDisplay* Display = World->SpawnActor<ABuildingEnergyDisplay>(SpawnParams);
+	bool bAllSizesRan = Display != nullptr;
+	if (Display)
+	{
+		// BeginPlay is never called: no authentication, preload, polling or WebSocket
+		Display->SetActorTickEnabled(false);
+		for (const int32 Size : Sizes)
+		{
+			FBuildingEnergySyntheticCity City;
+			City.NumBuildings = Size;
+			City.Seed = Seed;
+			UE_LOG(LogBuildingEnergyBenchmark, Display, TEXT("🏙️ BENCHMARK: %d buildings (seed %d)"), Size, Seed);
+			bAllSizesRan &= RunSize(*Display, City);
+		}
+		Display->Destroy();
+	}
+	else
+	{
+		UE_LOG(LogBuildingEnergyBenchmark, Error, TEXT("❌ BENCHMARK: Could not spawn ABuildingEnergyDisplay"));
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	SilencedLogs.Reset();
+
+	if (Results.Num() == 0)
+	{
+		return 1;
+	}
+
+	// === Report ===
+	for (const FPhaseResult& Result : Results)
+	{
+		const FSummary Summary = Summarize(Result.SampleMs, Result.NumItems);
+		UE_LOG(LogBuildingEnergyBenchmark, Display, TEXT("📊 %-17s %7d buildings  %10.0f/s  mean %8.3f  p50 %8.3f  p90 %8.3f  p99 %8.3f  max %8.3f ms  store %7.1f MB  peak %7.1f MB"),
+			*Result.Phase, Result.NumBuildings, Summary.ThroughputPerSecond, Summary.MeanMs, Summary.P50Ms, Summary.P90Ms, Summary.P99Ms, Summary.MaxMs,
+			Result.StoreMB, Result.PeakUsedPhysicalMB);
+	}
+
+	if (!FFileHelper::SaveStringToFile(bCsv ? FormatCsv() : FormatJson(), *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogBuildingEnergyBenchmark, Error, TEXT("❌ BENCHMARK: Failed to write %s"), *OutputPath);
+		return 1;
+	}
+	UE_LOG(LogBuildingEnergyBenchmark, Display, TEXT("✅ BENCHMARK: Wrote %d results to %s"), Results.Num(), *FPaths::ConvertRelativePathToFull(OutputPath));
+	return bAllSizesRan ? 0 : 1; // Partial results are still written, but a regression job must see the failure
+}
+
+bool UBuildingEnergyBenchmarkCommandlet::RunIngest(ABuildingEnergyDisplay& Display, const TArray<uint8>& Utf8Json, double& OutMs)
+{
+	Display.ClearCache();
+	TArray<uint8> JsonCopy = Utf8Json; // Copied outside the timing, the parse consumes its input
+
+	const double StartTime = FPlatformTime::Seconds();
+	Display.ParseAndCacheAllBuildings(MoveTemp(JsonCopy), false);
+	return WaitForIngest(Display, StartTime, OutMs);
+}
+
+bool UBuildingEnergyBenchmarkCommandlet::RunIngest(ABuildingEnergyDisplay& Display, const FString& Json, double& OutMs)
+{
+	Display.ClearCache();
+	FString JsonCopy = Json;
+
+	const double StartTime = FPlatformTime::Seconds();
+	Display.ParseAndCacheAllBuildings(MoveTemp(JsonCopy), false);
+	return WaitForIngest(Display, StartTime, OutMs);
+}
+
+bool UBuildingEnergyBenchmarkCommandlet::WaitForIngest(ABuildingEnergyDisplay& Display, double StartTime, double& OutMs)
+{
+	// The worker hands the store back through a game thread task; pump them until it is published
+	while (!Display.bDataLoaded)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		if (!Display.bIsLoading && !Display.bDataLoaded)
+		{
+			UE_LOG(LogBuildingEnergyBenchmark, Error, TEXT("❌ BENCHMARK: Ingest finished without publishing a store"));
+			return false;
+		}
+		if (FPlatformTime::Seconds() - StartTime > IngestTimeoutSeconds)
+		{
+			UE_LOG(LogBuildingEnergyBenchmark, Error, TEXT("❌ BENCHMARK: Ingest did not finish within %.0f s"), IngestTimeoutSeconds);
+			return false;
+		}
+		FPlatformProcess::Sleep(0.0f);
+	}
+	OutMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	return true;
+}
+
+bool UBuildingEnergyBenchmarkCommandlet::RunSize(ABuildingEnergyDisplay& Display, const FBuildingEnergySyntheticCity& City)
+{
+	// === Generate ===
+	double StartTime = FPlatformTime::Seconds();
+	const FString Json = City.GenerateJson();
+	const double GenerateMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	const FTCHARToUTF8 Utf8Converted(*Json, Json.Len());
+	const TArray<uint8> Utf8Json(reinterpret_cast<const uint8*>(Utf8Converted.Get()), Utf8Converted.Length());
+	UE_LOG(LogBuildingEnergyBenchmark, Display, TEXT("🏙️ BENCHMARK: Generated %.1f MB of JSON (%.1f MB as UTF-8) in %.0f ms"),
+		BuildingEnergyBenchmark::ToMB(Json.GetAllocatedSize()), BuildingEnergyBenchmark::ToMB(Utf8Json.Num()), GenerateMs);
+
+	// === Ingest: ParseAndCacheAllBuildings until the store is published ===
+	// "ingest" parses the UTF-8 bytes like the paged preload; "ingest_utf16" the FString the realtime and push paths still hand over
+	TArray<double> SampleMs;
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		double IngestMs = 0.0;
+		if (!RunIngest(Display, Json, IngestMs))
+		{
+			return false;
+		}
+		SampleMs.Add(IngestMs);
+	}
+	AddResult(TEXT("ingest_utf16"), Display, City.NumBuildings, MoveTemp(SampleMs));
+
+	SampleMs.Reset();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		double IngestMs = 0.0;
+		if (!RunIngest(Display, Utf8Json, IngestMs))
+		{
+			return false;
+		}
+		SampleMs.Add(IngestMs);
+	}
+	AddResult(TEXT("ingest"), Display, City.NumBuildings, MoveTemp(SampleMs));
+	if (Display.BuildingStore.Num() != City.NumBuildings)
+	{
+		UE_LOG(LogBuildingEnergyBenchmark, Warning, TEXT("⚠️ BENCHMARK: Store holds %d of %d generated buildings"), Display.BuildingStore.Num(), City.NumBuildings);
+	}
+
+	// === Full style: CreateCesiumColorExpression from an empty style state ===
+	SampleMs.Reset();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		Display.BuildingStyleState.Reset();
+		StartTime = FPlatformTime::Seconds();
+		Display.CreateCesiumColorExpression();
+		SampleMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	AddResult(TEXT("style_full"), Display, City.NumBuildings, MoveTemp(SampleMs));
+
+	// === Picking: GetBuildingByCoordinates at random footprint centers ===
+	SampleMs.Reset(Queries);
+	int32 NumMisses = 0;
+	FRandomStream Stream(City.Seed);
+	for (int32 Query = 0; Query < Queries; ++Query)
+	{
+		const int32 Index = Stream.RandRange(0, City.NumBuildings - 1);
+		const FVector ClickPosition = City.GetCenter(Index);
+		StartTime = FPlatformTime::Seconds();
+		const FString GmlId = Display.GetBuildingByCoordinates(ClickPosition);
+		SampleMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+		if (!GmlId.Equals(City.GetModifiedGmlId(Index), ESearchCase::CaseSensitive))
+		{
+			++NumMisses;
+		}
+	}
+	AddResult(TEXT("picking"), Display, 1, MoveTemp(SampleMs)).NumMisses = NumMisses;
+
+	// === Polls: DetectAndApplyChanges, the update queue, then the incremental style ===
+	TArray<double> DetectionMs;
+	TArray<double> ApplyMs;
+	TArray<double> IncrementalStyleMs;
+	int32 NumQueuedTotal = 0;
+	for (int32 Poll = 1; Poll <= Polls; ++Poll)
+	{
+		const FString PollJson = City.GenerateJson(Poll, ChangeFraction);
+
+		StartTime = FPlatformTime::Seconds();
+		Display.DetectAndApplyChanges(PollJson);
+		DetectionMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+		NumQueuedTotal += Display.PendingBuildingPatches.Num();
+
+		// Every call stays within UpdateFrameBudgetMs like a frame would; the sample is the whole drain
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < 100000 && (Display.PendingBuildingPatches.Num() > 0 || Display.PendingAppliedIndices.Num() > 0); ++Frame)
+		{
+			Display.ProcessPendingBuildingUpdates();
+		}
+		ApplyMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		StartTime = FPlatformTime::Seconds();
+		Display.CreateCesiumColorExpression();
+		IncrementalStyleMs.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	AddResult(TEXT("change_detection"), Display, City.NumBuildings, MoveTemp(DetectionMs)).NumQueued = NumQueuedTotal;
+	AddResult(TEXT("apply_updates"), Display, NumQueuedTotal / Polls, MoveTemp(ApplyMs)); // Patches per drain, on average
+	AddResult(TEXT("style_incremental"), Display, City.NumBuildings, MoveTemp(IncrementalStyleMs));
+	return true;
+}
+
+UBuildingEnergyBenchmarkCommandlet::FPhaseResult& UBuildingEnergyBenchmarkCommandlet::AddResult(const TCHAR* Phase, const ABuildingEnergyDisplay& Display, int32 NumItems, TArray<double>&& SampleMs)
+{
+	// Called when the phase is done, so the memory columns show what it left behind
+	FPhaseResult& Result = Results.AddDefaulted_GetRef();
+	Result.Phase = Phase;
+	Result.NumBuildings = Display.BuildingStore.Num();
+	Result.NumItems = NumItems;
+	Result.SampleMs = MoveTemp(SampleMs);
+	Result.StoreMB = BuildingEnergyBenchmark::ToMB(Display.BuildingStore.GetAllocatedSize());
+	Result.PeakUsedPhysicalMB = BuildingEnergyBenchmark::ToMB(FPlatformMemory::GetStats().PeakUsedPhysical);
+	return Result;
+}
+
+FString UBuildingEnergyBenchmarkCommandlet::FormatJson() const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("generated_at"), FDateTime::UtcNow().ToIso8601());
+	Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	Root->SetNumberField(TEXT("iterations"), Iterations);
+	Root->SetNumberField(TEXT("change_fraction"), ChangeFraction);
+
+	TArray<TSharedPtr<FJsonValue>> ResultValues;
+	for (const FPhaseResult& Result : Results)
+	{
+		const BuildingEnergyBenchmark::FSummary Summary = BuildingEnergyBenchmark::Summarize(Result.SampleMs, Result.NumItems);
+		TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetStringField(TEXT("phase"), Result.Phase);
+		Entry->SetNumberField(TEXT("buildings"), Result.NumBuildings);
+		Entry->SetNumberField(TEXT("samples"), Result.SampleMs.Num());
+		Entry->SetNumberField(TEXT("items_per_sample"), Result.NumItems);
+		Entry->SetNumberField(TEXT("throughput_per_s"), Summary.ThroughputPerSecond);
+		Entry->SetNumberField(TEXT("mean_ms"), Summary.MeanMs);
+		Entry->SetNumberField(TEXT("p50_ms"), Summary.P50Ms);
+		Entry->SetNumberField(TEXT("p90_ms"), Summary.P90Ms);
+		Entry->SetNumberField(TEXT("p99_ms"), Summary.P99Ms);
+		Entry->SetNumberField(TEXT("max_ms"), Summary.MaxMs);
+		Entry->SetNumberField(TEXT("store_mb"), Result.StoreMB);
+		Entry->SetNumberField(TEXT("peak_used_physical_mb"), Result.PeakUsedPhysicalMB);
+		Entry->SetNumberField(TEXT("misses"), Result.NumMisses);
+		Entry->SetNumberField(TEXT("queued"), Result.NumQueued);
+		ResultValues.Add(MakeShared<FJsonValueObject>(Entry));
+	}
+	Root->SetArrayField(TEXT("results"), ResultValues);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Output;
+}
+
+FString UBuildingEnergyBenchmarkCommandlet::FormatCsv() const
+{
+	FString Output = TEXT("phase,buildings,samples,items_per_sample,throughput_per_s,mean_ms,p50_ms,p90_ms,p99_ms,max_ms,store_mb,peak_used_physical_mb,misses,queued\n");
+	for (const FPhaseResult& Result : Results)
+	{
+		const BuildingEnergyBenchmark::FSummary Summary = BuildingEnergyBenchmark::Summarize(Result.SampleMs, Result.NumItems);
+		Output.Appendf(TEXT("%s,%d,%d,%d,%.1f,%.4f,%.4f,%.4f,%.4f,%.4f,%.2f,%.2f,%d,%d\n"),
+			*Result.Phase, Result.NumBuildings, Result.SampleMs.Num(), Result.NumItems, Summary.ThroughputPerSecond,
+			Summary.MeanMs, Summary.P50Ms, Summary.P90Ms, Summary.P99Ms, Summary.MaxMs,
+			Result.StoreMB, Result.PeakUsedPhysicalMB, Result.NumMisses, Result.NumQueued);
+	}
+	return Output;
+}
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BuildingEnergyBenchmarkCommandlet.generated.h"
+
+class ABuildingEnergyDisplay;
+class FBuildingEnergySyntheticCity;
+
+// Headless scaling benchmark of the building energy pipeline on synthetic cities.
+// Runs ingest, style generation, picking, change detection and the update queue for each
+// city size and writes throughput, latency percentiles and memory as JSON or CSV.
+//
+// UnrealEditor-Cmd.exe <Project>.uproject -run=BuildingEnergyBenchmark
+//   -Sizes=1000,10000,100000   City sizes in buildings (1000 to 500000)
+//   -Iterations=3              Runs of each bulk phase (ingest, full style)
+//   -Queries=10000             Picking queries per size
+//   -Polls=5                   Change detection polls per size
+//   -ChangeFraction=0.01       Share of buildings recolored by each poll
+//   -Seed=1                    Generator seed; equal seeds generate equal cities
+//   -Output=<path>             .json (default) or .csv; defaults to Saved/Benchmarks/
+//   -KeepLogs                  Keep the LogBuildingEnergy* output (it skews the timings)
+UCLASS()
+class UBuildingEnergyBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UBuildingEnergyBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	struct FPhaseResult
+	{
+		FString Phase;
+		int32 NumBuildings = 0;
+		int32 NumItems = 0; // Buildings, queries or patches processed by every sample
+		TArray<double> SampleMs;
+		double StoreMB = 0.0;
+		double PeakUsedPhysicalMB = 0.0;
+		int32 NumMisses = 0; // Picking queries that did not resolve to the queried building
+		int32 NumQueued = 0; // Patches queued by change detection
+	};
+
+	// Ingest through ParseAndCacheAllBuildings and wait for the store to be published.
+	// The bytes are what a paged preload parses; the FString overload adds the UTF-16 copy of the realtime and push callers.
+	bool RunIngest(ABuildingEnergyDisplay& Display, const TArray<uint8>& Utf8Json, double& OutMs);
+	bool RunIngest(ABuildingEnergyDisplay& Display, const FString& Json, double& OutMs);
+
+	// Pumps game thread tasks until the ingest started at StartTime has published its store
+	bool WaitForIngest(ABuildingEnergyDisplay& Display, double StartTime, double& OutMs);
+
+	// Every phase for one city; false when the ingest failed and the remaining phases were skipped
+	bool RunSize(ABuildingEnergyDisplay& Display, const FBuildingEnergySyntheticCity& City);
+
+	// Records a finished phase together with the store size and peak memory at that point
+	FPhaseResult& AddResult(const TCHAR* Phase, const ABuildingEnergyDisplay& Display, int32 NumItems, TArray<double>&& SampleMs);
+
+	FString FormatJson() const;
+	FString FormatCsv() const;
+
+	int32 Iterations = 3;
+	int32 Queries = 10000;
+	int32 Polls = 5;
+	float ChangeFraction = 0.01f;
+	double IngestTimeoutSeconds = 600.0;
+
+	TArray<FPhaseResult> Results;
+};
@@ -2,18 +2,34 @@
 
 #include "BuildingEnergyDisplay.h" // Include the header file for this class [BUILDING ENERGY DISPLAY INCLUDE]
 #include "BuildingAttributesWidget.h" // Include building attributes widget for UI functionality [BUILDING ATTRIBUTES WIDGET INCLUDE]
+#include "BuildingEnergyIngest.h" // Include streaming parser for the buildings-energy response [BUILDING ENERGY INGEST INCLUDE]
+#include "BuildingStoreSnapshot.h" // Include binary snapshot for warm starts [BUILDING STORE SNAPSHOT INCLUDE]
+#include "BuildingHttpValidators.h" // Include conditional GET validators for polling [BUILDING HTTP VALIDATORS INCLUDE]
+#include "BuildingEnergyPatch.h" // Include binary push patch frames [BUILDING ENERGY PATCH INCLUDE]
+#include "BuildingEnergyApiSubsystem.h" // Include the single-flight API request broker [BUILDING ENERGY API SUBSYSTEM INCLUDE]
+#include "BuildingEnergyLog.h" // Include log categories and hot-loop logging macros [BUILDING ENERGY LOG INCLUDE]
+#include "BuildingEnergyStats.h" // Include stat group and profiler scopes for `stat BuildingEnergy` and Insights [BUILDING ENERGY STATS INCLUDE]
 #include "HttpModule.h" // Include HTTP module for web request functionality [HTTP MODULE INCLUDE]
+#include "GenericPlatform/GenericPlatformHttp.h" // Include URL encoding for delta sync cursors [GENERIC PLATFORM HTTP INCLUDE]
 #include "Interfaces/IHttpResponse.h" // Include HTTP response interface for handling web responses [HTTP RESPONSE INTERFACE INCLUDE]
 #include "Json.h" // Include JSON library for parsing and creating JSON data [JSON INCLUDE]
 #include "JsonUtilities.h" // Include JSON utility functions for advanced JSON operations [JSON UTILITIES INCLUDE]
 #include "Engine/Engine.h" // Include engine functionality for global engine access [ENGINE INCLUDE]
 #include "EngineUtils.h" // Include engine utility functions for world iteration and object finding [ENGINE UTILS INCLUDE]
 #include "Materials/MaterialInstanceDynamic.h" // Include dynamic material instances for runtime material modifications [MATERIAL INSTANCE DYNAMIC INCLUDE]
+#include "Engine/Texture2D.h" // Include transient textures for the building color lookup [TEXTURE 2D INCLUDE]
 #include "Components/StaticMeshComponent.h" // Include static mesh component functionality for mesh handling [STATIC MESH COMPONENT INCLUDE]
 #include "WebSocketsModule.h" // Include WebSocket module for real-time energy updates [WEBSOCKET MODULE INCLUDE]
 #include "IWebSocket.h" // Include WebSocket interface for energy data connections [WEBSOCKET INTERFACE INCLUDE]
 #include "Cesium3DTileset.h"
+#include "CesiumGeoreference.h" // Include georeference for the camera longitude/latitude used by viewport loading [CESIUM GEOREFERENCE INCLUDE]
+#include "Camera/PlayerCameraManager.h" // Include camera manager for the viewport location [PLAYER CAMERA MANAGER INCLUDE]
 #include "Kismet/GameplayStatics.h" // Include gameplay statics for actor finding and world queries [GAMEPLAY STATICS INCLUDE]
+#include "Tasks/Task.h" // Include UE Tasks for background ingest [TASKS INCLUDE]
+#include "Async/Async.h" // Include AsyncTask for publishing results on the game thread [ASYNC INCLUDE]
+#include "Algo/Sort.h" // Include sorting for color lookup row runs [ALGO SORT INCLUDE]
+#include "Misc/Base64.h" // Include Base64 decoding for the JWT expiry claim [BASE64 INCLUDE]
+#include "Misc/ScopeExit.h" // Include scope exit guards for answering parked API requests [SCOPE EXIT INCLUDE]
 
 // Sets default values [CONSTRUCTOR COMMENT]
 ABuildingEnergyDisplay::ABuildingEnergyDisplay() // Default constructor for initializing member variables [CONSTRUCTOR DECLARATION]
@@ -38,7 +54,6 @@ ABuildingEnergyDisplay::ABuildingEnergyDisplay() // Default constructor for init
 	// Initialize WebSocket Energy Variables
 	EnergyWebSocket = nullptr; // Initialize energy WebSocket pointer to null [ENERGY WEBSOCKET INITIALIZATION]
 	bEnergyWebSocketConnected = false; // Initialize energy WebSocket connection status [ENERGY WEBSOCKET CONNECTION STATUS]
-	EnergyWebSocketURL = TEXT(""); // Disabled - using REST API polling instead of WebSocket
 	WebSocketReconnectTimer = 0.0f; // Initialize reconnect timer [WEBSOCKET RECONNECT TIMER]
 	EnergyUpdateCounter = 0; // Initialize energy update counter [ENERGY UPDATE COUNTER]
 	
@@ -65,18 +80,18 @@ void ABuildingEnergyDisplay::BeginPlay() // BeginPlay lifecycle method called wh
 	int32 ActiveInstances = FoundActors.Num();
 	FString ActorName = GetName();
 	
-	UE_LOG(LogTemp, Warning, TEXT("🎭 ACTIVE INSTANCES: %d BuildingEnergyDisplay actors found in world"), ActiveInstances);
-	UE_LOG(LogTemp, Warning, TEXT("🎭 CURRENT ACTOR: %s"), *ActorName);
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🎭 ACTIVE INSTANCES: %d BuildingEnergyDisplay actors found in world"), ActiveInstances);
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🎭 CURRENT ACTOR: %s"), *ActorName);
 	
 	if (ActiveInstances > 1)
 	{
-		UE_LOG(LogTemp, Error, TEXT("⚠️ MULTIPLE INSTANCES: Found %d BuildingEnergyDisplay actors in the level!"), ActiveInstances);
-		UE_LOG(LogTemp, Error, TEXT("💡 SOLUTION: Remove duplicate BuildingEnergyDisplay actors from your level to prevent duplicate data loading."));
+		UE_LOG(LogBuildingEnergy, Error, TEXT("⚠️ MULTIPLE INSTANCES: Found %d BuildingEnergyDisplay actors in the level!"), ActiveInstances);
+		UE_LOG(LogBuildingEnergy, Error, TEXT("💡 SOLUTION: Remove duplicate BuildingEnergyDisplay actors from your level to prevent duplicate data loading."));
 		
 		// Log all found actors for debugging
 		for (int32 i = 0; i < FoundActors.Num(); i++)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("   Actor %d: %s"), i + 1, *FoundActors[i]->GetName());
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("   Actor %d: %s"), i + 1, *FoundActors[i]->GetName());
 		}
 		
 		if (GEngine && bShowScreenMessages)
@@ -89,27 +104,42 @@ void ABuildingEnergyDisplay::BeginPlay() // BeginPlay lifecycle method called wh
 		bool bIsFirstInstance = (FoundActors[0] == this);
 		if (!bIsFirstInstance)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🚫 DISABLING duplicate instance: %s"), *ActorName);
+			UE_LOG(LogBuildingEnergy, Log, TEXT("🚫 DISABLING duplicate instance: %s"), *ActorName);
 			SetActorTickEnabled(false);
 			return; // Exit early for duplicate instances
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("✅ KEEPING primary instance: %s"), *ActorName);
+			UE_LOG(LogBuildingEnergy, Log, TEXT("✅ KEEPING primary instance: %s"), *ActorName);
 		}
 	}
 	
 	// Reset authentication message flag for fresh play session
 	bAuthenticationMessageShown = false;
+
+	// 💾 WARM START: Show the last preloaded buildings while Blueprint authenticates and revalidates
+	// (the snapshot holds the whole community, which viewport loading is meant to avoid)
+	if (!bLoadByViewport)
+	{
+		LoadBuildingSnapshot();
+	}
+
+	// Keep the buildings tileset lookup current without rescanning the world on every use
+	if (UWorld* World = GetWorld())
+	{
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnWorldActorSpawned));
+	}
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ABuildingEnergyDisplay::OnLevelStreamingChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ABuildingEnergyDisplay::OnLevelStreamingChanged);
 	
 	// 🎮 BLUEPRINT CONTROL: Let Blueprint BeginPlay event handle the authentication and loading
-	UE_LOG(LogTemp, Warning, TEXT("🎮 C++ BeginPlay complete. Blueprint will control authentication and data loading."));
-	UE_LOG(LogTemp, Warning, TEXT("💡 Blueprint should call AuthenticateAndLoadData() when ready."));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🎮 C++ BeginPlay complete. Blueprint will control authentication and data loading."));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("💡 Blueprint should call AuthenticateAndLoadData() when ready."));
 	
 	// Start real-time monitoring for continuous background updates [START REAL-TIME MONITORING COMMENT]
 	StartRealTimeMonitoring(); // Initialize real-time monitoring system for continuous data updates [START REAL-TIME MONITORING CALL]
 	
-	UE_LOG(LogTemp, Warning, TEXT("REALTIME Real-time monitoring system initialized")); // Log message indicating real-time monitoring is active [REAL-TIME MONITORING LOG MESSAGE]
+	UE_LOG(LogBuildingEnergy, Log, TEXT("REALTIME Real-time monitoring system initialized")); // Log message indicating real-time monitoring is active [REAL-TIME MONITORING LOG MESSAGE]
 	
 	// 🔄 CESIUM REFRESH MONITORING: Set up automatic color reapplication when Cesium refreshes
 	// TEMPORARILY DISABLED - Investigating interaction issues
@@ -120,9 +150,9 @@ void ABuildingEnergyDisplay::BeginPlay() // BeginPlay lifecycle method called wh
 		
 		// 🎨 AUTO COLOR APPLICATION AT STARTUP: If data is already loaded, apply colors immediately
 		// TEMPORARILY DISABLED - Causing gray overlay on entire scene
-		if (BuildingColorCache.Num() > 0)
+		if (BuildingStore.NumColoredBuildings() > 0)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🎨 STARTUP: Color cache contains %d buildings, but auto-application disabled to prevent gray overlay"), BuildingColorCache.Num());
+			UE_LOG(LogBuildingEnergy, Log, TEXT("🎨 STARTUP: Color cache contains %d buildings, but auto-application disabled to prevent gray overlay"), BuildingStore.NumColoredBuildings());
 			
 			// Apply colors with a short delay to ensure Cesium is ready
 			// DISABLED - This was causing the entire scene to turn gray
@@ -130,32 +160,156 @@ void ABuildingEnergyDisplay::BeginPlay() // BeginPlay lifecycle method called wh
 			FTimerHandle StartupColorTimer;
 			GetWorld()->GetTimerManager().SetTimer(StartupColorTimer, [this]()
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🎨 STARTUP EXECUTION: Applying colors at BeginPlay"));
+				UE_LOG(LogBuildingEnergy, Log, TEXT("🎨 STARTUP EXECUTION: Applying colors at BeginPlay"));
 				ApplyColorsDirectlyToGeometry();
 				ApplyColorsToCSiumTileset();
 				ForceApplyColors();
 			}, 3.0f, false); // 3 second delay for startup
 			*/
 		}
+	// Renew the token when the API broker parks a request on 401; the parked requests are replayed with the new one
+	if (UBuildingEnergyApiSubsystem* Api = UBuildingEnergyApiSubsystem::Get(this))
+	{
+		Api->OnTokenRejected.AddUObject(this, &ABuildingEnergyDisplay::OnApiTokenRejected);
+	}
+
 	/*
 	FTimerHandle AutoDebugTimer;
 	GetWorld()->GetTimerManager().SetTimer(AutoDebugTimer, [this]()
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧪 AUTO-DEBUG: Running automatic color system diagnostics..."));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 AUTO-DEBUG: Running automatic color system diagnostics..."));
 		LogColorCacheStatus();
 		ForceApplyColors();
 	}, 5.0f, false); // Run after 5 seconds to let everything initialize
 	*/
 } // End of BeginPlay method body [BEGIN PLAY BODY END]
 
+void ABuildingEnergyDisplay::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	InvalidateBuildingsTileset();
+
+	ReleaseEnergyWebSocket();
+
+	if (UBuildingEnergyApiSubsystem* Api = UBuildingEnergyApiSubsystem::Get(this))
+	{
+		Api->OnTokenRejected.RemoveAll(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// === BUILDINGS TILESET RESOLVER ===
+ACesium3DTileset* ABuildingEnergyDisplay::GetBuildingsTileset()
+{
+	if (CachedBuildingsTilesetName != BuildingsTilesetName)
+	{
+		InvalidateBuildingsTileset();
+	}
+
+	if (ACesium3DTileset* Tileset = CachedBuildingsTileset.Get())
+	{
+		return Tileset;
+	}
+
+	// A destroyed tileset leaves a stale pointer behind; anything else was already searched for
+	if (bBuildingsTilesetResolved && !CachedBuildingsTileset.IsStale())
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	ACesium3DTileset* OnlyTileset = nullptr;
+	int32 TilesetCount = 0;
+	CachedBuildingsTileset.Reset();
+	for (TActorIterator<ACesium3DTileset> It(World); It; ++It)
+	{
+		if (IsBuildingsTileset(*It))
+		{
+			CachedBuildingsTileset = *It;
+			break;
+		}
+		OnlyTileset = *It;
+		++TilesetCount;
+	}
+
+	if (!CachedBuildingsTileset.IsValid() && TilesetCount == 1)
+	{
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🏙️ TILESET: No tileset named '%s', using the only Cesium3DTileset '%s'"), *BuildingsTilesetName, *OnlyTileset->GetName());
+		CachedBuildingsTileset = OnlyTileset;
+	}
+
+	CachedBuildingsTilesetName = BuildingsTilesetName;
+	bBuildingsTilesetResolved = true;
+
+	if (ACesium3DTileset* Tileset = CachedBuildingsTileset.Get())
+	{
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("✅ TILESET: Resolved buildings tileset '%s'"), *Tileset->GetName());
+		return Tileset;
+	}
+
+	UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("❌ TILESET: No Cesium3DTileset named '%s' in the world"), *BuildingsTilesetName);
+	return nullptr;
+}
+
+bool ABuildingEnergyDisplay::IsBuildingsTileset(const ACesium3DTileset* Tileset) const
+{
+	return Tileset && Tileset->GetName().Contains(BuildingsTilesetName);
+}
+
+void ABuildingEnergyDisplay::InvalidateBuildingsTileset()
+{
+	CachedBuildingsTileset.Reset();
+	bBuildingsTilesetResolved = false;
+}
+
+void ABuildingEnergyDisplay::OnWorldActorSpawned(AActor* SpawnedActor)
+{
+	ACesium3DTileset* Tileset = Cast<ACesium3DTileset>(SpawnedActor);
+	if (!Tileset || CachedBuildingsTileset.IsValid())
+	{
+		return;
+	}
+
+	if (IsBuildingsTileset(Tileset))
+	{
+		CachedBuildingsTileset = Tileset;
+		CachedBuildingsTilesetName = BuildingsTilesetName;
+		bBuildingsTilesetResolved = true;
+	}
+	else
+	{
+		// May now be the only tileset; let the next lookup decide
+		InvalidateBuildingsTileset();
+	}
+}
+
+void ABuildingEnergyDisplay::OnLevelStreamingChanged(ULevel* Level, UWorld* World)
+{
+	if (World == GetWorld())
+	{
+		InvalidateBuildingsTileset();
+	}
+}
+
 // 🎨 IMMEDIATE COLOR APPLICATION: Apply colors to all buildings right now (Blueprint callable)
 void ABuildingEnergyDisplay::ApplyBuildingColorsImmediately()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎨 IMMEDIATE: Applying colors to all buildings NOW!"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 IMMEDIATE: Applying colors to all buildings NOW!"));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 WARNING: No building colors cached. Load data first."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 WARNING: No building colors cached. Load data first."));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange, TEXT("🎨 No building colors cached. Load data first!"));
@@ -164,25 +318,25 @@ void ABuildingEnergyDisplay::ApplyBuildingColorsImmediately()
 	}
 	
 	// Try ONLY the direct geometry approach to avoid blanket material application
-	UE_LOG(LogTemp, Warning, TEXT("🎨 Using SAFE color application method only"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 Using SAFE color application method only"));
 	ApplyColorsDirectlyToGeometry();
 	
 	// DO NOT call these - they cause gray overlay:
 	// ApplyColorsToCSiumTileset();  // This applies blanket material
 	// ForceApplyColors();           // This also applies blanket material
 	
-	UE_LOG(LogTemp, Warning, TEXT("🎨 IMMEDIATE: Safe color application complete. Check buildings for colors."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 IMMEDIATE: Safe color application complete. Check buildings for colors."));
 	if (GEngine)
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Green, 
-			FString::Printf(TEXT("🎨 Safe color method applied to %d buildings!"), BuildingColorCache.Num()));
+			FString::Printf(TEXT("🎨 Safe color method applied to %d buildings!"), BuildingStore.NumColoredBuildings()));
 	}
 }
 
 // 🎨 REFRESH ALL COLORS: Force refresh of all building colors
 void ABuildingEnergyDisplay::RefreshAllBuildingColors()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎨 REFRESH: Refreshing all building colors..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 REFRESH: Refreshing all building colors..."));
 	
 	// First, reload the data to get fresh colors
 	if (!AccessToken.IsEmpty())
@@ -198,18 +352,18 @@ void ABuildingEnergyDisplay::RefreshAllBuildingColors()
 			ApplyBuildingColorsImmediately();
 		}, 2.0f, false);
 		*/
-		UE_LOG(LogTemp, Warning, TEXT("🎨 Data loaded. Use manual color application to prevent gray overlay"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 Data loaded. Use manual color application to prevent gray overlay"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 WARNING: No access token. Cannot refresh data."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 WARNING: No access token. Cannot refresh data."));
 	}
 }
 
 // 🔄 CESIUM REFRESH MONITORING: Set up automatic color reapplication when Cesium tileset updates
 void ABuildingEnergyDisplay::SetupCesiumRefreshMonitoring()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔄 CESIUM MONITOR: Cesium refresh monitoring DISABLED to prevent gray overlay"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔄 CESIUM MONITOR: Cesium refresh monitoring DISABLED to prevent gray overlay"));
 	
 	// DISABLED - This was causing automatic reapplication of problematic gray material
 	/*
@@ -225,46 +379,39 @@ void ABuildingEnergyDisplay::SetupCesiumRefreshMonitoring()
 void ABuildingEnergyDisplay::OnCesiumTilesetRefresh()
 {
 	// Only reapply if we have colors cached
-	if (BuildingColorCache.Num() > 0)
+	if (BuildingStore.NumColoredBuildings() > 0)
 	{
-		// Check if any Cesium components lost their colors (reverted to white)
-		TArray<AActor*> CesiumActors;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), CesiumActors);
-		
+		// Check if the buildings tileset lost its colors (reverted to white)
 		bool bNeedsReapplication = false;
 		
-		for (AActor* Actor : CesiumActors)
+		if (ACesium3DTileset* Tileset = GetBuildingsTileset())
 		{
-			if (Actor && Actor->GetName().Contains(TEXT("Cesium")))
+			// Check if any Cesium components have reverted to default material
+			TArray<UPrimitiveComponent*> PrimitiveComponents;
+			Tileset->GetComponents<UPrimitiveComponent>(PrimitiveComponents);
+			
+			for (UPrimitiveComponent* Comp : PrimitiveComponents)
 			{
-				// Check if any Cesium components have reverted to default material
-				TArray<UPrimitiveComponent*> PrimitiveComponents;
-				Actor->GetComponents<UPrimitiveComponent>(PrimitiveComponents);
-				
-				for (UPrimitiveComponent* Comp : PrimitiveComponents)
+				if (Comp && Comp->GetClass()->GetName().Contains(TEXT("CesiumGltf")))
 				{
-					if (Comp && Comp->GetClass()->GetName().Contains(TEXT("CesiumGltf")))
+					UMaterialInterface* CurrentMat = Comp->GetMaterial(0);
+					if (CurrentMat && CurrentMat->GetName().Contains(TEXT("Default")))
 					{
-						UMaterialInterface* CurrentMat = Comp->GetMaterial(0);
-						if (CurrentMat && CurrentMat->GetName().Contains(TEXT("Default")))
-						{
-							bNeedsReapplication = true;
-							UE_LOG(LogTemp, Warning, TEXT("🔄 CESIUM REFRESH: Detected material reset, reapplying colors..."));
-							break;
-						}
+						bNeedsReapplication = true;
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🔄 CESIUM REFRESH: Detected material reset, reapplying colors..."));
+						break;
 					}
 				}
-				if (bNeedsReapplication) break;
 			}
 		}
 		
 		// Reapply colors if needed
 		if (bNeedsReapplication)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 CESIUM REFRESH: Color reapplication disabled to prevent gray overlay"));
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔄 CESIUM REFRESH: Color reapplication disabled to prevent gray overlay"));
 			// DISABLED - This was causing gray overlay on entire scene
 			// ApplyColorsToCSiumTileset();
-			UE_LOG(LogTemp, Warning, TEXT("💡 Use manual ApplyBuildingColorsImmediately() from Blueprint instead"));
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("💡 Use manual ApplyBuildingColorsImmediately() from Blueprint instead"));
 		}
 	}
 }
@@ -272,15 +419,15 @@ void ABuildingEnergyDisplay::OnCesiumTilesetRefresh()
 // 🎨 DIRECT COLOR APPLICATION: Apply colors directly to geometry without Cesium metadata
 void ABuildingEnergyDisplay::SetupDirectColorApplication()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎨 DIRECT: Setting up direct color application system..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 DIRECT: Setting up direct color application system..."));
 	
 	// Wait for Cesium to finish loading, then apply colors
 	FTimerHandle DirectColorTimer;
 	GetWorld()->GetTimerManager().SetTimer(DirectColorTimer, [this]()
 	{
-		if (BuildingColorCache.Num() > 0)
+		if (BuildingStore.NumColoredBuildings() > 0)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🎨 DIRECT: Applying colors directly to %d buildings..."), BuildingColorCache.Num());
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 DIRECT: Applying colors directly to %d buildings..."), BuildingStore.NumColoredBuildings());
 			ApplyColorsDirectlyToGeometry();
 		}
 	}, 8.0f, false); // Wait 8 seconds for Cesium to fully load
@@ -289,35 +436,23 @@ void ABuildingEnergyDisplay::SetupDirectColorApplication()
 // 🎨 DIRECT COLOR APPLICATION: Apply cached colors directly to Cesium geometry using proper property mapping
 void ABuildingEnergyDisplay::ApplyColorsDirectlyToGeometry()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM METADATA: Starting per-building color application using gml:id mapping..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM METADATA: Starting per-building color application using gml:id mapping..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 No building colors cached. Total buildings: %d"), BuildingColorCache.Num());
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 No building colors cached. Total buildings: %d"), BuildingStore.NumColoredBuildings());
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CACHE STATUS: %d buildings have cached colors"), BuildingColorCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("🎨 PROPERTY MAPPING: Looking for 'gml:id' in Cesium to match with 'modified_gml_id' cache keys"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CACHE STATUS: %d buildings have cached colors"), BuildingStore.NumColoredBuildings());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 PROPERTY MAPPING: Looking for 'gml:id' in Cesium to match with 'modified_gml_id' cache keys"));
 	
-	// Find the Cesium 3D Tileset actor using string-based approach
-	AActor* TilesetActor = nullptr;
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), AllActors);
-	
-	for (AActor* Actor : AllActors)
-	{
-		if (Actor && Actor->GetClass()->GetName().Contains(TEXT("Cesium3DTileset")))
-		{
-			TilesetActor = Actor;
-			UE_LOG(LogTemp, Warning, TEXT("🎯 FOUND Cesium3DTileset actor: %s"), *Actor->GetName());
-			break;
-		}
-	}
+	// Find the Cesium 3D Tileset actor
+	AActor* TilesetActor = GetBuildingsTileset();
 	
 	if (!TilesetActor)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 ERROR: No Cesium3DTileset actor found!"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 ERROR: No Cesium3DTileset actor found!"));
 		return;
 	}
 	
@@ -331,20 +466,20 @@ void ABuildingEnergyDisplay::ApplyColorsDirectlyToGeometry()
 		if (Component && Component->GetClass()->GetName().Contains(TEXT("CesiumFeaturesMetadata")))
 		{
 			MetadataComponent = Component;
-			UE_LOG(LogTemp, Warning, TEXT("🎯 FOUND CesiumFeaturesMetadataComponent: %s"), *Component->GetName());
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🎯 FOUND CesiumFeaturesMetadataComponent: %s"), *Component->GetName());
 			break;
 		}
 	}
 	
 	if (!MetadataComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 No CesiumFeaturesMetadataComponent found. Applying representative color."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 No CesiumFeaturesMetadataComponent found. Applying representative color."));
 		ApplyRepresentativeColorToAllBuildings(TilesetActor);
 		return;
 	}
 	
 	// Use reflection to inspect the metadata component for property tables
-	UE_LOG(LogTemp, Warning, TEXT("🎯 Analyzing CesiumFeaturesMetadataComponent for gml:id properties..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎯 Analyzing CesiumFeaturesMetadataComponent for gml:id properties..."));
 	
 	UClass* MetadataClass = MetadataComponent->GetClass();
 	for (TFieldIterator<FProperty> PropIt(MetadataClass); PropIt; ++PropIt)
@@ -355,7 +490,7 @@ void ABuildingEnergyDisplay::ApplyColorsDirectlyToGeometry()
 		if (PropName.Contains(TEXT("Description")) || PropName.Contains(TEXT("PropertyTable")) || 
 			PropName.Contains(TEXT("ModelMetadata")) || PropName.Contains(TEXT("Feature")))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🏷️ FOUND METADATA PROPERTY: %s"), *PropName);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🏷️ FOUND METADATA PROPERTY: %s"), *PropName);
 		}
 	}
 	
@@ -365,7 +500,7 @@ void ABuildingEnergyDisplay::ApplyColorsDirectlyToGeometry()
 	// 2. Log what we're doing for debugging
 	// 3. Use representative color as fallback but with proper logging
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔍 CESIUM PROPERTY SEARCH: Looking for buildings with 'gml:id' property..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔍 CESIUM PROPERTY SEARCH: Looking for buildings with 'gml:id' property..."));
 	
 	// Try to find individual building components that might have gml:id data
 	TArray<UMeshComponent*> AllMeshComponents;
@@ -373,18 +508,20 @@ void ABuildingEnergyDisplay::ApplyColorsDirectlyToGeometry()
 	
 	int32 ColorsApplied = 0;
 	int32 BuildingsProcessed = 0;
+	FBuildingLogSampler ComponentLog(LogBuildingEnergyStyle, TEXT("tileset components colored"));
 	
 	// Log a sample of our cached building IDs for debugging
-	UE_LOG(LogTemp, Warning, TEXT("📋 SAMPLE CACHE ENTRIES (modified_gml_id format):"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("📋 SAMPLE CACHE ENTRIES (modified_gml_id format):"));
 	int32 SampleCount = 0;
-	for (const auto& CacheEntry : BuildingColorCache)
+	for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num() && SampleCount < 5; ++BuildingIndex)
 	{
-		if (SampleCount < 5)
+		if (BuildingStore.HasColor(BuildingIndex))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("   Cache Key: %s -> Color: R=%.2f,G=%.2f,B=%.2f"), 
-				*CacheEntry.Key, CacheEntry.Value.R, CacheEntry.Value.G, CacheEntry.Value.B);
+			const FLinearColor& CachedColor = BuildingStore.GetColor(BuildingIndex);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Cache Key: %s -> Color: R=%.2f,G=%.2f,B=%.2f"), 
+				*BuildingStore.ModifiedGmlIds[BuildingIndex], CachedColor.R, CachedColor.G, CachedColor.B);
+			SampleCount++;
 		}
-		SampleCount++;
 	}
 	
 	// For each mesh component, try to determine if it has building properties
@@ -424,48 +561,49 @@ void ABuildingEnergyDisplay::ApplyColorsDirectlyToGeometry()
 				PotentialGmlId = ComponentName;
 			}
 			
-			// Try to find color in cache using potential ID
-			for (const auto& CachedBuilding : BuildingColorCache)
+			// Try direct match first (CASE-SENSITIVE - gml_id fields are case-sensitive)
+			const int32 ExactIndex = BuildingStore.FindIndex(PotentialGmlId);
+			if (ExactIndex != INDEX_NONE && BuildingStore.HasColor(ExactIndex))
 			{
-				FString CachedId = CachedBuilding.Key;
-				
-				// Try direct match (CASE-SENSITIVE - gml_id fields are case-sensitive)
-				if (PotentialGmlId.Equals(CachedId))
+				BuildingColor = BuildingStore.GetColor(ExactIndex);
+				bFoundSpecificColor = true;
+				ComponentLog.Tally(TEXT("exact matches"));
+			}
+			
+			// Try variant and partial match through the store's id index
+			if (!bFoundSpecificColor)
+			{
+				int32 MatchIndex = BuildingStore.FindVariantIndex(PotentialGmlId);
+				if (MatchIndex == INDEX_NONE)
 				{
-					BuildingColor = CachedBuilding.Value;
-					bFoundSpecificColor = true;
-					UE_LOG(LogTemp, Warning, TEXT("🎯 EXACT MATCH: Found color for building '%s'"), *PotentialGmlId);
-					break;
+					MatchIndex = BuildingStore.FindPartialMatchIndex(PotentialGmlId);
 				}
-				
-				// Try partial match
-				if (PotentialGmlId.Contains(CachedId) || CachedId.Contains(PotentialGmlId))
+				if (MatchIndex != INDEX_NONE && BuildingStore.HasColor(MatchIndex))
 				{
-					BuildingColor = CachedBuilding.Value;
+					BuildingColor = BuildingStore.GetColor(MatchIndex);
 					bFoundSpecificColor = true;
-					UE_LOG(LogTemp, Warning, TEXT("🎯 PARTIAL MATCH: Found color for building '%s' → '%s'"), *PotentialGmlId, *CachedId);
-					break;
+					ComponentLog.Tally(TEXT("partial matches"));
 				}
 			}
 			
 			// Fallback: Use a varied color instead of all same
-			if (!bFoundSpecificColor && BuildingColorCache.Num() > 0)
+			if (!bFoundSpecificColor && BuildingStore.NumColoredBuildings() > 0)
 			{
-				// Use different colors for different components to see variation
-				int32 ColorIndex = BuildingsProcessed % BuildingColorCache.Num();
-				auto Iterator = BuildingColorCache.CreateConstIterator();
-				for (int32 i = 0; i < ColorIndex && Iterator; ++i, ++Iterator) {}
-				if (Iterator)
-				{
-					BuildingColor = Iterator->Value;
-					UE_LOG(LogTemp, Verbose, TEXT("🎨 FALLBACK: Using varied color %d for component '%s'"), ColorIndex, *ComponentName);
-				}
+				// Use different palette colors for different components to see variation
+				int32 ColorIndex = BuildingsProcessed % BuildingStore.Palette.Num();
+				BuildingColor = BuildingStore.Palette[ColorIndex];
+				ComponentLog.Tally(TEXT("fallback colors"));
 			}
 			
 			// Apply the determined color to all materials in this component
 			{
 				int32 NumMaterials = StaticMeshComp->GetNumMaterials();
-				UE_LOG(LogTemp, Warning, TEXT("🏗️ MATERIAL DEBUG: Component '%s' has %d materials"), *ComponentName, NumMaterials);
+				const bool bLogComponent = ComponentLog.Sample();
+				if (bLogComponent)
+				{
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🏗️ MATERIAL DEBUG: Component '%s' (%s color) has %d materials"),
+						*ComponentName, bFoundSpecificColor ? TEXT("SPECIFIC") : TEXT("VARIED"), NumMaterials);
+				}
 				
 				for (int32 MatIdx = 0; MatIdx < NumMaterials; ++MatIdx)
 				{
@@ -486,45 +624,48 @@ void ABuildingEnergyDisplay::ApplyColorsDirectlyToGeometry()
 						
 						ColorsApplied++;
 						
-						FString ColorType = bFoundSpecificColor ? TEXT("SPECIFIC") : TEXT("VARIED");
-						UE_LOG(LogTemp, Warning, TEXT("   ✅ Applied %s color R=%.2f G=%.2f B=%.2f to material %d"), 
-							*ColorType, BuildingColor.R, BuildingColor.G, BuildingColor.B, MatIdx);
+						if (bLogComponent)
+						{
+							UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   ✅ Applied color R=%.2f G=%.2f B=%.2f to material %d"), 
+								BuildingColor.R, BuildingColor.G, BuildingColor.B, MatIdx);
+						}
 					}
 					else
 					{
-						UE_LOG(LogTemp, Error, TEXT("   ❌ Failed to create/get dynamic material %d"), MatIdx);
+						ComponentLog.Tally(TEXT("materials without a dynamic instance"));
 					}
 				}
 			}
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("✅ CESIUM COLOR APPLICATION RESULTS:"));
-	UE_LOG(LogTemp, Warning, TEXT("   Buildings processed: %d"), BuildingsProcessed);
-	UE_LOG(LogTemp, Warning, TEXT("   Materials colored: %d"), ColorsApplied);
-	UE_LOG(LogTemp, Warning, TEXT("   Cache entries available: %d"), BuildingColorCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("🔧 NEXT STEP: Implement runtime property table access to match gml:id with modified_gml_id"));
+	ComponentLog.Flush();
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("✅ CESIUM COLOR APPLICATION RESULTS:"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   Buildings processed: %d"), BuildingsProcessed);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   Materials colored: %d"), ColorsApplied);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   Cache entries available: %d"), BuildingStore.NumColoredBuildings());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔧 NEXT STEP: Implement runtime property table access to match gml:id with modified_gml_id"));
 	
 	if (GEngine)
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, 
 			FString::Printf(TEXT("🎨 Applied energy colors to %d materials from %d cached buildings!"), 
-				ColorsApplied, BuildingColorCache.Num()));
+				ColorsApplied, BuildingStore.NumColoredBuildings()));
 	}
 }
 
 // Helper method to apply representative color to all building components
 void ABuildingEnergyDisplay::ApplyRepresentativeColorToAllBuildings(AActor* TilesetActor)
 {
-	if (!TilesetActor || BuildingColorCache.Num() == 0)
+	if (!TilesetActor || BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 Cannot apply representative color: Invalid tileset actor or empty cache"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 Cannot apply representative color: Invalid tileset actor or empty cache"));
 		return;
 	}
 	
-	// Use the first color from cache as representative
-	FLinearColor RepresentativeColor = BuildingColorCache.begin()->Value;
-	UE_LOG(LogTemp, Warning, TEXT("🎨 Applying representative color: R=%.2f, G=%.2f, B=%.2f"), 
+	// Use the first palette color (the first color seen during ingest) as representative
+	FLinearColor RepresentativeColor = BuildingStore.Palette[0];
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 Applying representative color: R=%.2f, G=%.2f, B=%.2f"), 
 		RepresentativeColor.R, RepresentativeColor.G, RepresentativeColor.B);
 	
 	// Apply color to all mesh components in the tileset
@@ -532,7 +673,8 @@ void ABuildingEnergyDisplay::ApplyRepresentativeColorToAllBuildings(AActor* Tile
 	TilesetActor->GetComponents<UMeshComponent>(MeshComponents);
 	
 	int32 ColorsApplied = 0;
-	UE_LOG(LogTemp, Warning, TEXT("🏗️ REPRESENTATIVE COLOR: Processing %d mesh components"), MeshComponents.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🏗️ REPRESENTATIVE COLOR: Processing %d mesh components"), MeshComponents.Num());
+	FBuildingLogSampler ComponentLog(LogBuildingEnergyStyle, TEXT("tileset components given the representative color"));
 	
 	for (UMeshComponent* MeshComp : MeshComponents)
 	{
@@ -541,7 +683,10 @@ void ABuildingEnergyDisplay::ApplyRepresentativeColorToAllBuildings(AActor* Tile
 			FString ComponentName = StaticMeshComp->GetName();
 			int32 NumMaterials = StaticMeshComp->GetNumMaterials();
 			
-			UE_LOG(LogTemp, Warning, TEXT("   Component: %s (Materials: %d)"), *ComponentName, NumMaterials);
+			if (ComponentLog.Sample())
+			{
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Component: %s (Materials: %d)"), *ComponentName, NumMaterials);
+			}
 			
 			for (int32 MatIdx = 0; MatIdx < NumMaterials; ++MatIdx)
 			{
@@ -561,17 +706,17 @@ void ABuildingEnergyDisplay::ApplyRepresentativeColorToAllBuildings(AActor* Tile
 					StaticMeshComp->MarkRenderStateDirty();
 					
 					ColorsApplied++;
-					UE_LOG(LogTemp, Warning, TEXT("     ✅ Applied to material %d"), MatIdx);
 				}
 				else
 				{
-					UE_LOG(LogTemp, Error, TEXT("     ❌ Failed to create/get dynamic material %d"), MatIdx);
+					ComponentLog.Tally(TEXT("materials without a dynamic instance"));
 				}
 			}
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("✅ Applied representative color to %d material instances"), ColorsApplied);
+	ComponentLog.Flush();
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("✅ Applied representative color to %d material instances"), ColorsApplied);
 	
 	// Only show on-screen message once to prevent spam
 	static bool bFirstApplication = true;
@@ -586,7 +731,7 @@ void ABuildingEnergyDisplay::ApplyRepresentativeColorToAllBuildings(AActor* Tile
 	}
 	else if (ColorsApplied > 0)
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("🔄 Reapplication: %d materials updated (no screen message)"), ColorsApplied);
+		UE_LOG(LogBuildingEnergyStyle, Verbose, TEXT("🔄 Reapplication: %d materials updated (no screen message)"), ColorsApplied);
 	}
 }
 
@@ -604,26 +749,38 @@ void ABuildingEnergyDisplay::Tick(float DeltaTime) // Tick method called every f
 			WebSocketReconnectTimer = 0.0f;
 			if (!AccessToken.IsEmpty())
 			{
-				// UE_LOG(LogTemp, Verbose, TEXT("🔄 Fetching updated energy data via REST API"));
+				// UE_LOG(LogBuildingEnergy, Verbose, TEXT("🔄 Fetching updated energy data via REST API"));
 				FetchUpdatedEnergyData();
 			}
 		}
 	}
 	
 	// === WEBSOCKET RECONNECTION SYSTEM ===
-	else if (bAutoReconnectWebSocket && !bEnergyWebSocketConnected && EnergyWebSocket.IsValid() == false)
+	else if (bAutoReconnectWebSocket && !bEnergyWebSocketConnected && !bEnergyWebSocketConnecting)
 	{
 		WebSocketReconnectTimer += DeltaTime;
-		if (WebSocketReconnectTimer >= WebSocketReconnectInterval)
+		const float ReconnectDelay = PushReconnectDelay > 0.0f ? PushReconnectDelay : WebSocketReconnectInterval; // Push backoff after failures
+		if (WebSocketReconnectTimer >= ReconnectDelay)
 		{
 			WebSocketReconnectTimer = 0.0f;
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Attempting WebSocket reconnection for energy updates"));
+			UE_LOG(LogBuildingEnergy, Log, TEXT("🔄 Attempting WebSocket reconnection for energy updates"));
 			ConnectEnergyWebSocket();
 		}
 	}
 	
+	// === PROACTIVE TOKEN REFRESH ===
+	if (TokenRefreshCountdown >= 0.0f)
+	{
+		TokenRefreshCountdown -= DeltaTime;
+		if (TokenRefreshCountdown < 0.0f)
+		{
+			UE_LOG(LogBuildingEnergy, Log, TEXT("🔑 Access token expires soon - refreshing ahead of expiry"));
+			RefreshAccessToken();
+		}
+	}
+	
 	// === REAL-TIME MONITORING SYSTEM === [REAL-TIME MONITORING SYSTEM COMMENT]
-	if (bRealTimeMonitoringEnabled && !bIsPerformingRealTimeUpdate) // Check if real-time monitoring is enabled and not currently updating [REAL-TIME MONITORING CONDITION]
+	if (bRealTimeMonitoringEnabled && !bIsPerformingRealTimeUpdate && (!IsPushModeConnected() || bPushResyncPending)) // Check if real-time monitoring is enabled, not currently updating and not replaced by push [REAL-TIME MONITORING CONDITION]
 	{ // Start of real-time monitoring block [REAL-TIME MONITORING BLOCK START]
 		RealTimeMonitoringTimer += DeltaTime; // Accumulate time since last monitoring check [REAL-TIME MONITORING TIMER INCREMENT]
 		if (RealTimeMonitoringTimer >= RealTimeUpdateInterval) // Check if enough time has passed for next monitoring cycle [REAL-TIME MONITORING INTERVAL CHECK]
@@ -631,13 +788,28 @@ void ABuildingEnergyDisplay::Tick(float DeltaTime) // Tick method called every f
 			RealTimeMonitoringTimer = 0.0f; // Reset timer for next monitoring cycle [RESET MONITORING TIMER]
 			if (!AccessToken.IsEmpty() && bDataLoaded) // Check if authentication token exists and data is loaded [ACCESS TOKEN AND DATA CHECK]
 			{ // Start of token and data validation block [TOKEN DATA VALIDATION BLOCK START]
-				UE_LOG(LogTemp, Verbose, TEXT("REALTIME Performing automatic background data check...")); // Log verbose message for background data check [BACKGROUND DATA CHECK LOG]
+				UE_LOG(LogBuildingEnergy, Verbose, TEXT("REALTIME Performing automatic background data check...")); // Log verbose message for background data check [BACKGROUND DATA CHECK LOG]
 				PerformRealTimeDataCheck(); // Execute real-time data checking operation [PERFORM REAL-TIME DATA CHECK CALL]
+				bPushResyncPending = false; // A pending push resync is served by this poll [CLEAR PUSH RESYNC]
 			} // End of token and data validation block [TOKEN DATA VALIDATION BLOCK END]
 		} // End of monitoring interval block [MONITORING INTERVAL BLOCK END]
 	} // End of real-time monitoring block [REAL-TIME MONITORING BLOCK END]
 
 
+	// === VIEWPORT CHUNK LOADING ===
+	if (bLoadByViewport && !AccessToken.IsEmpty())
+	{
+		ViewportChunkTimer += DeltaTime;
+		if (ViewportChunkTimer >= 0.5f)
+		{
+			ViewportChunkTimer = 0.0f;
+			UpdateViewportChunks(); // Requests chunks that came into view and rebuilds the store when the cache changed
+		}
+	}
+
+	// === BUILDING UPDATE QUEUE ===
+	ProcessPendingBuildingUpdates(); // Coalesced poll and push changes, applied within UpdateFrameBudgetMs
+
 	// === CESIUM STYLE RETRY (tileset may load after BeginPlay) ===
 	if (bEnableCesiumPerFeatureStyling && !bCesiumStyleApplied && CesiumStyleRetryCount < 60)
 	{
@@ -647,7 +819,7 @@ void ABuildingEnergyDisplay::Tick(float DeltaTime) // Tick method called every f
 			CesiumStyleRetryAccumulator = 0.0f;
 			CesiumStyleRetryCount++;
 
-			UE_LOG(LogTemp, Log, TEXT("🎨 CESIUM COLORS: Retry #%d applying style..."), CesiumStyleRetryCount);
+			UE_LOG(LogBuildingEnergy, Log, TEXT("🎨 CESIUM COLORS: Retry #%d applying style..."), CesiumStyleRetryCount);
 			ApplyColorsToCSiumTileset();
 		}
 	}
@@ -655,46 +827,36 @@ void ABuildingEnergyDisplay::Tick(float DeltaTime) // Tick method called every f
 
 void ABuildingEnergyDisplay::PreloadAllBuildingData(const FString& Token) // PreloadAllBuildingData method to load all building data into cache [PRELOAD ALL BUILDING DATA DECLARATION]
 { // Start of PreloadAllBuildingData method body [PRELOAD ALL BUILDING DATA BODY START]
-	// DUPLICATE CALL PREVENTION - Allow manual retry every 3 seconds
-	static bool bPreloadInProgress = false;
-	static float LastCallTime = 0.0f;
-	float CurrentTime = FPlatformTime::Seconds();
-	
-	// Allow reset every 3 seconds for manual calls
-	if ((CurrentTime - LastCallTime) > 3.0f)
-	{
-		bPreloadInProgress = false; // Reset for manual retries
-		UE_LOG(LogTemp, Warning, TEXT("🔄 PRELOAD RESET: Manual data loading reset allowed"));
-	}
-	
-	if (bPreloadInProgress)
+	// DUPLICATE CALL PREVENTION - the response handler clears the flag once the request is answered or failed
+	if (bPreloadRequestPending)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🛑 DUPLICATE PRELOAD PREVENTED: PreloadAllBuildingData already in progress"));
+		UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("🛑 DUPLICATE PRELOAD PREVENTED: PreloadAllBuildingData already in progress"));
 		return;
 	}
 	
-	bPreloadInProgress = true;
-	LastCallTime = CurrentTime;
-	
 	// Always reload data to ensure cache is up-to-date [RELOAD DATA COMMENT]
-	UE_LOG(LogTemp, Warning, TEXT("Loading/Refreshing building data cache...")); // Log message indicating cache refresh operation [CACHE REFRESH LOG]
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Loading/Refreshing building data cache...")); // Log message indicating cache refresh operation [CACHE REFRESH LOG]
 	
 	// Check if already loading - but allow retry with new token [CHECK ALREADY LOADING COMMENT]
 	if (bIsLoading) // Check if loading operation is already in progress [IS LOADING CHECK]
 	{ // Start of already loading block [ALREADY LOADING BLOCK START]
-		UE_LOG(LogTemp, Warning, TEXT("PreloadAllBuildingData already in progress - resetting state to allow retry")); // Log warning about concurrent loading attempt [CONCURRENT LOADING LOG]
+		UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("PreloadAllBuildingData already in progress - resetting state to allow retry")); // Log warning about concurrent loading attempt [CONCURRENT LOADING LOG]
 		bIsLoading = false; // Reset to allow retry [RESET IS LOADING FLAG]
 	} // End of already loading block [ALREADY LOADING BLOCK END]
 
-	// Clear existing cache to ensure fresh data [CLEAR EXISTING CACHE COMMENT]
-	BuildingDataCache.Empty(); // Clear building data cache map [CLEAR BUILDING DATA CACHE]
-	GmlIdCache.Empty(); // Clear GML ID cache map [CLEAR GML ID CACHE]
-	UE_LOG(LogTemp, Warning, TEXT("Cleared existing cache for fresh data")); // Log message indicating cache has been cleared [CACHE CLEARED LOG]
-
+	// Viewport loading: only the chunks around the camera are requested, starting now [VIEWPORT LOADING COMMENT]
+	if (bLoadByViewport && !Token.IsEmpty()) // Check if the community is loaded by viewport chunks instead [VIEWPORT LOADING CHECK]
+	{ // Start of viewport loading block [VIEWPORT LOADING BLOCK START]
+		AccessToken = Token; // Store authentication token for the chunk requests [STORE ACCESS TOKEN]
+		bIsLoading = false; // Chunks load in the background, nothing blocks on a full download [RESET IS LOADING FLAG]
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🧩 VIEWPORT: Loading building data by level %d chunks around the camera"), ViewportChunkLevel); // Log viewport loading mode [VIEWPORT LOADING LOG]
+		UpdateViewportChunks(); // Request the chunks in view right away [UPDATE VIEWPORT CHUNKS CALL]
+		return; // Skip the full community download [EARLY RETURN FOR VIEWPORT LOADING]
+	} // End of viewport loading block [VIEWPORT LOADING BLOCK END]
+
+	// Keep serving the current store (e.g. the warm start snapshot) until the fresh one is swapped in [KEEP CURRENT STORE COMMENT]
 	AccessToken = Token; // Store authentication token for API requests [STORE ACCESS TOKEN]
 	bIsLoading = true; // Set loading flag to prevent concurrent operations [SET IS LOADING FLAG]
-	// Reset data loaded flag to allow refresh [RESET DATA LOADED FLAG COMMENT]
-	bDataLoaded = false; // Reset data loaded flag to indicate data is being refreshed [RESET DATA LOADED FLAG]
 
 	// Validate token [VALIDATE TOKEN COMMENT]
 	if (Token.IsEmpty()) // Check if provided token is empty [TOKEN EMPTY CHECK]
@@ -705,7 +867,7 @@ void ABuildingEnergyDisplay::PreloadAllBuildingData(const FString& Token) // Pre
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
 				TEXT("ERROR: Access token is empty! Cannot fetch building data.")); // Display error message on screen [ON SCREEN ERROR MESSAGE]
 		} // End of engine instance block [ENGINE INSTANCE BLOCK END]
-		UE_LOG(LogTemp, Error, TEXT("PreloadAllBuildingData called with empty token")); // Log error message for empty token [EMPTY TOKEN ERROR LOG]
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("PreloadAllBuildingData called with empty token")); // Log error message for empty token [EMPTY TOKEN ERROR LOG]
 		return; // Exit method early due to invalid token [EARLY RETURN ON ERROR]
 	} // End of empty token handling block [EMPTY TOKEN BLOCK END]
 
@@ -715,18 +877,61 @@ void ABuildingEnergyDisplay::PreloadAllBuildingData(const FString& Token) // Pre
 			TEXT("Preloading all building energy data...")); // Display status message on screen [PRELOAD STATUS MESSAGE]
 	} // End of engine instance block [ENGINE INSTANCE BLOCK END]
 	
-	UE_LOG(LogTemp, Warning, TEXT("Starting preload with token length: %d"), Token.Len()); // Log token length for debugging without exposing token content [TOKEN LENGTH LOG]
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Starting preload with token length: %d"), Token.Len()); // Log token length for debugging without exposing token content [TOKEN LENGTH LOG]
 
-	// Create HTTP request [CREATE HTTP REQUEST COMMENT]
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest(); // Create thread-safe HTTP request object [CREATE HTTP REQUEST OBJECT]
-	
-	// Set the URL with parameters [SET URL WITH PARAMETERS COMMENT]
-	// API configuration - should be externally configurable [API CONFIGURATION COMMENT]
-	FString ApiBaseUrl = TEXT("https://backend.gisworld-tech.com");  // Should come from config [API BASE URL ASSIGNMENT]
-	FString DefaultCommunityId = TEXT("08417008");  // Should come from project config [DEFAULT COMMUNITY ID ASSIGNMENT]
+	if (CommunityIds.Num() == 0) // Check if any community is configured [COMMUNITY IDS CHECK]
+	{ // Start of no communities block [NO COMMUNITIES BLOCK START]
+		bIsLoading = false; // Nothing to load [RESET IS LOADING ON ERROR]
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("PreloadAllBuildingData called without any CommunityIds")); // Log configuration error [NO COMMUNITIES ERROR LOG]
+		return; // Exit method early due to missing configuration [EARLY RETURN ON ERROR]
+	} // End of no communities block [NO COMMUNITIES BLOCK END]
+
+	// One request per community, all in flight at once; MergeCommunityShards publishes once the last shard is parsed [SHARD REQUESTS COMMENT]
+	for (const FString& CommunityId : CommunityIds) // Iterate over configured communities [COMMUNITY LOOP]
+	{ // Start of community loop body [COMMUNITY LOOP BODY START]
+		RequestCommunityShard(CommunityId); // Request this community's shard [REQUEST COMMUNITY SHARD CALL]
+	} // End of community loop body [COMMUNITY LOOP BODY END]
+} // End of PreloadAllBuildingData method body [PRELOAD ALL BUILDING DATA BODY END]
+
+void ABuildingEnergyDisplay::RequestCommunityShard(const FString& CommunityId)
+{
+	// Start a new load of the shard; pages of an older load are dropped by the generation
+	FCommunityShard& Shard = CommunityShards.FindOrAdd(CommunityId);
+	++Shard.Generation;
+	Shard.Pages.Reset();
+	Shard.NumPages = 1;
+	Shard.NumPagesRequested = 0;
+	Shard.FirstPageSize = 0;
+	Shard.NextPageUrl.Reset();
+	Shard.bLoadFailed = false;
+
+	RequestCommunityPage(CommunityId, MakeCommunityPageUrl(CommunityId, 0, 0));
+}
+
+FString ABuildingEnergyDisplay::MakeCommunityPageUrl(const FString& CommunityId, int32 PageIndex, int32 PageStride) const
+{
+	// API configuration - config, command line or a mock backend [API CONFIGURATION COMMENT]
+	const FString ApiBaseUrl = UBuildingEnergyApiSubsystem::GetApiBaseUrl(); // Base URL of the backend [API BASE URL ASSIGNMENT]
 	
 	FString URL = FString::Printf(TEXT("%s/geospatial/buildings-energy/?community_id=%s&format=json&include_colors=true&energy_type=total&time_period=annual&classification=co2&color_scheme=co2_classes"), 
-		*ApiBaseUrl, *DefaultCommunityId); // Construct full API URL with community ID parameter and CO2 color classification [CONSTRUCT API URL]
+		*ApiBaseUrl, *FGenericPlatformHttp::UrlEncode(CommunityId)); // Construct full API URL with community ID parameter and CO2 color classification [CONSTRUCT API URL]
+
+	// Later pages are only requested once the first page told how many there are
+	if (PreloadPageSize > 0 || PageIndex > 0)
+	{
+		if (PreloadPageSize > 0)
+		{
+			URL += FString::Printf(TEXT("&%s=%d"), *PreloadPageSizeQueryParameter, PreloadPageSize);
+		}
+		URL += FString::Printf(TEXT("&%s=%d"), *PreloadPageQueryParameter, bPreloadPageByOffset ? PageIndex * PageStride : PageIndex + 1);
+	}
+	return URL;
+}
+
+void ABuildingEnergyDisplay::RequestCommunityPage(const FString& CommunityId, const FString& URL)
+{
+	// Create HTTP request [CREATE HTTP REQUEST COMMENT]
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest(); // Create thread-safe HTTP request object [CREATE HTTP REQUEST OBJECT]
 	
 	HttpRequest->SetURL(URL); // Set request URL for HTTP operation [SET REQUEST URL]
 	HttpRequest->SetVerb("GET"); // Set HTTP method to GET for data retrieval [SET HTTP VERB]
@@ -734,34 +939,46 @@ void ABuildingEnergyDisplay::PreloadAllBuildingData(const FString& Token) // Pre
 	HttpRequest->SetHeader("Accept", "application/json"); // Set accept header to specify JSON response format [SET ACCEPT HEADER]
 	
 	// Add Authorization header with Bearer token [ADD AUTHORIZATION HEADER COMMENT]
-	HttpRequest->SetHeader("Authorization", FString::Printf(TEXT("Bearer %s"), *Token)); // Set authorization header with bearer token for API authentication [SET AUTHORIZATION HEADER]
+	HttpRequest->SetHeader("Authorization", FString::Printf(TEXT("Bearer %s"), *AccessToken)); // Set authorization header with bearer token for API authentication [SET AUTHORIZATION HEADER]
 	
-	UE_LOG(LogTemp, Warning, TEXT("Request URL: %s"), *URL); // Log request URL for debugging [REQUEST URL LOG]
-	UE_LOG(LogTemp, Warning, TEXT("Authorization Header: Bearer %s..."), *Token.Left(20)); // Log partial token for debugging without exposing full token [AUTHORIZATION HEADER LOG]
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Request URL: %s"), *URL); // Log request URL for debugging [REQUEST URL LOG]
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Authorization Header: Bearer token, length: %d"), AccessToken.Len()); // Log token length only, never token content [AUTHORIZATION HEADER LOG]
 
-	// Set timeout to 30 seconds - server might be slow [SET TIMEOUT COMMENT]
+	// Set timeout to 30 seconds per page - server might be slow [SET TIMEOUT COMMENT]
 	HttpRequest->SetTimeout(30.0f); // Set request timeout to 30 seconds to handle slow server responses [SET REQUEST TIMEOUT]
 
-	// Bind the preload response callback [BIND PRELOAD RESPONSE CALLBACK COMMENT]
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ABuildingEnergyDisplay::OnPreloadResponseReceived); // Bind response callback method for handling HTTP response [BIND RESPONSE CALLBACK]
-
-	// Execute the request [EXECUTE REQUEST COMMENT]
-	if (!HttpRequest->ProcessRequest()) // Attempt to execute HTTP request and check for immediate failure [PROCESS REQUEST CHECK]
-	{ // Start of request failure block [REQUEST FAILURE BLOCK START]
-		if (GEngine) // Check if global engine instance is available [ENGINE INSTANCE CHECK FOR ERROR]
-		{ // Start of engine error block [ENGINE ERROR BLOCK START]
-			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
-				TEXT("ERROR: Failed to start HTTP request!")); // Display error message on screen [HTTP REQUEST ERROR MESSAGE]
-		} // End of engine error block [ENGINE ERROR BLOCK END]
-		UE_LOG(LogTemp, Error, TEXT("ProcessRequest returned false")); // Log error message for failed request processing [PROCESS REQUEST ERROR LOG]
-	} // End of request failure block [REQUEST FAILURE BLOCK END]
-} // End of PreloadAllBuildingData method body [PRELOAD ALL BUILDING DATA BODY END]
+	// Execute the request through the API broker; a request that fails to start is answered as unsuccessful [EXECUTE REQUEST COMMENT]
+	FCommunityShard& Shard = CommunityShards.FindOrAdd(CommunityId); // Shard state of this community [FIND SHARD]
+	const int32 PageIndex = Shard.NumPagesRequested++; // Slot of this page in the shard [PAGE INDEX]
+	Shard.Pages.SetNum(Shard.NumPagesRequested); // Reserve the slot so pages combine in order [RESERVE PAGE SLOT]
+	Shard.NumPagesInFlight++; // Count the page on the wire [COUNT PAGE IN FLIGHT]
+	Shard.bRequestPending = true; // Merge waits for this shard [SET SHARD REQUEST PENDING]
+	bPreloadRequestPending = true; // Block duplicate preloads until every shard is loaded [SET PRELOAD PENDING FLAG]
+	UBuildingEnergyApiSubsystem::Send(this, HttpRequest, 
+		FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnPreloadResponseReceived, CommunityId, Shard.Generation, PageIndex), EBuildingApiPriority::UserInitiated); // Submit with user priority ahead of background polls [SEND PRELOAD REQUEST]
+}
 
-void ABuildingEnergyDisplay::OnPreloadResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful) // HTTP response callback for preload data operation [ON PRELOAD RESPONSE RECEIVED DECLARATION]
+void ABuildingEnergyDisplay::OnPreloadResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString CommunityId, uint32 LoadGeneration, int32 PageIndex) // HTTP response callback for one page of a community shard [ON PRELOAD RESPONSE RECEIVED DECLARATION]
 { // Start of OnPreloadResponseReceived method body [ON PRELOAD RESPONSE RECEIVED BODY START]
-	bIsLoading = false; // Always reset loading flag
+	FCommunityShard* Shard = CommunityShards.Find(CommunityId);
+	if (!Shard || LoadGeneration != Shard->Generation)
+	{
+		return; // The cache was cleared meanwhile
+	}
+	Shard->NumPagesInFlight--;
+	
+	// A failed page ends the shard's load, which then keeps its last data
+	bool bPageAccepted = false;
+	ON_SCOPE_EXIT
+	{
+		if (FCommunityShard* FailedShard = bPageAccepted ? nullptr : CommunityShards.Find(CommunityId))
+		{
+			FailedShard->bLoadFailed = true;
+		}
+		PumpCommunityPages(CommunityId);
+	};
 	
-	UE_LOG(LogTemp, Warning, TEXT("OnPreloadResponseReceived called. Success: %s"), bWasSuccessful ? TEXT("true") : TEXT("false"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("OnPreloadResponseReceived called for community %s page %d. Success: %s"), *CommunityId, PageIndex + 1, bWasSuccessful ? TEXT("true") : TEXT("false"));
 
 	if (!bWasSuccessful)
 	{
@@ -770,7 +987,7 @@ void ABuildingEnergyDisplay::OnPreloadResponseReceived(FHttpRequestPtr Request,
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
 				TEXT("ERROR: HTTP request failed or timed out. The server might be slow or unreachable."));
 		}
-		UE_LOG(LogTemp, Error, TEXT("HTTP Request was not successful - likely timeout or network error"));
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("HTTP Request was not successful - likely timeout or network error"));
 		return;
 	}
 
@@ -781,36 +998,21 @@ void ABuildingEnergyDisplay::OnPreloadResponseReceived(FHttpRequestPtr Request,
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
 				TEXT("ERROR: Invalid response from server."));
 		}
-		UE_LOG(LogTemp, Error, TEXT("Response is not valid"));
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("Response is not valid"));
 		return;
 	}
 
 	int32 ResponseCode = Response->GetResponseCode();
-	UE_LOG(LogTemp, Warning, TEXT("Response Code: %d"), ResponseCode);
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Response Code: %d"), ResponseCode);
 
 	if (ResponseCode == 401)
 	{
-		UE_LOG(LogTemp, Error, TEXT("401 Unauthorized - Access token may be expired"));
-		
-		// Try to refresh token automatically if we have a refresh token
-		if (!RefreshToken.IsEmpty())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Attempting automatic token refresh..."));
-			if (GEngine)
-			{
-				GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Yellow, 
-					TEXT("🔄 Token expired - attempting refresh..."));
-			}
-			RefreshAccessToken();
-		}
-		else
+		// The broker parks 401s and OnApiTokenRejected renews the token; a 401 here means renewal already failed
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("401 Unauthorized - token renewal failed, preload dropped"));
+		if (GEngine)
 		{
-			if (GEngine)
-			{
-				GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
-					TEXT("ERROR: Authentication failed (401). Check your access token."));
-			}
-			UE_LOG(LogTemp, Error, TEXT("401 Unauthorized - No refresh token available"));
+			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
+				TEXT("ERROR: Authentication failed (401). Check your access token."));
 		}
 		return;
 	}
@@ -822,10 +1024,19 @@ void ABuildingEnergyDisplay::OnPreloadResponseReceived(FHttpRequestPtr Request,
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
 				TEXT("ERROR: Access forbidden (403). Token lacks permissions."));
 		}
-		UE_LOG(LogTemp, Error, TEXT("403 Forbidden - Insufficient permissions"));
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("403 Forbidden - Insufficient permissions"));
 		return;
 	} // End of some previous block [PREVIOUS BLOCK END]
 
+	// A numbered page past the last one (the count shrank since the first page) ends the community instead of failing it
+	if (ResponseCode == 404 && PageIndex > 0 && Shard->NumPages > 0)
+	{
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Community %s has no page %d - treating it as the end of the data"), *CommunityId, PageIndex + 1);
+		Shard->NumPages = FMath::Min(Shard->NumPages, PageIndex);
+		bPageAccepted = true;
+		return;
+	}
+
 	if (ResponseCode != 200) // Check if HTTP response code is not successful (200 OK) [RESPONSE CODE CHECK]
 	{ // Start of error response handling block [ERROR RESPONSE BLOCK START]
 		FString ResponseBody = Response->GetContentAsString(); // Get response body content for error analysis [GET ERROR RESPONSE BODY]
@@ -834,28 +1045,30 @@ void ABuildingEnergyDisplay::OnPreloadResponseReceived(FHttpRequestPtr Request,
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
 				FString::Printf(TEXT("ERROR: Server returned code %d"), ResponseCode)); // Display HTTP error code on screen [DISPLAY HTTP ERROR CODE]
 		} // End of engine error display block [ENGINE ERROR DISPLAY BLOCK END]
-		UE_LOG(LogTemp, Error, TEXT("Server returned code %d. Response: %s"), ResponseCode, *ResponseBody.Left(500)); // Log HTTP error with partial response body [LOG HTTP ERROR]
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("Server returned code %d. Response: %s"), ResponseCode, *ResponseBody.Left(500)); // Log HTTP error with partial response body [LOG HTTP ERROR]
 		return; // Exit method early due to HTTP error [EARLY RETURN ON HTTP ERROR]
 	} // End of error response handling block [ERROR RESPONSE BLOCK END]
 
-	// Get the response content as string [GET RESPONSE CONTENT COMMENT]
-	FString ResponseContent = Response->GetContentAsString(); // Extract HTTP response body as string [EXTRACT RESPONSE CONTENT]
-	UE_LOG(LogTemp, Warning, TEXT("✅ BACKEND RESPONSE - Received %d bytes from: https://backend.gisworld-tech.com"), ResponseContent.Len()); // Log response content length for debugging [LOG RESPONSE LENGTH]
+	// The body stays UTF-8 bytes; the worker parses them without a UTF-16 copy [RESPONSE CONTENT COMMENT]
+	const TArray<uint8>& ResponseContent = Response->GetContent(); // Raw HTTP response body [RESPONSE CONTENT BYTES]
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("✅ BACKEND RESPONSE - Received %d bytes from: %s"), ResponseContent.Num(), *UBuildingEnergyApiSubsystem::GetApiBaseUrl()); // Log response content length for debugging [LOG RESPONSE LENGTH]
 	
 	// BACKEND VERIFICATION: Log a sample of the response to prove it's real data
-	FString ResponseSample = ResponseContent.Left(200).Replace(TEXT("\n"), TEXT(" ")).Replace(TEXT("\r"), TEXT(" "));
-	UE_LOG(LogTemp, Warning, TEXT("🔍 BACKEND DATA SAMPLE: %s..."), *ResponseSample);
+	const FUTF8ToTCHAR SampleText(reinterpret_cast<const ANSICHAR*>(ResponseContent.GetData()), FMath::Min(ResponseContent.Num(), 200));
+	FString ResponseSample = FString(SampleText.Length(), SampleText.Get()).Replace(TEXT("\n"), TEXT(" ")).Replace(TEXT("\r"), TEXT(" "));
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyIngest, Verbose, TEXT("🔍 BACKEND DATA SAMPLE: %s..."), *ResponseSample);
 	
 	if (GEngine)
 	{
-		// DISABLED for single building display: GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Cyan, FString::Printf(TEXT("🌐 BACKEND DATA RECEIVED - %d bytes from server"), ResponseContent.Len()));
+		// DISABLED for single building display: GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Cyan, FString::Printf(TEXT("🌐 BACKEND DATA RECEIVED - %d bytes from server"), ResponseContent.Num()));
 	}
 	
-	// Parse and cache all buildings [PARSE AND CACHE BUILDINGS COMMENT]
-	ParseAndCacheAllBuildings(ResponseContent); // Call method to parse JSON and populate building cache [PARSE AND CACHE CALL]
+	// Parse this page as it arrives; other pages and shards parse concurrently on their own workers [PARSE PAGE COMMENT]
+	IngestCommunityPage(CommunityId, LoadGeneration, PageIndex, Response); // Call method to parse JSON into a page store in the background [INGEST PAGE CALL]
+	bPageAccepted = true; // Page counts as loaded once parsed [PAGE ACCEPTED]
 } // End of response handling method [RESPONSE HANDLING METHOD END]
 
-void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(const FString& JsonResponse) // ParseAndCacheAllBuildings method to process JSON response and populate cache [PARSE AND CACHE ALL BUILDINGS DECLARATION]
+void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(FString JsonResponse, bool bIsFullPreload) // ParseAndCacheAllBuildings method to process JSON response and populate cache [PARSE AND CACHE ALL BUILDINGS DECLARATION]
 { // Start of ParseAndCacheAllBuildings method body [PARSE AND CACHE ALL BUILDINGS BODY START]
 	// 🔑 CASE SENSITIVITY STRATEGY
 	// ============================
@@ -870,476 +1083,719 @@ void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(const FString& JsonRespon
 	// This strategy ensures API compatibility and prevents ID mismatches
 	// between different API endpoints that expect specific case formats.
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔑 PARSING: Using case-sensitive strategy for all gml_id operations"));
-	
-	// Parse JSON [PARSE JSON COMMENT]
-	TSharedPtr<FJsonValue> JsonValue; // Create shared pointer for JSON value object [CREATE JSON VALUE POINTER]
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonResponse); // Create JSON reader from response string [CREATE JSON READER]
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔑 PARSING: Using case-sensitive strategy for all gml_id operations"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Parsing %d characters on a background task (generation %u)"), JsonResponse.Len(), IngestGeneration + 1);
 
-	if (!FJsonSerializer::Deserialize(Reader, JsonValue) || !JsonValue.IsValid()) // Attempt JSON deserialization and validate result [JSON DESERIALIZATION CHECK]
-	{ // Start of JSON parse error block [JSON PARSE ERROR BLOCK START]
-		if (GEngine) // Check if global engine instance is available [ENGINE INSTANCE CHECK FOR JSON ERROR]
-		{ // Start of engine JSON error display block [ENGINE JSON ERROR DISPLAY BLOCK START]
-			GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Red, 
-				TEXT("ERROR: Failed to parse building data JSON")); // Display JSON parse error on screen [DISPLAY JSON PARSE ERROR]
-		} // End of engine JSON error display block [ENGINE JSON ERROR DISPLAY BLOCK END]
-		return; // Exit method early due to JSON parse failure [EARLY RETURN ON JSON ERROR]
-	} // End of JSON parse error block [JSON PARSE ERROR BLOCK END]
+	LaunchIngest([JsonResponse = MoveTemp(JsonResponse)](TFunctionRef<void(FBuildingEnergyRecord&)> OnBuilding, FString* OutError)
+	{
+		return FBuildingEnergyStreamReader::ReadBuildings(JsonResponse, OnBuilding, OutError);
+	}, bIsFullPreload);
+} // End of ParseAndCacheAllBuildings method body [PARSE AND CACHE ALL BUILDINGS BODY END]
 
-	// The response is an array of buildings [RESPONSE IS ARRAY COMMENT]
-	TArray<TSharedPtr<FJsonValue>> BuildingsArray = JsonValue->AsArray(); // Extract JSON array containing building objects [EXTRACT BUILDINGS ARRAY]
-	int32 BuildingCount = 0; // Initialize building counter for statistics [INITIALIZE BUILDING COUNTER]
+void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(TArray<uint8> Utf8Json, bool bIsFullPreload)
+{
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Parsing %d bytes on a background task (generation %u)"), Utf8Json.Num(), IngestGeneration + 1);
 
-	// Process each building [PROCESS EACH BUILDING COMMENT]
-	for (const TSharedPtr<FJsonValue>& BuildingValue : BuildingsArray) // Iterate through each building in the JSON array [ITERATE BUILDINGS LOOP]
-	{ // Start of building processing loop [BUILDING PROCESSING LOOP START]
-		TSharedPtr<FJsonObject> BuildingObject = BuildingValue->AsObject(); // Extract building object from JSON value [EXTRACT BUILDING OBJECT]
-		if (!BuildingObject.IsValid()) // Check if building object is valid [BUILDING OBJECT VALIDATION]
-			continue; // Skip invalid building objects [SKIP INVALID BUILDING]
+	LaunchIngest([Utf8Json = MoveTemp(Utf8Json)](TFunctionRef<void(FBuildingEnergyRecord&)> OnBuilding, FString* OutError)
+	{
+		return FBuildingEnergyStreamReader::ReadBuildings(Utf8Json, OnBuilding, OutError);
+	}, bIsFullPreload);
+}
 
-		FString BuildingGmlId = BuildingObject->GetStringField(TEXT("modified_gml_id")); // Extract building GML ID from JSON object - CASE SENSITIVE: 'G' != 'g' [EXTRACT BUILDING GML ID]
-		
-		// 🔍 DETAILED JSON DEBUGGING FOR MISSING DATA INVESTIGATION
-		UE_LOG(LogTemp, Warning, TEXT("🔍 === DEBUGGING BUILDING: %s ==="), *BuildingGmlId);
-		
-		// Check if this is the problematic building
-		if (BuildingGmlId.Contains(TEXT("DEBW_0010008")) || BuildingGmlId.Contains(TEXT("wfbT")))
+void ABuildingEnergyDisplay::LaunchIngest(TUniqueFunction<bool(TFunctionRef<void(FBuildingEnergyRecord&)>, FString*)>&& ReadBuildings, bool bIsFullPreload)
+{
+	// Parsing, color conversion, coordinate parsing and display strings all run on a worker [BACKGROUND INGEST COMMENT]
+	// into a private building store; PublishBuildingStore swaps it in on the game thread. [PUBLISH COMMENT]
+	const uint32 Generation = ++IngestGeneration; // Newer ingests supersede results still in flight [INGEST GENERATION]
+	bIsLoading = true; // Mark loading in progress until the swap [SET LOADING FLAG]
+	TWeakObjectPtr<ABuildingEnergyDisplay> WeakThis(this); // Actor may be destroyed before the worker finishes [WEAK THIS]
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Generation, bIsFullPreload, ReadBuildings = MoveTemp(ReadBuildings)]()
+	{
+		BUILDING_ENERGY_SCOPE(Ingest);
+		TSharedRef<FBuildingIngestResult> Result = MakeShared<FBuildingIngestResult>();
+
+		// Stream the response token by token - no FJsonValue DOM is built for the whole array
+		Result->bParsed = ReadBuildings([&Result](FBuildingEnergyRecord& Record)
 		{
-			UE_LOG(LogTemp, Error, TEXT("🔴 FOUND PROBLEMATIC BUILDING: %s - DETAILED ANALYSIS"), *BuildingGmlId);
-			
-			// Log complete JSON structure for this building
-			FString JsonString;
-			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-			FJsonSerializer::Serialize(BuildingObject.ToSharedRef(), Writer);
-			UE_LOG(LogTemp, Error, TEXT("🔴 COMPLETE JSON FOR %s:"), *BuildingGmlId);
-			UE_LOG(LogTemp, Error, TEXT("%s"), *JsonString);
-		}
-		
-		// CRUCIAL: Also extract the actual gml_id (with L) for attributes API - CASE SENSITIVE: 'G' != 'g'
-		FString ActualGmlId;
-		if (BuildingObject->HasField(TEXT("gml_id"))) // CASE SENSITIVE field name check
+			if (CacheBuildingRecord(Result->Store, Record)) // Emit each building into the private store as soon as it is read
+			{
+				Result->BuildingCount++;
+			}
+		}, &Result->ParseError);
+		Result->Store.FinalizeGeometry(); // Group polygons per building once, after the last record
+		Result->Store.FinalizeIdIndex(); // Sort the prefix/suffix id order used by partial click matching
+
+		// A complete preload becomes the next warm start snapshot; its hash tells whether anything changed
+		if (bIsFullPreload && Result->bParsed && Result->BuildingCount > 0)
 		{
-			ActualGmlId = BuildingObject->GetStringField(TEXT("gml_id")); // CASE SENSITIVE field extraction
-			UE_LOG(LogTemp, Warning, TEXT("SUCCESS Found gml_id field in JSON: %s"), *ActualGmlId);
+			Result->SnapshotBytes = FBuildingStoreSnapshot::Serialize(Result->Store, &Result->ContentHash);
 		}
-		else
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Result]()
 		{
-			// Fallback: convert modified_gml_id to gml_id
-			ActualGmlId = BuildingGmlId.Replace(TEXT("_"), TEXT("L"));
-			UE_LOG(LogTemp, Warning, TEXT("WARNING No gml_id field found, using conversion: %s -> %s"), *BuildingGmlId, *ActualGmlId);
-		}
-		
-		// Store the mapping for later use by attributes API
-		GmlIdCache.Add(BuildingGmlId, ActualGmlId);
-		UE_LOG(LogTemp, Display, TEXT("🔗 CACHE [%d] Cached mapping: modified_gml_id=%s -> gml_id=%s"), BuildingCount + 1, *BuildingGmlId, *ActualGmlId);
+			ABuildingEnergyDisplay* This = WeakThis.Get();
+			if (!This || Generation != This->IngestGeneration)
+			{
+				UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Dropping stale ingest result (%d buildings)"), Result->BuildingCount);
+				return;
+			}
+			This->PublishBuildingStore(MoveTemp(Result.Get()));
+		});
+	});
+}
+
+void ABuildingEnergyDisplay::IngestCommunityPage(const FString& CommunityId, uint32 LoadGeneration, int32 PageIndex, FHttpResponsePtr Response)
+{
+	CommunityShards.FindChecked(CommunityId).NumPagesParsing++;
+	TWeakObjectPtr<ABuildingEnergyDisplay> WeakThis(this);
+
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Parsing %d bytes of community %s page %d on a background task"), Response->GetContent().Num(), *CommunityId, PageIndex + 1);
 
-		// Get the energy_result object
-		TSharedPtr<FJsonObject> EnergyResult = BuildingObject->GetObjectField(TEXT("energy_result"));
-		if (!EnergyResult.IsValid())
+	// The completed response is immutable; holding it keeps the body alive for the worker
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, CommunityId, LoadGeneration, PageIndex, Response]()
+	{
+		BUILDING_ENERGY_SCOPE(Ingest);
+		TSharedRef<FBuildingIngestResult> Result = MakeShared<FBuildingIngestResult>();
+		int32 NumRecords = 0;
+		FBuildingPageInfo PageInfo;
+		Result->bParsed = FBuildingEnergyStreamReader::ReadBuildings(Response->GetContent(), [&Result, &NumRecords](FBuildingEnergyRecord& Record)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔴 Building %s: Missing 'energy_result' field - checking for alternative structures"), *BuildingGmlId);
-			
-			// Check for alternative field names
-			if (BuildingObject->HasField(TEXT("energy_data")))
+			NumRecords++;
+			if (CacheBuildingRecord(Result->Store, Record))
 			{
-				EnergyResult = BuildingObject->GetObjectField(TEXT("energy_data"));
-				UE_LOG(LogTemp, Warning, TEXT("🔄 Found 'energy_data' field instead for %s"), *BuildingGmlId);
+				Result->BuildingCount++;
 			}
-			else if (BuildingObject->HasField(TEXT("result")))
+		}, &Result->ParseError, &PageInfo);
+		Result->Store.FinalizeGeometry();
+		Result->Store.FinalizeIdIndex();
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, CommunityId, LoadGeneration, PageIndex, Result, NumRecords, PageInfo = MoveTemp(PageInfo)]()
+		{
+			ABuildingEnergyDisplay* This = WeakThis.Get();
+			FCommunityShard* Shard = This ? This->CommunityShards.Find(CommunityId) : nullptr;
+			if (!Shard || LoadGeneration != Shard->Generation)
 			{
-				EnergyResult = BuildingObject->GetObjectField(TEXT("result"));
-				UE_LOG(LogTemp, Warning, TEXT("🔄 Found 'result' field instead for %s"), *BuildingGmlId);
+				UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Dropping stale page of community %s (%d buildings)"), *CommunityId, Result->BuildingCount);
+				return;
 			}
-			
-			if (!EnergyResult.IsValid())
+			Shard->NumPagesParsing--;
+
+			// Like a full ingest, buildings read before a parse error are still used
+			if (!Result->bParsed)
 			{
-				UE_LOG(LogTemp, Error, TEXT("❌ Building %s: No valid energy data structure found - SKIPPING"), *BuildingGmlId);
-				continue;
+				UE_LOG(LogBuildingEnergyIngest, Error, TEXT("❌ PARSING: Failed to stream community %s page %d after %d buildings: %s"), *CommunityId, PageIndex + 1, Result->BuildingCount, *Result->ParseError);
 			}
-		}
 
-		// Get the "begin" and "end" objects
-		TSharedPtr<FJsonObject> BeginObject = EnergyResult->GetObjectField(TEXT("begin"));
-		TSharedPtr<FJsonObject> EndObject = EnergyResult->GetObjectField(TEXT("end"));
-		
-		UE_LOG(LogTemp, Warning, TEXT("🔍 Building %s: Begin valid=%s, End valid=%s"), 
-			*BuildingGmlId, BeginObject.IsValid() ? TEXT("YES") : TEXT("NO"), EndObject.IsValid() ? TEXT("YES") : TEXT("NO"));
-		
-		if (!BeginObject.IsValid() || !EndObject.IsValid())
-		{
-			// Try alternative structures
-			if (!BeginObject.IsValid() && EnergyResult->HasField(TEXT("before")))
+			// The first page decides how the rest is fetched: all at once by number when the total is known,
+			// otherwise one after another along the "next" links. The page size is the requested one when the server
+			// honored it, else the raw length of "results" - records skipped for a missing id still take a slot.
+			// A first page cut short by a parse error has no reliable size and falls back to the links.
+			if (PageIndex == 0)
 			{
-				BeginObject = EnergyResult->GetObjectField(TEXT("before"));
-				UE_LOG(LogTemp, Warning, TEXT("🔄 Found 'before' instead of 'begin' for %s"), *BuildingGmlId);
+				const int32 PageSize = This->PreloadPageSize > 0 && PageInfo.NumResults == This->PreloadPageSize ? This->PreloadPageSize : PageInfo.NumResults;
+				Shard->FirstPageSize = PageSize;
+				if (Result->bParsed && PageInfo.TotalCount > PageSize && PageSize > 0 && !PageInfo.Next.IsEmpty())
+				{
+					Shard->NumPages = FMath::DivideAndRoundUp(PageInfo.TotalCount, PageSize);
+				}
+				else
+				{
+					Shard->NumPages = 0;
+					Shard->NextPageUrl = PageInfo.Next;
+				}
 			}
-			if (!EndObject.IsValid() && EnergyResult->HasField(TEXT("after")))
+			else if (Shard->NumPages == 0)
 			{
-				EndObject = EnergyResult->GetObjectField(TEXT("after"));
-				UE_LOG(LogTemp, Warning, TEXT("🔄 Found 'after' instead of 'end' for %s"), *BuildingGmlId);
+				Shard->NextPageUrl = PageInfo.Next;
 			}
-			
-			if (!BeginObject.IsValid() || !EndObject.IsValid())
+
+			if (Result->BuildingCount > 0)
 			{
-				UE_LOG(LogTemp, Error, TEXT("❌ Building %s: Missing begin/end structure - SKIPPING"), *BuildingGmlId);
-				continue;
+				const TSharedRef<FBuildingStore> Page = MakeShared<FBuildingStore>(MoveTemp(Result->Store));
+				Shard->Pages[PageIndex] = Page;
+
+				// Color the page right away; geometry and the sorted id index come with the merged store
+				const int32 NumAdded = This->BuildingStore.Append(*Page, false);
+				if (NumAdded > 0)
+				{
+					This->bDataLoaded = true;
+					if (This->bEnableCesiumPerFeatureStyling)
+					{
+						This->ApplyColorsToCSiumTileset();
+					}
+				}
+				UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Community %s page %d parsed, %d buildings (%d new on screen, %d records without energy skipped)"),
+					*CommunityId, PageIndex + 1, Result->BuildingCount, NumAdded, NumRecords - Result->BuildingCount);
 			}
-		}
+			This->PumpCommunityPages(CommunityId);
+		});
+	});
+}
 
-		TSharedPtr<FJsonObject> BeginResult = BeginObject->GetObjectField(TEXT("result"));
-		TSharedPtr<FJsonObject> EndResult = EndObject->GetObjectField(TEXT("result"));
-		
-		UE_LOG(LogTemp, Warning, TEXT("🔍 Building %s: BeginResult valid=%s, EndResult valid=%s"), 
-			*BuildingGmlId, BeginResult.IsValid() ? TEXT("YES") : TEXT("NO"), EndResult.IsValid() ? TEXT("YES") : TEXT("NO"));
-		
-		// If result objects are missing, try using the begin/end objects directly
-		if (!BeginResult.IsValid())
-		{
-			BeginResult = BeginObject;
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Using BeginObject directly as BeginResult for %s"), *BuildingGmlId);
-		}
-		if (!EndResult.IsValid())
+void ABuildingEnergyDisplay::PumpCommunityPages(const FString& CommunityId)
+{
+	if (FCommunityShard* Shard = CommunityShards.Find(CommunityId))
+	{
+		if (!Shard->bLoadFailed && Shard->NumPages == 0)
 		{
-			EndResult = EndObject;
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Using EndObject directly as EndResult for %s"), *BuildingGmlId);
+			// Cursor pagination: the next link is only known once the previous page is read
+			if (!Shard->NextPageUrl.IsEmpty())
+			{
+				const FString URL = MoveTemp(Shard->NextPageUrl);
+				Shard->NextPageUrl.Reset();
+				RequestCommunityPage(CommunityId, URL);
+			}
 		}
-		
-		if (!BeginResult.IsValid() || !EndResult.IsValid())
+		else if (!Shard->bLoadFailed)
 		{
-			UE_LOG(LogTemp, Error, TEXT("❌ Building %s: No valid result structure found - SKIPPING"), *BuildingGmlId);
-			continue;
+			while (Shard->NumPagesInFlight < FMath::Max(1, MaxPreloadPagesInFlight) && Shard->NumPagesRequested < Shard->NumPages)
+			{
+				RequestCommunityPage(CommunityId, MakeCommunityPageUrl(CommunityId, Shard->NumPagesRequested, Shard->FirstPageSize));
+			}
 		}
+		Shard->bRequestPending = Shard->NumPagesInFlight > 0 || (!Shard->bLoadFailed && Shard->NumPagesRequested < Shard->NumPages);
 
-		// Extract BEFORE renovation data
-		TSharedPtr<FJsonObject> BeginEnergyDemand = BeginResult->GetObjectField(TEXT("energy_demand"));
-		TSharedPtr<FJsonObject> BeginEnergySpecific = BeginResult->GetObjectField(TEXT("energy_demand_specific"));
-		TSharedPtr<FJsonObject> BeginCO2 = BeginResult->GetObjectField(TEXT("co2_from_energy_demand"));
-		
-		// Extract AFTER renovation data
-		TSharedPtr<FJsonObject> EndEnergyDemand = EndResult->GetObjectField(TEXT("energy_demand"));
-		TSharedPtr<FJsonObject> EndEnergySpecific = EndResult->GetObjectField(TEXT("energy_demand_specific"));
-		TSharedPtr<FJsonObject> EndCO2 = EndResult->GetObjectField(TEXT("co2_from_energy_demand"));
-		
-		// 🔍 DETAILED ENERGY DATA DEBUGGING
-		UE_LOG(LogTemp, Warning, TEXT("🔍 Building %s - Energy Fields:"), *BuildingGmlId);
-		UE_LOG(LogTemp, Warning, TEXT("   BeginEnergyDemand: %s"), BeginEnergyDemand.IsValid() ? TEXT("✅") : TEXT("❌"));
-		UE_LOG(LogTemp, Warning, TEXT("   BeginEnergySpecific: %s"), BeginEnergySpecific.IsValid() ? TEXT("✅") : TEXT("❌"));
-		UE_LOG(LogTemp, Warning, TEXT("   BeginCO2: %s"), BeginCO2.IsValid() ? TEXT("✅") : TEXT("❌"));
-		UE_LOG(LogTemp, Warning, TEXT("   EndEnergyDemand: %s"), EndEnergyDemand.IsValid() ? TEXT("✅") : TEXT("❌"));
-		UE_LOG(LogTemp, Warning, TEXT("   EndEnergySpecific: %s"), EndEnergySpecific.IsValid() ? TEXT("✅") : TEXT("❌"));
-		UE_LOG(LogTemp, Warning, TEXT("   EndCO2: %s"), EndCO2.IsValid() ? TEXT("✅") : TEXT("❌"));
-		
-		// Log available fields in BeginResult and EndResult for debugging
-		if (BuildingGmlId.Contains(TEXT("DEBW_0010008")) || BuildingGmlId.Contains(TEXT("wfbT")))
+		// Every page is in: combine them into the shard store
+		if (!Shard->IsLoading() && Shard->NumPagesRequested > 0)
 		{
-			UE_LOG(LogTemp, Error, TEXT("🔴 DEBUGGING FIELDS IN BeginResult for %s:"), *BuildingGmlId);
-			for (const auto& Field : BeginResult->Values)
+			TArray<TSharedRef<FBuildingStore>> Pages;
+			for (const TSharedPtr<FBuildingStore>& Page : Shard->Pages)
 			{
-				UE_LOG(LogTemp, Error, TEXT("   Field: %s"), *Field.Key);
+				if (Page.IsValid())
+				{
+					Pages.Add(Page.ToSharedRef());
+				}
 			}
-			
-			UE_LOG(LogTemp, Error, TEXT("🔴 DEBUGGING FIELDS IN EndResult for %s:"), *BuildingGmlId);
-			for (const auto& Field : EndResult->Values)
-			{
-				UE_LOG(LogTemp, Error, TEXT("   Field: %s"), *Field.Key);
-			}
-		}
+			const bool bLoadFailed = Shard->bLoadFailed;
+			Shard->Pages.Reset();
+			Shard->NumPagesRequested = 0;
 
-		// --- CESIUM MATERIAL COLORING LOGIC ---
-		// Extract color from "end" (after renovation) as specified
-		FString ColorHex = TEXT("#66b032"); // Fallback color only for this example
-		
-		// Debug: Check EndObject structure
-		UE_LOG(LogTemp, Warning, TEXT("🎨 COLOR DEBUGGING for building %s:"), *BuildingGmlId);
-		UE_LOG(LogTemp, Warning, TEXT("   EndObject valid: %s"), EndObject.IsValid() ? TEXT("YES") : TEXT("NO"));
-		
-		TSharedPtr<FJsonObject> EndColor = EndObject->GetObjectField(TEXT("color"));
-		UE_LOG(LogTemp, Warning, TEXT("   EndColor valid: %s"), EndColor.IsValid() ? TEXT("YES") : TEXT("NO"));
-		
-		if (EndColor.IsValid())
-		{
-			// Check available color fields
-			UE_LOG(LogTemp, Warning, TEXT("   Available color fields:"));
-			for (const auto& ColorField : EndColor->Values)
+			if (bLoadFailed)
 			{
-				if (ColorField.Value->Type == EJson::String)
-				{
-					FString ColorValue = ColorField.Value->AsString();
-					UE_LOG(LogTemp, Warning, TEXT("     %s: %s"), *ColorField.Key, *ColorValue);
-				}
+				UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("🔄 INGEST: Loading community %s failed - keeping its last data"), *CommunityId);
 			}
-			
-			if (EndColor->HasField(TEXT("energy_demand_specific_color")))
+			else if (Pages.Num() == 1)
 			{
-				ColorHex = EndColor->GetStringField(TEXT("energy_demand_specific_color"));
-				UE_LOG(LogTemp, Warning, TEXT("✅ COLOR Building %s extracted color: %s"), *BuildingGmlId, *ColorHex);
+				Shard->Store = Pages[0];
+				bCommunityShardsChanged = true;
 			}
-			else
+			else if (Pages.Num() > 1)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("❌ WARNING No 'energy_demand_specific_color' field found for %s"), *BuildingGmlId);
+				Shard->bCombiningPages = true;
+				TWeakObjectPtr<ABuildingEnergyDisplay> WeakThis(this);
+				UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, CommunityId, LoadGeneration = Shard->Generation, Pages = MoveTemp(Pages)]()
+				{
+					BUILDING_ENERGY_SCOPE(Merge);
+					TSharedRef<FBuildingStore> Store = MakeShared<FBuildingStore>();
+					for (const TSharedRef<FBuildingStore>& Page : Pages)
+					{
+						Store->Append(*Page);
+					}
+					Store->FinalizeGeometry();
+					Store->FinalizeIdIndex();
+
+					AsyncTask(ENamedThreads::GameThread, [WeakThis, CommunityId, LoadGeneration, Store, NumPages = Pages.Num()]()
+					{
+						ABuildingEnergyDisplay* This = WeakThis.Get();
+						FCommunityShard* Shard = This ? This->CommunityShards.Find(CommunityId) : nullptr;
+						if (!Shard || LoadGeneration != Shard->Generation)
+						{
+							return;
+						}
+						Shard->bCombiningPages = false;
+						Shard->Store = Store;
+						This->bCommunityShardsChanged = true;
+						UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Community %s combined from %d pages, %d buildings"), *CommunityId, NumPages, Store->Num());
+						This->MergeCommunityShards();
+					});
+				});
 			}
 		}
+	}
+
+	bPreloadRequestPending = false;
+	for (const TPair<FString, FCommunityShard>& Pair : CommunityShards)
+	{
+		bPreloadRequestPending |= Pair.Value.IsLoading();
+	}
+	MergeCommunityShards();
+}
+
+void ABuildingEnergyDisplay::MergeCommunityShards()
+{
+	for (const TPair<FString, FCommunityShard>& Pair : CommunityShards)
+	{
+		if (Pair.Value.IsLoading())
+		{
+			return; // Published together with the slowest shard
+		}
+	}
+	if (!bCommunityShardsChanged)
+	{
+		bIsLoading = false; // Every shard failed; keep serving the current store
+		return;
+	}
+	bCommunityShardsChanged = false;
+
+	// Configured order decides which community keeps a building listed twice
+	TArray<TSharedRef<FBuildingStore>> Stores;
+	bool bAllCommunities = true;
+	for (const FString& CommunityId : CommunityIds)
+	{
+		const FCommunityShard* Shard = CommunityShards.Find(CommunityId);
+		if (Shard && Shard->Store.IsValid())
+		{
+			Stores.Add(Shard->Store.ToSharedRef());
+		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("❌ WARNING No 'color' object found in EndObject for %s"), *BuildingGmlId);
-			
-			// Try alternative color field locations
-			if (EndResult->HasField(TEXT("color")))
-			{
-				EndColor = EndResult->GetObjectField(TEXT("color"));
-				if (EndColor.IsValid() && EndColor->HasField(TEXT("energy_demand_specific_color")))
-				{
-					ColorHex = EndColor->GetStringField(TEXT("energy_demand_specific_color"));
-					UE_LOG(LogTemp, Warning, TEXT("✅ COLOR Found color in EndResult instead: %s"), *ColorHex);
-				}
-			}
+			bAllCommunities = false;
 		}
+	}
+	if (Stores.Num() == 0)
+	{
+		bIsLoading = false;
+		return;
+	}
 
-		// Convert hex color to FLinearColor
-		FLinearColor BuildingColor = ConvertHexToLinearColor(ColorHex);
-		UE_LOG(LogTemp, Warning, TEXT("🎨 COLOR Converted %s to LinearColor(R:%.3f, G:%.3f, B:%.3f)"), 
-			*ColorHex, BuildingColor.R, BuildingColor.G, BuildingColor.B);
+	// A single community has nothing to merge or refresh separately: its store is handed over instead of copied
+	const bool bHandOver = CommunityIds.Num() == 1;
+	if (bHandOver)
+	{
+		CommunityShards[CommunityIds[0]].Store.Reset();
+	}
 
-		// Store color data for this building (CASE-SENSITIVE - no duplicates)
-		// Check if we already have this building in the cache
-		if (BuildingColorCache.Contains(BuildingGmlId))
+	const uint32 Generation = ++IngestGeneration;
+	bIsLoading = true;
+	++NumCommunityMergesPending;
+	TWeakObjectPtr<ABuildingEnergyDisplay> WeakThis(this);
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Generation, Stores = MoveTemp(Stores), bHandOver, bAllCommunities]()
+	{
+		BUILDING_ENERGY_SCOPE(Merge);
+		TSharedRef<FBuildingIngestResult> Result = MakeShared<FBuildingIngestResult>();
+		Result->bParsed = true;
+		if (bHandOver)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 COLOR CACHE: Overwriting existing color for %s"), *BuildingGmlId);
+			Result->Store = MoveTemp(*Stores[0]);
 		}
-		
-		BuildingColorCache.Add(BuildingGmlId, BuildingColor);
-		UE_LOG(LogTemp, Log, TEXT("✅ COLOR CACHED: %s -> %s (R:%.3f G:%.3f B:%.3f)"), 
-			*BuildingGmlId, *ColorHex, BuildingColor.R, BuildingColor.G, BuildingColor.B);
-		
-		// IMPORTANT: Only cache under actual gml_id if it's genuinely different
-		// This prevents duplicate cache entries that were causing color lookup issues
-		if (!ActualGmlId.IsEmpty() && !ActualGmlId.Equals(BuildingGmlId))
+		else
 		{
-			if (BuildingColorCache.Contains(ActualGmlId))
+			for (const TSharedRef<FBuildingStore>& Store : Stores)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🔄 COLOR CACHE: Overwriting existing color for actual gml_id %s"), *ActualGmlId);
+				Result->Store.Append(*Store);
 			}
-			BuildingColorCache.Add(ActualGmlId, BuildingColor);
-			UE_LOG(LogTemp, Log, TEXT("✅ COLOR CACHED (ACTUAL): %s -> %s"), *ActualGmlId, *ColorHex);
+			Result->Store.FinalizeGeometry();
+			Result->Store.FinalizeIdIndex();
 		}
+		Result->BuildingCount = Result->Store.Num();
 
-		// Build display message to match the screenshot format
-		FString DisplayMessage = FString::Printf(TEXT("Building ID: %s\n\n"), *BuildingGmlId);
-		
-		// CO2 Section
-		DisplayMessage += TEXT("CO2 [t CO2/a]\n");
-		
-		// Before Renovation CO2
-		if (BeginCO2.IsValid() && BeginCO2->HasField(TEXT("value")))
+		// Only a store holding every configured community becomes the next warm start snapshot
+		if (bAllCommunities && Result->BuildingCount > 0)
 		{
-			TSharedPtr<FJsonValue> BeginCO2Json = BeginCO2->TryGetField(TEXT("value"));
-			if (BeginCO2Json.IsValid() && BeginCO2Json->Type != EJson::Null)
+			Result->SnapshotBytes = FBuildingStoreSnapshot::Serialize(Result->Store, &Result->ContentHash);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Result, NumShards = Stores.Num()]()
+		{
+			ABuildingEnergyDisplay* This = WeakThis.Get();
+			if (!This)
 			{
-				int32 BeginCO2Value = BeginCO2->GetIntegerField(TEXT("value"));
-				// Convert from kg to tonnes (divide by 1000) and format with 3 decimal places
-				float BeginCO2Tonnes = BeginCO2Value / 1000.0f;
-				DisplayMessage += FString::Printf(TEXT("Before Renovation: %.3f\n"), BeginCO2Tonnes);
-				UE_LOG(LogTemp, Warning, TEXT("✅ Building %s: BeginCO2 = %d kg (%.3f tonnes)"), *BuildingGmlId, BeginCO2Value, BeginCO2Tonnes);
+				return;
 			}
-			else
+			--This->NumCommunityMergesPending;
+			if (Generation != This->IngestGeneration)
 			{
-				DisplayMessage += TEXT("Before Renovation: No data\n");
-				UE_LOG(LogTemp, Warning, TEXT("❌ Building %s: BeginCO2 value field is null"), *BuildingGmlId);
+				UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Dropping stale merge (%d buildings)"), Result->BuildingCount);
+				return;
 			}
-		}
-		else
+			UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔄 INGEST: Merged %d community shard(s) into %d buildings"), NumShards, Result->BuildingCount);
+			This->PublishBuildingStore(MoveTemp(Result.Get()));
+		});
+	});
+}
+
+void ABuildingEnergyDisplay::RefreshCommunity(const FString& CommunityId)
+{
+	if (!CommunityIds.Contains(CommunityId))
+	{
+		UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("RefreshCommunity: %s is not in CommunityIds"), *CommunityId);
+		return;
+	}
+	if (AccessToken.IsEmpty() || bLoadByViewport)
+	{
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("RefreshCommunity: %s"), AccessToken.IsEmpty() ? TEXT("no access token") : TEXT("viewport loading refreshes by chunk"));
+		return;
+	}
+	const FCommunityShard* Shard = CommunityShards.Find(CommunityId);
+	if (Shard && Shard->IsLoading())
+	{
+		return;
+	}
+	bIsLoading = true;
+	RequestCommunityShard(CommunityId);
+}
+
+FString ABuildingEnergyDisplay::GetCommunityOfBuilding(const FString& GmlId) const
+{
+	if (CommunityIds.Num() > 1)
+	{
+		for (const FString& CommunityId : CommunityIds)
 		{
-			DisplayMessage += TEXT("Before Renovation: No data\n");
-			UE_LOG(LogTemp, Warning, TEXT("❌ Building %s: BeginCO2 object missing or no 'value' field"), *BuildingGmlId);
+			const FCommunityShard* Shard = CommunityShards.Find(CommunityId);
+			if (Shard && Shard->Store.IsValid() && Shard->Store->FindIndex(GmlId) != INDEX_NONE)
+			{
+				return CommunityId;
+			}
 		}
-		
-		// After Renovation CO2
-		if (EndCO2.IsValid() && EndCO2->HasField(TEXT("value")))
+	}
+	return GetPrimaryCommunityId();
+}
+
+const FString& ABuildingEnergyDisplay::GetPrimaryCommunityId() const
+{
+	static const FString NoCommunity;
+	return CommunityIds.Num() > 0 ? CommunityIds[0] : NoCommunity;
+}
+
+FString ABuildingEnergyDisplay::GetCommunitySetKey() const
+{
+	return FString::Join(CommunityIds, TEXT("+"));
+}
+
+void ABuildingEnergyDisplay::LoadBuildingSnapshot()
+{
+	const FString SnapshotPath = FBuildingStoreSnapshot::GetSnapshotPath(GetCommunitySetKey());
+	const uint32 Generation = ++IngestGeneration; // A live ingest started meanwhile supersedes the snapshot
+	TWeakObjectPtr<ABuildingEnergyDisplay> WeakThis(this);
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Generation, SnapshotPath]()
+	{
+		BUILDING_ENERGY_SCOPE(SnapshotLoad);
+		const double StartTime = FPlatformTime::Seconds();
+		TSharedRef<FBuildingIngestResult> Result = MakeShared<FBuildingIngestResult>();
+		Result->bFromSnapshot = true;
+		Result->bParsed = FBuildingStoreSnapshot::LoadFromFile(SnapshotPath, Result->Store, &Result->ContentHash, &Result->ParseError);
+		Result->BuildingCount = Result->Store.Num();
+		const double LoadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Result, SnapshotPath, LoadMs]()
 		{
-			TSharedPtr<FJsonValue> EndCO2Json = EndCO2->TryGetField(TEXT("value"));
-			if (EndCO2Json.IsValid() && EndCO2Json->Type != EJson::Null)
+			ABuildingEnergyDisplay* This = WeakThis.Get();
+			if (!This || Generation != This->IngestGeneration)
 			{
-				int32 EndCO2Value = EndCO2->GetIntegerField(TEXT("value"));
-				// Convert from kg to tonnes (divide by 1000) and format with 3 decimal places
-				float EndCO2Tonnes = EndCO2Value / 1000.0f;
-				DisplayMessage += FString::Printf(TEXT("After Renovation: %.3f\n\n"), EndCO2Tonnes);
+				return;
 			}
-			else
+			if (!Result->bParsed)
 			{
-				DisplayMessage += TEXT("After Renovation: No data\n\n");
+				UE_LOG(LogBuildingEnergyIngest, Log, TEXT("💾 SNAPSHOT: No warm start from %s (%s)"), *SnapshotPath, *Result->ParseError);
+				return;
 			}
-		}
-		else
+
+			UE_LOG(LogBuildingEnergyIngest, Log, TEXT("💾 SNAPSHOT: Loaded %d buildings in %.1f ms from %s"), Result->BuildingCount, LoadMs, *SnapshotPath);
+			This->PublishBuildingStore(MoveTemp(Result.Get()));
+		});
+	});
+}
+
+void ABuildingEnergyDisplay::UpdateViewportChunks()
+{
+	APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(this, 0);
+	ACesiumGeoreference* Georeference = ACesiumGeoreference::GetDefaultGeoreference(this);
+	if (!CameraManager || !Georeference)
+	{
+		return;
+	}
+
+	// Higher up the camera sees (and Cesium loads) a wider area
+	const FVector LongitudeLatitudeHeight = Georeference->TransformUnrealPositionToLongitudeLatitudeHeight(CameraManager->GetCameraLocation());
+	const double Radius = FMath::Max<double>(ViewportLoadRadius, LongitudeLatitudeHeight.Z);
+
+	TArray<FBuildingChunkKey> WantedChunks;
+	FBuildingChunkCache::GatherChunksAround(LongitudeLatitudeHeight.X, LongitudeLatitudeHeight.Y, Radius, ViewportChunkLevel, WantedChunks);
+
+	// Never want more than the cache holds, or the nearest chunks would evict each other
+	ChunkCache.MaxChunks = FMath::Max(1, MaxCachedChunks);
+	ChunkCache.MaxBytes = SIZE_T(FMath::Max(0.0f, ChunkCacheBudgetMB) * 1024.0 * 1024.0);
+	if (WantedChunks.Num() > ChunkCache.MaxChunks)
+	{
+		if (!bChunkLimitWarned)
 		{
-			DisplayMessage += TEXT("After Renovation: No data\n\n");
+			UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🧩 VIEWPORT: %d chunks in view, loading the nearest %d (MaxCachedChunks)"), WantedChunks.Num(), ChunkCache.MaxChunks);
+			bChunkLimitWarned = true;
 		}
-		
-		// Energy Demand Specific Section
-		DisplayMessage += TEXT("Energy Demand Specific [kWh/m²a]\n");
-		
-		// Before Renovation Energy Demand Specific
-		if (BeginEnergySpecific.IsValid() && BeginEnergySpecific->HasField(TEXT("value")))
+		WantedChunks.SetNum(ChunkCache.MaxChunks);
+	}
+
+	// Touch from the rim inwards so the chunks under the camera are the most recently used
+	for (int32 Index = WantedChunks.Num() - 1; Index >= 0; --Index)
+	{
+		const FBuildingChunkKey& Key = WantedChunks[Index];
+		if (ChunkCache.Contains(Key))
 		{
-			TSharedPtr<FJsonValue> BeginSpecificJson = BeginEnergySpecific->TryGetField(TEXT("value"));
-			if (BeginSpecificJson.IsValid() && BeginSpecificJson->Type != EJson::Null)
-			{
-				int32 BeginSpecificValue = BeginEnergySpecific->GetIntegerField(TEXT("value"));
-				DisplayMessage += FString::Printf(TEXT("Before Renovation: %d\n"), BeginSpecificValue);
-				UE_LOG(LogTemp, Warning, TEXT("✅ Building %s: BeginEnergySpecific = %d"), *BuildingGmlId, BeginSpecificValue);
-			}
-			else
-			{
-				DisplayMessage += TEXT("Before Renovation: No data\n");
-				UE_LOG(LogTemp, Warning, TEXT("❌ Building %s: BeginEnergySpecific value field is null"), *BuildingGmlId);
-			}
+			ChunkCache.Touch(Key);
 		}
-		else
+	}
+	for (const FBuildingChunkKey& Key : WantedChunks)
+	{
+		if (!ChunkCache.Contains(Key) && !PendingChunks.Contains(Key))
 		{
-			DisplayMessage += TEXT("Before Renovation: No data\n");
-			UE_LOG(LogTemp, Warning, TEXT("❌ Building %s: BeginEnergySpecific object missing or no 'value' field"), *BuildingGmlId);
+			RequestChunk(Key);
 		}
-		
-		// After Renovation Energy Demand Specific
-		if (EndEnergySpecific.IsValid() && EndEnergySpecific->HasField(TEXT("value")))
+	}
+
+	if (bChunkStoreDirty)
+	{
+		bChunkStoreDirty = false;
+		RebuildChunkStore();
+	}
+}
+
+void ABuildingEnergyDisplay::RequestChunk(const FBuildingChunkKey& Key)
+{
+	double West, South, East, North;
+	Key.GetBounds(West, South, East, North);
+
+	FString URL = FString::Printf(TEXT("%s/geospatial/buildings-energy/?format=json&include_colors=true&energy_type=total&time_period=annual&classification=co2&color_scheme=co2_classes&%s=%.7f,%.7f,%.7f,%.7f"),
+		*UBuildingEnergyApiSubsystem::GetApiBaseUrl(), *ChunkBoundsQueryParameter, West, South, East, North);
+	if (CommunityIds.Num() == 1) // Several communities share the bounding box filter instead
+	{
+		URL += FString::Printf(TEXT("&community_id=%s"), *FGenericPlatformHttp::UrlEncode(CommunityIds[0]));
+	}
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetURL(URL);
+	HttpRequest->SetVerb(TEXT("GET"));
+	HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
+	HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *AccessToken));
+	HttpRequest->SetTimeout(30.0f);
+
+	PendingChunks.Add(Key);
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🧩 VIEWPORT: Requesting chunk %s"), *Key.ToString());
+
+	// The camera is waiting on these, so they go ahead of background polls
+	UBuildingEnergyApiSubsystem::Send(this, HttpRequest,
+		FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnChunkResponse, Key), EBuildingApiPriority::UserInitiated);
+}
+
+void ABuildingEnergyDisplay::OnChunkResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FBuildingChunkKey Key)
+{
+	if (!bWasSuccessful || !Response.IsValid() || Response->GetResponseCode() != EHttpResponseCodes::Ok)
+	{
+		PendingChunks.Remove(Key); // Requested again by the next viewport update while still in view
+		UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("🧩 VIEWPORT: Chunk %s failed (code %d)"), *Key.ToString(), Response.IsValid() ? Response->GetResponseCode() : 0);
+		return;
+	}
+
+	// Parse the UTF-8 body into records on a worker; the cache keeps them for store rebuilds
+	TWeakObjectPtr<ABuildingEnergyDisplay> WeakThis(this);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Key, Response]()
+	{
+		BUILDING_ENERGY_SCOPE(Ingest);
+		TSharedRef<FBuildingChunkCache::FRecords> Records = MakeShared<FBuildingChunkCache::FRecords>();
+		FString ParseError;
+		const bool bParsed = FBuildingEnergyStreamReader::ReadBuildings(Response->GetContent(), [&Records](FBuildingEnergyRecord& Record)
 		{
-			TSharedPtr<FJsonValue> EndSpecificJson = EndEnergySpecific->TryGetField(TEXT("value"));
-			if (EndSpecificJson.IsValid() && EndSpecificJson->Type != EJson::Null)
+			Records->Add(MoveTemp(Record));
+		}, &ParseError);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Key, Records, bParsed, ParseError]()
+		{
+			ABuildingEnergyDisplay* This = WeakThis.Get();
+			if (!This)
 			{
-				int32 EndSpecificValue = EndEnergySpecific->GetIntegerField(TEXT("value"));
-				DisplayMessage += FString::Printf(TEXT("After Renovation: %d"), EndSpecificValue);
+				return;
 			}
-			else
+			This->PendingChunks.Remove(Key);
+			if (!bParsed)
 			{
-				DisplayMessage += TEXT("After Renovation: No data");
+				UE_LOG(LogBuildingEnergyIngest, Error, TEXT("🧩 VIEWPORT: Failed to parse chunk %s: %s"), *Key.ToString(), *ParseError);
+				return;
 			}
-		}
-		else
-		{
-			DisplayMessage += TEXT("After Renovation: No data");
-		}
-		
-		// === CASE-SENSITIVE CACHE TRACKING ===
-		// ALWAYS cache building data from API, maintaining exact case sensitivity
-		// CRITICAL: gml_id and modified_gml_id fields are case-sensitive ('G' != 'g')
-		// Store with exact case from API response - no case conversion allowed
-		BuildingDataCache.Add(BuildingGmlId, DisplayMessage);
-		
-		// NEW: Also cache the full JSON object for later color extraction
-		BuildingJsonCache.Add(BuildingGmlId, BuildingObject);
-		UE_LOG(LogTemp, Warning, TEXT("✅ CACHE: Stored JSON object for %s"), *BuildingGmlId);
-		
-		// === COORDINATE CACHING FOR POSITION VALIDATION ===
-		// Extract and cache building coordinates for position validation
-		// Use a unique cache key when the JSON provides a numeric 'id' so duplicate gml_ids with
-		// different geometries are preserved. We still keep BuildingDataCache/BuildingColorCache
-		// keyed by the base GML id for lookups and coloring.
-		FString UniqueCacheKey = BuildingGmlId;
-		if (BuildingObject->HasField(TEXT("id")))
-		{
-			// Use integer id when available to create a unique key
-			double NumericIdD = 0.0;
-			if (BuildingObject->TryGetNumberField(TEXT("id"), NumericIdD))
+			if (!This->bLoadByViewport)
 			{
-				int32 NumericId = (int32)NumericIdD;
-				UniqueCacheKey = FString::Printf(TEXT("%s#%d"), *BuildingGmlId, NumericId);
+				return;
 			}
-		}
 
-		if (BuildingObject->HasField(TEXT("coordinates")))
-		{
-			FString CoordinatesData = BuildingObject->GetStringField(TEXT("coordinates"));
-			StoreBuildingCoordinates(UniqueCacheKey, CoordinatesData);
-		}
-		else if (BuildingObject->HasField(TEXT("geom")))
+			const int32 NumEvicted = This->ChunkCache.Add(Key, Records);
+			This->bChunkStoreDirty = true; // Rebuilt by the next viewport update, together with other arrivals
+			This->UpdateMemoryStats();
+			UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🧩 VIEWPORT: Cached chunk %s (%d buildings), %d chunks / %.1f MB resident, %d evicted"),
+				*Key.ToString(), Records->Num(), This->ChunkCache.Num(), This->ChunkCache.GetAllocatedSize() / (1024.0 * 1024.0), NumEvicted);
+		});
+	});
+}
+
+void ABuildingEnergyDisplay::RebuildChunkStore()
+{
+	TArray<TSharedRef<const FBuildingChunkCache::FRecords>> Chunks;
+	ChunkCache.GetResident(Chunks);
+
+	const uint32 Generation = ++IngestGeneration;
+	TWeakObjectPtr<ABuildingEnergyDisplay> WeakThis(this);
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Generation, Chunks = MoveTemp(Chunks)]()
+	{
+		BUILDING_ENERGY_SCOPE(Merge);
+		TSharedRef<FBuildingIngestResult> Result = MakeShared<FBuildingIngestResult>();
+		Result->bParsed = true;
+
+		// Buildings crossing a chunk edge come back with both chunks; keep the records of the first one
+		TMap<FString, int32> ChunkOfBuilding;
+		for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
 		{
-			TSharedPtr<FJsonObject> GeomObject = BuildingObject->GetObjectField(TEXT("geom"));
-			if (GeomObject.IsValid())
+			for (const FBuildingEnergyRecord& Record : *Chunks[ChunkIndex])
 			{
-				FString GeomString;
-				TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&GeomString);
-				FJsonSerializer::Serialize(GeomObject.ToSharedRef(), Writer);
-				StoreBuildingCoordinates(UniqueCacheKey, GeomString);
+				if (ChunkOfBuilding.FindOrAdd(Record.ModifiedGmlId, ChunkIndex) != ChunkIndex)
+				{
+					continue;
+				}
+				if (CacheBuildingRecord(Result->Store, Record))
+				{
+					Result->BuildingCount++;
+				}
 			}
 		}
-		else if (BuildingObject->HasField(TEXT("position")))
-		{
-			FString PositionData = BuildingObject->GetStringField(TEXT("position"));
-			StoreBuildingCoordinates(UniqueCacheKey, PositionData);
-		}
-		
-		UE_LOG(LogTemp, Warning, TEXT("📁 CACHED [%d]: %s"), BuildingCount, *BuildingGmlId);
-		
-		// Also cache the gml_id mapping for lookup with CASE TRACKING
-		if (!ActualGmlId.IsEmpty() && !ActualGmlId.Equals(BuildingGmlId))
+		Result->Store.FinalizeGeometry();
+		Result->Store.FinalizeIdIndex();
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Result]()
 		{
-			BuildingDataCache.Add(ActualGmlId, DisplayMessage);
-			BuildingJsonCache.Add(ActualGmlId, BuildingObject);  // NEW: Also cache JSON for actual gml_id
+			ABuildingEnergyDisplay* This = WeakThis.Get();
+			if (!This || Generation != This->IngestGeneration)
+			{
+				return;
+			}
+			This->PublishBuildingStore(MoveTemp(Result.Get()));
 
-			// For coordinate lookup convenience, build a combined coordinate set for the alternate id
-			TArray<FVector> CombinedCoords;
-			for (const auto& Entry : BuildingCoordinatesCache)
+			// The chunk records predate every poll and push patch the old store had taken, and a delta
+			// cursor would never resend those changes: fetch every community in full once more
+			This->NumChunkStoreRebuilds++;
+			for (const FString& CommunityId : This->CommunityIds)
 			{
-				if (Entry.Key.StartsWith(BuildingGmlId))
-				{
-					CombinedCoords.Append(Entry.Value);
-				}
+				This->ResetDeltaSync(CommunityId, TEXT("viewport store rebuilt from cached chunks"));
+				This->FullResyncCommunities.Add(CommunityId);
 			}
-			if (CombinedCoords.Num() > 0)
+
+			// The color lookup follows the new building set
+			if (This->bEnableCesiumPerFeatureStyling)
 			{
-				BuildingCoordinatesCache.Add(ActualGmlId, CombinedCoords);
+				This->ApplyColorsToCSiumTileset();
 			}
+		});
+	});
+}
+
+void ABuildingEnergyDisplay::PublishBuildingStore(FBuildingIngestResult&& Result)
+{
+	BUILDING_ENERGY_SCOPE(Publish);
+	check(IsInGameThread());
 
-			UE_LOG(LogTemp, Warning, TEXT("🔄 CASE MAPPING: '%s' -> '%s'"), *BuildingGmlId, *ActualGmlId);
+	const int32 BuildingCount = Result.BuildingCount;
+
+	if (!Result.bParsed) // Stop on malformed JSON; buildings read before the error are still published [JSON PARSE ERROR CHECK]
+	{ // Start of JSON parse error block [JSON PARSE ERROR BLOCK START]
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("❌ PARSING: Failed to stream building data JSON after %d buildings: %s"), BuildingCount, *Result.ParseError);
+		if (GEngine) // Check if global engine instance is available [ENGINE INSTANCE CHECK FOR JSON ERROR]
+		{ // Start of engine JSON error display block [ENGINE JSON ERROR DISPLAY BLOCK START]
+			GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Red, 
+				TEXT("ERROR: Failed to parse building data JSON")); // Display JSON parse error on screen [DISPLAY JSON PARSE ERROR]
+		} // End of engine JSON error display block [ENGINE JSON ERROR DISPLAY BLOCK END]
+		if (BuildingCount == 0)
+		{
+			bIsLoading = false;
+			return; // Exit method early due to JSON parse failure [EARLY RETURN ON JSON ERROR]
 		}
-		BuildingCount++;
+	} // End of JSON parse error block [JSON PARSE ERROR BLOCK END]
+
+	// Revalidation brought back exactly what is on screen (usually the warm start snapshot): keep it
+	const bool bUnchanged = !Result.bFromSnapshot && bDataLoaded && Result.ContentHash != 0 &&
+		Result.ContentHash == PublishedContentHash && BuildingStore.GetColorMapHash() == PublishedColorMapHash;
+	if (bUnchanged)
+	{
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("💾 SNAPSHOT: Backend data unchanged (%d buildings) - keeping the loaded store"), BuildingCount);
+		bIsLoading = false;
+		return;
 	}
 
-	// Mark data as loaded
+	if (Result.SnapshotBytes.Num() > 0)
+	{
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, [SnapshotBytes = MoveTemp(Result.SnapshotBytes), SnapshotPath = FBuildingStoreSnapshot::GetSnapshotPath(GetCommunitySetKey())]()
+		{
+			if (!FBuildingStoreSnapshot::SaveToFile(SnapshotBytes, SnapshotPath))
+			{
+				UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("💾 SNAPSHOT: Failed to write %s"), *SnapshotPath);
+			}
+		});
+	}
+
+	// Publish the new store in one step on the game thread, then mark data as loaded.
+	// Queued patches address the old store's indices and are dropped with it
+	BuildingStore = MoveTemp(Result.Store);
+	PendingBuildingPatches.Reset();
+	PendingAppliedIndices.Reset();
+	PublishedContentHash = Result.ContentHash;
+	PublishedColorMapHash = BuildingStore.GetColorMapHash();
+	if (!Result.bFromSnapshot)
+	{
+		bIsLoading = false; // A preload may still be in flight behind the snapshot
+	}
 	bDataLoaded = true;
+	UpdateMemoryStats();
+
+	// Warm start colors the buildings right away instead of waiting for the style retry
+	if (Result.bFromSnapshot && bEnableCesiumPerFeatureStyling)
+	{
+		ApplyColorsToCSiumTileset();
+	}
 
 	// BACKEND VERIFICATION: Confirm data is from real API
-	UE_LOG(LogTemp, Warning, TEXT("🔒 BACKEND VERIFICATION COMPLETE:"));
-	UE_LOG(LogTemp, Warning, TEXT("  ✅ Data Source: https://backend.gisworld-tech.com API"));
-	UE_LOG(LogTemp, Warning, TEXT("  ✅ Authentication: Bearer token verified"));
-	UE_LOG(LogTemp, Warning, TEXT("  ✅ Buildings loaded: %d from live database"), BuildingCount);
-	UE_LOG(LogTemp, Warning, TEXT("  ✅ Cache populated: Real-time building energy data"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔒 BACKEND VERIFICATION COMPLETE:"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("  ✅ Data Source: %s"), Result.bFromSnapshot ? TEXT("warm start snapshot (revalidating against the API)") : *UBuildingEnergyApiSubsystem::GetApiBaseUrl());
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("  ✅ Authentication: Bearer token verified"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("  ✅ Buildings loaded: %d from live database"), BuildingCount);
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("  ✅ Cache populated: Real-time building energy data"));
 	
 	// 🎨 COLOR CACHE STATISTICS (Case-Sensitive Analysis)
-	UE_LOG(LogTemp, Warning, TEXT("🎨 COLOR CACHE ANALYSIS:"));
-	UE_LOG(LogTemp, Warning, TEXT("  📊 BuildingDataCache: %d entries"), BuildingDataCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("  📊 BuildingColorCache: %d entries"), BuildingColorCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("  📊 GmlIdCache: %d mappings"), GmlIdCache.Num());
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 COLOR CACHE ANALYSIS:"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("  📊 BuildingStore: %d buildings (%d with colors, %d palette colors)"), 
+		BuildingStore.Num(), BuildingStore.NumColoredBuildings(), BuildingStore.Palette.Num());
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("  📊 BuildingStore: %d polygons, %d vertices, %.1f MB"), 
+		BuildingStore.GetNumPolygons(), BuildingStore.Vertices.Num(), BuildingStore.GetAllocatedSize() / (1024.0 * 1024.0));
 	
-	// Check for potential duplicate issues
-	if (BuildingColorCache.Num() != BuildingDataCache.Num())
+	// Buildings listed without a full energy result keep their ids but have no color
+	if (BuildingStore.NumColoredBuildings() != BuildingStore.Num())
 	{
-		int32 ColorDiff = FMath::Abs(BuildingColorCache.Num() - BuildingDataCache.Num());
-		UE_LOG(LogTemp, Warning, TEXT("  ⚠️ COLOR CACHE MISMATCH: %d difference between data and color cache"), ColorDiff);
-		UE_LOG(LogTemp, Warning, TEXT("  💡 This suggests some buildings lack color data or have duplicate entries"));
+		int32 ColorDiff = BuildingStore.Num() - BuildingStore.NumColoredBuildings();
+		UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("  ⚠️ COLOR CACHE MISMATCH: %d buildings without energy colors"), ColorDiff);
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("  💡 This suggests some buildings lack energy_result data"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("  ✅ COLOR CACHE MATCH: Data and color cache sizes align"));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("  ✅ COLOR CACHE MATCH: Every building has a color"));
 	}
 	
 	// Log sample color cache entries to verify case sensitivity
-	UE_LOG(LogTemp, Warning, TEXT("🎨 SAMPLE COLOR CACHE ENTRIES (case-sensitive):"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 SAMPLE COLOR CACHE ENTRIES (case-sensitive):"));
 	int32 ColorSampleCount = 0;
-	for (const auto& ColorEntry : BuildingColorCache)
+	for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num() && ColorSampleCount < 5; ++BuildingIndex) // Show first 5 entries
 	{
-		UE_LOG(LogTemp, Warning, TEXT("   %d: '%s' -> R:%.2f G:%.2f B:%.2f"), 
-			ColorSampleCount + 1, *ColorEntry.Key, 
-			ColorEntry.Value.R, ColorEntry.Value.G, ColorEntry.Value.B);
-		if (++ColorSampleCount >= 5) break; // Show first 5 entries
+		if (!BuildingStore.HasColor(BuildingIndex)) continue;
+		const FLinearColor& Color = BuildingStore.GetColor(BuildingIndex);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyIngest, Verbose, TEXT("   %d: '%s' -> R:%.2f G:%.2f B:%.2f"), 
+			ColorSampleCount + 1, *BuildingStore.ModifiedGmlIds[BuildingIndex], 
+			Color.R, Color.G, Color.B);
+		++ColorSampleCount;
 	}
 	
 	// 🧹 AUTOMATIC CACHE CLEANING: Remove any duplicates from case-insensitive era
-	UE_LOG(LogTemp, Warning, TEXT("🧹 Running automatic cache cleaning..."));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🧹 Running automatic cache cleaning..."));
 	CleanDuplicateColorCacheEntries();
 
 	// 🎨 AUTO COLOR APPLICATION: Apply colors immediately when data loads
 	// TEMPORARILY DISABLED - Causing gray overlay on entire scene
-	// UE_LOG(LogTemp, Warning, TEXT("🎨 AUTO-APPLYING COLORS: Starting immediate color application to all buildings..."));
+	// UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("🎨 AUTO-APPLYING COLORS: Starting immediate color application to all buildings..."));
 	
 	// Schedule color application after a short delay to ensure Cesium is ready
 	// DISABLED - This was causing the entire scene to turn gray
@@ -1347,14 +1803,14 @@ void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(const FString& JsonRespon
 	FTimerHandle DataLoadColorTimer;
 	GetWorld()->GetTimerManager().SetTimer(DataLoadColorTimer, [this]()
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 EXECUTING: Automatic color application post data load"));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 EXECUTING: Automatic color application post data load"));
 		ApplyColorsDirectlyToGeometry();
 		
 		// Try multiple approaches to ensure colors are applied
 		ApplyColorsToCSiumTileset();
 		ForceApplyColors();
 		
-		UE_LOG(LogTemp, Warning, TEXT("🎨 AUTO-APPLICATION COMPLETE: All color methods executed"));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 AUTO-APPLICATION COMPLETE: All color methods executed"));
 	}, 2.0f, false); // 2 second delay to let Cesium initialize
 	*/
 
@@ -1363,51 +1819,40 @@ void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(const FString& JsonRespon
 	// DISABLED for single building display: GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Green, FString::Printf(TEXT("🌐 BACKEND DATA LOADED ✓ %d buildings from live API! Click any building to see instant results."), BuildingCount));
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Successfully cached %d buildings"), BuildingCount);
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Successfully cached %d buildings"), BuildingCount);
 	
 	// 🎨 COLOR CACHE SUMMARY
-	UE_LOG(LogTemp, Warning, TEXT("🎨 ===== COLOR CACHE SUMMARY ====="));
-	UE_LOG(LogTemp, Warning, TEXT("🎨 BuildingColorCache contains %d entries:"), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 ===== COLOR CACHE SUMMARY ====="));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 BuildingStore contains %d colored buildings:"), BuildingStore.NumColoredBuildings());
 	
 	int32 ColorIndex = 0;
-	for (const auto& ColorEntry : BuildingColorCache)
+	for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
 	{
-		FString GmlId = ColorEntry.Key;
-		FLinearColor Color = ColorEntry.Value;
+		if (!BuildingStore.HasColor(BuildingIndex)) continue;
+		const FLinearColor& Color = BuildingStore.GetColor(BuildingIndex);
 		
-		// Convert back to hex for display
-		FColor SRGBColor = Color.ToFColor(true);
-		FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-		
-		UE_LOG(LogTemp, Warning, TEXT("🎨   [%d] %s -> %s (R:%.3f G:%.3f B:%.3f)"), 
-			ColorIndex++, *GmlId, *HexColor, Color.R, Color.G, Color.B);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyIngest, Verbose, TEXT("🎨   [%d] %s -> %s (R:%.3f G:%.3f B:%.3f)"), 
+			ColorIndex, *BuildingStore.ModifiedGmlIds[BuildingIndex], *BuildingStore.GetColorHex(BuildingIndex), Color.R, Color.G, Color.B);
+		ColorIndex++;
 		
 		// Log first 5 entries in detail, then summary for rest
-		if (ColorIndex >= 5 && BuildingColorCache.Num() > 10)
+		if (ColorIndex >= 5 && BuildingStore.NumColoredBuildings() > 10)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🎨   ... and %d more entries"), BuildingColorCache.Num() - ColorIndex);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyIngest, Verbose, TEXT("🎨   ... and %d more entries"), BuildingStore.NumColoredBuildings() - ColorIndex);
 			break;
 		}
 	}
-	UE_LOG(LogTemp, Warning, TEXT("🎨 ================================"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 ================================"));
 	
 	// Note: Color application will be triggered separately when needed
-	if (BuildingColorCache.Num() > 0)
+	if (BuildingStore.NumColoredBuildings() > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 Color cache populated with %d entries - ready for application"), BuildingColorCache.Num());
-		
-		// RESET PRELOAD FLAG: Allow future manual loading calls
-		static bool* PreloadFlag = []() -> bool* {
-			static bool bPreloadInProgress = false;
-			return &bPreloadInProgress;
-		}();
-		*PreloadFlag = false;
-		UE_LOG(LogTemp, Warning, TEXT("✅ PRELOAD FLAG RESET: Future data loading calls are now allowed"));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 Color cache populated with %d entries - ready for application"), BuildingStore.NumColoredBuildings());
 		
 		// 🛑 AUTOMATIC COLOR APPLICATION DISABLED  
 		// Prevents tile streaming from triggering repeated material creation
-		UE_LOG(LogTemp, Warning, TEXT("🛑 AUTO-APPLY DISABLED: Use ForceColorsNow() or ApplyColorsNow() manually"));
-		UE_LOG(LogTemp, Warning, TEXT("💡 This prevents %d building colors from creating materials on every tile stream"), BuildingColorCache.Num());
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🛑 AUTO-APPLY DISABLED: Use ForceColorsNow() or ApplyColorsNow() manually"));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("💡 This prevents %d building colors from creating materials on every tile stream"), BuildingStore.NumColoredBuildings());
 		
 		if (GEngine)
 		{
@@ -1426,41 +1871,26 @@ void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(const FString& JsonRespon
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 ERROR: No colors were cached! Color application will fail."));
+		UE_LOG(LogBuildingEnergyIngest, Error, TEXT("🎨 ERROR: No colors were cached! Color application will fail."));
 	}
 	
-	// Check for color variety in the dataset
-	TMap<FString, int32> ColorCounts;
-	for (const auto& BuildingColor : BuildingColorCache)
-	{
-		FLinearColor Color = BuildingColor.Value;
-		FColor SRGBColor = Color.ToFColor(true);
-		FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-		
-		if (ColorCounts.Contains(HexColor))
-		{
-			ColorCounts[HexColor]++;
-		}
-		else
-		{
-			ColorCounts.Add(HexColor, 1);
-		}
-	}
+	// Check for color variety in the dataset: one counter per palette class
+	const TArray<int32> ColorCounts = BuildingStore.CountBuildingsPerColorClass();
 	
-	UE_LOG(LogTemp, Warning, TEXT("STATS Color variety analysis:"));
-	for (const auto& ColorCount : ColorCounts)
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("STATS Color variety analysis:"));
+	for (int32 ColorClass = 0; ColorClass < ColorCounts.Num(); ++ColorClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("  Color %s: %d buildings"), *ColorCount.Key, ColorCount.Value);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyIngest, Verbose, TEXT("  Color %s: %d buildings"), *BuildingStore.PaletteHex[ColorClass], ColorCounts[ColorClass]);
 	}
 	
 	// If mostly gray colors, still proceed — apply real API colors (including #808080)
-	if (ColorCounts.Num() <= 2 && ColorCounts.Contains(TEXT("#808080")))
+	if (ColorCounts.Num() <= 2 && BuildingStore.PaletteHex.Contains(TEXT("#808080")))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("NOTICE Most buildings are gray (#808080). Using API colors as-is (no test colors)."));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("NOTICE Most buildings are gray (#808080). Using API colors as-is (no test colors)."));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🌈 Found %d different colors in API data."), ColorCounts.Num());
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🌈 Found %d different colors in API data."), ColorCounts.Num());
 	}
 	
 	// Create and apply dynamic material to Cesium tileset
@@ -1469,15 +1899,15 @@ void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(const FString& JsonRespon
 	{
 		CreateBuildingEnergyMaterial();
 		bMaterialCreated = true;
-		UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL: Created for first instance only"));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 MATERIAL: Created for first instance only"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL: Reusing existing material from first instance"));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🎨 MATERIAL: Reusing existing material from first instance"));
 	}
 	
 	// Always attempt to apply colors (apply defaults as well) — schedule after material creation
-	UE_LOG(LogTemp, Warning, TEXT("COLOR Scheduling per-building color application (including default colors)..."));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("COLOR Scheduling per-building color application (including default colors)..."));
 	FTimerHandle ColorApplicationTimer;
 	GetWorld()->GetTimerManager().SetTimer(ColorApplicationTimer, [this]()
 	{
@@ -1485,44 +1915,139 @@ void ABuildingEnergyDisplay::ParseAndCacheAllBuildings(const FString& JsonRespon
 	}, 1.0f, false);
 	
 	// Debug: Log first 10 building IDs to help with matching issues
-	UE_LOG(LogTemp, Warning, TEXT("LIST First 10 cached building IDs for reference:"));
-	int32 DebugCount = 0;
-	for (auto& Elem : BuildingDataCache)
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("LIST First 10 cached building IDs for reference:"));
+	for (int32 BuildingIndex = 0; BuildingIndex < FMath::Min(BuildingStore.Num(), 10); ++BuildingIndex)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("  %d: %s"), DebugCount + 1, *Elem.Key);
-		if (++DebugCount >= 10) break;
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyIngest, Verbose, TEXT("  %d: %s"), BuildingIndex + 1, *BuildingStore.ModifiedGmlIds[BuildingIndex]);
+	}
+
+	// If there's a currently displayed building, refresh it from the published store
+	if (!CurrentlyDisplayedBuildingId.IsEmpty())
+	{
+		const int32 DisplayedIndex = BuildingStore.FindIndex(CurrentlyDisplayedBuildingId);
+		if (DisplayedIndex != INDEX_NONE && BuildingStore.HasDisplayText(DisplayedIndex))
+		{
+			ShowBuildingInfoWidget(CurrentlyDisplayedBuildingId, BuildingStore.GetDisplayText(DisplayedIndex));
+			UE_LOG(LogBuildingEnergyIngest, Log, TEXT("✅ INGEST: Display refreshed for %s"), *CurrentlyDisplayedBuildingId);
+		}
 	}
 }
 
+bool ABuildingEnergyDisplay::CacheBuildingRecord(FBuildingStore& Store, const FBuildingEnergyRecord& Record)
+{
+	// Runs on the ingest worker: touch only Store and static helpers here
+	// CASE SENSITIVE: ids are stored exactly as received ('G' != 'g')
+	const FString& BuildingGmlId = Record.ModifiedGmlId;
+
+	// CRUCIAL: Both ids resolve to one building index; an empty gml_id (with L) is derived from modified_gml_id
+	const int32 BuildingIndex = Store.FindOrAddBuilding(BuildingGmlId, Record.ActualGmlId);
+	Store.Fingerprints[BuildingIndex] = Record.ComputeFingerprint(); // Lets real-time polls skip unchanged records, skipped ones included
+	if (Record.NumericId.IsSet())
+	{
+		Store.AddFeatureId(Record.NumericId.GetValue(), BuildingIndex); // The tileset's feature key of this geometry
+	}
+
+	FBuildingPatch Patch;
+	if (!MakeBuildingPatch(Store, BuildingIndex, Record, Patch))
+	{
+		// Per record: counted in the page summary instead of logged in production
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyIngest, Verbose, TEXT("❌ Building %s: No valid energy_result/begin/end structure - SKIPPING"), *BuildingGmlId);
+		return false;
+	}
+	FBuildingPatchCodec::Apply(Patch, Store);
+
+	// === COORDINATE CACHING FOR POSITION VALIDATION ===
+	// Records sharing a gml_id (different numeric 'id') add their geometry to the same building
+	if (!Record.CoordinatesText.IsEmpty())
+	{
+		TArray<FVector> ParsedCoordinates;
+		if (ParseBuildingCoordinates(Record.CoordinatesText, ParsedCoordinates))
+		{
+			Store.AddPolygon(BuildingIndex, ParsedCoordinates);
+		}
+	}
+	else if (Record.Coordinates.Num() > 0)
+	{
+		// One polygon per ring read from the GeoJSON arrays
+		int32 RingStart = 0;
+		for (const int32 RingEnd : Record.RingEnds)
+		{
+			Store.AddPolygon(BuildingIndex, MakeArrayView(Record.Coordinates.GetData() + RingStart, RingEnd - RingStart));
+			RingStart = RingEnd;
+		}
+		if (RingStart < Record.Coordinates.Num())
+		{
+			Store.AddPolygon(BuildingIndex, MakeArrayView(Record.Coordinates.GetData() + RingStart, Record.Coordinates.Num() - RingStart));
+		}
+	}
+
+	UE_LOG(LogBuildingEnergyIngest, Verbose, TEXT("📁 CACHED: %s -> %s (color %s)"), *BuildingGmlId, *Store.ActualGmlIds[BuildingIndex], *Store.GetColorHex(BuildingIndex));
+	return true;
+}
+
+bool ABuildingEnergyDisplay::MakeBuildingPatch(FBuildingStore& Store, int32 BuildingIndex, const FBuildingEnergyRecord& Record, FBuildingPatch& OutPatch, bool bFallbackColor)
+{
+	if (!Record.bHasEnergyResult || !Record.bHasBegin || !Record.bHasEnd)
+	{
+		return false;
+	}
+
+	OutPatch.BuildingIndex = BuildingIndex;
+	OutPatch.Fields = EBuildingPatchField::EnergyValues;
+	OutPatch.Values[0] = Record.Begin.CO2FromEnergyDemand.Get(FBuildingStore::MissingValue);
+	OutPatch.Values[1] = Record.End.CO2FromEnergyDemand.Get(FBuildingStore::MissingValue);
+	OutPatch.Values[2] = Record.Begin.EnergyDemandSpecific.Get(FBuildingStore::MissingValue);
+	OutPatch.Values[3] = Record.End.EnergyDemandSpecific.Get(FBuildingStore::MissingValue);
+	if (Record.End.EnergyDemandSpecificColor.IsEmpty() && !bFallbackColor)
+	{
+		return true; // No color in the response says nothing about the color, keep the current one
+	}
+
+	// --- CESIUM MATERIAL COLORING LOGIC ---
+	// Color comes from "end" (after renovation); #66b032 is the fallback
+	const FString EndColorHex = Record.End.EnergyDemandSpecificColor.IsEmpty() ? FString(TEXT("#66b032")) : Record.End.EnergyDemandSpecificColor;
+	int32 ColorClass = Store.FindColorClassByHex(EndColorHex);
+	if (ColorClass == INDEX_NONE)
+	{
+		ColorClass = Store.AddColorClassForHex(EndColorHex, ConvertHexToLinearColor(EndColorHex)); // Convert each distinct API color once
+	}
+	OutPatch.Fields |= EBuildingPatchField::ColorClass;
+	OutPatch.ColorClass = static_cast<uint16>(ColorClass);
+	return true;
+}
+
+bool ABuildingEnergyDisplay::PatchChangesStore(const FBuildingStore& Store, const FBuildingPatch& Patch)
+{
+	if (!Store.IsValidIndex(Patch.BuildingIndex))
+	{
+		return false;
+	}
+	const int32 Index = Patch.BuildingIndex;
+	return !Store.HasEnergyData[Index]
+		|| (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::BeginCO2) && Store.BeginCO2[Index] != Patch.Values[0])
+		|| (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::EndCO2) && Store.EndCO2[Index] != Patch.Values[1])
+		|| (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::BeginSpecificDemand) && Store.BeginSpecificDemand[Index] != Patch.Values[2])
+		|| (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::EndSpecificDemand) && Store.EndSpecificDemand[Index] != Patch.Values[3])
+		|| (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::ColorClass) && Store.ColorClasses[Index] != Patch.ColorClass);
+}
+
 // 🔍 BLUEPRINT CALLABLE: Debug Cesium property mapping between gml:id and modified_gml_id
 void ABuildingEnergyDisplay::DebugCesiumPropertyMapping()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔍 CESIUM DEBUG: Starting comprehensive property mapping analysis..."));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 CESIUM DEBUG: Starting comprehensive property mapping analysis..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 No building colors cached! Run API fetch first."));
+		UE_LOG(LogBuildingEnergy, Error, TEXT("🚨 No building colors cached! Run API fetch first."));
 		return;
 	}
 	
 	// Find Cesium tileset actor
-	AActor* TilesetActor = nullptr;
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), AllActors);
-	
-	for (AActor* Actor : AllActors)
-	{
-		if (Actor && Actor->GetClass()->GetName().Contains(TEXT("Cesium3DTileset")))
-		{
-			TilesetActor = Actor;
-			UE_LOG(LogTemp, Warning, TEXT("🎯 FOUND Cesium3DTileset: %s"), *Actor->GetName());
-			break;
-		}
-	}
+	AActor* TilesetActor = GetBuildingsTileset();
 	
 	if (!TilesetActor)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 No Cesium3DTileset actor found!"));
+		UE_LOG(LogBuildingEnergy, Error, TEXT("🚨 No Cesium3DTileset actor found!"));
 		return;
 	}
 	
@@ -1536,14 +2061,14 @@ void ABuildingEnergyDisplay::DebugCesiumPropertyMapping()
 		if (Component && Component->GetClass()->GetName().Contains(TEXT("CesiumFeaturesMetadata")))
 		{
 			MetadataComponent = Component;
-			UE_LOG(LogTemp, Warning, TEXT("🎯 FOUND CesiumFeaturesMetadataComponent"));
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("🎯 FOUND CesiumFeaturesMetadataComponent"));
 			break;
 		}
 	}
 	
 	if (MetadataComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("📋 CESIUM METADATA ANALYSIS:"));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("📋 CESIUM METADATA ANALYSIS:"));
 		UClass* MetadataClass = MetadataComponent->GetClass();
 		
 		for (TFieldIterator<FProperty> PropIt(MetadataClass); PropIt; ++PropIt)
@@ -1552,21 +2077,21 @@ void ABuildingEnergyDisplay::DebugCesiumPropertyMapping()
 			FString PropName = Property->GetName();
 			FString PropType = Property->GetClass()->GetName();
 			
-			UE_LOG(LogTemp, Warning, TEXT("   🏷️ Property: %s (Type: %s)"), *PropName, *PropType);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("   🏷️ Property: %s (Type: %s)"), *PropName, *PropType);
 			
 			if (PropName.Contains(TEXT("Description")))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("      🎯 METADATA DESCRIPTION PROPERTY FOUND!"));
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("      🎯 METADATA DESCRIPTION PROPERTY FOUND!"));
 			}
 		}
 	}
 	
 	// MATERIAL ANALYSIS: Check what materials are currently on the tileset
-	UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL ANALYSIS:"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🎨 MATERIAL ANALYSIS:"));
 	TArray<UMeshComponent*> MeshComponents;
 	TilesetActor->GetComponents<UMeshComponent>(MeshComponents);
 	
-	UE_LOG(LogTemp, Warning, TEXT("   Found %d mesh components"), MeshComponents.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT("   Found %d mesh components"), MeshComponents.Num());
 	
 	for (int32 i = 0; i < FMath::Min(MeshComponents.Num(), 5); ++i) // Analyze first 5 components
 	{
@@ -1575,7 +2100,7 @@ void ABuildingEnergyDisplay::DebugCesiumPropertyMapping()
 			FString ComponentName = StaticMeshComp->GetName();
 			int32 NumMaterials = StaticMeshComp->GetNumMaterials();
 			
-			UE_LOG(LogTemp, Warning, TEXT("   Component[%d]: %s (%d materials)"), i, *ComponentName, NumMaterials);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("   Component[%d]: %s (%d materials)"), i, *ComponentName, NumMaterials);
 			
 			for (int32 MatIdx = 0; MatIdx < NumMaterials; ++MatIdx)
 			{
@@ -1583,45 +2108,35 @@ void ABuildingEnergyDisplay::DebugCesiumPropertyMapping()
 				if (Material)
 				{
 					bool bIsDynamic = Cast<UMaterialInstanceDynamic>(Material) != nullptr;
-					UE_LOG(LogTemp, Warning, TEXT("     Material[%d]: %s (Dynamic: %s)"), 
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("     Material[%d]: %s (Dynamic: %s)"), 
 						MatIdx, *Material->GetName(), bIsDynamic ? TEXT("YES") : TEXT("NO"));
 				}
 				else
 				{
-					UE_LOG(LogTemp, Warning, TEXT("     Material[%d]: NULL"), MatIdx);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("     Material[%d]: NULL"), MatIdx);
 				}
 			}
 		}
 	}
-	
-	// Show cached building samples for debugging
-	UE_LOG(LogTemp, Warning, TEXT("📊 CACHE ANALYSIS: %d buildings cached with modified_gml_id keys"), BuildingColorCache.Num());
-	
-	int32 SampleCount = 0;
-	for (const auto& CacheEntry : BuildingColorCache)
-	{
-		if (SampleCount < 10) // Show first 10 for debugging
-		{
-			FString CachedModifiedGmlId = CacheEntry.Key;
-			
-			// Try to convert modified_gml_id to potential gml:id format
-			FString PotentialGmlId = CachedModifiedGmlId;
-			PotentialGmlId = PotentialGmlId.Replace(TEXT("_"), TEXT("L"));
-			
-			UE_LOG(LogTemp, Warning, TEXT("   [%d] Cache: %s -> Potential gml:id: %s"), 
-				SampleCount + 1, *CachedModifiedGmlId, *PotentialGmlId);
-		}
-		SampleCount++;
+	
+	// Show cached building samples for debugging
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊 CACHE ANALYSIS: %d buildings cached with modified_gml_id keys"), BuildingStore.NumColoredBuildings());
+	
+	for (int32 BuildingIndex = 0; BuildingIndex < FMath::Min(BuildingStore.Num(), 10); ++BuildingIndex) // Show first 10 for debugging
+	{
+		// The store keeps the gml:id (with L) next to each modified_gml_id
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("   [%d] Cache: %s -> gml:id: %s"), 
+			BuildingIndex + 1, *BuildingStore.ModifiedGmlIds[BuildingIndex], *BuildingStore.ActualGmlIds[BuildingIndex]);
 	}
 	
 	// Apply colors for immediate visual feedback
-	UE_LOG(LogTemp, Warning, TEXT("🎨 APPLYING COLORS: Using current cached data..."));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🎨 APPLYING COLORS: Using current cached data..."));
 	ApplyColorsDirectlyToGeometry();
 	
 	if (GEngine)
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Yellow, 
-			FString::Printf(TEXT("🔍 CESIUM DEBUG: Analyzed %d cached buildings. Check logs for property mapping details."), BuildingColorCache.Num()));
+			FString::Printf(TEXT("🔍 CESIUM DEBUG: Analyzed %d cached buildings. Check logs for property mapping details."), BuildingStore.NumColoredBuildings()));
 	}
 }
 
@@ -1630,14 +2145,14 @@ UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateOrGetDynamicMaterial(USt
 {
 	if (!MeshComp)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 CreateOrGetDynamicMaterial: Null mesh component"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🚨 CreateOrGetDynamicMaterial: Null mesh component"));
 		return nullptr;
 	}
 	
 	UMaterialInterface* CurrentMaterial = MeshComp->GetMaterial(MaterialIndex);
 	if (!CurrentMaterial)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔧 Material %d is null, cannot create dynamic material"), MaterialIndex);
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🔧 Material %d is null, cannot create dynamic material"), MaterialIndex);
 		return nullptr;
 	}
 	
@@ -1645,7 +2160,7 @@ UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateOrGetDynamicMaterial(USt
 	UMaterialInstanceDynamic* ExistingDynMat = Cast<UMaterialInstanceDynamic>(CurrentMaterial);
 	if (ExistingDynMat)
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("🔧 Reusing existing dynamic material %d"), MaterialIndex);
+		UE_LOG(LogBuildingEnergyStyle, Verbose, TEXT("🔧 Reusing existing dynamic material %d"), MaterialIndex);
 		return ExistingDynMat;
 	}
 	
@@ -1654,7 +2169,7 @@ UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateOrGetDynamicMaterial(USt
 	if (NewDynMat)
 	{
 		MeshComp->SetMaterial(MaterialIndex, NewDynMat);
-		UE_LOG(LogTemp, Warning, TEXT("🔧 Created new dynamic material %d: %s"), MaterialIndex, *NewDynMat->GetName());
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔧 Created new dynamic material %d: %s"), MaterialIndex, *NewDynMat->GetName());
 		
 		// Ensure it has the parameters we need
 		EnsureProperMaterialParameters(NewDynMat);
@@ -1663,7 +2178,7 @@ UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateOrGetDynamicMaterial(USt
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 Failed to create dynamic material %d"), MaterialIndex);
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🚨 Failed to create dynamic material %d"), MaterialIndex);
 		return nullptr;
 	}
 }
@@ -1686,17 +2201,17 @@ void ABuildingEnergyDisplay::EnsureProperMaterialParameters(UMaterialInstanceDyn
 	DynMaterial->SetScalarParameterValue(TEXT("Metallic"), 0.0f);
 	DynMaterial->SetScalarParameterValue(TEXT("Roughness"), 0.5f);
 	
-	UE_LOG(LogTemp, Verbose, TEXT("🔧 Set default material parameters for %s"), *DynMaterial->GetName());
+	UE_LOG(LogBuildingEnergyStyle, Verbose, TEXT("🔧 Set default material parameters for %s"), *DynMaterial->GetName());
 }
 
 // 🎨 BLUEPRINT CALLABLE: Apply colors to buildings immediately
 void ABuildingEnergyDisplay::ApplyColorsNow()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎨 MANUAL COLOR APPLICATION: User requested immediate color application"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 MANUAL COLOR APPLICATION: User requested immediate color application"));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 No cached building colors! Run data fetch first."));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🚨 No cached building colors! Run data fetch first."));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, 
@@ -1705,7 +2220,7 @@ void ABuildingEnergyDisplay::ApplyColorsNow()
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🎨 Found %d cached building colors, applying to Cesium tileset..."), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 Found %d cached building colors, applying to Cesium tileset..."), BuildingStore.NumColoredBuildings());
 	
 	// Apply colors using the existing function
 	ApplyColorsDirectlyToGeometry();
@@ -1714,20 +2229,20 @@ void ABuildingEnergyDisplay::ApplyColorsNow()
 	if (GEngine)
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Green, 
-			FString::Printf(TEXT("🎨 Applied colors from %d cached buildings to Cesium tileset!"), BuildingColorCache.Num()));
+			FString::Printf(TEXT("🎨 Applied colors from %d cached buildings to Cesium tileset!"), BuildingStore.NumColoredBuildings()));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("✅ Manual color application completed"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("✅ Manual color application completed"));
 }
 
 // 🔧 FORCE COLOR APPLICATION: Immediate color application bypassing all delays
 void ABuildingEnergyDisplay::ForceColorsNow()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔧 FORCE COLORS: Immediate forced application requested"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔧 FORCE COLORS: Immediate forced application requested"));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 No cached building colors! Run authentication first."));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🚨 No cached building colors! Run authentication first."));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, 
@@ -1736,7 +2251,7 @@ void ABuildingEnergyDisplay::ForceColorsNow()
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔧 FORCE: Applying colors to %d buildings immediately..."), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔧 FORCE: Applying colors to %d buildings immediately..."), BuildingStore.NumColoredBuildings());
 	
 	// Apply colors immediately without any delays
 	ApplyColorsDirectlyToGeometry();
@@ -1745,21 +2260,21 @@ void ABuildingEnergyDisplay::ForceColorsNow()
 	if (GEngine)
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Orange, 
-			FString::Printf(TEXT("🔧 FORCED: Applied %d building colors immediately!"), BuildingColorCache.Num()));
+			FString::Printf(TEXT("🔧 FORCED: Applied %d building colors immediately!"), BuildingStore.NumColoredBuildings()));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔧 Force color application completed"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔧 Force color application completed"));
 }
 
 void ABuildingEnergyDisplay::DisplayBuildingData(const FString& GmlId)
 {
 	// LEFT-CLICK: Display building energy information from cache
 	// GmlId is the modified_gml_id (with underscore) that comes directly from Cesium
-	UE_LOG(LogTemp, Warning, TEXT("✅ LEFT-CLICK: Received gml:id from Cesium: %s"), *GmlId);
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("✅ LEFT-CLICK: Received gml:id from Cesium: %s"), *GmlId);
 	
 	if (!bDataLoaded)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Building data not loaded yet for: %s"), *GmlId);
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Building data not loaded yet for: %s"), *GmlId);
 		return;
 	}
 
@@ -1767,7 +2282,7 @@ void ABuildingEnergyDisplay::DisplayBuildingData(const FString& GmlId)
 	double CurrentTime = FPlatformTime::Seconds();
 	if (LastDisplayedGmlId == GmlId && (CurrentTime - LastDisplayTime) < 1.0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Ignoring duplicate left-click on building %s (too soon)"), *GmlId);
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Ignoring duplicate left-click on building %s (too soon)"), *GmlId);
 		return;
 	}
 
@@ -1775,106 +2290,44 @@ void ABuildingEnergyDisplay::DisplayBuildingData(const FString& GmlId)
 	LastDisplayedGmlId = GmlId;
 	LastDisplayTime = CurrentTime;
 
-	// STEP 1: Check if this gml:id (modified_gml_id) exists in our cache
-	UE_LOG(LogTemp, Warning, TEXT("🔍 STEP 1: Looking for modified_gml_id '%s' in BuildingDataCache (%d entries)"), *GmlId, BuildingDataCache.Num());
+	// STEP 1: Resolve the gml:id (modified_gml_id) to its building index once
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("🔍 STEP 1: Looking for modified_gml_id '%s' in BuildingStore (%d buildings)"), *GmlId, BuildingStore.Num());
 	
-	FString* CachedEnergyData = BuildingDataCache.Find(GmlId);
-	if (!CachedEnergyData || CachedEnergyData->IsEmpty())
+	int32 BuildingIndex = BuildingStore.FindIndex(GmlId);
+	if (BuildingIndex == INDEX_NONE || !BuildingStore.HasDisplayText(BuildingIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("❌ Not found in cache. Searching for matching entry..."), *GmlId);
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("❌ Not found in cache. Searching for matching entry..."), *GmlId);
 		
-		// Try case-insensitive search as fallback
-		bool bFoundMatch = false;
-		for (const auto& Entry : BuildingDataCache)
+		// Try the variant index (case, '_'/'L', '_'/'-') as fallback
+		BuildingIndex = BuildingStore.FindVariantIndex(GmlId);
+		if (BuildingIndex != INDEX_NONE && BuildingStore.HasDisplayText(BuildingIndex))
 		{
-			if (Entry.Key.Equals(GmlId, ESearchCase::IgnoreCase))
-			{
-				CachedEnergyData = (FString*)&Entry.Value;
-				UE_LOG(LogTemp, Warning, TEXT("✅ Found case-insensitive match: %s"), *Entry.Key);
-				bFoundMatch = true;
-				break;
-			}
+			UE_LOG(LogBuildingEnergyIngest, Log, TEXT("✅ Found variant match: %s"), *BuildingStore.ModifiedGmlIds[BuildingIndex]);
+		}
+		else
+		{
+			BuildingIndex = INDEX_NONE;
 		}
 		
-		if (!bFoundMatch)
+		if (BuildingIndex == INDEX_NONE)
 		{
-			UE_LOG(LogTemp, Error, TEXT("❌ Building %s not found in any cache"), *GmlId);
+			UE_LOG(LogBuildingEnergyIngest, Error, TEXT("❌ Building %s not found in any cache"), *GmlId);
 			return;
 		}
 	}
 
-	// STEP 2: Look up the full JSON object for this building
-	UE_LOG(LogTemp, Warning, TEXT("✅ STEP 2: Building found in cache. Now looking for JSON object for '%s' in BuildingJsonCache (%d entries)"), *GmlId, BuildingJsonCache.Num());
-	
-	const TSharedPtr<FJsonObject>* BuildingObjPtr = BuildingJsonCache.Find(GmlId);
-	if (!BuildingObjPtr || !BuildingObjPtr->IsValid())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("⚠️ JSON object not found for %s"), *GmlId);
-		// Display data without color if JSON not found
-		ShowBuildingInfoWidget(GmlId, *CachedEnergyData);
-		return;
-	}
-
-	// STEP 3: Extract color from JSON: energy_result → end → color → energy_demand_specific_color
-	UE_LOG(LogTemp, Warning, TEXT("✅ STEP 3: Extracting color from JSON path: energy_result.end.color.energy_demand_specific_color"));
+	// STEP 2: Read the color column: energy_result → end → color → energy_demand_specific_color
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("✅ STEP 2: Building found in cache at index %d. Reading its end color"), BuildingIndex);
 	
-	FString ExtractedHexColor = TEXT("No data");
-	const TSharedPtr<FJsonObject>& BuildingObj = *BuildingObjPtr;
-	
-	const TSharedPtr<FJsonObject>* EnergyResultObjPtr = nullptr;
-	if (BuildingObj->TryGetObjectField(TEXT("energy_result"), EnergyResultObjPtr) && EnergyResultObjPtr && EnergyResultObjPtr->IsValid())
-	{
-		const TSharedPtr<FJsonObject>& EnergyResultObj = *EnergyResultObjPtr;
-		UE_LOG(LogTemp, Warning, TEXT("  ✓ Found energy_result object"));
-		
-		const TSharedPtr<FJsonObject>* EndObjPtr = nullptr;
-		if (EnergyResultObj->TryGetObjectField(TEXT("end"), EndObjPtr) && EndObjPtr && EndObjPtr->IsValid())
-		{
-			const TSharedPtr<FJsonObject>& EndObj = *EndObjPtr;
-			UE_LOG(LogTemp, Warning, TEXT("  ✓ Found end object"));
-			
-			const TSharedPtr<FJsonObject>* ColorObjPtr = nullptr;
-			if (EndObj->TryGetObjectField(TEXT("color"), ColorObjPtr) && ColorObjPtr && ColorObjPtr->IsValid())
-			{
-				const TSharedPtr<FJsonObject>& ColorObj = *ColorObjPtr;
-				UE_LOG(LogTemp, Warning, TEXT("  ✓ Found color object"));
-				
-				if (ColorObj->TryGetStringField(TEXT("energy_demand_specific_color"), ExtractedHexColor))
-				{
-					UE_LOG(LogTemp, Warning, TEXT("  ✅ SUCCESS: Extracted color: %s"), *ExtractedHexColor);
-					
-					// Store color in BuildingColorCache for consistency
-					FLinearColor ColorFromJson = ConvertHexToLinearColor(ExtractedHexColor);
-					BuildingColorCache.Add(GmlId, ColorFromJson);
-					UE_LOG(LogTemp, Warning, TEXT("  ✅ Stored color in BuildingColorCache"));
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("  ❌ No energy_demand_specific_color field in color object"));
-				}
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("  ❌ No color object in end object"));
-			}
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("  ❌ No end object in energy_result"));
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("  ❌ No energy_result object found"));
-	}
+	const FString ExtractedHexColor = BuildingStore.HasColor(BuildingIndex) ? BuildingStore.GetColorHex(BuildingIndex) : FString(TEXT("No data"));
 
-	// STEP 4: Display the information
-	UE_LOG(LogTemp, Warning, TEXT("✅ STEP 4: Displaying building information"));
-	UE_LOG(LogTemp, Warning, TEXT("   Building ID (modified_gml_id): %s"), *GmlId);
-	UE_LOG(LogTemp, Warning, TEXT("   Color (energy_demand_specific_color): %s"), *ExtractedHexColor);
+	// STEP 3: Display the information
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("✅ STEP 3: Displaying building information"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("   Building ID (modified_gml_id): %s"), *GmlId);
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("   Color (energy_demand_specific_color): %s"), *ExtractedHexColor);
 	
 	// Show widget with color information
-	ShowBuildingInfoWidget(GmlId, *CachedEnergyData);
+	ShowBuildingInfoWidget(GmlId, BuildingStore.GetDisplayText(BuildingIndex));
 }
 
 void ABuildingEnergyDisplay::FetchBuildingEnergyData(const FString& GmlId, const FString& Token)
@@ -1882,10 +2335,10 @@ void ABuildingEnergyDisplay::FetchBuildingEnergyData(const FString& GmlId, const
 	// 🚫 === DISABLED LEGACY FUNCTION - SHOULD NOT BE CALLED BY BLUEPRINT ===
 	static int32 FetchCallCounter = 0;
 	FetchCallCounter++;
-	UE_LOG(LogTemp, Error, TEXT("🚫 === FetchBuildingEnergyData() CALLED #%d ==="), FetchCallCounter);
-	UE_LOG(LogTemp, Error, TEXT("🚫 ERROR: This LEGACY function was DISABLED and should NOT be called!"));
-	UE_LOG(LogTemp, Error, TEXT("🚫 GmlId received: '%s'"), *GmlId);
-	UE_LOG(LogTemp, Error, TEXT("🚫 Blueprint should ONLY call OnBuildingClicked!"));
+	UE_LOG(LogBuildingEnergyIngest, Error, TEXT("🚫 === FetchBuildingEnergyData() CALLED #%d ==="), FetchCallCounter);
+	UE_LOG(LogBuildingEnergyIngest, Error, TEXT("🚫 ERROR: This LEGACY function was DISABLED and should NOT be called!"));
+	UE_LOG(LogBuildingEnergyIngest, Error, TEXT("🚫 GmlId received: '%s'"), *GmlId);
+	UE_LOG(LogBuildingEnergyIngest, Error, TEXT("🚫 Blueprint should ONLY call OnBuildingClicked!"));
 
 	// Use cached data instead of making new HTTP requests
 	DisplayBuildingData(GmlId);
@@ -2036,10 +2489,11 @@ void ABuildingEnergyDisplay::OnResponseReceived(FHttpRequestPtr Request, FHttpRe
 								
 								// DISABLED: Don't display here - only use the new ShowBuildingInfoWidget system
 								// ShowBuildingInfoWidget(ModifiedGmlId, DisplayMessage);
-								UE_LOG(LogTemp, Warning, TEXT("OLD OnResponseReceived called for: %s - DISABLED to prevent duplicates"), *ModifiedGmlId);
+								UE_LOG_BUILDING_LOOP(LogBuildingEnergyIngest, Verbose, TEXT("OLD OnResponseReceived called for: %s - DISABLED to prevent duplicates"), *ModifiedGmlId);
 								
 								// Cache this data for instant retrieval next time
-								BuildingDataCache.Add(ModifiedGmlId, DisplayMessage);
+								const int32 BuildingIndex = BuildingStore.FindOrAddBuilding(ModifiedGmlId);
+								BuildingStore.DisplayTextOverrides.Add(BuildingIndex, DisplayMessage);
 							}
 						}
 					}
@@ -2051,7 +2505,7 @@ void ABuildingEnergyDisplay::OnResponseReceived(FHttpRequestPtr Request, FHttpRe
 
 		if (!bFoundBuilding)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("No energy data found for building: %s"), *ModifiedGmlId);
+			UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("No energy data found for building: %s"), *ModifiedGmlId);
 			// Don't show screen message for missing buildings to avoid clutter
 		}
 	}
@@ -2066,26 +2520,34 @@ void ABuildingEnergyDisplay::OnResponseReceived(FHttpRequestPtr Request, FHttpRe
 
 void ABuildingEnergyDisplay::ClearCache()
 {
-	BuildingDataCache.Empty();
-	GmlIdCache.Empty(); // Also clear gml_id cache
+	++IngestGeneration; // Drop any ingest still running in the background
+	BuildingStore.Reset(); // Ids, energy values, colors and geometry go together
+	PendingBuildingPatches.Reset(); // Queued patches address the cleared store's indices
+	PendingAppliedIndices.Reset();
+	ChunkCache.Reset(); // Viewport chunks are refetched on the next update
+	CommunityShards.Reset(); // Shard responses and parses still in flight find no shard and are dropped
+	bCommunityShardsChanged = false;
+	bPreloadRequestPending = false;
+	bChunkStoreDirty = false;
 	bDataLoaded = false;
 	bIsLoading = false;
+	UpdateMemoryStats();
 	if (GEngine)
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Yellow, TEXT("Building data cache cleared"));
 	}
-	UE_LOG(LogTemp, Warning, TEXT("Building energy data cache cleared"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Building energy data cache cleared"));
 }
 
 // Manual cache refresh function (optimized for frequent calls)
 void ABuildingEnergyDisplay::RefreshBuildingCache()
 {
-	UE_LOG(LogTemp, Log, TEXT("Cache refresh requested for fresh building data"));
+	UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Cache refresh requested for fresh building data"));
 	
 	// Skip if already refreshing to avoid spam
 	if (bIsLoading)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Cache refresh already in progress, skipping"));
+		UE_LOG(LogBuildingEnergyIngest, Log, TEXT("Cache refresh already in progress, skipping"));
 		return;
 	}
 	
@@ -2094,9 +2556,10 @@ void ABuildingEnergyDisplay::RefreshBuildingCache()
 		// Reset cache refresh timer
 		CacheRefreshTimer = 0.0f;
 		
-		// Clear existing cache for fresh data
-		BuildingDataCache.Empty();
-		GmlIdCache.Empty();
+		// Clear existing cache for fresh data; queued patches address its indices and go with it
+		BuildingStore.Reset();
+		PendingBuildingPatches.Reset();
+		PendingAppliedIndices.Reset();
 		bDataLoaded = false;
 		
 		// Restart authentication and data loading
@@ -2104,7 +2567,7 @@ void ABuildingEnergyDisplay::RefreshBuildingCache()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No access token - starting authentication for cache refresh"));
+		UE_LOG(LogBuildingEnergyIngest, Warning, TEXT("No access token - starting authentication for cache refresh"));
 		// Try to authenticate first
 		AuthenticateAndLoadData();
 	}
@@ -2112,47 +2575,20 @@ void ABuildingEnergyDisplay::RefreshBuildingCache()
 
 void ABuildingEnergyDisplay::AuthenticateAndLoadData()
 {
-	// DUPLICATE CALL PREVENTION - But allow manual Blueprint calls
-	static bool bAuthInProgress = false;
-	static FString LastSuccessfulToken = TEXT("");
-	static double LastResetTime = 0.0;
-	
-	// Allow manual reset every 2 seconds for Blueprint calls
-	double CurrentTime = FPlatformTime::Seconds();
-	if (CurrentTime - LastResetTime > 2.0)
-	{
-		bAuthInProgress = false; // Reset for manual calls
-		LastResetTime = CurrentTime;
-		UE_LOG(LogTemp, Warning, TEXT("🔄 AUTH RESET: Manual authentication reset allowed"));
-	}
-	
-	if (bAuthInProgress)
+	// DUPLICATE CALL PREVENTION - Blueprint calls are accepted again once the pending login is answered
+	if (bAuthRequestPending)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🛑 DUPLICATE AUTH PREVENTED: Authentication already in progress. Skipping."));
+		UE_LOG(LogBuildingEnergyNet, Warning, TEXT("🛑 DUPLICATE AUTH PREVENTED: Authentication already in progress. Skipping."));
 		return;
 	}
 	
-	if (!LastSuccessfulToken.IsEmpty() && bDataLoaded)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("🔄 REUSING TOKEN: Using existing successful authentication."));
-		AccessToken = LastSuccessfulToken;
-		// Apply colors immediately if we have cached data
-		if (BuildingColorCache.Num() > 0)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("🎨 AUTO-APPLY: Applying colors from existing cache (%d buildings)"), BuildingColorCache.Num());
-			ApplyColorsDirectlyToGeometry();
-		}
-		return;
-	}
-	
-	bAuthInProgress = true;
-	UE_LOG(LogTemp, Warning, TEXT("AuthenticateAndLoadData() called - refreshing cache data"));
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("AuthenticateAndLoadData() called - refreshing cache data"));
 	
 	// Allow re-authentication and cache refresh
 	bIsLoading = false;
 	bDataLoaded = false;
 	
-	UE_LOG(LogTemp, Warning, TEXT("Reset cache flags for fresh data load"));
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("Reset cache flags for fresh data load"));
 
 	bIsLoading = true;
 	
@@ -2161,10 +2597,9 @@ void ABuildingEnergyDisplay::AuthenticateAndLoadData()
 		// DISABLED for single building display: GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Cyan, TEXT("Authenticating..."));
 	}
 
-	// API configuration - should be externally configurable
-	FString ApiBaseUrl = TEXT("https://backend.gisworld-tech.com");  // Should come from config
+	const FString ApiBaseUrl = UBuildingEnergyApiSubsystem::GetApiBaseUrl();
 	
-	UE_LOG(LogTemp, Warning, TEXT("Starting authentication request to: %s/api/token/"), *ApiBaseUrl);
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("Starting authentication request to: %s/api/token/"), *ApiBaseUrl);
 
 	// Create HTTP request for authentication
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
@@ -2185,48 +2620,40 @@ void ABuildingEnergyDisplay::AuthenticateAndLoadData()
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 	
-	UE_LOG(LogTemp, Warning, TEXT("Auth payload: %s"), *OutputString);
-	
 	HttpRequest->SetContentAsString(OutputString);
 	HttpRequest->SetTimeout(30.0f);
 	
-	// Bind authentication response callback
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ABuildingEnergyDisplay::OnAuthResponseReceived);
-	
-	// Execute the request
-	if (!HttpRequest->ProcessRequest())
-	{
-		bIsLoading = false;
-		UE_LOG(LogTemp, Error, TEXT("Failed to start authentication request"));
-		if (GEngine)
-		{
-			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, TEXT("ERROR: Failed to start authentication request"));
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Authentication request started successfully"));
-	}
+	// Execute the request through the API broker; a request that fails to start is answered as unsuccessful
+	bAuthRequestPending = true;
+	UBuildingEnergyApiSubsystem::Send(this, HttpRequest, 
+		FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnAuthResponseReceived), EBuildingApiPriority::UserInitiated);
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("Authentication request submitted"));
 }
 
 void ABuildingEnergyDisplay::OnAuthResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+	// Answered either way: allow the next authentication attempt
+	bAuthRequestPending = false;
+	
+	// Requests parked on 401 were replayed if this login produced a token, otherwise they get their 401 now
+	ON_SCOPE_EXIT
+	{
+		UBuildingEnergyApiSubsystem* Api = UBuildingEnergyApiSubsystem::Get(this);
+		if (Api && !bTokenRefreshPending)
+		{
+			Api->FailParkedRequests();
+		}
+	};
+	
 	if (!bWasSuccessful || !Response.IsValid())
 	{
 		bIsLoading = false;
-		// CRITICAL: Reset authentication flag on failure
-		static bool* AuthProgressFlag = []() -> bool* {
-			static bool bAuthInProgress = false;
-			return &bAuthInProgress;
-		}();
-		*AuthProgressFlag = false;
-		UE_LOG(LogTemp, Error, TEXT("🚫 AUTH FLAG RESET: Authentication failed - flag cleared"));
 		
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, TEXT("ERROR: Authentication failed"));
 		}
-		UE_LOG(LogTemp, Error, TEXT("Authentication request failed"));
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("Authentication request failed"));
 		return;
 	}
 
@@ -2234,20 +2661,13 @@ void ABuildingEnergyDisplay::OnAuthResponseReceived(FHttpRequestPtr Request, FHt
 	if (ResponseCode != 200)
 	{
 		bIsLoading = false;
-		// CRITICAL: Reset authentication flag on failure
-		static bool* AuthProgressFlag = []() -> bool* {
-			static bool bAuthInProgress = false;
-			return &bAuthInProgress;
-		}();
-		*AuthProgressFlag = false;
-		UE_LOG(LogTemp, Error, TEXT("🚫 AUTH FLAG RESET: Auth failed with code %d - flag cleared"), ResponseCode);
 		
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
 				FString::Printf(TEXT("ERROR: Authentication failed with code %d"), ResponseCode));
 		}
-		UE_LOG(LogTemp, Error, TEXT("Authentication failed with response code: %d"), ResponseCode);
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("Authentication failed with response code: %d"), ResponseCode);
 		return;
 	}
 
@@ -2283,44 +2703,28 @@ void ABuildingEnergyDisplay::OnAuthResponseReceived(FHttpRequestPtr Request, FHt
 	// Get the refresh token for automatic token renewal
 	RefreshToken = JsonObject->GetStringField(TEXT("refresh"));
 	
-	UE_LOG(LogTemp, Warning, TEXT("✅ BACKEND AUTH SUCCESS - Access token received, length: %d"), Token.Len());
-	UE_LOG(LogTemp, Warning, TEXT("✅ REFRESH TOKEN - Refresh token received, length: %d"), RefreshToken.Len());
-	UE_LOG(LogTemp, Warning, TEXT("✅ BACKEND VERIFICATION - API endpoint is responsive"));
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("✅ BACKEND AUTH SUCCESS - Access token received, length: %d"), Token.Len());
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("✅ REFRESH TOKEN - Refresh token received, length: %d"), RefreshToken.Len());
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("✅ BACKEND VERIFICATION - API endpoint is responsive"));
 	
 	if (GEngine)
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Green, 
-			FString::Printf(TEXT("✅ BACKEND CONNECTED - Token: %s..."), *Token.Left(10)));
+			FString::Printf(TEXT("✅ BACKEND CONNECTED - Token length: %d"), Token.Len()));
 	}
 	
-	// Now load building data with the token
-	AccessToken = Token;
-	
-	// Reset authentication message flag since we now have a token
-	bAuthenticationMessageShown = false;
+	// Now load building data with the token; replays requests parked on 401 and schedules the refresh ahead of expiry
+	ApplyAccessToken(Token);
 	
 	// Store refresh token if available in the authentication response
 	// This enables automatic token renewal when access token expires
 	if (!RefreshToken.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("✅ REFRESH TOKEN stored for automatic renewal"));
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("✅ REFRESH TOKEN stored for automatic renewal"));
 	}
 	
-	// Store successful token globally to prevent duplicate auth
-	static FString* GlobalSuccessToken = new FString(Token);
-	static bool* GlobalAuthInProgress = new bool(false);
-	*GlobalSuccessToken = Token;
-	*GlobalAuthInProgress = false;
-	
-	// CRITICAL: Reset the authentication progress flag
-	static bool* AuthProgressFlag = []() -> bool* {
-		static bool bAuthInProgress = false;
-		return &bAuthInProgress;
-	}();
-	*AuthProgressFlag = false;
-	
-	UE_LOG(LogTemp, Warning, TEXT("✅ AUTH FLAG RESET: Authentication completed successfully"));
-	UE_LOG(LogTemp, Warning, TEXT("🔄 BACKEND DATA REQUEST - Fetching building energy data..."));
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("✅ AUTH COMPLETE: Authentication completed successfully"));
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔄 BACKEND DATA REQUEST - Fetching building energy data..."));
 	PreloadAllBuildingData(Token);
 }
 
@@ -2329,7 +2733,7 @@ void ABuildingEnergyDisplay::RefreshAccessToken()
 {
 	if (RefreshToken.IsEmpty())
 	{
-		UE_LOG(LogTemp, Error, TEXT("🔄 No refresh token available - cannot refresh access token"));
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("🔄 No refresh token available - cannot refresh access token"));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, TEXT("❌ No refresh token - please re-authenticate"));
@@ -2337,14 +2741,20 @@ void ABuildingEnergyDisplay::RefreshAccessToken()
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔄 === REFRESHING ACCESS TOKEN ==="));
+	if (bTokenRefreshPending)
+	{
+		UE_LOG(LogBuildingEnergyNet, Verbose, TEXT("🔄 Token refresh already in progress, skipping"));
+		return;
+	}
+	
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔄 === REFRESHING ACCESS TOKEN ==="));
+	TokenRefreshCountdown = -1.0f; // Rescheduled from the new token
 	
 	// Create HTTP request for token refresh
 	FHttpModule& HttpModule = FModuleManager::LoadModuleChecked<FHttpModule>("HTTP");
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = HttpModule.CreateRequest();
 	
-	FString ApiBaseUrl = TEXT("https://backend.gisworld-tech.com");
-	FString RefreshURL = FString::Printf(TEXT("%s/api/token/refresh/"), *ApiBaseUrl);
+	FString RefreshURL = FString::Printf(TEXT("%s/api/token/refresh/"), *UBuildingEnergyApiSubsystem::GetApiBaseUrl());
 	
 	// Create JSON payload with refresh token
 	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
@@ -2355,44 +2765,65 @@ void ABuildingEnergyDisplay::RefreshAccessToken()
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 	
 	// Configure request
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ABuildingEnergyDisplay::OnRefreshTokenResponseReceived);
 	HttpRequest->SetURL(RefreshURL);
 	HttpRequest->SetVerb(TEXT("POST"));
 	HttpRequest->SetHeader("Content-Type", TEXT("application/json"));
 	HttpRequest->SetContentAsString(OutputString);
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔄 Sending refresh token request to: %s"), *RefreshURL);
-	HttpRequest->ProcessRequest();
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔄 Sending refresh token request to: %s"), *RefreshURL);
+	bTokenRefreshPending = true;
+	UBuildingEnergyApiSubsystem::Send(this, HttpRequest, 
+		FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnRefreshTokenResponseReceived), EBuildingApiPriority::UserInitiated);
 }
 
 // Handle refresh token response
 void ABuildingEnergyDisplay::OnRefreshTokenResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+	bTokenRefreshPending = false;
+	
+	// Requests parked on 401 were replayed if a new token arrived; unless a login took over, they get their 401 now
+	ON_SCOPE_EXIT
+	{
+		UBuildingEnergyApiSubsystem* Api = UBuildingEnergyApiSubsystem::Get(this);
+		if (Api && !bAuthRequestPending)
+		{
+			Api->FailParkedRequests();
+		}
+	};
+	
 	if (!bWasSuccessful || !Response.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("🔄 Token refresh request failed"));
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("🔄 Token refresh request failed"));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, TEXT("❌ Token refresh failed - please re-authenticate"));
 		}
+		TokenRefreshCountdown = 10.0f; // Network trouble: try again before the token runs out
 		return;
 	}
 	
 	int32 ResponseCode = Response->GetResponseCode();
 	FString ResponseContent = Response->GetContentAsString();
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔄 Token refresh response: %d"), ResponseCode);
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔄 Token refresh response: %d"), ResponseCode);
 	
 	if (ResponseCode != 200)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🔄 Token refresh failed with code: %d"), ResponseCode);
-		UE_LOG(LogTemp, Error, TEXT("🔄 Response: %s"), *ResponseContent);
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("🔄 Token refresh failed with code: %d"), ResponseCode);
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("🔄 Response: %s"), *ResponseContent);
 		
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, 
 				FString::Printf(TEXT("❌ Token refresh failed (%d) - please re-authenticate"), ResponseCode));
 		}
+		
+		// The refresh token itself expired or was revoked: log in again, parked requests wait for that token
+		if (ResponseCode == EHttpResponseCodes::Denied || ResponseCode == EHttpResponseCodes::BadRequest)
+		{
+			RefreshToken.Empty();
+			AuthenticateAndLoadData();
+		}
 		return;
 	}
 	
@@ -2402,29 +2833,113 @@ void ABuildingEnergyDisplay::OnRefreshTokenResponseReceived(FHttpRequestPtr Requ
 	
 	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("🔄 Failed to parse token refresh response JSON"));
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("🔄 Failed to parse token refresh response JSON"));
 		return;
 	}
 	
 	// Extract new access token
 	if (!JsonObject->HasField(TEXT("access")))
 	{
-		UE_LOG(LogTemp, Error, TEXT("🔄 No access token in refresh response"));
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("🔄 No access token in refresh response"));
 		return;
 	}
 	
 	FString NewAccessToken = JsonObject->GetStringField(TEXT("access"));
-	AccessToken = NewAccessToken;
 	
-	UE_LOG(LogTemp, Warning, TEXT("✅ ACCESS TOKEN REFRESHED - New token length: %d"), AccessToken.Len());
+	// Rotating refresh tokens come back with the new access token
+	FString NewRefreshToken;
+	if (JsonObject->TryGetStringField(TEXT("refresh"), NewRefreshToken) && !NewRefreshToken.IsEmpty())
+	{
+		RefreshToken = NewRefreshToken;
+	}
+	
+	ApplyAccessToken(NewAccessToken);
+	
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("✅ ACCESS TOKEN REFRESHED - New token length: %d"), AccessToken.Len());
 	
 	if (GEngine)
 	{
 		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Green, TEXT("✅ Access token refreshed successfully"));
 	}
+}
+
+void ABuildingEnergyDisplay::ApplyAccessToken(const FString& NewToken)
+{
+	AccessToken = NewToken;
 	
 	// Reset authentication message flag since we have a fresh token
 	bAuthenticationMessageShown = false;
+	
+	// Requests parked on 401 are replayed with the new token, stale copies of the old one (e.g. the widget's) are swapped on submit
+	if (UBuildingEnergyApiSubsystem* Api = UBuildingEnergyApiSubsystem::Get(this))
+	{
+		Api->UpdateAccessToken(NewToken);
+	}
+	
+	int64 Expiry = 0;
+	if (RefreshToken.IsEmpty() || !DecodeTokenExpiry(NewToken, Expiry))
+	{
+		TokenRefreshCountdown = -1.0f;
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔑 Token expiry unknown or no refresh token - renewing on 401 only"));
+		return;
+	}
+	
+	// Refresh TokenRefreshLeadTime ahead of exp, but never sooner than half the remaining lifetime of a short-lived token
+	const float SecondsLeft = float(Expiry - FDateTime::UtcNow().ToUnixTimestamp());
+	TokenRefreshCountdown = FMath::Max(0.0f, FMath::Max(SecondsLeft - TokenRefreshLeadTime, SecondsLeft * 0.5f));
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔑 Access token valid for %.0f s - refresh scheduled in %.0f s"), SecondsLeft, TokenRefreshCountdown);
+}
+
+void ABuildingEnergyDisplay::OnApiTokenRejected()
+{
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔑 API rejected the access token - renewing it before replaying parked requests"));
+	
+	if (!RefreshToken.IsEmpty())
+	{
+		RefreshAccessToken();
+	}
+	else if (!bAuthRequestPending)
+	{
+		// Token came from outside (PreloadAllBuildingData); nothing to renew it with
+		if (UBuildingEnergyApiSubsystem* Api = UBuildingEnergyApiSubsystem::Get(this))
+		{
+			Api->FailParkedRequests();
+		}
+	}
+}
+
+bool ABuildingEnergyDisplay::DecodeTokenExpiry(const FString& Jwt, int64& OutUnixExpiry)
+{
+	// header.payload.signature; the payload is unpadded base64url JSON
+	TArray<FString> Parts;
+	if (Jwt.ParseIntoArray(Parts, TEXT("."), false) != 3)
+	{
+		return false;
+	}
+	
+	FString Payload = Parts[1].Replace(TEXT("-"), TEXT("+")).Replace(TEXT("_"), TEXT("/"));
+	while (Payload.Len() % 4 != 0)
+	{
+		Payload += TEXT("=");
+	}
+	
+	TArray<uint8> Bytes;
+	if (!FBase64::Decode(Payload, Bytes))
+	{
+		return false;
+	}
+	
+	const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+	TSharedPtr<FJsonObject> Claims;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FString(Converter.Length(), Converter.Get()));
+	double Exp = 0.0;
+	if (!FJsonSerializer::Deserialize(Reader, Claims) || !Claims.IsValid() || !Claims->TryGetNumberField(TEXT("exp"), Exp))
+	{
+		return false;
+	}
+	
+	OutUnixExpiry = int64(Exp);
+	return true;
 }
 
 // Fetch updated energy data using REST API polling
@@ -2432,32 +2947,33 @@ void ABuildingEnergyDisplay::FetchUpdatedEnergyData()
 {
 	if (AccessToken.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔄 Cannot fetch energy updates - no access token"));
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("🔄 Cannot fetch energy updates - no access token"));
 		return;
 	}
 	
-	// Use the same endpoint that works for initial data load
-	FString ApiBaseUrl = TEXT("https://backend.gisworld-tech.com");
-	FString DefaultCommunityId = TEXT("08417008");
-	FString URL = FString::Printf(TEXT("%s/geospatial/buildings-energy/?community_id=%s&format=json"), 
-		*ApiBaseUrl, *DefaultCommunityId);
-	
-	// Create HTTP request
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetURL(URL);
-	HttpRequest->SetVerb("GET");
-	HttpRequest->SetHeader("Content-Type", "application/json");
-	HttpRequest->SetHeader("Accept", "application/json");
-	HttpRequest->SetHeader("Authorization", FString::Printf(TEXT("Bearer %s"), *AccessToken));
-	
-	// Bind response handler
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &ABuildingEnergyDisplay::OnEnergyUpdateResponse);
-	
-	// Send request
-	HttpRequest->ProcessRequest();
+	// Use the same endpoint that works for initial data load, once per community
+	const FString ApiBaseUrl = UBuildingEnergyApiSubsystem::GetApiBaseUrl();
+	for (const FString& CommunityId : CommunityIds)
+	{
+		FString URL = FString::Printf(TEXT("%s/geospatial/buildings-energy/?community_id=%s&format=json"), 
+			*ApiBaseUrl, *FGenericPlatformHttp::UrlEncode(CommunityId));
+		
+		// Create HTTP request
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+		HttpRequest->SetURL(URL);
+		HttpRequest->SetVerb("GET");
+		HttpRequest->SetHeader("Content-Type", "application/json");
+		HttpRequest->SetHeader("Accept", "application/json");
+		HttpRequest->SetHeader("Authorization", FString::Printf(TEXT("Bearer %s"), *AccessToken));
+		FBuildingHttpValidators::Get().ApplyTo(*HttpRequest); // Skip the body when nothing changed since the last update
+		
+		// Send request; an identical poll already in flight is shared instead of sent again
+		UBuildingEnergyApiSubsystem::Send(this, HttpRequest, 
+			FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnEnergyUpdateResponse), EBuildingApiPriority::Background);
+	}
 	
 	EnergyUpdateCounter++;
-	UE_LOG(LogTemp, Verbose, TEXT("🔄 Energy update request #%d sent"), EnergyUpdateCounter);
+	UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("🔄 Energy update request #%d sent"), EnergyUpdateCounter);
 }
 
 // Handle energy update response
@@ -2465,27 +2981,31 @@ void ABuildingEnergyDisplay::OnEnergyUpdateResponse(FHttpRequestPtr Request, FHt
 {
 	if (!bWasSuccessful || !Response.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔄 Energy update request failed"));
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("🔄 Energy update request failed"));
 		return;
 	}
 	
 	int32 ResponseCode = Response->GetResponseCode();
 	
+	if (FBuildingHttpValidators::IsNotModified(*Response))
+	{
+		UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("🔄 Energy update: 304 Not Modified"));
+		return;
+	}
+	
 	if (ResponseCode == 401)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔄 Energy update: Token expired, attempting refresh"));
-		if (!RefreshToken.IsEmpty())
-		{
-			RefreshAccessToken();
-		}
+		// Renewal belongs to OnApiTokenRejected; the next poll retries with whatever token it produced
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("🔄 Energy update: 401 after token renewal failed"));
 		return;
 	}
 	
 	if (ResponseCode != 200)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔄 Energy update failed with code: %d"), ResponseCode);
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("🔄 Energy update failed with code: %d"), ResponseCode);
 		return;
 	}
+	FBuildingHttpValidators::Get().Record(*Request, *Response);
 	
 	FString ResponseContent = Response->GetContentAsString();
 	
@@ -2495,7 +3015,7 @@ void ABuildingEnergyDisplay::OnEnergyUpdateResponse(FHttpRequestPtr Request, FHt
 	
 	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔄 Failed to parse energy update response"));
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("🔄 Failed to parse energy update response"));
 		return;
 	}
 	
@@ -2512,7 +3032,8 @@ void ABuildingEnergyDisplay::OnEnergyUpdateResponse(FHttpRequestPtr Request, FHt
 				FString BuildingId = BuildingObject->GetStringField(TEXT("gml_id"));
 				
 				// Update energy data in cache if this building exists
-				if (BuildingDataCache.Contains(BuildingId))
+				const int32 BuildingIndex = BuildingStore.FindIndex(BuildingId);
+				if (BuildingIndex != INDEX_NONE && BuildingStore.HasDisplayText(BuildingIndex))
 				{
 					// Create updated display message with new energy values
 					FString UpdatedDisplayMessage = TEXT("Real-time Energy Data\n");
@@ -2539,27 +3060,14 @@ void ABuildingEnergyDisplay::OnEnergyUpdateResponse(FHttpRequestPtr Request, FHt
 					}
 					
 					// Update the cache with the new display message
-					BuildingDataCache[BuildingId] = UpdatedDisplayMessage;
+					BuildingStore.DisplayTextOverrides.Add(BuildingIndex, UpdatedDisplayMessage);
 					
-					// Extract coordinates if available in the update
+					// Extract coordinates if available in the update; they replace the building's geometry
 					if (BuildingObject->HasField(TEXT("coordinates")))
 					{
 						FString CoordinatesData = BuildingObject->GetStringField(TEXT("coordinates"));
-
-						// Create unique cache key when numeric id is available
-						FString UniqueCacheKey = BuildingId;
-						if (BuildingObject->HasField(TEXT("id")))
-						{
-							double NumericIdD = 0.0;
-							if (BuildingObject->TryGetNumberField(TEXT("id"), NumericIdD))
-							{
-								int32 NumericId = (int32)NumericIdD;
-								UniqueCacheKey = FString::Printf(TEXT("%s#%d"), *BuildingId, NumericId);
-							}
-						}
-
-						StoreBuildingCoordinates(UniqueCacheKey, CoordinatesData);
-						UE_LOG(LogTemp, Warning, TEXT("🔄 Updated coordinates for building: %s (cached as %s)"), *BuildingId, *UniqueCacheKey);
+						StoreBuildingCoordinates(BuildingId, CoordinatesData);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyUpdates, Verbose, TEXT("🔄 Updated coordinates for building: %s (index %d)"), *BuildingId, BuildingIndex);
 					}
 				}
 			}
@@ -2567,12 +3075,12 @@ void ABuildingEnergyDisplay::OnEnergyUpdateResponse(FHttpRequestPtr Request, FHt
 		
 		if (UpdatedBuildings > 0)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("✅ Energy update: %d buildings updated"), UpdatedBuildings);
+			UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("✅ Energy update: %d buildings updated"), UpdatedBuildings);
 			
 			// Apply updated colors to the tileset
 			// DISABLED - This was causing gray overlay on entire scene
 			// ApplyColorsToCSiumTileset();
-			UE_LOG(LogTemp, Warning, TEXT("💡 Color update disabled. Use manual ApplyBuildingColorsImmediately() instead"));
+			UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("💡 Color update disabled. Use manual ApplyBuildingColorsImmediately() instead"));
 			
 			if (GEngine)
 			{
@@ -2582,53 +3090,48 @@ void ABuildingEnergyDisplay::OnEnergyUpdateResponse(FHttpRequestPtr Request, FHt
 		}
 		else
 		{
-			UE_LOG(LogTemp, Verbose, TEXT("🔄 Energy update: No changes detected"));
+			UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("🔄 Energy update: No changes detected"));
 		}
 	}
 }
 
 void ABuildingEnergyDisplay::ApplyColorsToCSiumTileset()
 {
+	BUILDING_ENERGY_SCOPE(StyleApplication);
 	// This is the ONLY supported strategy for per-building coloring:
 	// Use Cesium 3D Tiles Styling via ACesium3DTileset::SetTilesetStyleFromJson.
 	// Do NOT manually apply Unreal materials to Cesium tileset meshes (causes gray overlay / wrong layering).
 
 	if (!bEnableCesiumPerFeatureStyling)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM COLORS: Auto-apply disabled. Enable 'Enable Cesium Per Feature Styling' to apply colors."));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM COLORS: Auto-apply disabled. Enable 'Enable Cesium Per Feature Styling' to apply colors."));
 		return;
 	}
 
-	if (BuildingColorCache.Num() == 0 && !bDebugForceRedStyle)
+	if (BuildingStore.NumColoredBuildings() == 0 && !bDebugForceRedStyle)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM COLORS: BuildingColorCache is empty. No per-building colors to apply."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 CESIUM COLORS: BuildingStore has no colors. No per-building colors to apply."));
 	}
 
 	// Find the buildings tileset actor (bisingen)
-	ACesium3DTileset* Tileset = nullptr;
-	if (UWorld* World = GetWorld())
-	{
-		for (TActorIterator<ACesium3DTileset> It(World); It; ++It)
-		{
-			ACesium3DTileset* Candidate = *It;
-			if (!Candidate) continue;
-
-			if (Candidate->GetName().ToLower().Contains(TEXT("bisingen")))
-			{
-				Tileset = Candidate;
-				UE_LOG(LogTemp, Warning, TEXT("✅ Found bisingen Cesium tileset: %s"), *Candidate->GetName());
-				break;
-			}
-		}
-	}
+	ACesium3DTileset* Tileset = GetBuildingsTileset();
 
 	if (!Tileset)
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ CESIUM COLORS: Could not find Cesium3DTileset named 'bisingen'"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("❌ CESIUM COLORS: Could not find Cesium3DTileset named '%s'"), *BuildingsTilesetName);
 		bCesiumStyleApplied = false;
 		return;
 	}
 
+	// Skip regeneration and reapplication when this tileset already shows the current color map
+	const uint64 ColorMapHash = BuildingStore.GetColorMapHash();
+	if (!bDebugForceRedStyle && !BuildingStyleState.NeedsApply(Tileset, ColorMapHash))
+	{
+		UE_LOG(LogBuildingEnergyStyle, Verbose, TEXT("🎨 CESIUM COLORS: Style unchanged for '%s' - skipping reapply"), *Tileset->GetName());
+		bCesiumStyleApplied = true;
+		return;
+	}
+
 	// Build the style JSON with per-feature coloring
 	FString StyleJson;
 	if (bDebugForceRedStyle)
@@ -2642,8 +3145,8 @@ void ABuildingEnergyDisplay::ApplyColorsToCSiumTileset()
 		StyleJson = CreateCesiumColorExpression();
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM COLORS: Built style JSON with %d buildings"), BuildingColorCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM COLORS: Applying style to bisingen tileset using SetTilesetStyleFromJson..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM COLORS: Built style JSON with %d buildings"), BuildingStore.NumColoredBuildings());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM COLORS: Applying style to bisingen tileset using SetTilesetStyleFromJson..."));
 
 	// 🎨 DIRECTLY APPLY CESIUM STYLE - This is the key fix!
 	// Call SetTilesetStyleFromJson to apply per-feature coloring
@@ -2651,23 +3154,32 @@ void ABuildingEnergyDisplay::ApplyColorsToCSiumTileset()
 	if (ApplyCesiumStyleJsonToTileset(Tileset, StyleJson))
 	{
 		bCesiumStyleApplied = true;
-		UE_LOG(LogTemp, Warning, TEXT("✅ CESIUM COLORS: Successfully applied per-feature style to bisingen tileset (%d buildings with colors)"),
-			BuildingColorCache.Num());
+		if (!bDebugForceRedStyle)
+		{
+			BuildingStyleState.MarkApplied(Tileset, ColorMapHash);
+		}
+		else
+		{
+			BuildingStyleState.InvalidateApplied(); // The debug style is not the color map
+		}
+		UpdateMemoryStats(); // The style arms grow with the colored buildings
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("✅ CESIUM COLORS: Successfully applied per-feature style to bisingen tileset (%d buildings with colors)"),
+			BuildingStore.NumColoredBuildings());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ CESIUM COLORS: Failed to apply style to tileset"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("❌ CESIUM COLORS: Failed to apply style to tileset"));
 		bCesiumStyleApplied = false;
 	}
 }
 
 UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateBuildingEnergyMaterial()
 {
-	UE_LOG(LogTemp, Warning, TEXT("COLOR Creating dynamic material for %d buildings with energy colors"), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLOR Creating dynamic material for %d buildings with energy colors"), BuildingStore.NumColoredBuildings());
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No building colors to apply"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("No building colors to apply"));
 		return nullptr;
 	}
 	
@@ -2681,7 +3193,7 @@ UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateBuildingEnergyMaterial()
 	
 	if (!BaseMaterial)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Could not load base material for building energy visualization"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("ERROR Could not load base material for building energy visualization"));
 		return nullptr;
 	}
 	
@@ -2689,16 +3201,16 @@ UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateBuildingEnergyMaterial()
 	BuildingEnergyMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, this);
 	if (!BuildingEnergyMaterial)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Failed to create dynamic material instance"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("ERROR Failed to create dynamic material instance"));
 		return nullptr;
 	}
 	
 	// Set default energy color (use average or representative color from API)
 	FLinearColor AverageColor = FLinearColor::Green; // Default
-	if (BuildingColorCache.Num() > 0)
+	if (BuildingStore.NumColoredBuildings() > 0)
 	{
-		// Use the first building color as representative
-		AverageColor = BuildingColorCache.begin()->Value;
+		// Use the first palette color (first building color seen) as representative
+		AverageColor = BuildingStore.Palette[0];
 	}
 	
 	// Set material parameters for building energy visualization
@@ -2709,12 +3221,12 @@ UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateBuildingEnergyMaterial()
 	BuildingEnergyMaterial->SetScalarParameterValue(TEXT("Roughness"), 0.7f);
 	BuildingEnergyMaterial->SetScalarParameterValue(TEXT("Opacity"), 1.0f);
 	
-	UE_LOG(LogTemp, Warning, TEXT("SUCCESS Created dynamic building energy material with representative color"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SUCCESS Created dynamic building energy material with representative color"));
 	
 	// Automatically assign to Cesium tileset
 	// DISABLED - This was causing gray overlay on entire scene including landscape
 	// AssignMaterialToCesiumTileset();
-	UE_LOG(LogTemp, Warning, TEXT("NOTICE: Automatic material assignment disabled to prevent gray overlay"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("NOTICE: Automatic material assignment disabled to prevent gray overlay"));
 	
 	if (GEngine)
 	{
@@ -2728,9 +3240,9 @@ UMaterialInstanceDynamic* ABuildingEnergyDisplay::CreateBuildingEnergyMaterial()
 void ABuildingEnergyDisplay::AssignMaterialToCesiumTileset()
 {
 	// SAFETY CHECK: This function has been disabled to prevent gray overlay issues
-	UE_LOG(LogTemp, Warning, TEXT("🚫 AssignMaterialToCesiumTileset() DISABLED"));
-	UE_LOG(LogTemp, Warning, TEXT("🚫 This function was causing gray overlay on entire scene including landscape"));
-	UE_LOG(LogTemp, Warning, TEXT("💡 Use ApplyBuildingColorsImmediately() instead for safe color application"));
+	UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🚫 AssignMaterialToCesiumTileset() DISABLED"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚫 This function was causing gray overlay on entire scene including landscape"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("💡 Use ApplyBuildingColorsImmediately() instead for safe color application"));
 	
 	if (GEngine)
 	{
@@ -2742,7 +3254,7 @@ void ABuildingEnergyDisplay::AssignMaterialToCesiumTileset()
 	/* ORIGINAL CODE DISABLED TO PREVENT GRAY OVERLAY ISSUE
 	if (!BuildingEnergyMaterial)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No dynamic material to assign"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("No dynamic material to assign"));
 		return;
 	}
 	
@@ -2754,7 +3266,7 @@ void ABuildingEnergyDisplay::AssignMaterialToCesiumTileset()
 			AActor* Actor = *ActorItr;
 			if (Actor && Actor->GetName().Contains(TEXT("bisingen")))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("CESIUM Found Cesium tileset: %s"), *Actor->GetName());
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("CESIUM Found Cesium tileset: %s"), *Actor->GetName());
 				
 				// Try to find and set the material property using reflection
 				UClass* ActorClass = Actor->GetClass();
@@ -2766,7 +3278,7 @@ void ABuildingEnergyDisplay::AssignMaterialToCesiumTileset()
 					if (Property->GetName().Contains(TEXT("Material")) || 
 						Property->GetName().Contains(TEXT("material")))
 					{
-						UE_LOG(LogTemp, Warning, TEXT("Found material property: %s"), *Property->GetName());
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("Found material property: %s"), *Property->GetName());
 						
 						// Try to set as object property
 						if (FObjectProperty* ObjectProp = CastField<FObjectProperty>(Property))
@@ -2774,7 +3286,7 @@ void ABuildingEnergyDisplay::AssignMaterialToCesiumTileset()
 							if (ObjectProp->PropertyClass->IsChildOf(UMaterialInterface::StaticClass()))
 							{
 								ObjectProp->SetObjectPropertyValue_InContainer(Actor, BuildingEnergyMaterial);
-								UE_LOG(LogTemp, Warning, TEXT("SUCCESS Assigned material to property: %s"), *Property->GetName());
+								UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SUCCESS Assigned material to property: %s"), *Property->GetName());
 								
 								if (GEngine)
 								{
@@ -2796,7 +3308,7 @@ void ABuildingEnergyDisplay::AssignMaterialToCesiumTileset()
 					if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(MeshComp))
 					{
 						StaticMeshComp->SetMaterial(0, BuildingEnergyMaterial);
-						UE_LOG(LogTemp, Warning, TEXT("COLOR Applied material to mesh component as fallback"));
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("COLOR Applied material to mesh component as fallback"));
 					}
 				}
 				
@@ -2812,9 +3324,9 @@ void ABuildingEnergyDisplay::DisplayBuildingEnergyData(const FString& BuildingGm
 	// 🚫 === COMPLETELY DISABLED - CAUSES MULTIPLE BUILDING DISPLAYS ===
 	static int32 DisplayDataCallCounter = 0;
 	DisplayDataCallCounter++;
-	UE_LOG(LogTemp, Error, TEXT("🚫 === DisplayBuildingEnergyData() CALLED #%d - BLOCKED ==="), DisplayDataCallCounter);
-	UE_LOG(LogTemp, Error, TEXT("🚫 This function causes multiple building displays and is DISABLED"));
-	UE_LOG(LogTemp, Error, TEXT("🚫 BuildingGmlId: '%s' - NO DISPLAY WILL BE SHOWN"), *BuildingGmlId);
+	UE_LOG(LogBuildingEnergy, Error, TEXT("🚫 === DisplayBuildingEnergyData() CALLED #%d - BLOCKED ==="), DisplayDataCallCounter);
+	UE_LOG(LogBuildingEnergy, Error, TEXT("🚫 This function causes multiple building displays and is DISABLED"));
+	UE_LOG(LogBuildingEnergy, Error, TEXT("🚫 BuildingGmlId: '%s' - NO DISPLAY WILL BE SHOWN"), *BuildingGmlId);
 	
 	// COMPLETELY DISABLED - This function was causing multiple building displays
 	// Blueprint should ONLY use OnBuildingClicked() for single building display
@@ -2822,16 +3334,16 @@ void ABuildingEnergyDisplay::DisplayBuildingEnergyData(const FString& BuildingGm
 
 void ABuildingEnergyDisplay::CreateMaterialForEditor()
 {
-	UE_LOG(LogTemp, Warning, TEXT("COLOR Creating building-specific color material for editor..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLOR Creating building-specific color material for editor..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No building colors loaded. Loading default colors..."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING No building colors loaded. Loading default colors..."));
 		// Create some sample colors for testing
-		BuildingColorCache.Add(TEXT("DEBW_0010089wkDD"), ConvertHexToLinearColor(TEXT("#66b032"))); // Green from API
-		BuildingColorCache.Add(TEXT("DEBW_0010090wkDD"), ConvertHexToLinearColor(TEXT("#ff5733"))); // Red example
-		BuildingColorCache.Add(TEXT("DEBW_0010091wkDD"), ConvertHexToLinearColor(TEXT("#3366cc"))); // Blue example
-		BuildingColorCache.Add(TEXT("DEBW_0010092wkDD"), ConvertHexToLinearColor(TEXT("#ffcc00"))); // Yellow example
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("DEBW_0010089wkDD")), ConvertHexToLinearColor(TEXT("#66b032"))); // Green from API
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("DEBW_0010090wkDD")), ConvertHexToLinearColor(TEXT("#ff5733"))); // Red example
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("DEBW_0010091wkDD")), ConvertHexToLinearColor(TEXT("#3366cc"))); // Blue example
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("DEBW_0010092wkDD")), ConvertHexToLinearColor(TEXT("#ffcc00"))); // Yellow example
 	}
 	
 	// Load a base material
@@ -2843,7 +3355,7 @@ void ABuildingEnergyDisplay::CreateMaterialForEditor()
 	
 	if (!BaseMaterial)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Could not load base material"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("ERROR Could not load base material"));
 		return;
 	}
 	
@@ -2854,14 +3366,15 @@ void ABuildingEnergyDisplay::CreateMaterialForEditor()
 	{
 		// Instead of one color, we'll create a system that can handle multiple colors
 		// For now, set a representative color, but log all building colors
-		UE_LOG(LogTemp, Warning, TEXT("COLOR Building Color Mapping:"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLOR Building Color Mapping:"));
 		
-		for (const auto& BuildingColor : BuildingColorCache)
+		FBuildingLogSampler MappingLog(LogBuildingEnergyStyle, TEXT("building colors mapped"));
+		for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
 		{
-			FString GmlId = BuildingColor.Key;
-			FLinearColor Color = BuildingColor.Value;
-			UE_LOG(LogTemp, Warning, TEXT("  Building %s -> Color(R:%.2f, G:%.2f, B:%.2f)"), 
-				*GmlId, Color.R, Color.G, Color.B);
+			if (!BuildingStore.HasColor(BuildingIndex) || !MappingLog.Sample()) continue;
+			const FLinearColor& Color = BuildingStore.GetColor(BuildingIndex);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("  Building %s -> Color(R:%.2f, G:%.2f, B:%.2f)"), 
+				*BuildingStore.ModifiedGmlIds[BuildingIndex], Color.R, Color.G, Color.B);
 		}
 		
 		// Set a default color to the material
@@ -2873,8 +3386,8 @@ void ABuildingEnergyDisplay::CreateMaterialForEditor()
 		BuildingEnergyMaterial->SetScalarParameterValue(TEXT("Roughness"), 0.7f);
 		BuildingEnergyMaterial->SetScalarParameterValue(TEXT("Opacity"), 1.0f);
 		
-		UE_LOG(LogTemp, Warning, TEXT("SUCCESS Material created! Note: Cesium tiles need special handling for per-building colors."));
-		UE_LOG(LogTemp, Warning, TEXT("TIP Consider using Cesium's per-feature styling or custom shaders for individual building colors."));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SUCCESS Material created! Note: Cesium tiles need special handling for per-building colors."));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("TIP Consider using Cesium's per-feature styling or custom shaders for individual building colors."));
 		
 		#if WITH_EDITOR
 		// Mark the component as modified so it shows up in the editor
@@ -2886,56 +3399,46 @@ void ABuildingEnergyDisplay::CreateMaterialForEditor()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Failed to create material instance"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("ERROR Failed to create material instance"));
 	}
 }
 
 void ABuildingEnergyDisplay::ApplyPerBuildingColorsToCesium()
 {
-	UE_LOG(LogTemp, Warning, TEXT("COLOR Applying individual building colors to Cesium tileset..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLOR Applying individual building colors to Cesium tileset..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No building colors to apply"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("No building colors to apply"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("FOUND Found %d buildings with individual colors:"), BuildingColorCache.Num());
-	for (const auto& BuildingColor : BuildingColorCache)
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("FOUND Found %d buildings with individual colors:"), BuildingStore.NumColoredBuildings());
 	{
-		FString GmlId = BuildingColor.Key;
-		FLinearColor Color = BuildingColor.Value;
-		// Convert back to hex for display
-		FColor SRGBColor = Color.ToFColor(true);
-		FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-		UE_LOG(LogTemp, Warning, TEXT("  BUILDING %s -> %s"), *GmlId, *HexColor);
+		FBuildingLogSampler ColorLog(LogBuildingEnergyStyle, TEXT("building colors listed"));
+		for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
+		{
+			if (!BuildingStore.HasColor(BuildingIndex) || !ColorLog.Sample()) continue;
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("  BUILDING %s -> %s"), *BuildingStore.ModifiedGmlIds[BuildingIndex], *BuildingStore.GetColorHex(BuildingIndex));
+		}
 	}
 	
-	if (UWorld* World = GetWorld())
+	// Look for Cesium tileset
+	if (AActor* Actor = GetBuildingsTileset())
 	{
-		// Look for Cesium tileset
-		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
-		{
-			AActor* Actor = *ActorItr;
-			if (Actor && Actor->GetName().Contains(TEXT("bisingen")))
-			{
-				UE_LOG(LogTemp, Warning, TEXT("TARGET Found Cesium tileset: %s"), *Actor->GetName());
-				
-				// Apply the modern approach: Cesium tileset styling
-				ApplyCesiumTilesetStyling(Actor);
-				
-				// Alternative: Try to create multiple material instances for different parts
-				CreateMultipleMaterialsForCesium(Actor);
-				
-				break;
-			}
-		}
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("TARGET Found Cesium tileset: %s"), *Actor->GetName());
+		
+		// Apply the modern approach: Cesium tileset styling
+		ApplyCesiumTilesetStyling(Actor);
+		
+		// Alternative: Try to create multiple material instances for different parts
+		CreateMultipleMaterialsForCesium(Actor);
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("TIP For true per-building colors in Cesium, you may need:"));
-	UE_LOG(LogTemp, Warning, TEXT("   1. Cesium 3D Tiles styling (JSON expressions)"));
-	UE_LOG(LogTemp, Warning, TEXT("   2. Feature properties embedded in the tileset data"));
-	UE_LOG(LogTemp, Warning, TEXT("   3. Custom shader with building ID lookup"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("TIP For true per-building colors in Cesium, you may need:"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   1. Cesium 3D Tiles styling (JSON expressions)"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   2. Feature properties embedded in the tileset data"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   3. Custom shader with building ID lookup"));
 }
 
 FLinearColor ABuildingEnergyDisplay::ConvertHexToLinearColor(const FString& HexColor)
@@ -2948,7 +3451,7 @@ FLinearColor ABuildingEnergyDisplay::ConvertHexToLinearColor(const FString& HexC
 	// Validate hex string length
 	if (CleanHex.Len() != 6)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Invalid hex color format: %s (should be 6 characters like '66b032')"), *HexColor);
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("ERROR Invalid hex color format: %s (should be 6 characters like '66b032')"), *HexColor);
 		return FLinearColor(0.4f, 0.69f, 0.2f, 1.0f); // Return #66b032 as fallback
 	}
 	
@@ -2958,7 +3461,7 @@ FLinearColor ABuildingEnergyDisplay::ConvertHexToLinearColor(const FString& HexC
 		TCHAR Char = CleanHex[i];
 		if (!((Char >= '0' && Char <= '9') || (Char >= 'A' && Char <= 'F') || (Char >= 'a' && Char <= 'f')))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ERROR Invalid hex character in color: %s"), *HexColor);
+			UE_LOG(LogBuildingEnergyStyle, Error, TEXT("ERROR Invalid hex character in color: %s"), *HexColor);
 			return FLinearColor(0.4f, 0.69f, 0.2f, 1.0f); // Return #66b032 as fallback
 		}
 	}
@@ -2967,7 +3470,7 @@ FLinearColor ABuildingEnergyDisplay::ConvertHexToLinearColor(const FString& HexC
 	FColor ColorSRGB = FColor::FromHex(CleanHex);
 	FLinearColor Result = FLinearColor::FromSRGBColor(ColorSRGB);
 	
-	UE_LOG(LogTemp, Log, TEXT("COLOR Converted hex %s to Linear(R:%.3f, G:%.3f, B:%.3f)"), 
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLOR Converted hex %s to Linear(R:%.3f, G:%.3f, B:%.3f)"), 
 		*HexColor, Result.R, Result.G, Result.B);
 	
 	return Result;
@@ -2980,16 +3483,17 @@ void ABuildingEnergyDisplay::CreateMultipleMaterialsForCesium(AActor* CesiumActo
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("COLOR Creating multiple materials for individual buildings..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLOR Creating multiple materials for individual buildings..."));
 	
 	// Get mesh components from the Cesium actor
 	TArray<UMeshComponent*> MeshComponents;
 	CesiumActor->GetComponents<UMeshComponent>(MeshComponents);
 	
-	UE_LOG(LogTemp, Warning, TEXT("Found %d mesh components in Cesium tileset"), MeshComponents.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("Found %d mesh components in Cesium tileset"), MeshComponents.Num());
 	
 	int32 ComponentIndex = 0;
-	auto ColorIterator = BuildingColorCache.begin();
+	int32 NextBuildingIndex = 0; // Walks the colored buildings in store order
+	FBuildingLogSampler MaterialLog(LogBuildingEnergyStyle, TEXT("component materials created"));
 	
 	for (UMeshComponent* MeshComp : MeshComponents)
 	{
@@ -3012,11 +3516,15 @@ void ABuildingEnergyDisplay::CreateMultipleMaterialsForCesium(AActor* CesiumActo
 					FString BuildingId = TEXT("Unknown");
 					
 					// Use real building color if available
-					if (ColorIterator != BuildingColorCache.end())
+					while (NextBuildingIndex < BuildingStore.Num() && !BuildingStore.HasColor(NextBuildingIndex))
+					{
+						++NextBuildingIndex;
+					}
+					if (NextBuildingIndex < BuildingStore.Num())
 					{
-						BuildingColor = ColorIterator->Value;
-						BuildingId = ColorIterator->Key;
-						++ColorIterator;
+						BuildingColor = BuildingStore.GetColor(NextBuildingIndex);
+						BuildingId = BuildingStore.ModifiedGmlIds[NextBuildingIndex];
+						++NextBuildingIndex;
 					}
 					else
 					{
@@ -3037,12 +3545,12 @@ void ABuildingEnergyDisplay::CreateMultipleMaterialsForCesium(AActor* CesiumActo
 					// Apply to mesh component
 					StaticMeshComp->SetMaterial(0, DynamicMat);
 					
-					// Convert color to hex for logging
-					FColor SRGBColor = BuildingColor.ToFColor(true);
-					FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-					
-					UE_LOG(LogTemp, Warning, TEXT("SUCCESS Applied color %s to mesh component %d (Building: %s)"), 
-						*HexColor, ComponentIndex, *BuildingId);
+					if (MaterialLog.Sample())
+					{
+						const FColor SRGBColor = BuildingColor.ToFColor(true);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SUCCESS Applied color #%02X%02X%02X to mesh component %d (Building: %s)"), 
+							SRGBColor.R, SRGBColor.G, SRGBColor.B, ComponentIndex, *BuildingId);
+					}
 				}
 			}
 			
@@ -3050,179 +3558,184 @@ void ABuildingEnergyDisplay::CreateMultipleMaterialsForCesium(AActor* CesiumActo
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("MATERIALS Created %d individual materials for Cesium components"), ComponentIndex);
+	MaterialLog.Flush();
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("MATERIALS Created %d individual materials for Cesium components"), ComponentIndex);
 }
 
 void ABuildingEnergyDisplay::ApplyColorsUsingCesiumStyling()
 {
-	UE_LOG(LogTemp, Warning, TEXT("COLORS Applying actual API colors to Cesium tileset..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLORS Applying actual API colors to Cesium tileset..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No building colors cached. Run the game first to load API data."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING No building colors cached. Run the game first to load API data."));
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("APPLY Applying %d building colors:"), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("APPLY Applying %d building colors:"), BuildingStore.NumColoredBuildings());
 	
 	int32 ColorCount = 0;
-	for (const auto& BuildingColor : BuildingColorCache)
+	for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num() && ColorCount < 10; ++BuildingIndex) // Show first 10 for logging
 	{
-		if (ColorCount < 10) // Show first 10 for logging
-		{
-			FString GmlId = BuildingColor.Key;
-			FLinearColor Color = BuildingColor.Value;
-			FColor SRGBColor = Color.ToFColor(true);
-			FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-			UE_LOG(LogTemp, Warning, TEXT("  BUILDING %s -> %s"), *GmlId, *HexColor);
-		}
+		if (!BuildingStore.HasColor(BuildingIndex)) continue;
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("  BUILDING %s -> %s"), *BuildingStore.ModifiedGmlIds[BuildingIndex], *BuildingStore.GetColorHex(BuildingIndex));
 		ColorCount++;
 	}
+	ColorCount = BuildingStore.NumColoredBuildings();
 	
 	if (ColorCount > 10)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("  ... and %d more buildings"), ColorCount - 10);
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("  ... and %d more buildings"), ColorCount - 10);
 	}
 	
-	if (UWorld* World = GetWorld())
+	// Look for Cesium tileset
+	if (AActor* Actor = GetBuildingsTileset())
 	{
-		// Look for Cesium tileset
-		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("TARGET Found Cesium tileset: %s"), *Actor->GetName());
+		
+		// Skip the style rebuild and the reflection walk when the colors did not change
+		const uint64 ColorMapHash = BuildingStore.GetColorMapHash();
+		if (!BuildingStyleState.NeedsApply(Actor, ColorMapHash))
 		{
-			AActor* Actor = *ActorItr;
-			if (Actor && Actor->GetName().Contains(TEXT("bisingen")))
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SKIP Colors unchanged since the last apply to %s"), *Actor->GetName());
+			return;
+		}
+		
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SEARCH Searching for Cesium styling properties..."));
+		
+		UClass* ActorClass = Actor->GetClass();
+		bool bAppliedStyling = false;
+		FString ColorExpression; // Built on first use; one style serves every property
+		
+		// Try multiple approaches to apply colors
+		
+		// Approach 1: Look for Cesium styling properties
+		for (TFieldIterator<FProperty> PropIt(ActorClass); PropIt; ++PropIt)
+		{
+			FProperty* Property = *PropIt;
+			FString PropName = Property->GetName();
+			
+			if (PropName.Contains(TEXT("Color")))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("TARGET Found Cesium tileset: %s"), *Actor->GetName());
-				UE_LOG(LogTemp, Warning, TEXT("SEARCH Searching for Cesium styling properties..."));
-				
-				UClass* ActorClass = Actor->GetClass();
-				bool bAppliedStyling = false;
-				
-				// Try multiple approaches to apply colors
-				
-				// Approach 1: Look for Cesium styling properties
-				for (TFieldIterator<FProperty> PropIt(ActorClass); PropIt; ++PropIt)
-				{
-					FProperty* Property = *PropIt;
-					FString PropName = Property->GetName();
-					
-					if (PropName.Contains(TEXT("Color")))
-					{
-						FStrProperty* StrProp = CastField<FStrProperty>(Property);
-						if (StrProp)
-						{
-							// Try to set a Cesium color expression
-							FString ColorExpression = CreateCesiumColorExpression();
-							StrProp->SetPropertyValue_InContainer(Actor, ColorExpression);
-							
-							UE_LOG(LogTemp, Warning, TEXT("SUCCESS Applied Cesium color expression to property: %s"), *PropName);
-							UE_LOG(LogTemp, Warning, TEXT("   Expression: %s"), *ColorExpression);
-							bAppliedStyling = true;
-						}
-					}
-				}
-				
-				// Approach 2: Try to set material with average color
-				if (!bAppliedStyling)
+				FStrProperty* StrProp = CastField<FStrProperty>(Property);
+				if (StrProp)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("MATERIAL No Cesium styling properties found. Trying material approach..."));
-					
-					// Calculate average color from all buildings
-					FLinearColor AverageColor = FLinearColor::Black;
-					for (const auto& BuildingColor : BuildingColorCache)
+					// Try to set a Cesium color expression
+					if (ColorExpression.IsEmpty())
 					{
-						AverageColor += BuildingColor.Value;
+						ColorExpression = CreateCesiumColorExpression();
 					}
-					AverageColor /= BuildingColorCache.Num();
-					
-					// Convert to hex for logging
-					FColor SRGBColor = AverageColor.ToFColor(true);
-					FString AverageHex = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-					
-					UE_LOG(LogTemp, Warning, TEXT("COLOR Calculated average color: %s"), *AverageHex);
+					StrProp->SetPropertyValue_InContainer(Actor, ColorExpression);
 					
-					// Try to find and set material properties
-					for (TFieldIterator<FProperty> PropIt(ActorClass); PropIt; ++PropIt)
-					{
-						FProperty* Property = *PropIt;
-						FString PropName = Property->GetName();
-						
-						if (PropName.Contains(TEXT("Material")))
-						{
-							FObjectProperty* ObjProp = CastField<FObjectProperty>(Property);
-							if (ObjProp && ObjProp->PropertyClass->IsChildOf(UMaterialInterface::StaticClass()))
-							{
-								// Set our building energy material
-								if (BuildingEnergyMaterial)
-								{
-									ObjProp->SetObjectPropertyValue_InContainer(Actor, BuildingEnergyMaterial);
-									UE_LOG(LogTemp, Warning, TEXT("SUCCESS Applied BuildingEnergyMaterial to property: %s"), *PropName);
-									bAppliedStyling = true;
-								}
-							}
-						}
-					}
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SUCCESS Applied Cesium color expression to property: %s"), *PropName);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Expression: %s"), *ColorExpression);
+					bAppliedStyling = true;
 				}
-				
-				// Approach 3: Direct mesh component modification
-				if (!bAppliedStyling)
+			}
+		}
+		
+		// Approach 2: Try to set material with average color
+		if (!bAppliedStyling)
+		{
+			UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("MATERIAL No Cesium styling properties found. Trying material approach..."));
+			
+			// Calculate average color from all buildings
+			FLinearColor AverageColor = FLinearColor::Black;
+			for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
+			{
+				if (BuildingStore.HasColor(BuildingIndex))
 				{
-					UE_LOG(LogTemp, Warning, TEXT("🔧 Trying direct mesh component approach..."));
-					CreateMultipleMaterialsForCesium(Actor);
-					bAppliedStyling = true;
+					AverageColor += BuildingStore.GetColor(BuildingIndex);
 				}
+			}
+			AverageColor /= BuildingStore.NumColoredBuildings();
+			
+			// Convert to hex for logging
+			FColor SRGBColor = AverageColor.ToFColor(true);
+			FString AverageHex = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
+			
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLOR Calculated average color: %s"), *AverageHex);
+			
+			// Try to find and set material properties
+			for (TFieldIterator<FProperty> PropIt(ActorClass); PropIt; ++PropIt)
+			{
+				FProperty* Property = *PropIt;
+				FString PropName = Property->GetName();
 				
-				// Fallback: try setting style on tileset components (some Cesium setups store style on component)
-				if (!bAppliedStyling)
+				if (PropName.Contains(TEXT("Material")))
 				{
-					UE_LOG(LogTemp, Warning, TEXT("FALLBACK Trying to set style string on Cesium actor components..."));
-					FString StyleJson = CreateCesiumColorExpression();
-					TArray<UActorComponent*> Components = Actor->GetComponents().Array();
-					for (UActorComponent* Comp : Components)
+					FObjectProperty* ObjProp = CastField<FObjectProperty>(Property);
+					if (ObjProp && ObjProp->PropertyClass->IsChildOf(UMaterialInterface::StaticClass()))
 					{
-						if (!Comp) continue;
-						UClass* CompClass = Comp->GetClass();
-						for (TFieldIterator<FProperty> CompPropIt(CompClass); CompPropIt; ++CompPropIt)
+						// Set our building energy material
+						if (BuildingEnergyMaterial)
 						{
-							FProperty* CompProp = *CompPropIt;
-							FString CompPropName = CompProp->GetName();
-							if (CompPropName.Contains(TEXT("Style")) || CompPropName.Contains(TEXT("style")) || CompPropName.Contains(TEXT("Expression")))
-							{
-								if (FStrProperty* StrProp = CastField<FStrProperty>(CompProp))
-								{
-									StrProp->SetPropertyValue_InContainer(Comp, StyleJson);
-									UE_LOG(LogTemp, Warning, TEXT("SUCCESS Set style on component property: %s"), *CompPropName);
-									bAppliedStyling = true;
-									break;
-								}
-							}
+							ObjProp->SetObjectPropertyValue_InContainer(Actor, BuildingEnergyMaterial);
+							UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SUCCESS Applied BuildingEnergyMaterial to property: %s"), *PropName);
+							bAppliedStyling = true;
 						}
-						if (bAppliedStyling) break;
 					}
 				}
-
-				// Mark actor as modified
-				Actor->Modify();
-				
-				if (bAppliedStyling)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("SUCCESS Successfully applied colors to Cesium tileset!"));
-				}
-				else
+			}
+		}
+		
+		// Approach 3: Direct mesh component modification
+		if (!bAppliedStyling)
+		{
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🔧 Trying direct mesh component approach..."));
+			CreateMultipleMaterialsForCesium(Actor);
+			bAppliedStyling = true;
+		}
+		
+		// Fallback: try setting style on tileset components (some Cesium setups store style on component)
+		if (!bAppliedStyling)
+		{
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("FALLBACK Trying to set style string on Cesium actor components..."));
+			FString StyleJson = CreateCesiumColorExpression();
+			TArray<UActorComponent*> Components = Actor->GetComponents().Array();
+			for (UActorComponent* Comp : Components)
+			{
+				if (!Comp) continue;
+				UClass* CompClass = Comp->GetClass();
+				for (TFieldIterator<FProperty> CompPropIt(CompClass); CompPropIt; ++CompPropIt)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("WARNING Could not find suitable properties to apply colors"));
+					FProperty* CompProp = *CompPropIt;
+					FString CompPropName = CompProp->GetName();
+					if (CompPropName.Contains(TEXT("Style")) || CompPropName.Contains(TEXT("style")) || CompPropName.Contains(TEXT("Expression")))
+					{
+						if (FStrProperty* StrProp = CastField<FStrProperty>(CompProp))
+						{
+							StrProp->SetPropertyValue_InContainer(Comp, StyleJson);
+							UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SUCCESS Set style on component property: %s"), *CompPropName);
+							bAppliedStyling = true;
+							break;
+						}
+					}
 				}
-				
-				break;
+				if (bAppliedStyling) break;
 			}
 		}
+
+		// Mark actor as modified
+		Actor->Modify();
+		
+		if (bAppliedStyling)
+		{
+			BuildingStyleState.MarkApplied(Actor, ColorMapHash);
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SUCCESS Successfully applied colors to Cesium tileset!"));
+		}
+		else
+		{
+			UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING Could not find suitable properties to apply colors"));
+		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("COLOR Color application complete. Check the Cesium tileset for changes."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("COLOR Color application complete. Check the Cesium tileset for changes."));
 }
 
 FString ABuildingEnergyDisplay::CreateCesiumColorExpression()
 {
+	BUILDING_ENERGY_SCOPE(StyleGeneration);
 	// IMPORTANT: This function MUST return full 3D Tiles Styling JSON (not just an expression),
 	// because we apply it via ACesium3DTileset::SetTilesetStyleFromJson.
 	// Keep everything ONE LINE to avoid TEXT() macro newline issues.
@@ -3242,142 +3755,82 @@ FString ABuildingEnergyDisplay::CreateCesiumColorExpression()
 
 
 	// If cache empty, apply a visible default so you know styling is active.
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 CESIUM STYLE: BuildingColorCache is EMPTY! No colors to apply. Check if BuildCesiumStyleJsonFromCache was called."));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 CESIUM STYLE: BuildingStore has no colors! No colors to apply. Check if the building data was loaded."));
 		return TEXT("{\"color\":{\"evaluate\":\"color('#ffffff')\"}}");
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM STYLE: Creating style JSON from %d buildings in cache"), BuildingColorCache.Num());
-
-	// Build: {"color":["match", <FeatureIdExpr>, "ID1","#HEX1", "ID2","#HEX2", "#ffffff"]}
-	FString StyleJson = TEXT("{\"color\":[\"match\",");
-	StyleJson += FeatureIdExpr;
-	StyleJson += TEXT(",");
-
-	int32 Added = 0;
-	for (const auto& BuildingColor : BuildingColorCache)
-	{
-		const FString& GmlId = BuildingColor.Key;
-		const FLinearColor Color = BuildingColor.Value;
-		const FColor SRGBColor = Color.ToFColor(true);
-		const FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-
-		// Escape quotes in GML ID for JSON
-		FString SafeGmlId = GmlId;
-		SafeGmlId.ReplaceInline(TEXT("\""), TEXT("\\\""));
-
-		UE_LOG(LogTemp, Log, TEXT("🎨 CESIUM STYLE: Adding mapping - GML ID: '%s' -> Color: %s (R:%.2f G:%.2f B:%.2f)"), 
-			*SafeGmlId, *HexColor, Color.R, Color.G, Color.B);
-
-		// Append: "ID","#HEX",
-		StyleJson += FString::Printf(TEXT("\"%s\",\"%s\","), *SafeGmlId, *HexColor);
-		Added++;
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM STYLE: Creating style JSON from %d buildings in cache"), BuildingStore.NumColoredBuildings());
 
-		// Guard against extremely long styles (can break some runtimes)
-		if (StyleJson.Len() > 200000)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM STYLE: JSON truncated after %d entries (length=%d)"), Added, StyleJson.Len());
-			break;
-		}
-	}
+	// One match arm per palette color, each listing its ids. The style state keeps the arms
+	// between calls and only regenerates those touched by the store's color dirty set
+	const FString& StyleJson = BuildingStyleState.BuildStyleJson(BuildingStore, FeatureIdExpr);
 
-	// Default fallback color
-	StyleJson += TEXT("\"#ffffff\"]}");
-
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM STYLE: Final JSON built (entries=%d, length=%d bytes)"), Added, StyleJson.Len());
-	UE_LOG(LogTemp, Log, TEXT("🎨 CESIUM STYLE: Full Style JSON:\n%s"), *StyleJson);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM STYLE: Final JSON built (buildings=%d, color arms=%d, length=%d bytes)"),
+		BuildingStore.NumColoredBuildings(), BuildingStore.Palette.Num(), StyleJson.Len());
+	UE_LOG(LogBuildingEnergyStyle, Verbose, TEXT("🎨 CESIUM STYLE: Full Style JSON:\n%s"), *StyleJson);
 	
 	return StyleJson;
 }
 
 void ABuildingEnergyDisplay::SetupCesiumColorMaterial()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎨 SETUP: Initializing Cesium color material..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 SETUP: Initializing Cesium color material..."));
 
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 SETUP: BuildingColorCache is empty! Load data first using AuthenticateAndLoadData() or PreloadAllBuildingData()"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 SETUP: BuildingStore has no colors! Load data first using AuthenticateAndLoadData() or PreloadAllBuildingData()"));
 		return;
 	}
 
 	// Find or create the bisingen tileset
-	ACesium3DTileset* BisigenTileset = nullptr;
-	if (UWorld* World = GetWorld())
-	{
-		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
-		{
-			AActor* Actor = *ActorItr;
-			if (Actor && Actor->GetName().Contains(TEXT("bisingen")))
-			{
-				BisigenTileset = Cast<ACesium3DTileset>(Actor);
-				if (BisigenTileset)
-				{
-					break;
-				}
-			}
-		}
-	}
+	ACesium3DTileset* BisigenTileset = GetBuildingsTileset();
 
 	if (!BisigenTileset)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 SETUP: Could not find bisingen Cesium tileset in the world!"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 SETUP: Could not find bisingen Cesium tileset in the world!"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("🎨 SETUP: Found bisingen tileset: %s"), *BisigenTileset->GetName());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 SETUP: Found bisingen tileset: %s"), *BisigenTileset->GetName());
 	
 	// Create a dynamic material instance if we have a base material
 	if (!BuildingEnergyMaterial)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 SETUP: BuildingEnergyMaterial not set. Creating a basic material..."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 SETUP: BuildingEnergyMaterial not set. Creating a basic material..."));
 		BuildingEnergyMaterial = CreateBuildingEnergyMaterial();
 	}
 
 	// Apply the material to the tileset
 	ApplyColorLookupMaterialToTileset(BisigenTileset);
 
-	UE_LOG(LogTemp, Warning, TEXT("🎨 SETUP: Material setup complete!"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 SETUP: Material setup complete!"));
 }
 
 void ABuildingEnergyDisplay::ApplyTilesetColors()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎨 APPLY: Applying tileset colors..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 APPLY: Applying tileset colors..."));
 
 	// Find the bisingen tileset
-	ACesium3DTileset* BisigenTileset = nullptr;
-	if (UWorld* World = GetWorld())
-	{
-		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
-		{
-			AActor* Actor = *ActorItr;
-			if (Actor && Actor->GetName().Contains(TEXT("bisingen")))
-			{
-				BisigenTileset = Cast<ACesium3DTileset>(Actor);
-				if (BisigenTileset)
-				{
-					break;
-				}
-			}
-		}
-	}
+	ACesium3DTileset* BisigenTileset = GetBuildingsTileset();
 
 	if (!BisigenTileset)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 APPLY: bisingen tileset not found in world"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 APPLY: bisingen tileset not found in world"));
 		return;
 	}
 
 	// Try both approaches to apply colors
-	UE_LOG(LogTemp, Warning, TEXT("🎨 APPLY: Attempting to apply %d building colors to tileset..."), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 APPLY: Attempting to apply %d building colors to tileset..."), BuildingStore.NumColoredBuildings());
 	ApplyCesiumTilesetStyling(BisigenTileset);
-	UE_LOG(LogTemp, Warning, TEXT("🎨 APPLY: Color application complete!"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 APPLY: Color application complete!"));
 }
 
 
 void ABuildingEnergyDisplay::CreateTestColors()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🌈 Creating test colors to demonstrate per-building coloring..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🌈 Creating test colors to demonstrate per-building coloring..."));
 	
 	// Get the first few buildings and assign them different colors
 	int32 ColorIndex = 0;
@@ -3394,77 +3847,61 @@ void ABuildingEnergyDisplay::CreateTestColors()
 		TEXT("#ff0080")  // Pink
 	};
 	
-	for (auto& BuildingColor : BuildingColorCache)
+	for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
 	{
 		if (ColorIndex >= TestColors.Num())
 		{
 			break; // Only color the first 10 buildings with different colors
 		}
+		if (!BuildingStore.HasColor(BuildingIndex)) continue;
 		
 		FString TestColorHex = TestColors[ColorIndex];
 		FLinearColor TestColor = ConvertHexToLinearColor(TestColorHex);
 		
 		// Update the building color
-		BuildingColor.Value = TestColor;
+		BuildingStore.SetColor(BuildingIndex, TestColor);
 		
-		UE_LOG(LogTemp, Warning, TEXT("TEST Assigned test color %s to building %s"), 
-			*TestColorHex, *BuildingColor.Key);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("TEST Assigned test color %s to building %s"), 
+			*TestColorHex, *BuildingStore.ModifiedGmlIds[BuildingIndex]);
 		
 		ColorIndex++;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("SUCCESS Created %d test colors for demonstration"), ColorIndex);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SUCCESS Created %d test colors for demonstration"), ColorIndex);
 }
 
 void ABuildingEnergyDisplay::CreateTextureBasedMaterial()
 {
-	UE_LOG(LogTemp, Warning, TEXT("MATERIAL Creating texture-based material for Cesium manual assignment..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("MATERIAL Creating texture-based material for Cesium manual assignment..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No building colors cached. Using default colors..."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING No building colors cached. Using default colors..."));
 		// Create some default colors for testing
-		BuildingColorCache.Add(TEXT("TEST_001"), ConvertHexToLinearColor(TEXT("#ff0000"))); // Red
-		BuildingColorCache.Add(TEXT("TEST_002"), ConvertHexToLinearColor(TEXT("#00ff00"))); // Green
-		BuildingColorCache.Add(TEXT("TEST_003"), ConvertHexToLinearColor(TEXT("#0000ff"))); // Blue
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("TEST_001")), ConvertHexToLinearColor(TEXT("#ff0000"))); // Red
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("TEST_002")), ConvertHexToLinearColor(TEXT("#00ff00"))); // Green
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("TEST_003")), ConvertHexToLinearColor(TEXT("#0000ff"))); // Blue
 	}
 	
 	// Calculate representative color from all building colors
 	FLinearColor RepresentativeColor = FLinearColor::Black;
-	TMap<FString, int32> ColorFrequency;
 	
 	// Find the most common color
-	for (const auto& BuildingColor : BuildingColorCache)
-	{
-		FLinearColor Color = BuildingColor.Value;
-		FColor SRGBColor = Color.ToFColor(true);
-		FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-		
-		if (ColorFrequency.Contains(HexColor))
-		{
-			ColorFrequency[HexColor]++;
-		}
-		else
-		{
-			ColorFrequency.Add(HexColor, 1);
-		}
-	}
-	
-	// Find most frequent color
+	const TArray<int32> ColorFrequency = BuildingStore.CountBuildingsPerColorClass();
 	FString MostFrequentColor = TEXT("#808080");
 	int32 MaxCount = 0;
-	for (const auto& ColorCount : ColorFrequency)
+	for (int32 ColorClass = 0; ColorClass < ColorFrequency.Num(); ++ColorClass)
 	{
-		if (ColorCount.Value > MaxCount)
+		if (ColorFrequency[ColorClass] > MaxCount)
 		{
-			MaxCount = ColorCount.Value;
-			MostFrequentColor = ColorCount.Key;
+			MaxCount = ColorFrequency[ColorClass];
+			MostFrequentColor = BuildingStore.PaletteHex[ColorClass];
 		}
 	}
 	
 	RepresentativeColor = ConvertHexToLinearColor(MostFrequentColor);
 	
-	UE_LOG(LogTemp, Warning, TEXT("STATS Most common building color: %s (%d buildings)"), *MostFrequentColor, MaxCount);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("STATS Most common building color: %s (%d buildings)"), *MostFrequentColor, MaxCount);
 	
 	// Create a material that represents the building energy colors
 	UMaterialInterface* BaseMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
@@ -3489,37 +3926,29 @@ void ABuildingEnergyDisplay::CreateTextureBasedMaterial()
 			BuildingEnergyMaterial->SetScalarParameterValue(TEXT("Opacity"), 1.0f);
 			BuildingEnergyMaterial->SetScalarParameterValue(TEXT("Specular"), 0.5f);
 			
-			UE_LOG(LogTemp, Warning, TEXT("SUCCESS Created BuildingEnergyMaterial with color: %s"), *MostFrequentColor);
-			UE_LOG(LogTemp, Warning, TEXT("READY Material is ready for manual assignment to Cesium tileset!"));
-			UE_LOG(LogTemp, Warning, TEXT("INFO Instructions:"));
-			UE_LOG(LogTemp, Warning, TEXT("   1. Select your Cesium tileset (bisingen)"));
-			UE_LOG(LogTemp, Warning, TEXT("   2. In Details panel, find the Material property"));
-			UE_LOG(LogTemp, Warning, TEXT("   3. Drag the BuildingEnergyMaterial from this actor"));
-			UE_LOG(LogTemp, Warning, TEXT("   4. Drop it into the Cesium Material slot"));
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SUCCESS Created BuildingEnergyMaterial with color: %s"), *MostFrequentColor);
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("READY Material is ready for manual assignment to Cesium tileset!"));
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("INFO Instructions:"));
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   1. Select your Cesium tileset (bisingen)"));
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   2. In Details panel, find the Material property"));
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   3. Drag the BuildingEnergyMaterial from this actor"));
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   4. Drop it into the Cesium Material slot"));
 			
 			// Also try to automatically find and list Cesium material properties
-			if (UWorld* World = GetWorld())
+			if (AActor* Actor = GetBuildingsTileset())
 			{
-				for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+				UE_LOG(LogBuildingEnergyStyle, Log, TEXT("TARGET Found Cesium tileset for reference: %s"), *Actor->GetName());
+				UE_LOG(LogBuildingEnergyStyle, Log, TEXT("PROPS Available material properties on Cesium tileset:"));
+				
+				UClass* ActorClass = Actor->GetClass();
+				for (TFieldIterator<FProperty> PropIt(ActorClass); PropIt; ++PropIt)
 				{
-					AActor* Actor = *ActorItr;
-					if (Actor && Actor->GetName().Contains(TEXT("bisingen")))
+					FProperty* Property = *PropIt;
+					FString PropName = Property->GetName();
+					
+					if (PropName.Contains(TEXT("Material")) || PropName.Contains(TEXT("Color")))
 					{
-						UE_LOG(LogTemp, Warning, TEXT("TARGET Found Cesium tileset for reference: %s"), *Actor->GetName());
-						UE_LOG(LogTemp, Warning, TEXT("PROPS Available material properties on Cesium tileset:"));
-						
-						UClass* ActorClass = Actor->GetClass();
-						for (TFieldIterator<FProperty> PropIt(ActorClass); PropIt; ++PropIt)
-						{
-							FProperty* Property = *PropIt;
-							FString PropName = Property->GetName();
-							
-							if (PropName.Contains(TEXT("Material")) || PropName.Contains(TEXT("Color")))
-							{
-								UE_LOG(LogTemp, Warning, TEXT("   PROP %s (%s)"), *PropName, *Property->GetClass()->GetName());
-							}
-						}
-						break;
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   PROP %s (%s)"), *PropName, *Property->GetClass()->GetName());
 					}
 				}
 			}
@@ -3530,75 +3959,61 @@ void ABuildingEnergyDisplay::CreateTextureBasedMaterial()
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("ERROR Failed to create dynamic material instance"));
+			UE_LOG(LogBuildingEnergyStyle, Error, TEXT("ERROR Failed to create dynamic material instance"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Failed to load base material"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("ERROR Failed to load base material"));
 	}
 }
 
 void ABuildingEnergyDisplay::CreatePerBuildingColorMaterial()
 {
-	UE_LOG(LogTemp, Error, TEXT("🚀 === CREATE PER BUILDING COLOR MATERIAL START ==="));
-	UE_LOG(LogTemp, Warning, TEXT("MATERIAL Creating per-building color material using conditional styling approach..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 === CREATE PER BUILDING COLOR MATERIAL START ==="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("MATERIAL Creating per-building color material using conditional styling approach..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No building colors cached. Creating sample data..."));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING No building colors cached. Creating sample data..."));
 		return;
 	}
 	
 	// Log the color variety we're working with
-	UE_LOG(LogTemp, Warning, TEXT("🌈 Building Color Breakdown:"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🌈 Building Color Breakdown:"));
 
 	// DEBUG: Check for known problematic building IDs and report sample color
-	UE_LOG(LogTemp, Warning, TEXT("DEBUG Checking BuildingColorCache for problematic IDs (DEBW_0010008 / wfbT)..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("DEBUG Checking BuildingStore for problematic IDs (DEBW_0010008 / wfbT)..."));
 	{
 		bool bFoundProblematic = false;
-		for (const auto& BuildingColor : BuildingColorCache)
+		for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num() && !bFoundProblematic; ++BuildingIndex)
 		{
-			const FString& Key = BuildingColor.Key;
-			if (Key.Contains(TEXT("DEBW_0010008")) || Key.Contains(TEXT("wfbT")))
+			if (!BuildingStore.HasColor(BuildingIndex)) continue;
+			for (const FString* Key : { &BuildingStore.ModifiedGmlIds[BuildingIndex], &BuildingStore.ActualGmlIds[BuildingIndex] })
 			{
-				FColor SRGB = BuildingColor.Value.ToFColor(true);
-				FString Hex = FString::Printf(TEXT("#%02X%02X%02X"), SRGB.R, SRGB.G, SRGB.B);
-				UE_LOG(LogTemp, Warning, TEXT("DEBUG Found problematic building in cache: %s -> %s"), *Key, *Hex);
-				bFoundProblematic = true;
-				break;
+				if (Key->Contains(TEXT("DEBW_0010008")) || Key->Contains(TEXT("wfbT")))
+				{
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("DEBUG Found problematic building in cache: %s -> %s"), **Key, *BuildingStore.GetColorHex(BuildingIndex));
+					bFoundProblematic = true;
+					break;
+				}
 			}
 		}
 		if (!bFoundProblematic)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("DEBUG No problematic building IDs found in BuildingColorCache"));
-		}
-	}
-	TMap<FString, int32> ColorStats;
-	
-	for (const auto& BuildingColor : BuildingColorCache)
-	{
-		FColor SRGBColor = BuildingColor.Value.ToFColor(true);
-		FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-		
-		if (ColorStats.Contains(HexColor))
-		{
-			ColorStats[HexColor]++;
-		}
-		else
-		{
-			ColorStats.Add(HexColor, 1);
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("DEBUG No problematic building IDs found in BuildingStore"));
 		}
 	}
+	const TArray<int32> ColorStats = BuildingStore.CountBuildingsPerColorClass();
 	
-	UE_LOG(LogTemp, Warning, TEXT("STATS Total buildings with colors: %d"), BuildingColorCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("STATS Unique colors found: %d"), ColorStats.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("STATS Total buildings with colors: %d"), BuildingStore.NumColoredBuildings());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("STATS Unique colors found: %d"), ColorStats.Num());
 	
 	// Show top colors
 	TArray<TPair<FString, int32>> SortedColors;
-	for (const auto& ColorStat : ColorStats)
+	for (int32 ColorClass = 0; ColorClass < ColorStats.Num(); ++ColorClass)
 	{
-		SortedColors.Add(TPair<FString, int32>(ColorStat.Key, ColorStat.Value));
+		SortedColors.Add(TPair<FString, int32>(BuildingStore.PaletteHex[ColorClass], ColorStats[ColorClass]));
 	}
 	
 	SortedColors.Sort([](const TPair<FString, int32>& A, const TPair<FString, int32>& B)
@@ -3606,105 +4021,39 @@ void ABuildingEnergyDisplay::CreatePerBuildingColorMaterial()
 		return A.Value > B.Value; // Sort by count, descending
 	});
 	
-	UE_LOG(LogTemp, Warning, TEXT("STATS Top building colors in your dataset:"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("STATS Top building colors in your dataset:"));
 	for (int32 i = 0; i < FMath::Min(10, SortedColors.Num()); i++)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("   %s: %d buildings"), *SortedColors[i].Key, SortedColors[i].Value);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   %s: %d buildings"), *SortedColors[i].Key, SortedColors[i].Value);
 	}
 	
 	// Apply colors using Cesium conditional styling approach (like your JavaScript version)
-	UE_LOG(LogTemp, Error, TEXT("🚀 === ABOUT TO CALL ApplyOfficialCesiumMetadataVisualization ==="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 === ABOUT TO CALL ApplyOfficialCesiumMetadataVisualization ==="));
 	ApplyOfficialCesiumMetadataVisualization();
-	UE_LOG(LogTemp, Error, TEXT("🚀 === CREATE PER BUILDING COLOR MATERIAL END ==="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 === CREATE PER BUILDING COLOR MATERIAL END ==="));
 }
 
 void ABuildingEnergyDisplay::ApplyConditionalStylingToTileset()
 {
-	UE_LOG(LogTemp, Warning, TEXT("DEBUG === CONDITIONAL STYLING DEBUG START ==="));
-	UE_LOG(LogTemp, Warning, TEXT("DEBUG Applying conditional styling to Cesium tileset (JavaScript approach)..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("DEBUG === CONDITIONAL STYLING DEBUG START ==="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("DEBUG Applying conditional styling to Cesium tileset (JavaScript approach)..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No building colors available for styling"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING No building colors available for styling"));
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("DEBUG Building %d conditions from BuildingColorCache..."), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("DEBUG Building %d conditions from BuildingStore..."), BuildingStore.NumColoredBuildings());
 	
 	// Find Cesium 3D Tileset actor in the level
-	AActor* CesiumActor = nullptr;
+	AActor* CesiumActor = GetBuildingsTileset();
 	UWorld* World = GetWorld();
-	if (World)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("SEARCH Searching for Cesium actors in level..."));
-		
-		// List all Cesium-related actors and look for "bisingen" specifically
-		TArray<AActor*> AllCesiumActors;
-		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
-		{
-			AActor* CurrentActor = *ActorItr;
-			if (CurrentActor)
-			{
-				FString ActorName = CurrentActor->GetName();
-				FString ClassName = CurrentActor->GetClass()->GetName();
-				
-				// Log all actors that might be relevant
-				if (ClassName.Contains(TEXT("Cesium")) || ActorName.Contains(TEXT("bisingen")))
-				{
-					AllCesiumActors.Add(CurrentActor);
-					UE_LOG(LogTemp, Warning, TEXT("   Found actor: %s (Class: %s)"), *ActorName, *ClassName);
-				}
-			}
-		}
-		
-		// Look specifically for "bisingen" tileset first
-		for (AActor* Actor : AllCesiumActors)
-		{
-			FString ActorName = Actor->GetName();
-			if (ActorName.Contains(TEXT("bisingen")))
-			{
-				UE_LOG(LogTemp, Warning, TEXT("TARGET Selected bisingen tileset actor: %s (Class: %s)"), 
-					*ActorName, *Actor->GetClass()->GetName());
-				CesiumActor = Actor;
-				break;
-			}
-		}
-		
-		// Fallback to Cesium3DTileset class
-		if (!CesiumActor)
-		{
-			for (AActor* Actor : AllCesiumActors)
-			{
-				if (Actor->GetClass()->GetName().Contains(TEXT("Cesium3DTileset")) || 
-					Actor->GetClass()->GetName().Contains(TEXT("3DTileset")))
-				{
-					UE_LOG(LogTemp, Warning, TEXT("TARGET Selected Cesium3DTileset actor: %s"), *Actor->GetClass()->GetName());
-					CesiumActor = Actor;
-					break;
-				}
-			}
-		}
-		
-		// Final fallback to any non-georeference Cesium actor
-		if (!CesiumActor)
-		{
-			for (AActor* Actor : AllCesiumActors)
-			{
-				// Skip CesiumGeoreference as it's just for positioning
-				if (!Actor->GetClass()->GetName().Contains(TEXT("CesiumGeoreference")))
-				{
-					UE_LOG(LogTemp, Warning, TEXT("FALLBACK Using fallback Cesium actor: %s"), *Actor->GetClass()->GetName());
-					CesiumActor = Actor;
-					break;
-				}
-			}
-		}
-	}
 	
 	if (!CesiumActor)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ERROR No Cesium tileset actor found in level"));
-		UE_LOG(LogTemp, Warning, TEXT("SEARCH Available actors in level:"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("ERROR No Cesium tileset actor found in level"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SEARCH Available actors in level:"));
 		if (World)
 		{
 			int32 ActorCount = 0;
@@ -3713,7 +4062,7 @@ void ABuildingEnergyDisplay::ApplyConditionalStylingToTileset()
 				AActor* CurrentActor = *ActorItr;
 				if (CurrentActor)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("   Actor %d: %s"), ActorCount++, *CurrentActor->GetClass()->GetName());
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Actor %d: %s"), ActorCount++, *CurrentActor->GetClass()->GetName());
 					if (ActorCount >= 10) break; // Show first 10 actors
 				}
 			}
@@ -3722,57 +4071,58 @@ void ABuildingEnergyDisplay::ApplyConditionalStylingToTileset()
 	}
 	
 	// Build conditional styling expression similar to your JavaScript
-	UE_LOG(LogTemp, Warning, TEXT("BUILD Building conditions for %d buildings..."), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("BUILD Building conditions for %d buildings..."), BuildingStore.NumColoredBuildings());
 	
 	// Show first 5 conditions as examples
 	TArray<FString> ConditionPairs;
 	int32 ConditionCount = 0;
 	
-	for (const auto& BuildingColor : BuildingColorCache)
+	for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
 	{
-		FString BuildingId = BuildingColor.Key;
-		FLinearColor Color = BuildingColor.Value;
-		
-		// Convert LinearColor back to hex
-		FColor SRGBColor = Color.ToFColor(true);
-		FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
+		if (!BuildingStore.HasColor(BuildingIndex)) continue;
 		
-		// Create condition like JavaScript: '${gml:id}' === 'building_id'
-		FString Condition = FString::Printf(TEXT("'${gml:id}' === '%s'"), *BuildingId);
+		// Hex comes straight from the palette
+		const FString& HexColor = BuildingStore.GetColorHex(BuildingIndex);
 		FString ColorAction = FString::Printf(TEXT("color('%s')"), *HexColor);
 		
-		// Add to conditions
-		ConditionPairs.Add(FString::Printf(TEXT("[\"%s\", \"%s\"]"), 
-			*Condition.Replace(TEXT("\""), TEXT("\\\"")), 
-			*ColorAction.Replace(TEXT("\""), TEXT("\\\""))));
-		
-		// Show first 5 conditions for debugging
-		if (ConditionCount < 5)
+		for (const FString* BuildingId : { &BuildingStore.ModifiedGmlIds[BuildingIndex], &BuildingStore.ActualGmlIds[BuildingIndex] })
 		{
-			UE_LOG(LogTemp, Warning, TEXT("   Condition %d: Building %s -> Color %s"), 
-				ConditionCount + 1, *BuildingId, *HexColor);
-			UE_LOG(LogTemp, Warning, TEXT("     Full condition: %s"), *ConditionPairs.Last());
+			// Create condition like JavaScript: '${gml:id}' === 'building_id'
+			FString Condition = FString::Printf(TEXT("'${gml:id}' === '%s'"), **BuildingId);
+			
+			// Add to conditions
+			ConditionPairs.Add(FString::Printf(TEXT("[\"%s\", \"%s\"]"), 
+				*Condition.Replace(TEXT("\""), TEXT("\\\"")), 
+				*ColorAction.Replace(TEXT("\""), TEXT("\\\""))));
+			
+			// Show first 5 conditions for debugging
+			if (ConditionCount < 5)
+			{
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Condition %d: Building %s -> Color %s"), 
+					ConditionCount + 1, **BuildingId, *HexColor);
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("     Full condition: %s"), *ConditionPairs.Last());
+			}
+			ConditionCount++;
 		}
-		ConditionCount++;
 	}
 	
 	// Add fallback condition (white for unmatched buildings)
 	ConditionPairs.Add(TEXT("[\"true\", \"color('#FFFFFF')\"]"));
-	UE_LOG(LogTemp, Warning, TEXT("   Fallback condition: [\"true\", \"color('#FFFFFF')\"]"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   Fallback condition: [\"true\", \"color('#FFFFFF')\"]"));
 	
 	// Join all conditions
 	FString ConditionsArray = TEXT("[") + FString::Join(ConditionPairs, TEXT(", ")) + TEXT("]");
 	
-	UE_LOG(LogTemp, Warning, TEXT("RULES Created %d conditional styling rules"), ConditionPairs.Num() - 1);
-	UE_LOG(LogTemp, Warning, TEXT("CONDITIONS Complete conditions array: %s"), *ConditionsArray.Left(500));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("RULES Created %d conditional styling rules"), ConditionPairs.Num() - 1);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("CONDITIONS Complete conditions array: %s"), *ConditionsArray.Left(500));
 	if (ConditionsArray.Len() > 500)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("TRUNCATED ... (truncated, full length: %d characters)"), ConditionsArray.Len());
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("TRUNCATED ... (truncated, full length: %d characters)"), ConditionsArray.Len());
 	}
 	
 	// Create complete style JSON
 	FString StyleJSON = FString::Printf(TEXT("{\"color\": {\"conditions\": %s}}"), *ConditionsArray);
-	UE_LOG(LogTemp, Warning, TEXT("STYLE Style JSON (first 300 chars): %s"), *StyleJSON.Left(300));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("STYLE Style JSON (first 300 chars): %s"), *StyleJSON.Left(300));
 	
 	// Try to apply styling through Cesium component properties
 	if (UActorComponent* CesiumComponent = CesiumActor->GetComponentByClass(UActorComponent::StaticClass()))
@@ -3781,20 +4131,20 @@ void ABuildingEnergyDisplay::ApplyConditionalStylingToTileset()
 		TArray<UActorComponent*> TilesetComponents;
 		CesiumActor->GetComponents<UActorComponent>(TilesetComponents);
 		
-		UE_LOG(LogTemp, Warning, TEXT("SEARCH Found %d components on Cesium actor"), TilesetComponents.Num());
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SEARCH Found %d components on Cesium actor"), TilesetComponents.Num());
 		
 		for (UActorComponent* Component : TilesetComponents)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("   Component: %s"), *Component->GetClass()->GetName());
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Component: %s"), *Component->GetClass()->GetName());
 			
 			if (Component->GetClass()->GetName().Contains(TEXT("Cesium3DTileset")))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("TARGET Found Cesium3DTileset component: %s"), *Component->GetClass()->GetName());
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("TARGET Found Cesium3DTileset component: %s"), *Component->GetClass()->GetName());
 				
 				// Try to apply styling through reflection (property access)
 				UClass* ComponentClass = Component->GetClass();
 				
-				UE_LOG(LogTemp, Warning, TEXT("SEARCH Searching for style properties on %s..."), *ComponentClass->GetName());
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SEARCH Searching for style properties on %s..."), *ComponentClass->GetName());
 				
 				// Look for style-related properties
 				bool bFoundStyleProperty = false;
@@ -3809,17 +4159,17 @@ void ABuildingEnergyDisplay::ApplyConditionalStylingToTileset()
 						PropName.Contains(TEXT("Cesium")) || PropName.Contains(TEXT("Render")) ||
 						PropName.Contains(TEXT("Feature")) || PropName.Contains(TEXT("Expression")))
 					{
-						UE_LOG(LogTemp, Warning, TEXT("SEARCH Found potentially relevant property: %s (Type: %s)"), 
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SEARCH Found potentially relevant property: %s (Type: %s)"), 
 							*PropName, *Property->GetCPPType());
 						
 						// Try to set any string property that might be styling-related
 						if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
 						{
-							UE_LOG(LogTemp, Warning, TEXT("SETTING Attempting to set string property: %s"), *PropName);
+							UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SETTING Attempting to set string property: %s"), *PropName);
 							StrProperty->SetPropertyValue_InContainer(Component, StyleJSON);
 							Component->Modify();
 							bFoundStyleProperty = true;
-							UE_LOG(LogTemp, Warning, TEXT("SUCCESS Applied conditional styling to property: %s"), *PropName);
+							UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SUCCESS Applied conditional styling to property: %s"), *PropName);
 						}
 					}
 				}
@@ -3827,7 +4177,7 @@ void ABuildingEnergyDisplay::ApplyConditionalStylingToTileset()
 				// If no obvious style properties found, try alternative approaches
 				if (!bFoundStyleProperty)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("WARNING No direct style properties found. Trying alternative approaches..."));
+					UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING No direct style properties found. Trying alternative approaches..."));
 					
 					// Try to call methods on the component
 					UClass* ComponentClassForMethods = Component->GetClass();
@@ -3841,18 +4191,18 @@ void ABuildingEnergyDisplay::ApplyConditionalStylingToTileset()
 						if (FuncName.Contains(TEXT("Style")) || FuncName.Contains(TEXT("Color")) || 
 							FuncName.Contains(TEXT("SetMaterial")) || FuncName.Contains(TEXT("Apply")))
 						{
-							UE_LOG(LogTemp, Warning, TEXT("🔧 Found potential styling function: %s"), *FuncName);
+							UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🔧 Found potential styling function: %s"), *FuncName);
 						}
 					}
 					
 					// Alternative: Try to modify the material directly if possible
-					UE_LOG(LogTemp, Warning, TEXT("INFO ALTERNATIVE SOLUTION NEEDED:"));
-					UE_LOG(LogTemp, Warning, TEXT("   Cesium for Unreal may not support direct JSON styling"));
-					UE_LOG(LogTemp, Warning, TEXT("   Consider these approaches:"));
-					UE_LOG(LogTemp, Warning, TEXT("   1. MATERIAL Use material overrides on mesh components"));
-					UE_LOG(LogTemp, Warning, TEXT("   2. 🔧 Implement custom shader with building ID lookup"));
-					UE_LOG(LogTemp, Warning, TEXT("   3. VERTEX Use vertex colors if tileset supports them"));
-					UE_LOG(LogTemp, Warning, TEXT("   4. EXTERNAL Generate styled tileset externally with cesium-native"));
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("INFO ALTERNATIVE SOLUTION NEEDED:"));
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Cesium for Unreal may not support direct JSON styling"));
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Consider these approaches:"));
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   1. MATERIAL Use material overrides on mesh components"));
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   2. 🔧 Implement custom shader with building ID lookup"));
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   3. VERTEX Use vertex colors if tileset supports them"));
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   4. EXTERNAL Generate styled tileset externally with cesium-native"));
 				}
 				break;
 			}
@@ -3860,68 +4210,31 @@ void ABuildingEnergyDisplay::ApplyConditionalStylingToTileset()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ERROR No components found on Cesium actor"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("ERROR No components found on Cesium actor"));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("STYLE Conditional styling applied using approach similar to your JavaScript version"));
-	UE_LOG(LogTemp, Warning, TEXT("INFO This mimics: tileSet.style = new Cesium3DTileStyle({ color: { conditions: [...] } })"));
-	UE_LOG(LogTemp, Warning, TEXT("DEBUG === CONDITIONAL STYLING DEBUG END ==="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("STYLE Conditional styling applied using approach similar to your JavaScript version"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("INFO This mimics: tileSet.style = new Cesium3DTileStyle({ color: { conditions: [...] } })"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("DEBUG === CONDITIONAL STYLING DEBUG END ==="));
 }
 
 void ABuildingEnergyDisplay::ApplyOfficialCesiumMetadataVisualization()
 {
-	UE_LOG(LogTemp, Warning, TEXT("METADATA === OFFICIAL CESIUM METADATA VISUALIZATION START ==="));
-	UE_LOG(LogTemp, Warning, TEXT("METADATA Implementing official Cesium for Unreal metadata approach..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("METADATA === OFFICIAL CESIUM METADATA VISUALIZATION START ==="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("METADATA Implementing official Cesium for Unreal metadata approach..."));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No building colors available for visualization"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING No building colors available for visualization"));
 		return;
 	}
 	
-	// Find the Cesium 3D Tileset actor (bisingen)
-	AActor* CesiumActor = nullptr;
-	UWorld* World = GetWorld();
-	if (World)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("SEARCH Searching for bisingen Cesium tileset..."));
-		
-		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
-		{
-			AActor* CurrentActor = *ActorItr;
-			if (CurrentActor)
-			{
-				FString ActorName = CurrentActor->GetName();
-				if (ActorName.Contains(TEXT("bisingen")))
-				{
-					UE_LOG(LogTemp, Warning, TEXT("TARGET Found bisingen tileset: %s (Class: %s)"), 
-						*ActorName, *CurrentActor->GetClass()->GetName());
-					CesiumActor = CurrentActor;
-					break;
-				}
-			}
-		}
-		
-		// Fallback to any Cesium3DTileset
-		if (!CesiumActor)
-		{
-			for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
-			{
-				AActor* CurrentActor = *ActorItr;
-				if (CurrentActor && CurrentActor->GetClass()->GetName().Contains(TEXT("Cesium3DTileset")))
-				{
-					UE_LOG(LogTemp, Warning, TEXT("FALLBACK Using fallback Cesium3DTileset: %s"), 
-						*CurrentActor->GetClass()->GetName());
-					CesiumActor = CurrentActor;
-					break;
-				}
-			}
-		}
-	}
+	// Find the Cesium 3D Tileset actor (bisingen, or the only tileset in the world)
+	AActor* CesiumActor = GetBuildingsTileset();
 	
 	if (!CesiumActor)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ERROR No Cesium tileset actor found"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("ERROR No Cesium tileset actor found"));
 		return;
 	}
 	
@@ -3930,16 +4243,16 @@ void ABuildingEnergyDisplay::ApplyOfficialCesiumMetadataVisualization()
 	TArray<UActorComponent*> Components;
 	CesiumActor->GetComponents<UActorComponent>(Components);
 	
-	UE_LOG(LogTemp, Warning, TEXT("SEARCH Checking tileset components for CesiumFeaturesMetadata..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SEARCH Checking tileset components for CesiumFeaturesMetadata..."));
 	
 	for (UActorComponent* Component : Components)
 	{
 		FString ComponentClassName = Component->GetClass()->GetName();
-		UE_LOG(LogTemp, Warning, TEXT("   Component: %s"), *ComponentClassName);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   Component: %s"), *ComponentClassName);
 		
 		if (ComponentClassName.Contains(TEXT("CesiumFeaturesMetadata")))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("SUCCESS Found existing CesiumFeaturesMetadata component"));
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("SUCCESS Found existing CesiumFeaturesMetadata component"));
 			ExistingComponent = Component;
 			break;
 		}
@@ -3947,31 +4260,31 @@ void ABuildingEnergyDisplay::ApplyOfficialCesiumMetadataVisualization()
 	
 	if (!ExistingComponent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No CesiumFeaturesMetadata component found"));
-		UE_LOG(LogTemp, Warning, TEXT("INFO SOLUTION: Manually add CesiumFeaturesMetadata component to tileset:"));
-		UE_LOG(LogTemp, Warning, TEXT("   1. SELECT Select your 'bisingen' tileset in World Outliner"));
-		UE_LOG(LogTemp, Warning, TEXT("   2. ➕ Click 'Add' button in Details panel"));
-		UE_LOG(LogTemp, Warning, TEXT("   3. 🔧 Add 'CesiumFeaturesMetadata' component"));
-		UE_LOG(LogTemp, Warning, TEXT("   4. REFRESH Click 'Auto Fill' to discover metadata"));
-		UE_LOG(LogTemp, Warning, TEXT("   5. GENERATE Click 'Generate Material' to create material layer"));
-		UE_LOG(LogTemp, Warning, TEXT("   6. 🎪 Create custom logic with RemapValueRangeNormalized nodes"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING No CesiumFeaturesMetadata component found"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("INFO SOLUTION: Manually add CesiumFeaturesMetadata component to tileset:"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   1. SELECT Select your 'bisingen' tileset in World Outliner"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   2. ➕ Click 'Add' button in Details panel"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   3. 🔧 Add 'CesiumFeaturesMetadata' component"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   4. REFRESH Click 'Auto Fill' to discover metadata"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   5. GENERATE Click 'Generate Material' to create material layer"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   6. 🎪 Create custom logic with RemapValueRangeNormalized nodes"));
 		
 		// Check if tileset has metadata extensions
-		UE_LOG(LogTemp, Warning, TEXT(""));
-		UE_LOG(LogTemp, Warning, TEXT("EXTENSIONS Your tileset needs these extensions for official method:"));
-		UE_LOG(LogTemp, Warning, TEXT("   • EXT_mesh_features (for feature ID sets)"));
-		UE_LOG(LogTemp, Warning, TEXT("   • EXT_structural_metadata (for property tables)"));
-		UE_LOG(LogTemp, Warning, TEXT(""));
-		UE_LOG(LogTemp, Warning, TEXT("ALTERNATIVES If extensions missing, alternative approaches:"));
-		UE_LOG(LogTemp, Warning, TEXT("   1. EXTERNAL External tileset preprocessing with cesium-native"));
-		UE_LOG(LogTemp, Warning, TEXT("   2. MATERIAL Custom material system with building ID lookup"));
-		UE_LOG(LogTemp, Warning, TEXT("   3. VERTEX Vertex color injection if geometry supports it"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT(""));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("EXTENSIONS Your tileset needs these extensions for official method:"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   • EXT_mesh_features (for feature ID sets)"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   • EXT_structural_metadata (for property tables)"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT(""));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("ALTERNATIVES If extensions missing, alternative approaches:"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   1. EXTERNAL External tileset preprocessing with cesium-native"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   2. MATERIAL Custom material system with building ID lookup"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   3. VERTEX Vertex color injection if geometry supports it"));
 		
 		return;
 	}
 	
 	// If component exists, analyze its properties
-	UE_LOG(LogTemp, Warning, TEXT("ANALYZE Analyzing CesiumFeaturesMetadata component properties..."));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("ANALYZE Analyzing CesiumFeaturesMetadata component properties..."));
 	UClass* ComponentClass = ExistingComponent->GetClass();
 	
 	// Look for property-related methods and properties
@@ -3984,7 +4297,7 @@ void ABuildingEnergyDisplay::ApplyOfficialCesiumMetadataVisualization()
 		if (PropName.Contains(TEXT("Feature")) || PropName.Contains(TEXT("Metadata")) || 
 			PropName.Contains(TEXT("Property")) || PropName.Contains(TEXT("Table")))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔧 Found metadata property: %s (Type: %s)"), 
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🔧 Found metadata property: %s (Type: %s)"), 
 				*PropName, *Property->GetCPPType());
 			bFoundRelevantProperties = true;
 		}
@@ -3999,53 +4312,52 @@ void ABuildingEnergyDisplay::ApplyOfficialCesiumMetadataVisualization()
 		if (FuncName.Contains(TEXT("AutoFill")) || FuncName.Contains(TEXT("Generate")) || 
 			FuncName.Contains(TEXT("Material")) || FuncName.Contains(TEXT("Property")))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🎮 Found metadata function: %s"), *FuncName);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🎮 Found metadata function: %s"), *FuncName);
 			bFoundRelevantProperties = true;
 		}
 	}
 	
 	if (bFoundRelevantProperties)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SUCCESS CesiumFeaturesMetadata component has metadata capabilities"));
-		UE_LOG(LogTemp, Warning, TEXT("INFO NEXT STEPS: Bridge your API data with Cesium metadata:"));
-		UE_LOG(LogTemp, Warning, TEXT("   1. AUTOFILL Use 'Auto Fill' to discover existing metadata"));
-		UE_LOG(LogTemp, Warning, TEXT("   2. GENERATE Generate material layer for discovered properties"));
-		UE_LOG(LogTemp, Warning, TEXT("   3. 🔧 Map API building colors to material logic"));
-		UE_LOG(LogTemp, Warning, TEXT("   4. REMAP Use RemapValueRangeNormalized for color ranges"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SUCCESS CesiumFeaturesMetadata component has metadata capabilities"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("INFO NEXT STEPS: Bridge your API data with Cesium metadata:"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   1. AUTOFILL Use 'Auto Fill' to discover existing metadata"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   2. GENERATE Generate material layer for discovered properties"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   3. 🔧 Map API building colors to material logic"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   4. REMAP Use RemapValueRangeNormalized for color ranges"));
 		
 		// Show sample of our API color data for reference
-		UE_LOG(LogTemp, Warning, TEXT(""));
-		UE_LOG(LogTemp, Warning, TEXT("SAMPLE Available API color data sample:"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT(""));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("SAMPLE Available API color data sample:"));
 		int32 ColorCount = 0;
-		for (const auto& BuildingColor : BuildingColorCache)
+		for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num() && ColorCount < 5; ++BuildingIndex)
 		{
-			FColor SRGBColor = BuildingColor.Value.ToFColor(true);
-			FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-			UE_LOG(LogTemp, Warning, TEXT("   BUILDING %s → %s"), *BuildingColor.Key, *HexColor);
-			if (++ColorCount >= 5) break;
+			if (!BuildingStore.HasColor(BuildingIndex)) continue;
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("   BUILDING %s → %s"), *BuildingStore.ModifiedGmlIds[BuildingIndex], *BuildingStore.GetColorHex(BuildingIndex));
+			++ColorCount;
 		}
-		UE_LOG(LogTemp, Warning, TEXT("   ... and %d more buildings"), BuildingColorCache.Num() - ColorCount);
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("   ... and %d more buildings"), BuildingStore.NumColoredBuildings() - ColorCount);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING CesiumFeaturesMetadata component found but no metadata methods available"));
-		UE_LOG(LogTemp, Warning, TEXT("INFO This suggests tileset may not have required metadata extensions"));
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("WARNING CesiumFeaturesMetadata component found but no metadata methods available"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("INFO This suggests tileset may not have required metadata extensions"));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("METADATA === OFFICIAL CESIUM METADATA VISUALIZATION END ==="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("METADATA === OFFICIAL CESIUM METADATA VISUALIZATION END ==="));
 }
 
 void ABuildingEnergyDisplay::CreateBuildingAttributesForm(const FString& JsonData)
 {
-	UE_LOG(LogTemp, Error, TEXT("FORM *** CreateBuildingAttributesForm() FUNCTION ENTERED ***"));
-	UE_LOG(LogTemp, Warning, TEXT("FORM Creating building attributes form widget..."));
-	UE_LOG(LogTemp, Warning, TEXT("DATA JSON Data Length: %d characters"), JsonData.Len());
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM *** CreateBuildingAttributesForm() FUNCTION ENTERED ***"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM Creating building attributes form widget..."));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("DATA JSON Data Length: %d characters"), JsonData.Len());
 	
 	if (!BuildingAttributesWidgetClass)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR BuildingAttributesWidgetClass not set! Please assign it in the editor."));
-		UE_LOG(LogTemp, Error, TEXT("FIX TO FIX: In editor, select BuildingEnergyDisplay actor -> Details panel -> Building Attributes Widget Class -> Select your UMG widget"));
-		UE_LOG(LogTemp, Error, TEXT("WIDGET Expected widget class: WBP_BuildingAttributes or similar UMG widget you created"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR BuildingAttributesWidgetClass not set! Please assign it in the editor."));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("FIX TO FIX: In editor, select BuildingEnergyDisplay actor -> Details panel -> Building Attributes Widget Class -> Select your UMG widget"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("WIDGET Expected widget class: WBP_BuildingAttributes or similar UMG widget you created"));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
@@ -4056,12 +4368,12 @@ void ABuildingEnergyDisplay::CreateBuildingAttributesForm(const FString& JsonDat
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("FORM BuildingAttributesWidgetClass is assigned correctly"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM BuildingAttributesWidgetClass is assigned correctly"));
 	
 	// Remove existing widget if any
 	if (BuildingAttributesWidget)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FORM Removing existing widget..."));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM Removing existing widget..."));
 		BuildingAttributesWidget->RemoveFromParent();
 		BuildingAttributesWidget = nullptr;
 	}
@@ -4069,43 +4381,43 @@ void ABuildingEnergyDisplay::CreateBuildingAttributesForm(const FString& JsonDat
 	// Create new widget instance
 	if (UWorld* World = GetWorld())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FORM World found successfully"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM World found successfully"));
 		if (APlayerController* PlayerController = World->GetFirstPlayerController())
 		{
-			UE_LOG(LogTemp, Warning, TEXT("FORM PlayerController found successfully"));
+			UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM PlayerController found successfully"));
 			BuildingAttributesWidget = CreateWidget<UUserWidget>(PlayerController, BuildingAttributesWidgetClass);
 			if (BuildingAttributesWidget)
 			{
 				// Cast to the specific widget type and set building data
 				if (UBuildingAttributesWidget* AttributesWidget = Cast<UBuildingAttributesWidget>(BuildingAttributesWidget))
 				{
-					UE_LOG(LogTemp, Warning, TEXT("FORM Widget cast successful - setting building data"));
+					UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM Widget cast successful - setting building data"));
 					// Set the building data - this will trigger the API call and form population
-					AttributesWidget->SetBuildingData(CurrentRequestedBuildingKey, AccessToken);
-					UE_LOG(LogTemp, Warning, TEXT("FORM SetBuildingData called with GmlId: %s"), *CurrentRequestedBuildingKey);
+					AttributesWidget->SetBuildingData(CurrentRequestedBuildingKey, AccessToken, GetCommunityOfBuilding(CurrentRequestedBuildingKey));
+					UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM SetBuildingData called with GmlId: %s"), *CurrentRequestedBuildingKey);
 					
 					// Check if buttons are properly bound
 					if (AttributesWidget->BTN_Save)
 					{
-						UE_LOG(LogTemp, Warning, TEXT("WIDGET BTN_Save found and valid"));
+						UE_LOG(LogBuildingEnergyUI, Log, TEXT("WIDGET BTN_Save found and valid"));
 					}
 					else
 					{
-						UE_LOG(LogTemp, Error, TEXT("WIDGET BTN_Save is NULL - check UMG widget binding!"));
+						UE_LOG(LogBuildingEnergyUI, Error, TEXT("WIDGET BTN_Save is NULL - check UMG widget binding!"));
 					}
 					
 					if (AttributesWidget->BTN_Close)
 					{
-						UE_LOG(LogTemp, Warning, TEXT("WIDGET BTN_Close found and valid"));
+						UE_LOG(LogBuildingEnergyUI, Log, TEXT("WIDGET BTN_Close found and valid"));
 					}
 					else
 					{
-						UE_LOG(LogTemp, Error, TEXT("WIDGET BTN_Close is NULL - check UMG widget binding!"));
+						UE_LOG(LogBuildingEnergyUI, Error, TEXT("WIDGET BTN_Close is NULL - check UMG widget binding!"));
 					}
 				}
 				
 				// Add widget to viewport
-				UE_LOG(LogTemp, Warning, TEXT("FORM Adding widget to viewport..."));
+				UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM Adding widget to viewport..."));
 				BuildingAttributesWidget->AddToViewport(100); // High Z-order to appear on top
 				
 				// Center the widget on screen
@@ -4124,28 +4436,28 @@ void ABuildingEnergyDisplay::CreateBuildingAttributesForm(const FString& JsonDat
 						
 						// Log actual widget dimensions for debugging
 						FVector2D WidgetSize = BuildingAttributesWidget->GetDesiredSize();
-						UE_LOG(LogTemp, Warning, TEXT("WIDGET Actual widget size: %f x %f pixels"), WidgetSize.X, WidgetSize.Y);
+						UE_LOG(LogBuildingEnergyUI, Log, TEXT("WIDGET Actual widget size: %f x %f pixels"), WidgetSize.X, WidgetSize.Y);
 						
-						UE_LOG(LogTemp, Warning, TEXT("FORM Widget centered at: %f, %f (ViewportSize: %f, %f)"), CenterPosition.X, CenterPosition.Y, ViewportSize.X, ViewportSize.Y);
+						UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM Widget centered at: %f, %f (ViewportSize: %f, %f)"), CenterPosition.X, CenterPosition.Y, ViewportSize.X, ViewportSize.Y);
 					}
 				}
 				BuildingAttributesWidget->SetRenderOpacity(0.95f); // Slight transparency
 				
-				UE_LOG(LogTemp, Warning, TEXT("SUCCESS Widget created and added to viewport with transparency"));
-				UE_LOG(LogTemp, Warning, TEXT("WIDGET Widget name: %s"), *BuildingAttributesWidget->GetName());
-				UE_LOG(LogTemp, Warning, TEXT("WIDGET Widget class: %s"), *BuildingAttributesWidget->GetClass()->GetName());
+				UE_LOG(LogBuildingEnergyUI, Log, TEXT("SUCCESS Widget created and added to viewport with transparency"));
+				UE_LOG(LogBuildingEnergyUI, Log, TEXT("WIDGET Widget name: %s"), *BuildingAttributesWidget->GetName());
+				UE_LOG(LogBuildingEnergyUI, Log, TEXT("WIDGET Widget class: %s"), *BuildingAttributesWidget->GetClass()->GetName());
 				
 				// Enable mouse cursor for UI interaction with Game+UI mode for transparency
 				if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
 				{
 					PC->SetShowMouseCursor(true);
 					PC->SetInputMode(FInputModeGameAndUI()); // Allow game input + UI interaction
-					UE_LOG(LogTemp, Warning, TEXT("UI Mouse cursor enabled with Game+UI mode for transparency"));
+					UE_LOG(LogBuildingEnergyUI, Log, TEXT("UI Mouse cursor enabled with Game+UI mode for transparency"));
 				}
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("ERROR Failed to create BuildingAttributesWidget instance"));
+				UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR Failed to create BuildingAttributesWidget instance"));
 				if (GEngine)
 				{
 					GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Red, 
@@ -4155,24 +4467,25 @@ void ABuildingEnergyDisplay::CreateBuildingAttributesForm(const FString& JsonDat
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("ERROR No PlayerController found"));
+			UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR No PlayerController found"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR No World context found"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR No World context found"));
 	}
 	
-	UE_LOG(LogTemp, Error, TEXT("FORM *** CreateBuildingAttributesForm() FUNCTION COMPLETED ***"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("FORM *** CreateBuildingAttributesForm() FUNCTION COMPLETED ***"));
 }
 
 void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& JsonData)
 {
-	UE_LOG(LogTemp, Warning, TEXT("POPULATE === Populating Building Attributes Widget ==="));
+	BUILDING_ENERGY_SCOPE(WidgetPopulation);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("POPULATE === Populating Building Attributes Widget ==="));
 	
 	if (!BuildingAttributesWidget)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR No widget to populate"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR No widget to populate"));
 		return;
 	}
 	
@@ -4182,14 +4495,14 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 	
 	if (!FJsonSerializer::Deserialize(Reader, JsonValue) || !JsonValue.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Failed to parse JSON data"));
-		UE_LOG(LogTemp, Error, TEXT("RAW JSON: %s"), *JsonData.Left(200));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR Failed to parse JSON data"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("RAW JSON: %s"), *JsonData.Left(200));
 		return;
 	}
 	
 	if (JsonValue->Type != EJson::Object)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR JSON is not an object"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR JSON is not an object"));
 		return;
 	}
 	
@@ -4198,7 +4511,7 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 	// Cast to our specific widget type for setting values
 	if (UBuildingAttributesWidget* AttributesWidget = Cast<UBuildingAttributesWidget>(BuildingAttributesWidget))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SUCCESS Widget cast successful - populating fields"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("SUCCESS Widget cast successful - populating fields"));
 		
 		// Extract general_info data
 		if (JsonObject->HasField(TEXT("general_info")))
@@ -4209,17 +4522,17 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 			if (GeneralInfo->HasField(TEXT("construction_year_class")))
 			{
 				FString ConstructionYear = GeneralInfo->GetStringField(TEXT("construction_year_class"));
-				UE_LOG(LogTemp, Warning, TEXT("FIELD Construction Year Class: %s"), *ConstructionYear);
+				UE_LOG(LogBuildingEnergyUI, Log, TEXT("FIELD Construction Year Class: %s"), *ConstructionYear);
 				
 				// Set the construction year dropdown
 				if (AttributesWidget->CB_ConstructionYear)
 				{
 					AttributesWidget->CB_ConstructionYear->SetSelectedOption(ConstructionYear);
-					UE_LOG(LogTemp, Warning, TEXT("SET Construction Year dropdown to: %s"), *ConstructionYear);
+					UE_LOG(LogBuildingEnergyUI, Log, TEXT("SET Construction Year dropdown to: %s"), *ConstructionYear);
 				}
 				else
 				{
-					UE_LOG(LogTemp, Error, TEXT("ERROR CB_ConstructionYear widget is null"));
+					UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR CB_ConstructionYear widget is null"));
 				}
 			}
 			
@@ -4227,17 +4540,17 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 			if (GeneralInfo->HasField(TEXT("number_of_storey")))
 			{
 				FString NumberOfStoreys = GeneralInfo->GetStringField(TEXT("number_of_storey"));
-				UE_LOG(LogTemp, Warning, TEXT("FIELD Number of Storeys: %s"), *NumberOfStoreys);
+				UE_LOG(LogBuildingEnergyUI, Log, TEXT("FIELD Number of Storeys: %s"), *NumberOfStoreys);
 				
 				// Set the number of storeys text box
 				if (AttributesWidget->TB_NumberOfStorey)
 				{
 					AttributesWidget->TB_NumberOfStorey->SetText(FText::FromString(NumberOfStoreys));
-					UE_LOG(LogTemp, Warning, TEXT("SET Number of Storeys to: %s"), *NumberOfStoreys);
+					UE_LOG(LogBuildingEnergyUI, Log, TEXT("SET Number of Storeys to: %s"), *NumberOfStoreys);
 				}
 				else
 				{
-					UE_LOG(LogTemp, Error, TEXT("ERROR TB_NumberOfStorey widget is null"));
+					UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR TB_NumberOfStorey widget is null"));
 				}
 			}
 			
@@ -4254,13 +4567,13 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 				if (GeneralInfo->HasField(FieldName))
 				{
 					FString RoofType = GeneralInfo->GetStringField(FieldName);
-					UE_LOG(LogTemp, Warning, TEXT("FIELD Roof Storey Type (%s): %s"), *FieldName, *RoofType);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("FIELD Roof Storey Type (%s): %s"), *FieldName, *RoofType);
 					
 					// Set the roof type dropdown if widget exists
 					if (AttributesWidget->CB_RoofStorey)
 					{
 						AttributesWidget->CB_RoofStorey->SetSelectedOption(RoofType);
-						UE_LOG(LogTemp, Warning, TEXT("SET Roof Storey Type to: %s"), *RoofType);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("SET Roof Storey Type to: %s"), *RoofType);
 					}
 					break; // Use first found field
 				}
@@ -4271,7 +4584,7 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 		if (JsonObject->HasField(TEXT("begin_of_project")))
 		{
 			TSharedPtr<FJsonObject> BeginProject = JsonObject->GetObjectField(TEXT("begin_of_project"));
-			UE_LOG(LogTemp, Warning, TEXT("FIELDS Found begin_of_project section with %d fields"), BeginProject->Values.Num());
+			UE_LOG(LogBuildingEnergyUI, Log, TEXT("FIELDS Found begin_of_project section with %d fields"), BeginProject->Values.Num());
 			
 			// Heating System Type (dropdown) - check multiple possible field names
 			TArray<FString> PossibleHeatingFields = {
@@ -4286,17 +4599,17 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 				if (BeginProject->HasField(FieldName))
 				{
 					FString HeatingSystem = BeginProject->GetStringField(FieldName);
-					UE_LOG(LogTemp, Warning, TEXT("FIELD Heating System Type (%s): %s"), *FieldName, *HeatingSystem);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("FIELD Heating System Type (%s): %s"), *FieldName, *HeatingSystem);
 					
 					// Set heating system dropdown if widget exists
 					if (AttributesWidget->CB_HeatingSystemBefore)
 					{
 						AttributesWidget->CB_HeatingSystemBefore->SetSelectedOption(HeatingSystem);
-						UE_LOG(LogTemp, Warning, TEXT("SET Heating System Type to: %s"), *HeatingSystem);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("SET Heating System Type to: %s"), *HeatingSystem);
 					}
 					else
 					{
-						UE_LOG(LogTemp, Error, TEXT("ERROR CB_HeatingSystemBefore widget is null"));
+						UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR CB_HeatingSystemBefore widget is null"));
 					}
 					break; // Use first found field
 				}
@@ -4315,17 +4628,17 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 				if (BeginProject->HasField(FieldName))
 				{
 					FString WindowYear = BeginProject->GetStringField(FieldName);
-					UE_LOG(LogTemp, Warning, TEXT("FIELD Window Construction Year (%s): %s"), *FieldName, *WindowYear);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("FIELD Window Construction Year (%s): %s"), *FieldName, *WindowYear);
 					
 					// Set window construction year dropdown if widget exists
 					if (AttributesWidget->CB_WindowBefore)
 					{
 						AttributesWidget->CB_WindowBefore->SetSelectedOption(WindowYear);
-						UE_LOG(LogTemp, Warning, TEXT("SET Window Construction Year to: %s"), *WindowYear);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("SET Window Construction Year to: %s"), *WindowYear);
 					}
 					else
 					{
-						UE_LOG(LogTemp, Error, TEXT("ERROR CB_WindowBefore widget is null"));
+						UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR CB_WindowBefore widget is null"));
 					}
 					break; // Use first found field
 				}
@@ -4344,30 +4657,30 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 				if (BeginProject->HasField(FieldName))
 				{
 					FString WallYear = BeginProject->GetStringField(FieldName);
-					UE_LOG(LogTemp, Warning, TEXT("FIELD Wall Construction Year (%s): %s"), *FieldName, *WallYear);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("FIELD Wall Construction Year (%s): %s"), *FieldName, *WallYear);
 					
 					// Set wall construction year dropdown if widget exists
 					if (AttributesWidget->CB_WallBefore)
 					{
 						AttributesWidget->CB_WallBefore->SetSelectedOption(WallYear);
-						UE_LOG(LogTemp, Warning, TEXT("SET Wall Construction Year to: %s"), *WallYear);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("SET Wall Construction Year to: %s"), *WallYear);
 					}
 					else
 					{
-						UE_LOG(LogTemp, Error, TEXT("ERROR CB_WallBefore widget is null"));
+						UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR CB_WallBefore widget is null"));
 					}
 					break; // Use first found field
 				}
 			}
 			
 			// Log all available fields in begin_of_project for debugging
-			UE_LOG(LogTemp, Warning, TEXT("AVAILABLE Before Renovation fields:"));
+			UE_LOG(LogBuildingEnergyUI, Log, TEXT("AVAILABLE Before Renovation fields:"));
 			for (auto& Field : BeginProject->Values)
 			{
 				if (Field.Value->Type == EJson::String)
 				{
 					FString FieldValue = Field.Value->AsString();
-					UE_LOG(LogTemp, Warning, TEXT("   %s: %s"), *Field.Key, *FieldValue);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("   %s: %s"), *Field.Key, *FieldValue);
 				}
 			}
 		}
@@ -4376,7 +4689,7 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 		if (JsonObject->HasField(TEXT("end_of_project")))
 		{
 			TSharedPtr<FJsonObject> EndProject = JsonObject->GetObjectField(TEXT("end_of_project"));
-			UE_LOG(LogTemp, Warning, TEXT("FIELDS Found end_of_project section with %d fields"), EndProject->Values.Num());
+			UE_LOG(LogBuildingEnergyUI, Log, TEXT("FIELDS Found end_of_project section with %d fields"), EndProject->Values.Num());
 			
 			// Log all fields in end_of_project
 			for (auto& Field : EndProject->Values)
@@ -4385,18 +4698,18 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 				if (Field.Value->Type == EJson::String)
 				{
 					FString FieldValue = Field.Value->AsString();
-					UE_LOG(LogTemp, Warning, TEXT("FIELD After: %s = %s"), *FieldName, *FieldValue);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("FIELD After: %s = %s"), *FieldName, *FieldValue);
 				}
 			}
 		}
 		
-		UE_LOG(LogTemp, Warning, TEXT("SUCCESS Widget populated with API data"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("SUCCESS Widget populated with API data"));
 		
 		// Log complete API structure for debugging field names
-		UE_LOG(LogTemp, Warning, TEXT("COMPLETE API STRUCTURE - All available fields:"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("COMPLETE API STRUCTURE - All available fields:"));
 		for (auto& Section : JsonObject->Values)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Section: %s"), *Section.Key);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("Section: %s"), *Section.Key);
 			if (Section.Value->Type == EJson::Object)
 			{
 				TSharedPtr<FJsonObject> SubObject = Section.Value->AsObject();
@@ -4405,22 +4718,22 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 					if (Field.Value->Type == EJson::String)
 					{
 						FString FieldValue = Field.Value->AsString();
-						UE_LOG(LogTemp, Warning, TEXT("  %s.%s: %s"), *Section.Key, *Field.Key, *FieldValue);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("  %s.%s: %s"), *Section.Key, *Field.Key, *FieldValue);
 					}
 					else if (Field.Value->Type == EJson::Number)
 					{
 						double FieldValue = Field.Value->AsNumber();
-						UE_LOG(LogTemp, Warning, TEXT("  %s.%s: %.2f"), *Section.Key, *Field.Key, FieldValue);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("  %s.%s: %.2f"), *Section.Key, *Field.Key, FieldValue);
 					}
 					else
 					{
-						UE_LOG(LogTemp, Warning, TEXT("  %s.%s: (non-string/number type)"), *Section.Key, *Field.Key);
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("  %s.%s: (non-string/number type)"), *Section.Key, *Field.Key);
 					}
 				}
 			}
 			else
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Section %s is not an object"), *Section.Key);
+				UE_LOG(LogBuildingEnergyUI, Warning, TEXT("Section %s is not an object"), *Section.Key);
 			}
 		}
 		
@@ -4433,11 +4746,11 @@ void ABuildingEnergyDisplay::PopulateBuildingAttributesWidget(const FString& Jso
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Failed to cast widget to UBuildingAttributesWidget"));
-		UE_LOG(LogTemp, Error, TEXT("ACTUAL Widget class: %s"), *BuildingAttributesWidget->GetClass()->GetName());
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR Failed to cast widget to UBuildingAttributesWidget"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ACTUAL Widget class: %s"), *BuildingAttributesWidget->GetClass()->GetName());
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("POPULATE === End Populating Widget ==="));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("POPULATE === End Populating Widget ==="));
 }
 
 void ABuildingEnergyDisplay::GetBuildingAttributes(const FString& BuildingKey, const FString& CommunityId, const FString& Token)
@@ -4445,10 +4758,10 @@ void ABuildingEnergyDisplay::GetBuildingAttributes(const FString& BuildingKey, c
 	// 🚫 === DISABLED FUNCTION - SHOULD NOT BE CALLED BY BLUEPRINT ===
 	static int32 GetAttributesCallCounter = 0;
 	GetAttributesCallCounter++;
-	UE_LOG(LogTemp, Error, TEXT("🚫 === GetBuildingAttributes() CALLED #%d ==="), GetAttributesCallCounter);
-	UE_LOG(LogTemp, Error, TEXT("🚫 ERROR: This function was DISABLED and should NOT be called directly!"));
-	UE_LOG(LogTemp, Error, TEXT("🚫 BuildingKey received: '%s'"), *BuildingKey);
-	UE_LOG(LogTemp, Error, TEXT("🚫 Blueprint should ONLY call OnBuildingClicked!"));
+	UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚫 === GetBuildingAttributes() CALLED #%d ==="), GetAttributesCallCounter);
+	UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚫 ERROR: This function was DISABLED and should NOT be called directly!"));
+	UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚫 BuildingKey received: '%s'"), *BuildingKey);
+	UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚫 Blueprint should ONLY call OnBuildingClicked!"));
 	
 	// Store current request info for debugging
 	CurrentRequestedBuildingKey = BuildingKey;
@@ -4470,48 +4783,37 @@ void ABuildingEnergyDisplay::GetBuildingAttributes(const FString& BuildingKey, c
 			// Fallback: simple underscore to L replacement
 			ActualGmlId = BuildingKey.Replace(TEXT("_"), TEXT("L"));
 		}
-		UE_LOG(LogTemp, Error, TEXT("🔄 ID CONVERSION: '%s' -> '%s'"), *BuildingKey, *ActualGmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔄 ID CONVERSION: '%s' -> '%s'"), *BuildingKey, *ActualGmlId);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("✅ ID FORMAT: Already correct format '%s'"), *ActualGmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ ID FORMAT: Already correct format '%s'"), *ActualGmlId);
 	}
 	
 	// Create HTTP request
 	TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
 	
 	// Build the URL with gml_id in the path (corrected format)
-	FString Url = FString::Printf(TEXT("https://backend.gisworld-tech.com/geospatial/buildings-energy/%s/?community_id=%s&field_type=basic"), 
-		*ActualGmlId, *CommunityId);
+	FString Url = FString::Printf(TEXT("%s/geospatial/buildings-energy/%s/?community_id=%s&field_type=basic"), 
+		*UBuildingEnergyApiSubsystem::GetApiBaseUrl(), *ActualGmlId, *CommunityId);
 	
-	UE_LOG(LogTemp, Warning, TEXT("GET Building Attributes: %s"), *Url);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("GET Building Attributes: %s"), *Url);
 	
 	// Enhanced debugging for API request
-	UE_LOG(LogTemp, Warning, TEXT("REQUEST === Building Attributes GET Request Debug ==="));
-	UE_LOG(LogTemp, Warning, TEXT("REQUEST Full URL: %s"), *Url);
-	UE_LOG(LogTemp, Warning, TEXT("REQUEST BuildingKey (gml_id): %s"), *BuildingKey);
-	UE_LOG(LogTemp, Warning, TEXT("REQUEST CommunityId: %s"), *CommunityId);
-	UE_LOG(LogTemp, Warning, TEXT("REQUEST Token Length: %d"), Token.Len());
-	UE_LOG(LogTemp, Warning, TEXT("REQUEST Token First 20 chars: %s"), *Token.Left(20));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("REQUEST === Building Attributes GET Request Debug ==="));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("REQUEST Full URL: %s"), *Url);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("REQUEST BuildingKey (gml_id): %s"), *BuildingKey);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("REQUEST CommunityId: %s"), *CommunityId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("REQUEST Token Length: %d"), Token.Len());
 	
 	Request->SetURL(Url);
 	Request->SetVerb(TEXT("GET"));
 	Request->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Token));
 	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 	
-	// Bind the response function
-	Request->OnProcessRequestComplete().BindUObject(this, &ABuildingEnergyDisplay::OnGetBuildingAttributesResponse);
-	
-	// Execute the request
-	if (!Request->ProcessRequest())
-	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Failed to start GET building attributes request"));
-		if (GEngine)
-		{
-			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
-				TEXT("ERROR: Failed to start GET building attributes request"));
-		}
-	}
+	// Execute the request; the attributes widget loading the same building shares the response
+	UBuildingEnergyApiSubsystem::Send(this, Request, 
+		FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnGetBuildingAttributesResponse), EBuildingApiPriority::UserInitiated);
 }
 
 void ABuildingEnergyDisplay::UpdateBuildingAttributes(const FString& BuildingKey, const FString& CommunityId, const FString& AttributesJson, const FString& Token)
@@ -4532,22 +4834,22 @@ void ABuildingEnergyDisplay::UpdateBuildingAttributes(const FString& BuildingKey
 			// Fallback: simple underscore to L replacement
 			ActualGmlId = BuildingKey.Replace(TEXT("_"), TEXT("L"));
 		}
-		UE_LOG(LogTemp, Error, TEXT("🔄 ID CONVERSION: '%s' -> '%s'"), *BuildingKey, *ActualGmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔄 ID CONVERSION: '%s' -> '%s'"), *BuildingKey, *ActualGmlId);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("✅ ID FORMAT: Already correct format '%s'"), *ActualGmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ ID FORMAT: Already correct format '%s'"), *ActualGmlId);
 	}
 	
 	// Create HTTP request
 	TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
 	
 	// Build the URL with gml_id in the path (corrected format)
-	FString Url = FString::Printf(TEXT("https://backend.gisworld-tech.com/geospatial/buildings-energy/%s/?community_id=%s&field_type=basic"), 
-		*ActualGmlId, *CommunityId);
+	FString Url = FString::Printf(TEXT("%s/geospatial/buildings-energy/%s/?community_id=%s&field_type=basic"), 
+		*UBuildingEnergyApiSubsystem::GetApiBaseUrl(), *ActualGmlId, *CommunityId);
 	
-	UE_LOG(LogTemp, Warning, TEXT("PUT Building Attributes: %s"), *Url);
-	UE_LOG(LogTemp, Log, TEXT("JSON Payload: %s"), *AttributesJson.Left(200)); // Log first 200 chars
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("PUT Building Attributes: %s"), *Url);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("JSON Payload: %s"), *AttributesJson.Left(200)); // Log first 200 chars
 	
 	Request->SetURL(Url);
 	Request->SetVerb(TEXT("PUT"));
@@ -4555,19 +4857,9 @@ void ABuildingEnergyDisplay::UpdateBuildingAttributes(const FString& BuildingKey
 	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 	Request->SetContentAsString(AttributesJson);
 	
-	// Bind the response function
-	Request->OnProcessRequestComplete().BindUObject(this, &ABuildingEnergyDisplay::OnUpdateBuildingAttributesResponse);
-	
 	// Execute the request
-	if (!Request->ProcessRequest())
-	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Failed to start PUT building attributes request"));
-		if (GEngine)
-		{
-			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
-				TEXT("ERROR: Failed to start PUT building attributes request"));
-		}
-	}
+	UBuildingEnergyApiSubsystem::Send(this, Request, 
+		FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnUpdateBuildingAttributesResponse), EBuildingApiPriority::UserInitiated);
 }
 
 void ABuildingEnergyDisplay::OnGetBuildingAttributesResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
@@ -4576,28 +4868,29 @@ void ABuildingEnergyDisplay::OnGetBuildingAttributesResponse(FHttpRequestPtr Req
 	if (!CurrentRequestedBuildingKey.IsEmpty())
 	{
 		// Check if this building should exist in our cache
-		if (!BuildingDataCache.Contains(CurrentRequestedBuildingKey))
+		const int32 RequestedIndex = BuildingStore.FindIndex(CurrentRequestedBuildingKey);
+		if (RequestedIndex == INDEX_NONE || !BuildingStore.HasDisplayText(RequestedIndex))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Blocked API response: Building '%s' not in cache"), *CurrentRequestedBuildingKey);
+			UE_LOG(LogBuildingEnergyUI, Warning, TEXT("Blocked API response: Building '%s' not in cache"), *CurrentRequestedBuildingKey);
 			return; // STOP HERE - Do not create form for invalid building
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Blocked API response: No building key specified"));
+		UE_LOG(LogBuildingEnergyUI, Warning, TEXT("Blocked API response: No building key specified"));
 		return;
 	}
 	
 	if (!bWasSuccessful || !Response.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR GET Building Attributes request failed"));
-		UE_LOG(LogTemp, Error, TEXT("STATUS Request was successful: %s"), bWasSuccessful ? TEXT("true") : TEXT("false"));
-		UE_LOG(LogTemp, Error, TEXT("📞 Response is valid: %s"), Response.IsValid() ? TEXT("true") : TEXT("false"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR GET Building Attributes request failed"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("STATUS Request was successful: %s"), bWasSuccessful ? TEXT("true") : TEXT("false"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("📞 Response is valid: %s"), Response.IsValid() ? TEXT("true") : TEXT("false"));
 		
 		if (Request.IsValid())
 		{
-			UE_LOG(LogTemp, Error, TEXT("📞 Request URL: %s"), *Request->GetURL());
-			UE_LOG(LogTemp, Error, TEXT("📞 Request Verb: %s"), *Request->GetVerb());
+			UE_LOG(LogBuildingEnergyUI, Error, TEXT("📞 Request URL: %s"), *Request->GetURL());
+			UE_LOG(LogBuildingEnergyUI, Error, TEXT("📞 Request Verb: %s"), *Request->GetVerb());
 		}
 		
 		if (GEngine)
@@ -4611,12 +4904,12 @@ void ABuildingEnergyDisplay::OnGetBuildingAttributesResponse(FHttpRequestPtr Req
 	int32 ResponseCode = Response->GetResponseCode();
 	FString ResponseContent = Response->GetContentAsString();
 	
-	UE_LOG(LogTemp, Warning, TEXT("RESPONSE GET Building Attributes Response Code: %d"), ResponseCode);
-UE_LOG(LogTemp, Warning, TEXT("RESPONSE Response Content Length: %d"), ResponseContent.Len());
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("RESPONSE GET Building Attributes Response Code: %d"), ResponseCode);
+UE_LOG(LogBuildingEnergyUI, Log, TEXT("RESPONSE Response Content Length: %d"), ResponseContent.Len());
 	
 	if (ResponseCode == 200)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Building attributes loaded successfully"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("Building attributes loaded successfully"));
 		
 		// Parse and create the building attributes form
 		TSharedPtr<FJsonValue> JsonValue;
@@ -4628,19 +4921,19 @@ UE_LOG(LogTemp, Warning, TEXT("RESPONSE Response Content Length: %d"), ResponseC
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("Could not parse building attributes JSON response"));
+			UE_LOG(LogBuildingEnergyUI, Error, TEXT("Could not parse building attributes JSON response"));
 		}
 	}
 	else if (ResponseCode == 404)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Building not found (404) - Building may not exist in attributes database"));
-		UE_LOG(LogTemp, Error, TEXT("� DEBUG: Requested gml_id=%s, community_id=%s"), *CurrentRequestedBuildingKey, *CurrentRequestedCommunityId);
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR Building not found (404) - Building may not exist in attributes database"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("� DEBUG: Requested gml_id=%s, community_id=%s"), *CurrentRequestedBuildingKey, *CurrentRequestedCommunityId);
 		
 		// Check if maybe the building exists but with original modified_gml_id format
 		FString AlternateGmlId = CurrentRequestedBuildingKey.Replace(TEXT("L"), TEXT("_"));
-		UE_LOG(LogTemp, Warning, TEXT("CONVERT Maybe building exists as: %s instead of %s?"), *AlternateGmlId, *CurrentRequestedBuildingKey);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("CONVERT Maybe building exists as: %s instead of %s?"), *AlternateGmlId, *CurrentRequestedBuildingKey);
 		
-		UE_LOG(LogTemp, Error, TEXT("RESPONSE Response: %s"), *ResponseContent.Left(300));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("RESPONSE Response: %s"), *ResponseContent.Left(300));
 		
 		if (GEngine)
 		{
@@ -4650,32 +4943,18 @@ UE_LOG(LogTemp, Warning, TEXT("RESPONSE Response Content Length: %d"), ResponseC
 	}
 	else if (ResponseCode == 401)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR Unauthorized (401) - Token may be expired"));
-		
-		// Try to refresh token automatically if we have a refresh token
-		if (!RefreshToken.IsEmpty())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Attempting automatic token refresh for attributes request..."));
-			if (GEngine)
-			{
-				GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Yellow, 
-					TEXT("🔄 Token expired - attempting refresh..."));
-			}
-			RefreshAccessToken();
-		}
-		else
+		// Parked 401s are renewed by OnApiTokenRejected; reaching here means renewal already failed
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR Unauthorized (401) - token renewal failed"));
+		if (GEngine)
 		{
-			if (GEngine)
-			{
-				GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
-					TEXT("Unauthorized - Please re-authenticate"));
-			}
+			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
+				TEXT("Unauthorized - Please re-authenticate"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ GET Building Attributes failed (Code: %d)"), ResponseCode);
-		UE_LOG(LogTemp, Error, TEXT("📄 Error response: %s"), *ResponseContent.Left(500));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("❌ GET Building Attributes failed (Code: %d)"), ResponseCode);
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("📄 Error response: %s"), *ResponseContent.Left(500));
 		
 		if (GEngine)
 		{
@@ -4689,7 +4968,7 @@ void ABuildingEnergyDisplay::OnUpdateBuildingAttributesResponse(FHttpRequestPtr
 {
 	if (!bWasSuccessful || !Response.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ PUT Building Attributes request failed"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("❌ PUT Building Attributes request failed"));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Red, 
@@ -4703,8 +4982,8 @@ void ABuildingEnergyDisplay::OnUpdateBuildingAttributesResponse(FHttpRequestPtr
 	
 	if (ResponseCode == 200 || ResponseCode == 201 || ResponseCode == 204)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("✅ PUT Building Attributes SUCCESS (Code: %d)"), ResponseCode);
-		UE_LOG(LogTemp, Warning, TEXT("📊 Response: %s"), *ResponseContent.Left(500));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ PUT Building Attributes SUCCESS (Code: %d)"), ResponseCode);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("📊 Response: %s"), *ResponseContent.Left(500));
 		
 		if (GEngine)
 		{
@@ -4713,7 +4992,7 @@ void ABuildingEnergyDisplay::OnUpdateBuildingAttributesResponse(FHttpRequestPtr
 		}
 		
 		// � WEBSOCKET: Connect to energy WebSocket for real-time updates
-		UE_LOG(LogTemp, Warning, TEXT("🔌 WEBSOCKET: Connecting to energy WebSocket for real-time updates"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔌 WEBSOCKET: Connecting to energy WebSocket for real-time updates"));
 		
 		// Connect to WebSocket for immediate energy data updates
 		ConnectEnergyWebSocket();
@@ -4729,8 +5008,8 @@ void ABuildingEnergyDisplay::OnUpdateBuildingAttributesResponse(FHttpRequestPtr
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ PUT Building Attributes failed (Code: %d)"), ResponseCode);
-		UE_LOG(LogTemp, Error, TEXT("📄 Error response: %s"), *ResponseContent.Left(500));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("❌ PUT Building Attributes failed (Code: %d)"), ResponseCode);
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("📄 Error response: %s"), *ResponseContent.Left(500));
 		
 		if (GEngine)
 		{
@@ -4744,7 +5023,7 @@ void ABuildingEnergyDisplay::TestBuildingAttributesAPI()
 {
 	if (AccessToken.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No access token available. Please wait for authentication to complete."));
+		UE_LOG(LogBuildingEnergyUI, Warning, TEXT("WARNING No access token available. Please wait for authentication to complete."));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Orange, 
@@ -4753,9 +5032,9 @@ void ABuildingEnergyDisplay::TestBuildingAttributesAPI()
 		return;
 	}
 	
-	if (BuildingDataCache.Num() == 0)
+	if (BuildingStore.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WARNING No building data cached. Please run the game first to load building data."));
+		UE_LOG(LogBuildingEnergyUI, Warning, TEXT("WARNING No building data cached. Please run the game first to load building data."));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 8.0f, FColor::Orange, 
@@ -4768,30 +5047,20 @@ void ABuildingEnergyDisplay::TestBuildingAttributesAPI()
 	FString TestModifiedGmlId;
 	static int32 TestBuildingIndex = 0; // Static to remember between calls
 	
-	if (BuildingDataCache.Num() > 0)
-	{
-		// Get array of building IDs
-		TArray<FString> BuildingIds;
-		BuildingDataCache.GetKeys(BuildingIds);
-		
-		// Use modulo to cycle through buildings
-		TestBuildingIndex = TestBuildingIndex % BuildingIds.Num();
-		TestModifiedGmlId = BuildingIds[TestBuildingIndex];
-		
-		// Increment for next test
-		TestBuildingIndex++;
-		
-		UE_LOG(LogTemp, Warning, TEXT("TEST Testing with building %d/%d: %s"), TestBuildingIndex, BuildingIds.Num(), *TestModifiedGmlId);
-	}
-	else
-	{
-		return;
-	}
+	// Use modulo to cycle through buildings in store order
+	TestBuildingIndex = TestBuildingIndex % BuildingStore.Num();
+	const int32 StoreIndex = TestBuildingIndex;
+	TestModifiedGmlId = BuildingStore.ModifiedGmlIds[StoreIndex];
+	
+	// Increment for next test
+	TestBuildingIndex++;
 	
-	// Get the actual gml_id (with L) from our cache
-	FString* ActualGmlIdPtr = GmlIdCache.Find(TestModifiedGmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("TEST Testing with building %d/%d: %s"), TestBuildingIndex, BuildingStore.Num(), *TestModifiedGmlId);
+	
+	// Get the actual gml_id (with L) from the same building index
+	const FString* ActualGmlIdPtr = &BuildingStore.ActualGmlIds[StoreIndex];
 	FString TestActualGmlId;
-	if (ActualGmlIdPtr && !ActualGmlIdPtr->IsEmpty())
+	if (!ActualGmlIdPtr->IsEmpty())
 	{
 		TestActualGmlId = *ActualGmlIdPtr;
 	}
@@ -4799,67 +5068,50 @@ void ABuildingEnergyDisplay::TestBuildingAttributesAPI()
 	{
 		// Fallback: try to convert manually
 		TestActualGmlId = ConvertGmlIdToBuildingKey(TestModifiedGmlId);
-		UE_LOG(LogTemp, Warning, TEXT("FALLBACK Using fallback conversion for: %s"), *TestModifiedGmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("FALLBACK Using fallback conversion for: %s"), *TestModifiedGmlId);
 	}
 	
-// Configuration - should come from project settings
-    FString DefaultCommunityId = TEXT("08417008"); // Should be configurable per project
-    UE_LOG(LogTemp, Warning, TEXT("TEST Using default Community ID: %s (should be configurable)"), *DefaultCommunityId);
+// Community whose shard holds the building
+    FString DefaultCommunityId = GetCommunityOfBuilding(TestModifiedGmlId);
+    UE_LOG(LogBuildingEnergyUI, Log, TEXT("TEST Using Community ID: %s"), *DefaultCommunityId);
 	
-	UE_LOG(LogTemp, Warning, TEXT("TEST === TESTING BUILDING ATTRIBUTES API ==="));
-	UE_LOG(LogTemp, Warning, TEXT("MODIFIED Modified GML ID (from energy API): %s"), *TestModifiedGmlId);
-	UE_LOG(LogTemp, Warning, TEXT("ACTUAL Actual GML ID (for attributes API): %s"), *TestActualGmlId);
-	UE_LOG(LogTemp, Warning, TEXT("COMMUNITY Community ID: %s"), *DefaultCommunityId);
-	// API configuration - should be externally configurable
-	FString ApiBaseUrl = TEXT("https://backend.gisworld-tech.com");  // Should come from config
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("TEST === TESTING BUILDING ATTRIBUTES API ==="));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("MODIFIED Modified GML ID (from energy API): %s"), *TestModifiedGmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("ACTUAL Actual GML ID (for attributes API): %s"), *TestActualGmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("COMMUNITY Community ID: %s"), *DefaultCommunityId);
+	const FString ApiBaseUrl = UBuildingEnergyApiSubsystem::GetApiBaseUrl();
 	
 	FString TestApiUrl = FString::Printf(TEXT("%s/geospatial/buildings-energy/%s/?community_id=%s&field_type=basic"), *ApiBaseUrl, *TestActualGmlId, *DefaultCommunityId);
-	UE_LOG(LogTemp, Log, TEXT("API URL: %s"), *TestApiUrl);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("API URL: %s"), *TestApiUrl);
 	
 	// Call the GET function using the actual gml_id (with L)
-	UE_LOG(LogTemp, Warning, TEXT("DEBUG About to call GetBuildingAttributes with gml_id: %s"), *TestActualGmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("DEBUG About to call GetBuildingAttributes with gml_id: %s"), *TestActualGmlId);
 	
-	// ENHANCED DEBUG: Check if the GmlIdCache lookup worked
-	UE_LOG(LogTemp, Log, TEXT("GmlIdCache entries: %d, BuildingColorCache entries: %d"), GmlIdCache.Num(), BuildingColorCache.Num());
+	// ENHANCED DEBUG: Check if the gml_id lookup worked
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("BuildingStore buildings: %d, with colors: %d"), BuildingStore.Num(), BuildingStore.NumColoredBuildings());
 	
-	if (ActualGmlIdPtr && !ActualGmlIdPtr->IsEmpty())
+	if (!ActualGmlIdPtr->IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CACHE SUCCESS: Found %s in cache -> %s"), *TestModifiedGmlId, *TestActualGmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("CACHE SUCCESS: Found %s in cache -> %s"), *TestModifiedGmlId, *TestActualGmlId);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("CACHE MISS: %s not found in GmlIdCache, using fallback conversion"), *TestModifiedGmlId);
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("CACHE MISS: %s has no gml_id in BuildingStore, using fallback conversion"), *TestModifiedGmlId);
 		// Show some cache entries for debugging
-		int32 Count = 0;
-		for (auto& Entry : GmlIdCache)
-		{
-			if (Count < 5) // Show first 5 entries
-			{
-				UE_LOG(LogTemp, Warning, TEXT("CACHE Sample entry: %s -> %s"), *Entry.Key, *Entry.Value);
-			}
-			Count++;
-		}
-		
-		// Also show BuildingColorCache entries to see if any data is available
-		UE_LOG(LogTemp, Warning, TEXT("COLORDATA Sample BuildingColorCache entries:"));
-		Count = 0;
-		for (auto& Entry : BuildingColorCache)
+		for (int32 SampleIndex = 0; SampleIndex < FMath::Min(BuildingStore.Num(), 5); ++SampleIndex) // Show first 5 entries
 		{
-			if (Count < 5) // Show first 5 entries
-			{
-				UE_LOG(LogTemp, Warning, TEXT("COLORDATA %s -> color"), *Entry.Key);
-			}
-			Count++;
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("CACHE Sample entry: %s -> %s (color: %s)"), *BuildingStore.ModifiedGmlIds[SampleIndex], 
+				*BuildingStore.ActualGmlIds[SampleIndex], BuildingStore.HasColor(SampleIndex) ? TEXT("yes") : TEXT("no"));
 		}
 	}
 	
 	// ENHANCED DEBUG: Validate the final ID format
-	UE_LOG(LogTemp, Warning, TEXT("VALIDATE === ID Validation ==="));
-	UE_LOG(LogTemp, Warning, TEXT("VALIDATE Original modified_gml_id: %s"), *TestModifiedGmlId);
-	UE_LOG(LogTemp, Warning, TEXT("VALIDATE Final gml_id for API: %s"), *TestActualGmlId);
-	UE_LOG(LogTemp, Warning, TEXT("VALIDATE Contains underscore: %s"), TestActualGmlId.Contains(TEXT("_")) ? TEXT("YES - ERROR!") : TEXT("NO - Good"));
-	UE_LOG(LogTemp, Warning, TEXT("VALIDATE Contains L: %s"), TestActualGmlId.Contains(TEXT("L")) ? TEXT("YES - Good") : TEXT("NO - Error"));
-	UE_LOG(LogTemp, Warning, TEXT("VALIDATE Community ID: %s"), *DefaultCommunityId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("VALIDATE === ID Validation ==="));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("VALIDATE Original modified_gml_id: %s"), *TestModifiedGmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("VALIDATE Final gml_id for API: %s"), *TestActualGmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("VALIDATE Contains underscore: %s"), TestActualGmlId.Contains(TEXT("_")) ? TEXT("YES - ERROR!") : TEXT("NO - Good"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("VALIDATE Contains L: %s"), TestActualGmlId.Contains(TEXT("L")) ? TEXT("YES - Good") : TEXT("NO - Error"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("VALIDATE Community ID: %s"), *DefaultCommunityId);
 	
 	GetBuildingAttributes(TestActualGmlId, DefaultCommunityId, AccessToken);
 }
@@ -4890,7 +5142,7 @@ FString ABuildingEnergyDisplay::ConvertGmlIdToBuildingKey(const FString& GmlId)
 	ConvertCallCounts[GmlId]++;
 	
 	// 📊 LOG CONVERSION STATISTICS
-	UE_LOG(LogTemp, Error, TEXT("🔄 CONVERT CALL #%d - Input: %s, Total conversions for this ID: %d"), 
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔄 CONVERT CALL #%d - Input: %s, Total conversions for this ID: %d"), 
 		GlobalConvertCounter, *GmlId, ConvertCallCounts[GmlId]);
 		
 	// Check recent conversion frequency (last 3 seconds)
@@ -4904,21 +5156,21 @@ FString ABuildingEnergyDisplay::ConvertGmlIdToBuildingKey(const FString& GmlId)
 	
 	if (RecentConversions > 1)
 	{
-		UE_LOG(LogTemp, Error, TEXT("⚠️ MULTIPLE CONVERSIONS detected - %d conversions in last 3 seconds for ID: %s"), 
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("⚠️ MULTIPLE CONVERSIONS detected - %d conversions in last 3 seconds for ID: %s"), 
 			RecentConversions, *GmlId);
 			
 		// Show all recent conversion timestamps
 		for (int32 i = ConvertTimestamps.Num() - 1; i >= 0 && i >= ConvertTimestamps.Num() - 3; i--)
 		{
 			float TimeDiff = CurrentTime - ConvertTimestamps[i];
-			UE_LOG(LogTemp, Error, TEXT("   🔄 Convert Call %d: %.3f seconds ago"), 
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("   🔄 Convert Call %d: %.3f seconds ago"), 
 				ConvertTimestamps.Num() - i, TimeDiff);
 		}
 	}
 	
 	// Convert modified_gml_id (with _) to actual gml_id (with L) for attributes API
 	// Example: DEBW_001000wrHDD → DEBWL001000wrHDD
-	UE_LOG(LogTemp, Error, TEXT("🔄 CONVERT INPUT: '%s'"), *GmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔄 CONVERT INPUT: '%s'"), *GmlId);
 	
 	FString BuildingKey = GmlId;
 	
@@ -4926,14 +5178,14 @@ FString ABuildingEnergyDisplay::ConvertGmlIdToBuildingKey(const FString& GmlId)
 	if (BuildingKey.Contains(TEXT("_")))
 	{
 		BuildingKey = BuildingKey.Replace(TEXT("_"), TEXT("L"));
-		UE_LOG(LogTemp, Error, TEXT("🔄 CONVERT SUCCESS: %s -> %s"), *GmlId, *BuildingKey);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔄 CONVERT SUCCESS: %s -> %s"), *GmlId, *BuildingKey);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("🔄 CONVERT SKIPPED: %s (already in L format)"), *GmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔄 CONVERT SKIPPED: %s (already in L format)"), *GmlId);
 	}
 	
-	UE_LOG(LogTemp, Error, TEXT("🔄 CONVERT OUTPUT: '%s'"), *BuildingKey);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔄 CONVERT OUTPUT: '%s'"), *BuildingKey);
 	
 	return BuildingKey;
 }
@@ -4950,7 +5202,7 @@ FString ABuildingEnergyDisplay::ConvertActualGmlIdToModified(const FString& Actu
 	if (LocalModifiedGmlId.Contains(TEXT("L")))
 	{
 		LocalModifiedGmlId = LocalModifiedGmlId.Replace(TEXT("L"), TEXT("_"));
-		UE_LOG(LogTemp, Log, TEXT("Converted gml_id to modified_gml_id: %s -> %s"), *ActualGmlId, *LocalModifiedGmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("Converted gml_id to modified_gml_id: %s -> %s"), *ActualGmlId, *LocalModifiedGmlId);
 	}
 	
 	return LocalModifiedGmlId;
@@ -4977,7 +5229,7 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 	FormCallCounts[BuildingGmlId]++;
 	
 	// 📊 LOG FORM CALL STATISTICS
-	UE_LOG(LogTemp, Error, TEXT("📋 FORM CALL #%d - Building: %s, Total form calls for this building: %d"), 
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("📋 FORM CALL #%d - Building: %s, Total form calls for this building: %d"), 
 		GlobalFormCounter, *BuildingGmlId, FormCallCounts[BuildingGmlId]);
 		
 	// Check recent form call frequency (last 2 seconds)
@@ -4991,21 +5243,21 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 	
 	if (RecentFormCalls > 1)
 	{
-		UE_LOG(LogTemp, Error, TEXT("⚠️ MULTIPLE FORM CALLS detected - %d form calls in last 2 seconds for Building: %s"), 
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("⚠️ MULTIPLE FORM CALLS detected - %d form calls in last 2 seconds for Building: %s"), 
 			RecentFormCalls, *BuildingGmlId);
 		
 		// Show all recent form timestamps
 		for (int32 i = FormTimestamps.Num() - 1; i >= 0 && i >= FormTimestamps.Num() - 3; i--)
 		{
 			float TimeDiff = CurrentTime - FormTimestamps[i];
-			UE_LOG(LogTemp, Error, TEXT("   📋 Form Call %d: %.3f seconds ago"), 
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyUI, Verbose, TEXT("   📋 Form Call %d: %.3f seconds ago"), 
 				FormTimestamps.Num() - i, TimeDiff);
 		}
 	}
 	
 	// RIGHT-CLICK ATTRIBUTES FORM: Convert modified_gml_id to gml_id for attributes API
-	UE_LOG(LogTemp, Warning, TEXT("📝 === ATTRIBUTES FORM DEBUG ==="));
-	UE_LOG(LogTemp, Warning, TEXT("📝 Input (modified_gml_id): %s"), *BuildingGmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("📝 === ATTRIBUTES FORM DEBUG ==="));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("📝 Input (modified_gml_id): %s"), *BuildingGmlId);
 	
 	// DUPLICATE PREVENTION (keeping existing logic)
 	static FString LastFormId = TEXT("");
@@ -5014,7 +5266,7 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 	// Block duplicate form calls within 300ms for same building
 	if ((CurrentTime - LastFormTime) < 0.3f && LastFormId == BuildingGmlId)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚫 BLOCKED duplicate form call - Building: %s (%.3fms gap, Total: %d)"), 
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚫 BLOCKED duplicate form call - Building: %s (%.3fms gap, Total: %d)"), 
 			*BuildingGmlId, (CurrentTime - LastFormTime) * 1000.0f, FormCallCounts[BuildingGmlId]);
 		return;
 	}
@@ -5024,43 +5276,34 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 	
 	CurrentBuildingGmlId = BuildingGmlId;
 	
-	// === CRITICAL DEBUG: Check GmlIdCache contents ===
-	UE_LOG(LogTemp, Error, TEXT("🔍 CACHE DEBUG: Total GmlIdCache entries: %d"), GmlIdCache.Num());
-	for (const auto& CacheEntry : GmlIdCache)
-	{
-		if (CacheEntry.Key == BuildingGmlId)
-		{
-			UE_LOG(LogTemp, Error, TEXT("🔍 FOUND in cache: %s -> %s"), *CacheEntry.Key, *CacheEntry.Value);
-		}
-	}
-	
 	// CONVERT: modified_gml_id (with _) → gml_id (with L) for attributes API
 	FString AttributesApiGmlId;
 	
-	// First try cache lookup using the stable ID
-	FString* CachedActualGmlIdPtr = GmlIdCache.Find(BuildingGmlId);
-	if (CachedActualGmlIdPtr && !CachedActualGmlIdPtr->IsEmpty())
+	// First try the store using the stable ID; either id resolves to the same building
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔍 CACHE DEBUG: Total buildings in store: %d"), BuildingStore.Num());
+	const int32 BuildingIndex = BuildingStore.FindIndex(BuildingGmlId);
+	if (BuildingIndex != INDEX_NONE && !BuildingStore.ActualGmlIds[BuildingIndex].IsEmpty())
 	{
-		AttributesApiGmlId = *CachedActualGmlIdPtr;
-		UE_LOG(LogTemp, Error, TEXT("🔍 CACHE HIT: %s -> %s"), *BuildingGmlId, *AttributesApiGmlId);
+		AttributesApiGmlId = BuildingStore.ActualGmlIds[BuildingIndex];
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔍 CACHE HIT: %s -> %s"), *BuildingGmlId, *AttributesApiGmlId);
 	}
 	else
 	{
 		// Convert from modified_gml_id (with _) to actual gml_id (with L) for attributes API
 		AttributesApiGmlId = ConvertGmlIdToBuildingKey(BuildingGmlId);
-		UE_LOG(LogTemp, Error, TEXT("🔍 CACHE MISS - CONVERTED: %s -> %s"), *BuildingGmlId, *AttributesApiGmlId);
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("🔍 CACHE MISS - CONVERTED: %s -> %s"), *BuildingGmlId, *AttributesApiGmlId);
 		
-		// Add to cache to ensure consistency
-		GmlIdCache.Add(BuildingGmlId, AttributesApiGmlId);
-		UE_LOG(LogTemp, Error, TEXT("🔍 ADDED TO CACHE: %s -> %s"), *BuildingGmlId, *AttributesApiGmlId);
+		// Add to the store to ensure consistency
+		BuildingStore.FindOrAddBuilding(BuildingGmlId, AttributesApiGmlId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔍 ADDED TO CACHE: %s -> %s"), *BuildingGmlId, *AttributesApiGmlId);
 	}
 	
-	UE_LOG(LogTemp, Error, TEXT("🔍 FINAL gml_id for widget: %s"), *AttributesApiGmlId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔍 FINAL gml_id for widget: %s"), *AttributesApiGmlId);
 	
 	// VALIDATION: Check widget class is assigned
 	if (!BuildingAttributesWidgetClass)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ERROR BuildingAttributesWidgetClass not set!"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("ERROR BuildingAttributesWidgetClass not set!"));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, 
@@ -5074,7 +5317,7 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 	{
 		BuildingAttributesWidget->RemoveFromParent();
 		BuildingAttributesWidget = nullptr;
-		UE_LOG(LogTemp, Warning, TEXT("📝 Removed existing attributes widget"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("📝 Removed existing attributes widget"));
 	}
 
 	// Create new widget instance
@@ -5086,7 +5329,7 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 			if (BuildingAttributesWidget)
 			{
 				BuildingAttributesWidget->AddToViewport();
-				UE_LOG(LogTemp, Warning, TEXT("📝 Created and added attributes widget to viewport"));
+				UE_LOG(LogBuildingEnergyUI, Log, TEXT("📝 Created and added attributes widget to viewport"));
 				
 				// Center the widget on screen
 				if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
@@ -5097,7 +5340,7 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 						LocalPlayer->ViewportClient->GetViewportSize(ViewportSize);
 						FVector2D CenterPosition = ViewportSize * 0.5f;
 						BuildingAttributesWidget->SetPositionInViewport(CenterPosition - FVector2D(250, 200));
-						UE_LOG(LogTemp, Warning, TEXT("📝 Positioned widget at center of screen"));
+						UE_LOG(LogBuildingEnergyUI, Log, TEXT("📝 Positioned widget at center of screen"));
 					}
 				}
 				
@@ -5105,8 +5348,8 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 				if (UBuildingAttributesWidget* AttributesWidget = Cast<UBuildingAttributesWidget>(BuildingAttributesWidget))
 				{
 					// Pass the actual gml_id (with L) to the widget for attributes API call
-					AttributesWidget->SetBuildingData(AttributesApiGmlId, AccessToken);
-					UE_LOG(LogTemp, Warning, TEXT("✅ Attributes form opened for gml_id: %s"), *AttributesApiGmlId);
+					AttributesWidget->SetBuildingData(AttributesApiGmlId, AccessToken, GetCommunityOfBuilding(AttributesApiGmlId));
+					UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ Attributes form opened for gml_id: %s"), *AttributesApiGmlId);
 					
 					// REMOVED: Screen message to prevent duplicate displays - only ShowBuildingInfoWidget should show messages
 					// if (GEngine)
@@ -5117,44 +5360,44 @@ void ABuildingEnergyDisplay::ShowBuildingAttributesForm(const FString& BuildingG
 				}
 				else
 				{
-					UE_LOG(LogTemp, Error, TEXT("🚨 Failed to cast widget to UBuildingAttributesWidget"));
+					UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚨 Failed to cast widget to UBuildingAttributesWidget"));
 				}
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("🚨 Failed to create building attributes widget"));
+				UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚨 Failed to create building attributes widget"));
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("🚨 No player controller found"));
+			UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚨 No player controller found"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 No world found"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("🚨 No world found"));
 	}
 }
 
 void ABuildingEnergyDisplay::GetBuildingAttributeOptions()
 {
-	UE_LOG(LogTemp, Warning, TEXT("OPTIONS Getting building attribute dropdown options..."));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("OPTIONS Getting building attribute dropdown options..."));
 	
 	// This would typically call an API endpoint that returns dropdown options
 	// For now, we'll log what options we need based on the screenshot
 	
-	UE_LOG(LogTemp, Warning, TEXT("REQUIRED Required dropdown options for building attributes form:"));
-	UE_LOG(LogTemp, Warning, TEXT("   General Information:"));
-	UE_LOG(LogTemp, Warning, TEXT("     - Construction year class"));
-	UE_LOG(LogTemp, Warning, TEXT("     - Number/Type of Roof Storey"));
-	UE_LOG(LogTemp, Warning, TEXT("   Before Renovation:"));
-	UE_LOG(LogTemp, Warning, TEXT("     - Heating system type 1"));
-	UE_LOG(LogTemp, Warning, TEXT("     - Construction year class of renovated window"));
-	UE_LOG(LogTemp, Warning, TEXT("     - Construction year class of renovated wall"));
-	UE_LOG(LogTemp, Warning, TEXT("     - Construction year class of renovated roof"));
-	UE_LOG(LogTemp, Warning, TEXT("     - Construction year class of renovated ceiling"));
-	UE_LOG(LogTemp, Warning, TEXT("   After Renovation:"));
-	UE_LOG(LogTemp, Warning, TEXT("     - Same fields as Before Renovation"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("REQUIRED Required dropdown options for building attributes form:"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("   General Information:"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("     - Construction year class"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("     - Number/Type of Roof Storey"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("   Before Renovation:"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("     - Heating system type 1"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("     - Construction year class of renovated window"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("     - Construction year class of renovated wall"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("     - Construction year class of renovated roof"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("     - Construction year class of renovated ceiling"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("   After Renovation:"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("     - Same fields as Before Renovation"));
 	
 	// TODO: Make actual API call to get dropdown values
 	// This might be a separate endpoint or part of the building attributes API response
@@ -5162,6 +5405,7 @@ void ABuildingEnergyDisplay::GetBuildingAttributeOptions()
 
 void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 {
+	BUILDING_ENERGY_SCOPE(ClickResolution);
 	// 📨 TRACK MESSAGE FREQUENCY AND FUNCTION CALLS
 	static TMap<FString, TArray<float>> MessageTimestamps;
 	static TMap<FString, int32> TotalMessageCounts;
@@ -5181,7 +5425,7 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 	TotalMessageCounts[BuildingGmlId]++;
 	
 	// 📊 LOG MESSAGE STATISTICS
-	UE_LOG(LogTemp, Error, TEXT("📨 MESSAGE #%d - Building: %s, Total for this building: %d"), 
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📨 MESSAGE #%d - Building: %s, Total for this building: %d"), 
 		GlobalCallCounter, *BuildingGmlId, TotalMessageCounts[BuildingGmlId]);
 		
 	// Check recent message frequency (last 1 second)
@@ -5195,21 +5439,21 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 	
 	if (RecentMessages > 1)
 	{
-		UE_LOG(LogTemp, Error, TEXT("⚠️ MULTIPLE MESSAGES detected - %d calls in last 1 second for Building: %s"), 
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("⚠️ MULTIPLE MESSAGES detected - %d calls in last 1 second for Building: %s"), 
 			RecentMessages, *BuildingGmlId);
 		
 		// Show all recent timestamps
 		for (int32 i = Timestamps.Num() - 1; i >= 0 && i >= Timestamps.Num() - 5; i--)
 		{
 			float TimeDiff = CurrentTime - Timestamps[i];
-			UE_LOG(LogTemp, Error, TEXT("   📍 Call %d: %.3f seconds ago"), 
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("   📍 Call %d: %.3f seconds ago"), 
 				Timestamps.Num() - i, TimeDiff);
 		}
 	}
 	
 	// 🔍 FUNCTION SOURCE TRACKING
-	UE_LOG(LogTemp, Error, TEXT("🔍 FUNCTION TRACE - OnBuildingClicked entry point"));
-	UE_LOG(LogTemp, Error, TEXT("📍 CALL STACK - Building: %s, Time: %.3f"), *BuildingGmlId, CurrentTime);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 FUNCTION TRACE - OnBuildingClicked entry point"));
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📍 CALL STACK - Building: %s, Time: %.3f"), *BuildingGmlId, CurrentTime);
 	
 	// DUPLICATE PREVENTION (keep existing logic but enhance logging)
 	static FString LastProcessedId = TEXT("");
@@ -5217,7 +5461,7 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 	
 	if ((CurrentTime - LastCallTime) < 0.3f && LastProcessedId == BuildingGmlId)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚫 BLOCKED duplicate call - Building: %s (%.3fms gap, Total calls: %d)"), 
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚫 BLOCKED duplicate call - Building: %s (%.3fms gap, Total calls: %d)"), 
 			*BuildingGmlId, (CurrentTime - LastCallTime) * 1000.0f, TotalMessageCounts[BuildingGmlId]);
 		return;
 	}
@@ -5228,32 +5472,21 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 	// VALIDATION: Check if this is a valid building click
 	if (BuildingGmlId.IsEmpty())
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 Right-click rejected: Empty building ID"));
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚨 Right-click rejected: Empty building ID"));
 		return;
 	}
 	
 	if (BuildingGmlId == TEXT("XXXXX") || BuildingGmlId == TEXT("Default") || BuildingGmlId == TEXT("None"))
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 Right-click rejected: Invalid building ID '%s'"), *BuildingGmlId);
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚨 Right-click rejected: Invalid building ID '%s'"), *BuildingGmlId);
 		return;
 	}
 	
 	// 🔍 CESIUM PROPERTY DEBUG: When a building is clicked, show what Cesium properties are available
-	UE_LOG(LogTemp, Warning, TEXT("🔍 CESIUM DEBUG: Analyzing clicked building '%s' for gml:id properties"), *BuildingGmlId);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 CESIUM DEBUG: Analyzing clicked building '%s' for gml:id properties"), *BuildingGmlId);
 	
 	// Find the Cesium tileset actor to check its properties
-	AActor* TilesetActor = nullptr;
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), AllActors);
-	
-	for (AActor* Actor : AllActors)
-	{
-		if (Actor && Actor->GetClass()->GetName().Contains(TEXT("Cesium3DTileset")))
-		{
-			TilesetActor = Actor;
-			break;
-		}
-	}
+	AActor* TilesetActor = GetBuildingsTileset();
 	
 	if (TilesetActor)
 	{
@@ -5273,25 +5506,26 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 		
 		if (MetadataComponent)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🎯 CESIUM ANALYSIS: Found metadata component for clicked building"));
-			UE_LOG(LogTemp, Warning, TEXT("   Clicked Building ID: %s (format: modified_gml_id)"), *BuildingGmlId);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🎯 CESIUM ANALYSIS: Found metadata component for clicked building"));
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("   Clicked Building ID: %s (format: modified_gml_id)"), *BuildingGmlId);
 			
 			// Convert modified_gml_id to potential gml:id format for comparison
 			FString PotentialGmlId = BuildingGmlId;
 			// Replace _ with L patterns common in the conversion
 			PotentialGmlId = PotentialGmlId.Replace(TEXT("_"), TEXT("L"));
-			UE_LOG(LogTemp, Warning, TEXT("   Potential gml:id: %s (converted for matching)"), *PotentialGmlId);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("   Potential gml:id: %s (converted for matching)"), *PotentialGmlId);
 			
 			// Check if we have this building in our cache
-			if (BuildingColorCache.Contains(BuildingGmlId))
+			const int32 CachedIndex = BuildingStore.FindIndex(BuildingGmlId);
+			if (CachedIndex != INDEX_NONE && BuildingStore.HasColor(CachedIndex))
 			{
-				FLinearColor CachedColor = BuildingColorCache[BuildingGmlId];
-				UE_LOG(LogTemp, Warning, TEXT("   ✅ CACHE HIT: Found color R=%.2f G=%.2f B=%.2f"), 
+				const FLinearColor& CachedColor = BuildingStore.GetColor(CachedIndex);
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("   ✅ CACHE HIT: Found color R=%.2f G=%.2f B=%.2f"), 
 					CachedColor.R, CachedColor.G, CachedColor.B);
 			}
 			else
 			{
-				UE_LOG(LogTemp, Warning, TEXT("   ❌ CACHE MISS: No color found for this building"));
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("   ❌ CACHE MISS: No color found for this building"));
 			}
 			
 			// Look for gml:id in component properties using reflection
@@ -5304,19 +5538,19 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 				if (PropName.Contains(TEXT("gml")) || PropName.Contains(TEXT("id")) || 
 					PropName.Contains(TEXT("Description")) || PropName.Contains(TEXT("PropertyTable")))
 				{
-					UE_LOG(LogTemp, Warning, TEXT("   🏷️ PROPERTY: %s"), *PropName);
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("   🏷️ PROPERTY: %s"), *PropName);
 				}
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("   ❌ No CesiumFeaturesMetadata component found on tileset"));
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("   ❌ No CesiumFeaturesMetadata component found on tileset"));
 		}
 	}
 	
 	if (AccessToken.IsEmpty())
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 No access token. Cannot open attributes form."));
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚨 No access token. Cannot open attributes form."));
 		// REMOVED: Authentication message to prevent interference with single building display
 		// if (GEngine)
 		// {
@@ -5327,104 +5561,60 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 	
 	// RIGHT-CLICK: BuildingGmlId is the modified_gml_id (with _) from Blueprint
 	// We need to validate it exists in our energy data cache first
-	if (!BuildingDataCache.Contains(BuildingGmlId))
+	const int32 ClickedIndex = BuildingStore.FindIndex(BuildingGmlId);
+	if (ClickedIndex == INDEX_NONE || !BuildingStore.HasDisplayText(ClickedIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 Building '%s' not found in energy data cache"), *BuildingGmlId);
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚨 Building '%s' not found in energy data cache"), *BuildingGmlId);
 		
 		// CASE-SENSITIVE search (gml_id and modified_gml_id are case-sensitive)
 		bool bFoundMatch = false;
 		FString FoundKey;
 		
-		UE_LOG(LogTemp, Warning, TEXT("🔍 RIGHT-CLICK SEARCH: Looking for building '%s' in cache"), *BuildingGmlId);
-		UE_LOG(LogTemp, Warning, TEXT("🔍 CACHE SIZE: %d buildings available"), BuildingDataCache.Num());
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 RIGHT-CLICK SEARCH: Looking for building '%s' in cache"), *BuildingGmlId);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 CACHE SIZE: %d buildings available"), BuildingStore.Num());
 		
-		// Strategy 1: Exact case-sensitive match
-		for (const auto& Entry : BuildingDataCache)
-		{
-			if (Entry.Key.Equals(BuildingGmlId))
-			{
-				FoundKey = Entry.Key;
-				bFoundMatch = true;
-				UE_LOG(LogTemp, Warning, TEXT("✅ Strategy 1 SUCCESS: Exact case-sensitive match '%s' -> '%s'"), *BuildingGmlId, *FoundKey);
-				break;
-			}
-		}
+		// Strategy 1: Exact case-sensitive match is the store hash lookup above
 		
-		// Strategy 2: If no exact match, try ID format variations and transformations
+		// Strategy 2: If no exact match, try ID format variations through the precomputed variant index
 		if (!bFoundMatch)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔍 Strategy 2: Trying ID format variations for: %s"), *BuildingGmlId);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 Strategy 2: Trying ID format variations for: %s"), *BuildingGmlId);
 			
-			for (const auto& Entry : BuildingDataCache)
+			// The index also folds case; only accept the candidate when the '_'/'L' forms match CASE-SENSITIVELY
+			const int32 VariantIndex = BuildingStore.FindVariantIndex(BuildingGmlId);
+			if (VariantIndex != INDEX_NONE && BuildingStore.HasDisplayText(VariantIndex))
 			{
-				FString CacheKey = Entry.Key;
-				FString SearchKey = BuildingGmlId;
-				
-				// Create multiple normalized versions to compare
-				TArray<FString> SearchVariations;
-				TArray<FString> CacheVariations;
-				
-				// Add original versions (CASE-SENSITIVE - gml_id fields are case-sensitive)
-				SearchVariations.Add(SearchKey);
-				CacheVariations.Add(CacheKey);
-				
-				// Add underscore/L conversion variations (CASE-SENSITIVE)
-				// Convert L to _ and _ to L
-				FString SearchWithUnderscore = SearchKey.Replace(TEXT("L"), TEXT("_"));
-				FString SearchWithL = SearchKey.Replace(TEXT("_"), TEXT("L"));
-				FString CacheWithUnderscore = CacheKey.Replace(TEXT("L"), TEXT("_"));
-				FString CacheWithL = CacheKey.Replace(TEXT("_"), TEXT("L"));
-				
-				SearchVariations.Add(SearchWithUnderscore);
-				SearchVariations.Add(SearchWithL);
-				CacheVariations.Add(CacheWithUnderscore);
-				CacheVariations.Add(CacheWithL);
-				
-				// REMOVED: Case variations for common suffixes - gml_id fields are case-sensitive
-				// GML IDs must be matched exactly with correct case (G != g)
-				
-				// Compare all variations
-				for (const FString& SearchVar : SearchVariations)
+				const FString SearchWithL = BuildingGmlId.Replace(TEXT("_"), TEXT("L"));
+				for (const FString* CacheKey : { &BuildingStore.ModifiedGmlIds[VariantIndex], &BuildingStore.ActualGmlIds[VariantIndex] })
 				{
-					for (const FString& CacheVar : CacheVariations)
-					{
-						if (SearchVar.Equals(CacheVar))
-						{
-							FoundKey = Entry.Key;
-							bFoundMatch = true;
-							UE_LOG(LogTemp, Warning, TEXT("✅ Strategy 2 SUCCESS: ID format match '%s' <-> '%s' (search:'%s' cache:'%s')"), 
-								*BuildingGmlId, *FoundKey, *SearchVar, *CacheVar);
-							break;
-						}
+					if (CacheKey->Replace(TEXT("_"), TEXT("L")).Equals(SearchWithL, ESearchCase::CaseSensitive))
+					{
+						FoundKey = *CacheKey;
+						bFoundMatch = true;
+						UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("✅ Strategy 2 SUCCESS: ID format match '%s' <-> '%s'"), *BuildingGmlId, *FoundKey);
+						break;
 					}
-					if (bFoundMatch) break;
 				}
-				if (bFoundMatch) break;
 			}
 		}
 		
-		// Strategy 3: If still no match, try partial matching (contains)
-		// Strategy 3: Try partial matching for: CASE-SENSITIVE (gml_id fields are case-sensitive)
+		// Strategy 3: If still no match, try partial matching (contains) through the prefix/suffix index
 		if (!bFoundMatch)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔍 Trying partial matching for: %s"), *BuildingGmlId);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 Trying partial matching for: %s"), *BuildingGmlId);
 			
-			for (const auto& Entry : BuildingDataCache)
+			const int32 PartialIndex = BuildingStore.FindPartialMatchIndex(BuildingGmlId);
+			if (PartialIndex != INDEX_NONE && BuildingStore.HasDisplayText(PartialIndex))
 			{
-				// Try partial matching - check if the search string is contained in cache key (CASE-SENSITIVE)
-				if (Entry.Key.Contains(BuildingGmlId) || BuildingGmlId.Contains(Entry.Key))
-				{
-					FoundKey = Entry.Key;
-					bFoundMatch = true;
-					UE_LOG(LogTemp, Warning, TEXT("✅ Partial match found: '%s' -> '%s'"), *BuildingGmlId, *FoundKey);
-					break;
-				}
+				FoundKey = BuildingStore.ModifiedGmlIds[PartialIndex];
+				bFoundMatch = true;
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("✅ Partial match found: '%s' -> '%s'"), *BuildingGmlId, *FoundKey);
 			}
 		}
 		
 		if (bFoundMatch)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("✅ RIGHT-CLICK SUCCESS: Building match resolved. Opening form for: %s"), *FoundKey);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("✅ RIGHT-CLICK SUCCESS: Building match resolved. Opening form for: %s"), *FoundKey);
 			// REMOVED: Screen message to prevent duplicate displays - only ShowBuildingInfoWidget should show messages
 			// if (GEngine)
 			// {
@@ -5436,18 +5626,20 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 		else
 		{
 			// Enhanced debugging for failed matches
-			UE_LOG(LogTemp, Error, TEXT("🚨 RIGHT-CLICK FAILED: Building '%s' not found after all strategies"), *BuildingGmlId);
-			UE_LOG(LogTemp, Error, TEXT("🔍 DEBUGGING: Available buildings in cache:"));
+			UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚨 RIGHT-CLICK FAILED: Building '%s' not found after all strategies"), *BuildingGmlId);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 DEBUGGING: Available buildings in cache:"));
 			int32 LogCount = 0;
-			for (const auto& Entry : BuildingDataCache)
+			for (int32 Index = 0; Index < BuildingStore.Num() && LogCount < 10; ++Index) // Log first 10 for better debugging
 			{
-				FString CacheKey = Entry.Key;
-				FString Similarity = CacheKey.Contains(BuildingGmlId) ? TEXT("[PARTIAL]") : TEXT("");
-				UE_LOG(LogTemp, Error, TEXT("  %d: '%s' %s"), LogCount + 1, *CacheKey, *Similarity);
-				if (++LogCount >= 10) break; // Log first 10 for better debugging
+				if (BuildingStore.HasDisplayText(Index))
+				{
+					const FString& CacheKey = BuildingStore.ModifiedGmlIds[Index];
+					FString Similarity = CacheKey.Contains(BuildingGmlId) ? TEXT("[PARTIAL]") : TEXT("");
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("  %d: '%s' %s"), ++LogCount, *CacheKey, *Similarity);
+				}
 			}
 			
-			UE_LOG(LogTemp, Error, TEXT("🚨 SOLUTION: Check if building ID format matches cache. Search: '%s'"), *BuildingGmlId);
+			UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚨 SOLUTION: Check if building ID format matches cache. Search: '%s'"), *BuildingGmlId);
 			// REMOVED: Screen message to prevent clutter - errors logged to console only
 			// if (GEngine)
 			// {
@@ -5459,7 +5651,7 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 	}
 	
 	// Building found in cache - proceed to show attributes form
-	UE_LOG(LogTemp, Error, TEXT("✅ Building found in cache. Opening attributes form for: %s"), *BuildingGmlId);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("✅ Building found in cache. Opening attributes form for: %s"), *BuildingGmlId);
 	ShowBuildingAttributesForm(BuildingGmlId);
 }
 
@@ -5467,14 +5659,16 @@ void ABuildingEnergyDisplay::OnBuildingClicked(const FString& BuildingGmlId)
 
 void ABuildingEnergyDisplay::OnBuildingClickedWithPosition(const FString& BuildingGmlId, const FVector& ClickPosition)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(BuildingEnergy_ClickWithPosition); // Validation counts as HitTest, the resolved click as ClickResolution
 	// ⭐ CRITICAL: Position validation must be the FIRST check before ANY building operations
-	UE_LOG(LogTemp, Warning, TEXT("🎯 Position-aware building click: ID=%s, Pos=(%f,%f,%f)"), 
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🎯 Position-aware building click: ID=%s, Pos=(%f,%f,%f)"), 
 		*BuildingGmlId, ClickPosition.X, ClickPosition.Y, ClickPosition.Z);
 	
 	// Step 1: Check if building has coordinate data
-	if (!BuildingCoordinatesCache.Contains(BuildingGmlId))
+	const int32 BuildingIndex = BuildingStore.FindIndex(BuildingGmlId);
+	if (BuildingIndex == INDEX_NONE || !BuildingStore.HasGeometry(BuildingIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚨 Building %s has no coordinate data - cannot validate position"), *BuildingGmlId);
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚨 Building %s has no coordinate data - cannot validate position"), *BuildingGmlId);
 		// Fallback to standard method if no coordinates available
 		OnBuildingClicked(BuildingGmlId);
 		return;
@@ -5483,28 +5677,28 @@ void ABuildingEnergyDisplay::OnBuildingClickedWithPosition(const FString& Buildi
 	// Step 2: Validate position is within building polygon
 	if (!ValidateBuildingPosition(ClickPosition, BuildingGmlId))
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚫 Click position validation FAILED - position outside building bounds"));
-		UE_LOG(LogTemp, Error, TEXT("🚫 Building ID: %s"), *BuildingGmlId);
-		UE_LOG(LogTemp, Error, TEXT("🚫 Click Position: (%f, %f, %f)"), ClickPosition.X, ClickPosition.Y, ClickPosition.Z);
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚫 Click position validation FAILED - position outside building bounds"));
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚫 Building ID: %s"), *BuildingGmlId);
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🚫 Click Position: (%f, %f, %f)"), ClickPosition.X, ClickPosition.Y, ClickPosition.Z);
 		
 		// Try to find correct building at this position using coordinate map
 		FString CorrectGmlId = GetBuildingByCoordinates(ClickPosition);
 		if (!CorrectGmlId.IsEmpty() && CorrectGmlId != BuildingGmlId)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Found correct building at position: %s (instead of %s)"), 
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔄 Found correct building at position: %s (instead of %s)"), 
 				*CorrectGmlId, *BuildingGmlId);
 			// Use the correct building ID
 			OnBuildingClicked(CorrectGmlId);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("❌ No valid building found at click position"));
+			UE_LOG(LogBuildingEnergyPicking, Error, TEXT("❌ No valid building found at click position"));
 		}
 		return;
 	}
 	
 	// ✅ Position validation PASSED - proceed with standard building click handling
-	UE_LOG(LogTemp, Warning, TEXT("✅ Position validation PASSED for building %s"), *BuildingGmlId);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("✅ Position validation PASSED for building %s"), *BuildingGmlId);
 	OnBuildingClicked(BuildingGmlId);
 }
 
@@ -5519,12 +5713,10 @@ void ABuildingEnergyDisplay::StartRealTimeMonitoring()
 	// Start with fast polling for immediate responsiveness
 	RealTimeUpdateInterval = bEnhancedPollingMode ? FastPollingInterval : RealTimeUpdateInterval;
 	
-	UE_LOG(LogTemp, Warning, TEXT("REALTIME Real-time monitoring STARTED (checking every %.1f seconds)"), RealTimeUpdateInterval);
-	UE_LOG(LogTemp, Warning, TEXT("REALTIME Enhanced polling mode: %s"), bEnhancedPollingMode ? TEXT("ENABLED") : TEXT("DISABLED"));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Real-time monitoring STARTED (checking every %.1f seconds)"), RealTimeUpdateInterval);
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Enhanced polling mode: %s"), bEnhancedPollingMode ? TEXT("ENABLED") : TEXT("DISABLED"));
 	
-	// Create initial snapshot for change detection
-	PreviousBuildingDataSnapshot = BuildingDataCache;
-	PreviousColorSnapshot = BuildingColorCache;
+	// Change detection compares against the fingerprints the last ingest stored per building
 	
 	if (GEngine)
 	{
@@ -5539,7 +5731,7 @@ void ABuildingEnergyDisplay::StopRealTimeMonitoring()
 	bRealTimeMonitoringEnabled = false;
 	bIsPerformingRealTimeUpdate = false;
 	NoChangesCount = 0;
-	UE_LOG(LogTemp, Warning, TEXT("REALTIME Real-time monitoring STOPPED"));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Real-time monitoring STOPPED"));
 	
 	if (GEngine)
 	{
@@ -5551,12 +5743,12 @@ void ABuildingEnergyDisplay::SetRealTimeUpdateInterval(float Seconds)
 {
 	if (Seconds < 0.5f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME Minimum update interval is 0.5 second. Setting to 0.5s"));
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Minimum update interval is 0.5 second. Setting to 0.5s"));
 		RealTimeUpdateInterval = 0.5f;
 	}
 	else if (Seconds > 60.0f)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME Maximum update interval is 60 seconds. Setting to 60.0s"));
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Maximum update interval is 60 seconds. Setting to 60.0s"));
 		RealTimeUpdateInterval = 60.0f;
 	}
 	else
@@ -5564,7 +5756,7 @@ void ABuildingEnergyDisplay::SetRealTimeUpdateInterval(float Seconds)
 		RealTimeUpdateInterval = Seconds;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("REALTIME Update interval set to %.1f seconds"), RealTimeUpdateInterval);
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Update interval set to %.1f seconds"), RealTimeUpdateInterval);
 }
 
 void ABuildingEnergyDisplay::EnableEnhancedPolling(bool bEnable)
@@ -5575,11 +5767,11 @@ void ABuildingEnergyDisplay::EnableEnhancedPolling(bool bEnable)
 	if (bEnable)
 	{
 		RealTimeUpdateInterval = FastPollingInterval;
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME Enhanced polling ENABLED - smart intervals active"));
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Enhanced polling ENABLED - smart intervals active"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME Enhanced polling DISABLED - fixed intervals"));
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Enhanced polling DISABLED - fixed intervals"));
 	}
 }
 
@@ -5587,36 +5779,56 @@ void ABuildingEnergyDisplay::PerformRealTimeDataCheck()
 {
 	if (bIsPerformingRealTimeUpdate)
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("REALTIME Real-time update already in progress, skipping"));
+		UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("REALTIME Real-time update already in progress, skipping"));
 		return;
 	}
 	
+	if (CommunityIds.Num() == 0)
+	{
+		return;
+	}
+	
+	// One community per check, so each poll stays the size of one shard
+	NextRealTimeCommunity = NextRealTimeCommunity % CommunityIds.Num();
+	PollRealTimeCommunity(CommunityIds[NextRealTimeCommunity++]);
+}
+
+void ABuildingEnergyDisplay::PollRealTimeCommunity(const FString& CommunityId)
+{
 	bIsPerformingRealTimeUpdate = true;
+	RealTimeRequestCommunityId = CommunityId;
+	RealTimeRequestChunkRebuild = NumChunkStoreRebuilds;
 	
 	// Make HTTP request to check for data changes
 	TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
-	FString ApiUrl = TEXT("https://backend.gisworld-tech.com/geospatial/buildings-energy/?community_id=08417008&field_type=basic");
+	// Same color parameters as the preload: the fingerprints compare the end color, and polls must see the same palette
+	FString ApiUrl = FString::Printf(TEXT("%s/geospatial/buildings-energy/?community_id=%s&field_type=basic&include_colors=true&energy_type=total&time_period=annual&classification=co2&color_scheme=co2_classes"),
+		*UBuildingEnergyApiSubsystem::GetApiBaseUrl(), *FGenericPlatformHttp::UrlEncode(CommunityId));
+	
+	// Delta sync: ask only for buildings changed since the last cursor the server handed out for this community
+	const FString* Cursor = DeltaSyncCursors.Find(CommunityId);
+	bRealTimeRequestUsedCursor = bUseDeltaSync && Cursor;
+	if (bRealTimeRequestUsedCursor)
+	{
+		ApiUrl += FString::Printf(TEXT("&%s=%s"), *DeltaSyncQueryParameter, *FGenericPlatformHttp::UrlEncode(*Cursor));
+	}
 	
 	Request->SetURL(ApiUrl);
 	Request->SetVerb(TEXT("GET"));
 	Request->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *AccessToken));
 	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 	
-	// Real-time cache busting headers
-	Request->SetHeader(TEXT("Cache-Control"), TEXT("no-cache, no-store, must-revalidate"));
-	Request->SetHeader(TEXT("Pragma"), TEXT("no-cache"));
-	
-	Request->OnProcessRequestComplete().BindUObject(this, &ABuildingEnergyDisplay::OnRealTimeDataResponse);
-	
-	if (Request->ProcessRequest())
+	// Conditional GET: an unchanged dataset comes back as a bodiless 304 - unless the store must be resynced,
+	// which an unchanged dataset does not mean
+	if (!FullResyncCommunities.Contains(CommunityId))
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("REALTIME Background data check request sent"));
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("REALTIME Failed to send background data check request"));
-		bIsPerformingRealTimeUpdate = false;
+		FBuildingHttpValidators::Get().ApplyTo(*Request);
 	}
+	
+	// Background priority: user requests go first; OnRealTimeDataResponse clears bIsPerformingRealTimeUpdate either way
+	UBuildingEnergyApiSubsystem::Send(this, Request, 
+		FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnRealTimeDataResponse), EBuildingApiPriority::Background);
+	UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("REALTIME Background data check request submitted for community %s"), *CommunityId);
 }
 
 void ABuildingEnergyDisplay::OnRealTimeDataResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
@@ -5625,112 +5837,157 @@ void ABuildingEnergyDisplay::OnRealTimeDataResponse(FHttpRequestPtr Request, FHt
 	
 	if (!bWasSuccessful || !Response.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME Background data check failed"));
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("REALTIME Background data check failed"));
 		return;
 	}
 	
-	if (Response->GetResponseCode() != 200)
+	// Sent against a viewport store that was rebuilt meanwhile; the full resync replaces it
+	if (RealTimeRequestChunkRebuild != NumChunkStoreRebuilds)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME Background data check returned HTTP %d"), Response->GetResponseCode());
+		UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("REALTIME Dropping a poll sent before the viewport store was rebuilt"));
 		return;
 	}
 	
-	FString ResponseContent = Response->GetContentAsString();
-	if (ResponseContent.IsEmpty())
+	if (FBuildingHttpValidators::IsNotModified(*Response))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME Background data check returned empty response"));
+		UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("REALTIME Background data check: 304 Not Modified"));
+		UpdatePollingStrategy(false);
 		return;
 	}
 	
-	UE_LOG(LogTemp, Verbose, TEXT("REALTIME Background data check successful, analyzing for changes..."));
-	DetectAndApplyChanges(ResponseContent);
-}
-
-void ABuildingEnergyDisplay::DetectAndApplyChanges(const FString& NewJsonData)
-{
-	// Parse new JSON data
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(NewJsonData);
+	const int32 ResponseCode = Response->GetResponseCode();
+	if (bRealTimeRequestUsedCursor && (ResponseCode == 400 || ResponseCode == 410 || ResponseCode == 422))
+	{
+		// Cursor expired or unknown to the server: resync the whole community right away
+		const FString CommunityId = RealTimeRequestCommunityId;
+		ResetDeltaSync(CommunityId, *FString::Printf(TEXT("cursor rejected with HTTP %d"), ResponseCode));
+		PollRealTimeCommunity(CommunityId);
+		return;
+	}
 	
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	if (ResponseCode != 200)
 	{
-		UE_LOG(LogTemp, Error, TEXT("REALTIME Failed to parse new JSON data"));
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("REALTIME Background data check returned HTTP %d"), ResponseCode);
 		return;
 	}
+	FBuildingHttpValidators::Get().Record(*Request, *Response);
 	
-	const TArray<TSharedPtr<FJsonValue>>* ResultsArray;
-	if (!JsonObject->TryGetArrayField(TEXT("results"), ResultsArray))
+	FString ResponseContent = Response->GetContentAsString();
+	if (ResponseContent.IsEmpty())
 	{
-		UE_LOG(LogTemp, Error, TEXT("REALTIME No results array in JSON response"));
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("REALTIME Background data check returned empty response"));
 		return;
 	}
 	
+	// A delta response holds only the changed buildings, which DetectAndApplyChanges patches in place;
+	// a full one is diffed against the stored fingerprints
+	UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("REALTIME Background data check successful, analyzing for changes..."));
+	if (!DetectAndApplyChanges(ResponseContent, RealTimeRequestCommunityId))
+	{
+		return; // Keep the old cursor so the same changes are asked for again
+	}
+	FullResyncCommunities.Remove(RealTimeRequestCommunityId);
+	
+	if (bUseDeltaSync)
+	{
+		const FString NextCursor = Response->GetHeader(DeltaSyncCursorHeader);
+		if (NextCursor.IsEmpty())
+		{
+			if (DeltaSyncCursors.Contains(RealTimeRequestCommunityId))
+			{
+				ResetDeltaSync(RealTimeRequestCommunityId, TEXT("response carried no cursor"));
+			}
+		}
+		else
+		{
+			UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("REALTIME %s response for community %s, next cursor %s"), bRealTimeRequestUsedCursor ? TEXT("Delta") : TEXT("Full"), *RealTimeRequestCommunityId, *NextCursor);
+			DeltaSyncCursors.Add(RealTimeRequestCommunityId, NextCursor);
+		}
+	}
+}
+
+void ABuildingEnergyDisplay::ResetDeltaSync(const FString& CommunityId, const TCHAR* Reason)
+{
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Delta sync reset for community %s (%s) - next poll fetches the full community"), *CommunityId, Reason);
+	DeltaSyncCursors.Remove(CommunityId);
+	bRealTimeRequestUsedCursor = false;
+}
+
+bool ABuildingEnergyDisplay::DetectAndApplyChanges(const FString& NewJsonData, const FString& CommunityId)
+{
+	BUILDING_ENERGY_SCOPE(ChangeDetection);
+	// Changes are mirrored into the community's shard so a later merge (another shard's refresh) keeps them.
+	// Skipped while a merge worker reads the shards; the next full poll of the community catches up
+	FCommunityShard* Shard = NumCommunityMergesPending == 0 ? CommunityShards.Find(CommunityId) : nullptr;
+	FBuildingStore* ShardStore = Shard ? Shard->Store.Get() : nullptr;
+	
 	// Track changed buildings
 	TArray<FString> ChangedBuildings;
-	TMap<FString, FString> NewBuildingData;
-	TMap<FString, FLinearColor> NewColorData;
 	
-	// Process each building result
-	for (const TSharedPtr<FJsonValue>& ResultValue : *ResultsArray)
+	// Stream the poll response and compare one fingerprint per building - no JSON is re-serialized
+	FString ParseError;
+	const bool bParsed = FBuildingEnergyStreamReader::ReadBuildings(NewJsonData, [this, &ChangedBuildings, ShardStore](FBuildingEnergyRecord& Record)
 	{
-		TSharedPtr<FJsonObject> ResultObject = ResultValue->AsObject();
-		if (!ResultObject.IsValid()) continue;
-		
-		FString BuildingModifiedGmlId = ResultObject->GetStringField(TEXT("modified_gml_id"));
-		if (BuildingModifiedGmlId.IsEmpty()) continue;
+		// Viewport loading only keeps the buildings of cached chunks; the rest arrive with their chunk
+		const int32 BuildingIndex = bLoadByViewport ? BuildingStore.FindIndex(Record.ModifiedGmlId) : BuildingStore.FindOrAddBuilding(Record.ModifiedGmlId, Record.ActualGmlId);
+		if (BuildingIndex == INDEX_NONE)
+		{
+			return;
+		}
+		// The fingerprint covers the end color, so it only compares records that carry one; a colorless record
+		// (a response without include_colors) is compared value by value and never recolors the building
+		const bool bHasColor = !Record.End.EnergyDemandSpecificColor.IsEmpty();
+		const uint64 Fingerprint = Record.ComputeFingerprint();
+		if (bHasColor && BuildingStore.Fingerprints[BuildingIndex] == Fingerprint)
+		{
+			return; // Unchanged since the last ingest or poll
+		}
 		
-		// Convert to JSON string for comparison
-		FString NewDataJson;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&NewDataJson);
-		FJsonSerializer::Serialize(ResultObject.ToSharedRef(), Writer);
+		// Polls only update energy and color; geometry stays as ingested. The queue applies it within the frame budget
+		FBuildingPatch Patch;
+		if (MakeBuildingPatch(BuildingStore, BuildingIndex, Record, Patch, false) && (bHasColor || PatchChangesStore(BuildingStore, Patch)))
+		{
+			QueueBuildingPatch(Patch);
+			ChangedBuildings.Add(Record.ModifiedGmlId);
+		}
+		if (bHasColor)
+		{
+			BuildingStore.Fingerprints[BuildingIndex] = Fingerprint;
+		}
 		
-		// Check if data has changed
-		FString* PreviousData = PreviousBuildingDataSnapshot.Find(BuildingModifiedGmlId);
-		if (!PreviousData || !PreviousData->Equals(NewDataJson))
+		const int32 ShardIndex = ShardStore ? ShardStore->FindIndex(Record.ModifiedGmlId) : INDEX_NONE;
+		FBuildingPatch ShardPatch;
+		if (ShardIndex != INDEX_NONE && MakeBuildingPatch(*ShardStore, ShardIndex, Record, ShardPatch, false))
 		{
-			ChangedBuildings.Add(BuildingModifiedGmlId);
-			NewBuildingData.Add(BuildingModifiedGmlId, NewDataJson);
-			
-			// Extract color information for automatic UI updates
-			TSharedPtr<FJsonObject> EndObject = ResultObject->GetObjectField(TEXT("end"));
-			if (EndObject.IsValid())
+			FBuildingPatchCodec::Apply(ShardPatch, *ShardStore);
+			if (bHasColor)
 			{
-				TSharedPtr<FJsonObject> EndColor = EndObject->GetObjectField(TEXT("color"));
-				if (EndColor.IsValid() && EndColor->HasField(TEXT("energy_demand_specific_color")))
-				{
-					FString ColorHex = EndColor->GetStringField(TEXT("energy_demand_specific_color"));
-					FLinearColor BuildingColor = ConvertHexToLinearColor(ColorHex);
-					NewColorData.Add(BuildingModifiedGmlId, BuildingColor);
-				}
+				ShardStore->Fingerprints[ShardIndex] = Fingerprint;
 			}
 		}
+	}, &ParseError);
+	
+	if (!bParsed)
+	{
+		UE_LOG(LogBuildingEnergyUpdates, Error, TEXT("REALTIME Failed to parse new JSON data: %s"), *ParseError);
+		return false;
 	}
 	
 	// Apply changes if any detected
 	if (ChangedBuildings.Num() > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME CHANGES DETECTED! %d building(s) changed:"), ChangedBuildings.Num());
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME CHANGES DETECTED! %d building(s) changed:"), ChangedBuildings.Num());
 		
-		// Update caches
+		// Changes were queued while streaming; Tick applies and restyles them
+		FBuildingLogSampler ChangeLog(LogBuildingEnergyUpdates, TEXT("changed buildings queued"));
 		for (const FString& BuildingId : ChangedBuildings)
 		{
-			if (NewBuildingData.Contains(BuildingId))
-			{
-				BuildingDataCache.Add(BuildingId, NewBuildingData[BuildingId]);
-				PreviousBuildingDataSnapshot.Add(BuildingId, NewBuildingData[BuildingId]);
-				UE_LOG(LogTemp, Warning, TEXT("  - Building %s: Data updated"), *BuildingId);
-			}
-			
-			if (NewColorData.Contains(BuildingId))
+			if (ChangeLog.Sample())
 			{
-				BuildingColorCache.Add(BuildingId, NewColorData[BuildingId]);
-				PreviousColorSnapshot.Add(BuildingId, NewColorData[BuildingId]);
-				UE_LOG(LogTemp, Warning, TEXT("  - Building %s: Color updated"), *BuildingId);
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyUpdates, Verbose, TEXT("  - Building %s: Data and color queued"), *BuildingId);
 			}
 		}
-		
-		// Apply visual updates automatically
-		ApplyColorsUsingCesiumStyling();
+		ChangeLog.Flush();
 		
 		// Notify about changes
 		NotifyRealTimeChanges(ChangedBuildings);
@@ -5740,11 +5997,12 @@ void ABuildingEnergyDisplay::DetectAndApplyChanges(const FString& NewJsonData)
 	}
 	else
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("REALTIME No changes detected in background check"));
+		UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("REALTIME No changes detected in background check"));
 		
 		// Update polling strategy for no changes
 		UpdatePollingStrategy(false);
 	}
+	return true;
 }
 
 void ABuildingEnergyDisplay::UpdatePollingStrategy(bool bChangesDetected)
@@ -5759,7 +6017,7 @@ void ABuildingEnergyDisplay::UpdatePollingStrategy(bool bChangesDetected)
 		// Changes detected - stay on fast polling and reset counter
 		NoChangesCount = 0;
 		RealTimeUpdateInterval = FastPollingInterval;
-		UE_LOG(LogTemp, Warning, TEXT("REALTIME Changes detected - using fast polling (%.1fs)"), FastPollingInterval);
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Changes detected - using fast polling (%.1fs)"), FastPollingInterval);
 	}
 	else
 	{
@@ -5770,7 +6028,7 @@ void ABuildingEnergyDisplay::UpdatePollingStrategy(bool bChangesDetected)
 		{
 			// Switch to slow polling mode to reduce API load
 			RealTimeUpdateInterval = SlowPollingInterval;
-			UE_LOG(LogTemp, Verbose, TEXT("REALTIME No changes for %d checks - switching to slow polling (%.1fs)"), 
+			UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("REALTIME No changes for %d checks - switching to slow polling (%.1fs)"), 
 				NoChangesCount, SlowPollingInterval);
 		}
 		else
@@ -5784,35 +6042,35 @@ void ABuildingEnergyDisplay::UpdatePollingStrategy(bool bChangesDetected)
 void ABuildingEnergyDisplay::NotifyRealTimeChanges(const TArray<FString>& ChangedBuildings)
 {
 	// Log changes to console for debugging
-	UE_LOG(LogTemp, Warning, TEXT("REALTIME Real-time changes applied automatically: %d buildings updated"), ChangedBuildings.Num());
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("REALTIME Real-time changes applied automatically: %d buildings updated"), ChangedBuildings.Num());
 	
 	// Log first few changed buildings for debugging
 	int32 ShowCount = FMath::Min(ChangedBuildings.Num(), 3);
 	for (int32 i = 0; i < ShowCount; i++)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("  - Updated: %s"), *ChangedBuildings[i]);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyUpdates, Verbose, TEXT("  - Updated: %s"), *ChangedBuildings[i]);
 	}
 	
 	if (ChangedBuildings.Num() > 3)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("  ... and %d more buildings updated"), ChangedBuildings.Num() - 3);
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("  ... and %d more buildings updated"), ChangedBuildings.Num() - 3);
 	}
 }
 
 void ABuildingEnergyDisplay::CloseAttributesForm()
 {
-	UE_LOG(LogTemp, Log, TEXT("Closing building attributes form"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("Closing building attributes form"));
 	
 	// Remove existing widget if any
 	if (BuildingAttributesWidget)
 	{
 		BuildingAttributesWidget->RemoveFromParent();
 		BuildingAttributesWidget = nullptr;
-		UE_LOG(LogTemp, Log, TEXT("Building attributes form closed"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("Building attributes form closed"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("No building attributes form to close"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("No building attributes form to close"));
 	}
 }
 
@@ -5822,36 +6080,37 @@ void ABuildingEnergyDisplay::CloseAttributesForm()
 
 void ABuildingEnergyDisplay::CreateBuildingInfoWidget()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CreateBuildingInfoWidget - Using screen overlay approach"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("🎨 CreateBuildingInfoWidget - Using screen overlay approach"));
 	
 	// Remove existing widget if any (single building display)
 	HideBuildingInfoWidget();
 	
-	UE_LOG(LogTemp, Warning, TEXT("✅ Building Info Widget system initialized (screen overlay mode)"));
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ Building Info Widget system initialized (screen overlay mode)"));
 }
 
 void ABuildingEnergyDisplay::ShowBuildingInfoWidget(const FString& BuildingId, const FString& BuildingData)
 {
+	BUILDING_ENERGY_SCOPE(WidgetPopulation);
 	// INSTANCE PROTECTION: Only allow the first instance to show messages
 	static ABuildingEnergyDisplay* PrimaryInstance = nullptr;
 	if (PrimaryInstance == nullptr)
 	{
 		PrimaryInstance = this;
-		UE_LOG(LogTemp, Warning, TEXT("👑 PRIMARY INSTANCE: %s designated as primary display instance"), *GetName());
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("👑 PRIMARY INSTANCE: %s designated as primary display instance"), *GetName());
 	}
 	
 	if (this != PrimaryInstance)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🚫 SECONDARY INSTANCE: %s blocked from showing messages (Primary: %s)"), *GetName(), *PrimaryInstance->GetName());
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🚫 SECONDARY INSTANCE: %s blocked from showing messages (Primary: %s)"), *GetName(), *PrimaryInstance->GetName());
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🎨 ShowBuildingInfoWidget - Building: %s (Primary Instance)"), *BuildingId);
+	UE_LOG(LogBuildingEnergyUI, Log, TEXT("🎨 ShowBuildingInfoWidget - Building: %s (Primary Instance)"), *BuildingId);
 	
 	// SINGLE BUILDING DISPLAY: Hide any previously displayed building
 	if (!CurrentlyDisplayedBuildingId.IsEmpty() && CurrentlyDisplayedBuildingId != BuildingId)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔄 SINGLE DISPLAY: Hiding previous building '%s' and showing '%s'"), 
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🔄 SINGLE DISPLAY: Hiding previous building '%s' and showing '%s'"), 
 			*CurrentlyDisplayedBuildingId, *BuildingId);
 		HideBuildingInfoWidget();
 	}
@@ -5875,103 +6134,24 @@ void ABuildingEnergyDisplay::ShowBuildingInfoWidget(const FString& BuildingId, c
 		FormattedData = FormattedData.Replace(TEXT("{"), TEXT("{\n  "));
 		FormattedData = FormattedData.Replace(TEXT("}"), TEXT("\n}"));
 		
-		// NEW: Extract hex color directly from JSON cache following ChatGPT approach
-		// BuildingId should be modified_gml_id (with underscore) which is the cache key
+		// Color hex comes straight from the building store; BuildingId may be either id
 		FString EndEnergyDemandSpecificColor = TEXT("No data");
 		
-		UE_LOG(LogTemp, Warning, TEXT("🎨 LOOKUP: Looking for building '%s' in BuildingJsonCache (%d entries)"), *BuildingId, BuildingJsonCache.Num());
-		
-		// Try direct lookup first with the provided BuildingId
-		const TSharedPtr<FJsonObject>* BuildingObjPtr = BuildingJsonCache.Find(BuildingId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🎨 LOOKUP: Looking for building '%s' in building store (%d buildings)"), *BuildingId, BuildingStore.Num());
 		
-		// If not found, try to find any matching entry (case-insensitive or variant lookup)
-		if (!BuildingObjPtr || !BuildingObjPtr->IsValid())
+		int32 BuildingIndex = BuildingStore.FindIndex(BuildingId);
+		if (BuildingIndex == INDEX_NONE)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("⚠️ LOOKUP: Direct lookup failed for '%s', searching cache..."), *BuildingId);
-			
-			// Search through cache to find matching entry
-			for (const auto& CacheEntry : BuildingJsonCache)
-			{
-				if (CacheEntry.Key.Equals(BuildingId, ESearchCase::IgnoreCase) || CacheEntry.Key == BuildingId)
-				{
-					BuildingObjPtr = &CacheEntry.Value;
-					UE_LOG(LogTemp, Warning, TEXT("✅ LOOKUP: Found matching cache entry: %s"), *CacheEntry.Key);
-					break;
-				}
-			}
+			BuildingIndex = BuildingStore.FindVariantIndex(BuildingId);
 		}
-		
-		// If we found a JSON object, extract the color
-		if (BuildingObjPtr && BuildingObjPtr->IsValid())
+		if (BuildingIndex != INDEX_NONE && BuildingStore.HasColor(BuildingIndex))
 		{
-			const TSharedPtr<FJsonObject>& BuildingObj = *BuildingObjPtr;
-			UE_LOG(LogTemp, Warning, TEXT("🎨 JSON DEBUG: Found building object for %s"), *BuildingId);
-			
-			// Navigate: energy_result → end → color → energy_demand_specific_color
-			const TSharedPtr<FJsonObject>* EnergyResultObjPtr = nullptr;
-			if (BuildingObj->TryGetObjectField(TEXT("energy_result"), EnergyResultObjPtr) && EnergyResultObjPtr && EnergyResultObjPtr->IsValid())
-			{
-				const TSharedPtr<FJsonObject>& EnergyResultObj = *EnergyResultObjPtr;
-				UE_LOG(LogTemp, Warning, TEXT("🎨 JSON DEBUG: Found energy_result object"));
-				
-				const TSharedPtr<FJsonObject>* EndObjPtr = nullptr;
-				if (EnergyResultObj->TryGetObjectField(TEXT("end"), EndObjPtr) && EndObjPtr && EndObjPtr->IsValid())
-				{
-					const TSharedPtr<FJsonObject>& EndObj = *EndObjPtr;
-					UE_LOG(LogTemp, Warning, TEXT("🎨 JSON DEBUG: Found end object"));
-					
-					const TSharedPtr<FJsonObject>* ColorObjPtr = nullptr;
-					if (EndObj->TryGetObjectField(TEXT("color"), ColorObjPtr) && ColorObjPtr && ColorObjPtr->IsValid())
-					{
-						const TSharedPtr<FJsonObject>& ColorObj = *ColorObjPtr;
-						UE_LOG(LogTemp, Warning, TEXT("🎨 JSON DEBUG: Found color object"));
-						
-						if (ColorObj->TryGetStringField(TEXT("energy_demand_specific_color"), EndEnergyDemandSpecificColor))
-						{
-							UE_LOG(LogTemp, Warning, TEXT("✅ COLOR JSON: Extracted color from JSON for %s: %s"), *BuildingId, *EndEnergyDemandSpecificColor);
-							
-							// Also update BuildingColorCache with this color for consistency
-							FLinearColor ColorFromJson = ConvertHexToLinearColor(EndEnergyDemandSpecificColor);
-							BuildingColorCache.Add(BuildingId, ColorFromJson);
-							UE_LOG(LogTemp, Warning, TEXT("✅ CACHE UPDATE: Stored color %s in BuildingColorCache for %s"), *EndEnergyDemandSpecificColor, *BuildingId);
-						}
-						else
-						{
-							UE_LOG(LogTemp, Warning, TEXT("⚠️ JSON: No energy_demand_specific_color field in color object for %s"), *BuildingId);
-						}
-					}
-					else
-					{
-						UE_LOG(LogTemp, Warning, TEXT("⚠️ JSON: No color object in end object for %s"), *BuildingId);
-					}
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("⚠️ JSON: No end object in energy_result for %s"), *BuildingId);
-				}
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("⚠️ JSON: No energy_result object found for %s"), *BuildingId);
-			}
+			EndEnergyDemandSpecificColor = BuildingStore.GetColorHex(BuildingIndex);
+			UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ COLOR: Found color for %s: %s"), *BuildingId, *EndEnergyDemandSpecificColor);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("⚠️ JSON: Building %s (modified_gml_id) not found in BuildingJsonCache"), *BuildingId);
-			UE_LOG(LogTemp, Warning, TEXT("📊 CACHE DEBUG: Cache contains %d entries:"), BuildingJsonCache.Num());
-			int32 DebugCount = 0;
-			for (const auto& Entry : BuildingJsonCache)
-			{
-				if (DebugCount < 5)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("  - %s"), *Entry.Key);
-					DebugCount++;
-				}
-			}
-			if (BuildingJsonCache.Num() > 5)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("  ... and %d more"), BuildingJsonCache.Num() - 5);
-			}
+			UE_LOG(LogBuildingEnergyUI, Warning, TEXT("⚠️ COLOR: Building %s not found or has no color in building store"), *BuildingId);
 		}
 		
 		// Create display message with building information and hex color
@@ -5987,16 +6167,16 @@ void ABuildingEnergyDisplay::ShowBuildingInfoWidget(const FString& BuildingId, c
 		// Now show ONLY our message
 		GEngine->AddOnScreenDebugMessage(1000, 60.0f, FColor::Cyan, DisplayMessage);
 		
-		UE_LOG(LogTemp, Warning, TEXT("✅ NUCLEAR SINGLE BUILDING: Displayed info for %s using key 1000"), *BuildingId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ NUCLEAR SINGLE BUILDING: Displayed info for %s using key 1000"), *BuildingId);
 		
-		UE_LOG(LogTemp, Warning, TEXT("✅ Building Info displayed for: %s (using screen overlay)"), *BuildingId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ Building Info displayed for: %s (using screen overlay)"), *BuildingId);
 		
 		// 🎨 APPLY COLOR TO THE BUILDING IN THE CESIUM TILESET
 		ApplyColorToClickedBuilding(BuildingId);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Cannot show Building Info - GEngine is null"));
+		UE_LOG(LogBuildingEnergyUI, Error, TEXT("❌ Cannot show Building Info - GEngine is null"));
 	}
 }
 
@@ -6004,7 +6184,7 @@ void ABuildingEnergyDisplay::HideBuildingInfoWidget()
 {
 	if (!CurrentlyDisplayedBuildingId.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 Hiding Building Info for: %s"), *CurrentlyDisplayedBuildingId);
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("🎨 Hiding Building Info for: %s"), *CurrentlyDisplayedBuildingId);
 		
 		// Clear specifically the building info message using the key
 		if (GEngine)
@@ -6013,53 +6193,38 @@ void ABuildingEnergyDisplay::HideBuildingInfoWidget()
 		}
 		
 		CurrentlyDisplayedBuildingId = TEXT(""); // Clear the currently displayed building ID
-		UE_LOG(LogTemp, Warning, TEXT("✅ Building Info hidden (screen messages cleared)"));
+		UE_LOG(LogBuildingEnergyUI, Log, TEXT("✅ Building Info hidden (screen messages cleared)"));
 	}
 }
 
 void ABuildingEnergyDisplay::ApplyColorToClickedBuilding(const FString& BuildingGmlId)
 {
 	// 🎨 APPLY COLOR TO CLICKED BUILDING: Take the extracted color and apply it to the Cesium tileset
-	UE_LOG(LogTemp, Warning, TEXT("🎨 === APPLYING COLOR TO CLICKED BUILDING ==="));
-	UE_LOG(LogTemp, Warning, TEXT("🎨 Building ID: %s"), *BuildingGmlId);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 === APPLYING COLOR TO CLICKED BUILDING ==="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 Building ID: %s"), *BuildingGmlId);
 	
 	// Check if the building has a color in the cache
-	const FLinearColor* BuildingColorPtr = BuildingColorCache.Find(BuildingGmlId);
-	if (!BuildingColorPtr)
+	const int32 BuildingIndex = BuildingStore.FindIndex(BuildingGmlId);
+	if (BuildingIndex == INDEX_NONE || !BuildingStore.HasColor(BuildingIndex))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("⚠️ No color found in BuildingColorCache for %s"), *BuildingGmlId);
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("⚠️ No color found in building store for %s"), *BuildingGmlId);
 		return;
 	}
 	
-	FLinearColor BuildingColor = *BuildingColorPtr;
-	UE_LOG(LogTemp, Warning, TEXT("🎨 COLOR FOUND: R=%.2f, G=%.2f, B=%.2f"), BuildingColor.R, BuildingColor.G, BuildingColor.B);
+	FLinearColor BuildingColor = BuildingStore.GetColor(BuildingIndex);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 COLOR FOUND: R=%.2f, G=%.2f, B=%.2f"), BuildingColor.R, BuildingColor.G, BuildingColor.B);
 	
 	// Convert to hex color for logging
 	FColor SRGBColor = BuildingColor.ToFColor(true);
 	FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
-	UE_LOG(LogTemp, Warning, TEXT("🎨 HEX COLOR: %s"), *HexColor);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 HEX COLOR: %s"), *HexColor);
 	
 	// Find the Cesium 3D Tileset actor (bisingen)
-	ACesium3DTileset* Tileset = nullptr;
-	if (UWorld* World = GetWorld())
-	{
-		for (TActorIterator<ACesium3DTileset> It(World); It; ++It)
-		{
-			ACesium3DTileset* Candidate = *It;
-			if (!Candidate) continue;
-			
-			if (Candidate->GetName().ToLower().Contains(TEXT("bisingen")))
-			{
-				Tileset = Candidate;
-				UE_LOG(LogTemp, Warning, TEXT("✅ Found Cesium3DTileset: %s"), *Candidate->GetName());
-				break;
-			}
-		}
-	}
+	ACesium3DTileset* Tileset = GetBuildingsTileset();
 	
 	if (!Tileset)
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Could not find Cesium3DTileset named 'bisingen'"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("❌ Could not find Cesium3DTileset named '%s'"), *BuildingsTilesetName);
 		return;
 	}
 	
@@ -6067,39 +6232,38 @@ void ABuildingEnergyDisplay::ApplyColorToClickedBuilding(const FString& Building
 	CurrentlyClickedBuildingId = BuildingGmlId;
 	CurrentlyClickedBuildingColor = BuildingColor;
 	
-	UE_LOG(LogTemp, Warning, TEXT("✅ Stored clicked building: %s with color %s for material-based styling"), *BuildingGmlId, *HexColor);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("✅ Stored clicked building: %s with color %s for material-based styling"), *BuildingGmlId, *HexColor);
 	
 	// Apply color lookup material to the bisingen tileset
-	// This material uses BuildingColorCache to look up and render colors per building
+	// This material uses the building store colors to render each building
 	ApplyColorLookupMaterialToTileset(Tileset);
 	
-	UE_LOG(LogTemp, Warning, TEXT("✅ COLOR APPLICATION COMPLETE: Building %s should now display in color %s"), *BuildingGmlId, *HexColor);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("✅ COLOR APPLICATION COMPLETE: Building %s should now display in color %s"), *BuildingGmlId, *HexColor);
 }
 
 void ABuildingEnergyDisplay::FetchRealTimeEnergyData()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🚀 === REAL-TIME ENERGY DATA FETCH INITIATED ==="));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🚀 === REAL-TIME ENERGY DATA FETCH INITIATED ==="));
 	
 	// Check if authentication token is available
 	if (AccessToken.IsEmpty())
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚀 REAL-TIME: No access token available"));
+		UE_LOG(LogBuildingEnergyUpdates, Error, TEXT("🚀 REAL-TIME: No access token available"));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Orange, TEXT("🔐 Need authentication for real-time data"));
 		}
 		
 		// Show message to user that authentication is needed
-		UE_LOG(LogTemp, Warning, TEXT("🚀 REAL-TIME: Please authenticate first using PreloadAllBuildingData"));
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("🚀 REAL-TIME: Please authenticate first using PreloadAllBuildingData"));
 		return;
 	}
 	
 	// Fast direct API call for fresh energy data
-	UE_LOG(LogTemp, Warning, TEXT("🚀 REAL-TIME: Starting fast energy data fetch"));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🚀 REAL-TIME: Starting fast energy data fetch"));
 	
 	// Create high-priority HTTP request for real-time data
 	TSharedRef<IHttpRequest> Request = FHttpModule::Get().CreateRequest();
-	Request->OnProcessRequestComplete().BindUObject(this, &ABuildingEnergyDisplay::OnRealTimeEnergyDataResponse);
 	Request->SetURL("https://app-hft-buildingenergyapi-staging.azurewebsites.net/api/building-energy/community/13");
 	Request->SetVerb("GET");
 	Request->SetHeader("Content-Type", "application/json");
@@ -6108,33 +6272,26 @@ void ABuildingEnergyDisplay::FetchRealTimeEnergyData()
 	// Add priority headers for faster processing
 	Request->SetTimeout(5.0f); // 5 second timeout for fast response
 	
-	UE_LOG(LogTemp, Warning, TEXT("🚀 REAL-TIME: Sending priority energy data request"));
-	UE_LOG(LogTemp, Warning, TEXT("🚀 URL: https://app-hft-buildingenergyapi-staging.azurewebsites.net/api/building-energy/community/13"));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🚀 REAL-TIME: Sending priority energy data request"));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🚀 URL: https://app-hft-buildingenergyapi-staging.azurewebsites.net/api/building-energy/community/13"));
 	
-	if (!Request->ProcessRequest())
-	{
-		UE_LOG(LogTemp, Error, TEXT("🚀 REAL-TIME: Failed to start priority energy data request"));
-		if (GEngine)
-		{
-			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, TEXT("❌ Real-time data fetch failed"));
-		}
-	}
-	else
+	// User priority: dispatched ahead of any queued background poll
+	UBuildingEnergyApiSubsystem::Send(this, Request, 
+		FHttpRequestCompleteDelegate::CreateUObject(this, &ABuildingEnergyDisplay::OnRealTimeEnergyDataResponse), EBuildingApiPriority::UserInitiated);
+	
+	if (GEngine)
 	{
-		if (GEngine)
-		{
-			GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Yellow, TEXT("⚡ Fetching real-time energy data..."));
-		}
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Yellow, TEXT("⚡ Fetching real-time energy data..."));
 	}
 }
 
 void ABuildingEnergyDisplay::OnRealTimeEnergyDataResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
-	UE_LOG(LogTemp, Warning, TEXT("🚀 === REAL-TIME ENERGY DATA RESPONSE ==="));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🚀 === REAL-TIME ENERGY DATA RESPONSE ==="));
 	
 	if (!bWasSuccessful || !Response.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚀 REAL-TIME: Energy data request failed"));
+		UE_LOG(LogBuildingEnergyUpdates, Error, TEXT("🚀 REAL-TIME: Energy data request failed"));
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, TEXT("❌ Real-time data fetch failed"));
@@ -6145,29 +6302,22 @@ void ABuildingEnergyDisplay::OnRealTimeEnergyDataResponse(FHttpRequestPtr Reques
 	int32 ResponseCode = Response->GetResponseCode();
 	FString ResponseContent = Response->GetContentAsString();
 	
-	UE_LOG(LogTemp, Warning, TEXT("🚀 REAL-TIME: Response Code: %d"), ResponseCode);
-	UE_LOG(LogTemp, Warning, TEXT("🚀 REAL-TIME: Data size: %d characters"), ResponseContent.Len());
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🚀 REAL-TIME: Response Code: %d"), ResponseCode);
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🚀 REAL-TIME: Data size: %d characters"), ResponseContent.Len());
 	
 	if (ResponseCode == 200)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("✅ REAL-TIME: Fresh energy data received successfully"));
-		
-		// Clear old cache and immediately populate with fresh data
-		BuildingDataCache.Empty();
-		GmlIdCache.Empty();
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("✅ REAL-TIME: Fresh energy data received successfully"));
 		
-		UE_LOG(LogTemp, Warning, TEXT("🔄 REAL-TIME: Processing fresh API data"));
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 REAL-TIME: Processing fresh API data"));
 		
-		// Process the fresh data immediately
-		ParseAndCacheAllBuildings(ResponseContent);
-		
-		// Mark data as loaded
-		bDataLoaded = true;
-		bIsLoading = false;
+		// Parse in the background; the old store stays visible until the fresh one is swapped in
+		// and PublishBuildingStore refreshes the displayed building
+		ParseAndCacheAllBuildings(MoveTemp(ResponseContent));
 		
 		// 🎨 AUTO COLOR APPLICATION: Apply colors immediately after real-time data update
 		// TEMPORARILY DISABLED - Causing gray overlay on entire scene
-		// UE_LOG(LogTemp, Warning, TEXT("🎨 REAL-TIME COLOR UPDATE: Applying fresh colors to buildings..."));
+		// UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("🎨 REAL-TIME COLOR UPDATE: Applying fresh colors to buildings..."));
 		
 		// Schedule color application after a short delay
 		// DISABLED - This was causing the entire scene to turn gray
@@ -6175,7 +6325,7 @@ void ABuildingEnergyDisplay::OnRealTimeEnergyDataResponse(FHttpRequestPtr Reques
 		FTimerHandle RealTimeColorTimer;
 		GetWorld()->GetTimerManager().SetTimer(RealTimeColorTimer, [this]()
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🎨 EXECUTING: Real-time color application"));
+			UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🎨 EXECUTING: Real-time color application"));
 			ApplyColorsDirectlyToGeometry();
 			ApplyColorsToCSiumTileset();
 			ForceApplyColors();
@@ -6188,26 +6338,10 @@ void ABuildingEnergyDisplay::OnRealTimeEnergyDataResponse(FHttpRequestPtr Reques
 				TEXT("✅ Real-time energy data updated!"));
 		}
 		
-		UE_LOG(LogTemp, Warning, TEXT("🚀 REAL-TIME: Fresh data cache populated with %d buildings"), BuildingDataCache.Num());
-		
-		// If there's a currently displayed building, refresh its data immediately
-		if (!CurrentlyDisplayedBuildingId.IsEmpty())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 REAL-TIME: Refreshing displayed building: %s"), *CurrentlyDisplayedBuildingId);
-			
-			// Get fresh data for the currently displayed building
-			FString* FreshEnergyData = BuildingDataCache.Find(CurrentlyDisplayedBuildingId);
-			if (FreshEnergyData && !FreshEnergyData->IsEmpty())
-			{
-				// Update the display with fresh data
-				ShowBuildingInfoWidget(CurrentlyDisplayedBuildingId, **FreshEnergyData);
-				UE_LOG(LogTemp, Warning, TEXT("✅ REAL-TIME: Display updated with fresh data"));
-			}
-		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ REAL-TIME: Failed to get fresh energy data (Code: %d)"), ResponseCode);
+		UE_LOG(LogBuildingEnergyUpdates, Error, TEXT("❌ REAL-TIME: Failed to get fresh energy data (Code: %d)"), ResponseCode);
 		if (GEngine)
 		{
 			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, 
@@ -6218,7 +6352,7 @@ void ABuildingEnergyDisplay::OnRealTimeEnergyDataResponse(FHttpRequestPtr Reques
 
 void ABuildingEnergyDisplay::ForceRealTimeRefresh()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔄 === MANUAL REAL-TIME REFRESH TRIGGERED ==="));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 === MANUAL REAL-TIME REFRESH TRIGGERED ==="));
 	
 	if (GEngine)
 	{
@@ -6226,8 +6360,7 @@ void ABuildingEnergyDisplay::ForceRealTimeRefresh()
 	}
 	
 	// Clear cache completely to force fresh fetch
-	BuildingDataCache.Empty();
-	GmlIdCache.Empty();
+	BuildingStore.Reset();
 	bDataLoaded = false;
 	bIsLoading = false;
 	
@@ -6237,17 +6370,17 @@ void ABuildingEnergyDisplay::ForceRealTimeRefresh()
 
 void ABuildingEnergyDisplay::ConnectEnergyWebSocket()
 {
-	UE_LOG(LogTemp, Warning, TEXT("� === STARTING REST API ENERGY POLLING ==="));
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("� === STARTING REST API ENERGY POLLING ==="));
 	
 	// Skip WebSocket - we're using REST API polling instead
 	if (EnergyWebSocketURL.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔄 Setting up REST API polling for real-time energy updates"));
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔄 Setting up REST API polling for real-time energy updates"));
 		
 		// Validate we have authentication token
 		if (AccessToken.IsEmpty())
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Polling setup delayed - waiting for authentication token"));
+			UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔄 Polling setup delayed - waiting for authentication token"));
 			
 			// Show authentication waiting message only once to prevent spam
 			if (!bAuthenticationMessageShown && GEngine)
@@ -6268,7 +6401,7 @@ void ABuildingEnergyDisplay::ConnectEnergyWebSocket()
 				FString::Printf(TEXT("🔄 REST API polling active (every %.1fs)"), WebSocketReconnectInterval));
 		}
 		
-		UE_LOG(LogTemp, Warning, TEXT("✅ REST API energy polling started - interval: %.1fs"), WebSocketReconnectInterval);
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("✅ REST API energy polling started - interval: %.1fs"), WebSocketReconnectInterval);
 		
 		// Perform initial energy data fetch
 		FetchUpdatedEnergyData();
@@ -6277,21 +6410,17 @@ void ABuildingEnergyDisplay::ConnectEnergyWebSocket()
 	
 	if (bEnergyWebSocketConnected && EnergyWebSocket.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔌 Energy WebSocket already connected"));
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 Energy WebSocket already connected"));
 		return;
 	}
 	
 	// Disconnect existing WebSocket if any
-	if (EnergyWebSocket.IsValid())
-	{
-		EnergyWebSocket->Close();
-		EnergyWebSocket = nullptr;
-	}
+	ReleaseEnergyWebSocket();
 	
 	// Validate Access Token before creating WebSocket
 	if (AccessToken.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔌 WebSocket connection delayed - waiting for authentication token"));
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 WebSocket connection delayed - waiting for authentication token"));
 		
 		// Show authentication waiting message only once to prevent spam
 		if (!bAuthenticationMessageShown && GEngine)
@@ -6312,7 +6441,7 @@ void ABuildingEnergyDisplay::ConnectEnergyWebSocket()
 		Headers.Add("Authorization", "Bearer " + AccessToken);
 		Headers.Add("Content-Type", "application/json");
 		
-		UE_LOG(LogTemp, Warning, TEXT("🔌 Creating energy WebSocket with URL: %s"), *EnergyWebSocketURL);
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 Creating energy WebSocket with URL: %s"), *EnergyWebSocketURL);
 		
 		EnergyWebSocket = WebSocketsModule.CreateWebSocket(EnergyWebSocketURL, TEXT(""), Headers);
 		
@@ -6323,11 +6452,13 @@ void ABuildingEnergyDisplay::ConnectEnergyWebSocket()
 			EnergyWebSocket->OnConnectionError().AddUObject(this, &ABuildingEnergyDisplay::OnEnergyWebSocketConnectionError);
 			EnergyWebSocket->OnClosed().AddUObject(this, &ABuildingEnergyDisplay::OnEnergyWebSocketClosed);
 			EnergyWebSocket->OnMessage().AddUObject(this, &ABuildingEnergyDisplay::OnEnergyWebSocketMessage);
+			EnergyWebSocket->OnBinaryMessage().AddUObject(this, &ABuildingEnergyDisplay::OnEnergyWebSocketBinaryMessage);
 			
 			// Connect to WebSocket server
+			bEnergyWebSocketConnecting = true;
 			EnergyWebSocket->Connect();
 			
-			UE_LOG(LogTemp, Warning, TEXT("🔌 Connecting to energy WebSocket: %s"), *EnergyWebSocketURL);
+			UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 Connecting to energy WebSocket: %s"), *EnergyWebSocketURL);
 			
 			if (GEngine)
 			{
@@ -6336,7 +6467,8 @@ void ABuildingEnergyDisplay::ConnectEnergyWebSocket()
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("🔌 Failed to create energy WebSocket - CreateWebSocket returned null"));
+			UE_LOG(LogBuildingEnergyNet, Error, TEXT("🔌 Failed to create energy WebSocket - CreateWebSocket returned null"));
+			SchedulePushReconnect();
 			if (GEngine)
 			{
 				GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, TEXT("❌ Energy WebSocket error: Could not initialize connection"));
@@ -6345,96 +6477,297 @@ void ABuildingEnergyDisplay::ConnectEnergyWebSocket()
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("🔌 WebSockets module not loaded"));
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("🔌 WebSockets module not loaded"));
 	}
 }
 
 void ABuildingEnergyDisplay::DisconnectEnergyWebSocket()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔌 === DISCONNECTING ENERGY WEBSOCKET ==="));
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 === DISCONNECTING ENERGY WEBSOCKET ==="));
 	
 	bEnergyWebSocketConnected = false;
+	bEnergyWebSocketConnecting = false;
+	ReleaseEnergyWebSocket();
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Yellow, TEXT("🔌 Energy WebSocket disconnected"));
+	}
+	
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 Energy WebSocket disconnected"));
+}
+
+void ABuildingEnergyDisplay::OnEnergyWebSocketConnected()
+{
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("✅ ENERGY WEBSOCKET CONNECTED"));
+	
+	bEnergyWebSocketConnected = true;
+	bEnergyWebSocketConnecting = false;
+	WebSocketReconnectTimer = 0.0f;
+	PushReconnectBackoff = 0.0f;
+	PushReconnectDelay = 0.0f;
+	PushFrameBuffer.Reset();
+	PushPalette.Reset(); // The server sends its palette after the subscription
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Green, TEXT("✅ Real-time energy WebSocket connected!"));
+	}
+	
+	// Patches only cover changes from now on; catch up on whatever changed while disconnected
+	RequestPushResync(TEXT("connected"));
 	
+	SendPushSubscription();
+}
+
+void ABuildingEnergyDisplay::SendPushSubscription()
+{
+	// Send subscription message for building energy updates as binary patch frames.
+	// The id order hash tells the server which building each index means; it answers with frames carrying its own.
+	FString SubscriptionMessage = FString::Printf(TEXT("{\"action\":\"subscribe\",\"type\":\"energy-updates\",\"community\":\"%s\",\"format\":\"binary-patches\",\"buildings\":%d,\"id_order_hash\":\"%016llx\"}"),
+		*FString::Join(CommunityIds, TEXT(",")), BuildingStore.Num(), BuildingStore.GetIdOrderHash());
 	if (EnergyWebSocket.IsValid())
 	{
-		EnergyWebSocket->Close();
-		EnergyWebSocket = nullptr;
+		EnergyWebSocket->Send(SubscriptionMessage);
+		PushSubscribedIdOrderHash = BuildingStore.GetIdOrderHash();
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 Sent subscription: %s"), *SubscriptionMessage);
 	}
+}
+
+void ABuildingEnergyDisplay::OnEnergyWebSocketConnectionError(const FString& Error)
+{
+	UE_LOG(LogBuildingEnergyNet, Error, TEXT("❌ ENERGY WEBSOCKET CONNECTION ERROR: %s"), *Error);
+	
+	bEnergyWebSocketConnected = false;
+	bEnergyWebSocketConnecting = false;
+	SchedulePushReconnect();
 	
 	if (GEngine)
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Yellow, TEXT("🔌 Energy WebSocket disconnected"));
+		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, 
+			FString::Printf(TEXT("❌ Energy WebSocket error: %s"), *Error));
+	}
+}
+
+void ABuildingEnergyDisplay::OnEnergyWebSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean)
+{
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 ENERGY WEBSOCKET CLOSED: Code=%d, Reason=%s, Clean=%s"), 
+		StatusCode, *Reason, bWasClean ? TEXT("true") : TEXT("false"));
+	
+	bEnergyWebSocketConnected = false;
+	bEnergyWebSocketConnecting = false;
+	SchedulePushReconnect();
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Yellow, TEXT("🔌 Energy WebSocket closed"));
+	}
+}
+
+void ABuildingEnergyDisplay::OnEnergyWebSocketMessage(const FString& Message)
+{
+	EnergyUpdateCounter++;
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("📨 ENERGY WEBSOCKET MESSAGE #%d RECEIVED"), EnergyUpdateCounter);
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("📨 Message: %s"), *Message.Left(200));
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Green, 
+			FString::Printf(TEXT("📨 Real-time energy update #%d"), EnergyUpdateCounter));
+	}
+	
+	// Process the energy update
+	ProcessEnergyWebSocketUpdate(Message);
+}
+
+void ABuildingEnergyDisplay::OnEnergyWebSocketBinaryMessage(const void* Data, SIZE_T Size, bool bIsLastFragment)
+{
+	PushFrameBuffer.Append(static_cast<const uint8*>(Data), Size);
+	if (!bIsLastFragment)
+	{
+		return;
+	}
+	
+	FBuildingPatchFrame Frame;
+	FString DecodeError;
+	const bool bDecoded = FBuildingPatchCodec::Decode(PushFrameBuffer, Frame, &DecodeError);
+	PushFrameBuffer.Reset();
+	if (!bDecoded)
+	{
+		UE_LOG(LogBuildingEnergyNet, Warning, TEXT("❌ PUSH: Dropping binary frame (%s)"), *DecodeError);
+		RequestPushResync(TEXT("undecodable frame"));
+		return;
+	}
+	
+	EnergyUpdateCounter++;
+	ApplyPushFrame(Frame);
+}
+
+void ABuildingEnergyDisplay::ApplyPushFrame(const FBuildingPatchFrame& Frame)
+{
+	BUILDING_ENERGY_SCOPE(ChangeDetection);
+	// Every frame of a connection is numbered; a hole means patches were lost
+	if (bPushSequenceKnown && Frame.Sequence != LastPushSequence + 1)
+	{
+		RequestPushResync(*FString::Printf(TEXT("sequence gap %llu -> %llu"), LastPushSequence, Frame.Sequence));
+	}
+	bPushSequenceKnown = true;
+	LastPushSequence = Frame.Sequence;
+	
+	if (Frame.Kind == FBuildingPatchFrame::EKind::Palette)
+	{
+		for (const TPair<uint16, FColor>& Entry : Frame.PaletteEntries)
+		{
+			PushPalette.Add(Entry.Key, Entry.Value);
+		}
+		UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("📨 PUSH: Palette #%llu with %d colors"), Frame.Sequence, Frame.PaletteEntries.Num());
+		return;
+	}
+	
+	// Indices address the server's building order; a store of the same size can still order its buildings differently
+	if (Frame.NumBuildings != BuildingStore.Num() || Frame.IdOrderHash != BuildingStore.GetIdOrderHash())
+	{
+		RequestPushResync(*FString::Printf(TEXT("server has %d buildings in order %016llx, store has %d in order %016llx"),
+			Frame.NumBuildings, Frame.IdOrderHash, BuildingStore.Num(), BuildingStore.GetIdOrderHash()));
+		
+		// The store changed since the subscription; tell the server about the current order once
+		if (PushSubscribedIdOrderHash != BuildingStore.GetIdOrderHash())
+		{
+			SendPushSubscription();
+		}
+		return;
+	}
+	
+	// The store may have been republished since the palette arrived, so map server classes per frame
+	TMap<uint16, int32> ColorClassMap;
+	for (const TPair<uint16, FColor>& Entry : PushPalette)
+	{
+		ColorClassMap.Add(Entry.Key, BuildingStore.FindOrAddColorClass(FLinearColor::FromSRGBColor(Entry.Value)));
+	}
+	
+	TArray<FString> ChangedBuildings;
+	ChangedBuildings.Reserve(Frame.Patches.Num());
+	bool bAllResolved = true;
+	for (FBuildingPatch Patch : Frame.Patches)
+	{
+		if (!FBuildingPatchCodec::Localize(Patch, ColorClassMap, BuildingStore))
+		{
+			bAllResolved = false;
+			continue;
+		}
+		BuildingStore.Fingerprints[Patch.BuildingIndex] = 0; // The next poll record for this building is applied again
+		QueueBuildingPatch(Patch);
+		ChangedBuildings.Add(BuildingStore.ModifiedGmlIds[Patch.BuildingIndex]);
+	}
+	if (!bAllResolved)
+	{
+		RequestPushResync(TEXT("patch for an unknown building or color class"));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔌 Energy WebSocket disconnected"));
+	UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("📨 PUSH: Frame #%llu queued %d of %d patches"), Frame.Sequence, ChangedBuildings.Num(), Frame.Patches.Num());
+	if (ChangedBuildings.Num() > 0)
+	{
+		NotifyRealTimeChanges(ChangedBuildings);
+	}
+}
+
+void ABuildingEnergyDisplay::QueueBuildingPatch(const FBuildingPatch& Patch)
+{
+	// Several updates of one building before the queue drains collapse into one patch
+	FBuildingPatchCodec::Merge(PendingBuildingPatches.FindOrAdd(Patch.BuildingIndex), Patch);
 }
 
-void ABuildingEnergyDisplay::OnEnergyWebSocketConnected()
+void ABuildingEnergyDisplay::ProcessPendingBuildingUpdates()
 {
-	UE_LOG(LogTemp, Warning, TEXT("✅ ENERGY WEBSOCKET CONNECTED"));
-	
-	bEnergyWebSocketConnected = true;
-	WebSocketReconnectTimer = 0.0f;
+	BUILDING_ENERGY_SCOPE(ApplyUpdates);
+	SET_DWORD_STAT(STAT_BuildingEnergy_NumQueuedUpdates, PendingBuildingPatches.Num());
+	if (PendingBuildingPatches.Num() == 0 && PendingAppliedIndices.Num() == 0)
+	{
+		return;
+	}
 	
-	if (GEngine)
+	const double Deadline = FPlatformTime::Seconds() + UpdateFrameBudgetMs / 1000.0;
+	int32 NumApplied = 0;
+	for (auto It = PendingBuildingPatches.CreateIterator(); It; ++It)
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Green, TEXT("✅ Real-time energy WebSocket connected!"));
+		if (FBuildingPatchCodec::Apply(It.Value(), BuildingStore))
+		{
+			PendingAppliedIndices.Add(It.Key());
+		}
+		It.RemoveCurrent();
+		
+		// Reading the clock per patch would cost more than applying it
+		if ((++NumApplied % 32) == 0 && FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
 	}
 	
-	// Send subscription message for building energy updates
-	FString SubscriptionMessage = FString::Printf(TEXT("{\"action\":\"subscribe\",\"type\":\"energy-updates\",\"community\":\"13\"}"));
-	if (EnergyWebSocket.IsValid())
+	// Restyle once everything queued is applied, in a frame that still has budget left
+	if (PendingBuildingPatches.Num() > 0 || PendingAppliedIndices.Num() == 0 || FPlatformTime::Seconds() >= Deadline)
 	{
-		EnergyWebSocket->Send(SubscriptionMessage);
-		UE_LOG(LogTemp, Warning, TEXT("🔌 Sent subscription: %s"), *SubscriptionMessage);
+		UE_LOG(LogBuildingEnergyUpdates, Verbose, TEXT("🔄 QUEUE: Applied %d patches, %d still queued"), NumApplied, PendingBuildingPatches.Num());
+		return;
 	}
-}
-
-void ABuildingEnergyDisplay::OnEnergyWebSocketConnectionError(const FString& Error)
-{
-	UE_LOG(LogTemp, Error, TEXT("❌ ENERGY WEBSOCKET CONNECTION ERROR: %s"), *Error);
 	
-	bEnergyWebSocketConnected = false;
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 QUEUE: Restyling after %d building updates"), PendingAppliedIndices.Num());
+	ApplyColorsUsingCesiumStyling();
 	
-	if (GEngine)
+	// If the displayed building changed, refresh its text from the new values
+	const int32 DisplayedIndex = BuildingStore.FindIndex(CurrentlyDisplayedBuildingId);
+	if (DisplayedIndex != INDEX_NONE && PendingAppliedIndices.Contains(DisplayedIndex))
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, 
-			FString::Printf(TEXT("❌ Energy WebSocket error: %s"), *Error));
+		ShowBuildingInfoWidget(CurrentlyDisplayedBuildingId, BuildingStore.GetDisplayText(DisplayedIndex));
 	}
+	PendingAppliedIndices.Reset();
 }
 
-void ABuildingEnergyDisplay::OnEnergyWebSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean)
+void ABuildingEnergyDisplay::ReleaseEnergyWebSocket()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔌 ENERGY WEBSOCKET CLOSED: Code=%d, Reason=%s, Clean=%s"), 
-		StatusCode, *Reason, bWasClean ? TEXT("true") : TEXT("false"));
-	
-	bEnergyWebSocketConnected = false;
-	
-	if (GEngine)
+	if (!EnergyWebSocket.IsValid())
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Yellow, TEXT("🔌 Energy WebSocket closed"));
+		return;
 	}
+	
+	// Unbind first: the close of a replaced socket must not schedule a reconnect or touch the new one
+	EnergyWebSocket->OnConnected().RemoveAll(this);
+	EnergyWebSocket->OnConnectionError().RemoveAll(this);
+	EnergyWebSocket->OnClosed().RemoveAll(this);
+	EnergyWebSocket->OnMessage().RemoveAll(this);
+	EnergyWebSocket->OnBinaryMessage().RemoveAll(this);
+	EnergyWebSocket->Close();
+	EnergyWebSocket.Reset();
 }
 
-void ABuildingEnergyDisplay::OnEnergyWebSocketMessage(const FString& Message)
+void ABuildingEnergyDisplay::SchedulePushReconnect()
 {
-	EnergyUpdateCounter++;
-	UE_LOG(LogTemp, Warning, TEXT("📨 ENERGY WEBSOCKET MESSAGE #%d RECEIVED"), EnergyUpdateCounter);
-	UE_LOG(LogTemp, Warning, TEXT("📨 Message: %s"), *Message.Left(200));
-	
-	if (GEngine)
+	if (EnergyWebSocketURL.IsEmpty())
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Green, 
-			FString::Printf(TEXT("📨 Real-time energy update #%d"), EnergyUpdateCounter));
+		return; // Polling mode keeps its fixed interval
 	}
 	
-	// Process the energy update
-	ProcessEnergyWebSocketUpdate(Message);
+	// Exponential backoff with jitter so a backend restart is not hit by every client at once
+	PushReconnectBackoff = PushReconnectBackoff > 0.0f
+		? FMath::Min(PushReconnectBackoff * 2.0f, PushReconnectMaxInterval)
+		: WebSocketReconnectInterval;
+	PushReconnectDelay = PushReconnectBackoff * FMath::FRandRange(0.8f, 1.2f);
+	WebSocketReconnectTimer = 0.0f;
+	bPushSequenceKnown = false;
+	
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🔌 PUSH: Reconnecting in %.1fs"), PushReconnectDelay);
+}
+
+void ABuildingEnergyDisplay::RequestPushResync(const TCHAR* Reason)
+{
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 PUSH: Resync requested (%s)"), Reason);
+	bPushSequenceKnown = false;
+	bPushResyncPending = true;
+	RealTimeMonitoringTimer = RealTimeUpdateInterval; // Poll on the next Tick; delta sync keeps it small
 }
 
 void ABuildingEnergyDisplay::ProcessEnergyWebSocketUpdate(const FString& JsonData)
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔄 PROCESSING WEBSOCKET ENERGY UPDATE"));
+	UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 PROCESSING WEBSOCKET ENERGY UPDATE"));
 	
 	// Parse the WebSocket message as JSON
 	TSharedPtr<FJsonObject> JsonObject;
@@ -6450,17 +6783,13 @@ void ABuildingEnergyDisplay::ProcessEnergyWebSocketUpdate(const FString& JsonDat
 			if (JsonObject->HasField(TEXT("buildings")))
 			{
 				// Full energy data update
-				UE_LOG(LogTemp, Warning, TEXT("🔄 Full energy data update received via WebSocket"));
-				
-				// Clear existing cache
-				BuildingDataCache.Empty();
-				GmlIdCache.Empty();
+				UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 Full energy data update received via WebSocket"));
 				
-				// Process the full update
+				// Process the full update in the background; the caches are replaced when it is published
 				FString BuildingsArray = JsonObject->GetStringField(TEXT("buildings"));
 				if (!BuildingsArray.IsEmpty())
 				{
-					ParseAndCacheAllBuildings(BuildingsArray);
+					ParseAndCacheAllBuildings(MoveTemp(BuildingsArray));
 				}
 			}
 			else if (JsonObject->HasField(TEXT("building_id")) && JsonObject->HasField(TEXT("energy_data")))
@@ -6469,78 +6798,41 @@ void ABuildingEnergyDisplay::ProcessEnergyWebSocketUpdate(const FString& JsonDat
 				FString BuildingId = JsonObject->GetStringField(TEXT("building_id"));
 				FString EnergyData = JsonObject->GetStringField(TEXT("energy_data"));
 				
-				UE_LOG(LogTemp, Warning, TEXT("🔄 Specific building energy update: %s"), *BuildingId);
+				UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 Specific building energy update: %s"), *BuildingId);
 				
-				// Extract coordinates if available in the update
+				// Extract coordinates if available in the update; they replace the building's geometry
+				FString CoordinatesData;
 				if (JsonObject->HasField(TEXT("coordinates")))
 				{
-					FString CoordinatesData = JsonObject->GetStringField(TEXT("coordinates"));
-
-					// Create unique cache key when numeric id is available
-					FString UniqueCacheKey = BuildingId;
-					if (JsonObject->HasField(TEXT("id")))
-					{
-						double NumericIdD = 0.0;
-						if (JsonObject->TryGetNumberField(TEXT("id"), NumericIdD))
-						{
-							int32 NumericId = (int32)NumericIdD;
-							UniqueCacheKey = FString::Printf(TEXT("%s#%d"), *BuildingId, NumericId);
-						}
-					}
-
-					StoreBuildingCoordinates(UniqueCacheKey, CoordinatesData);
-					UE_LOG(LogTemp, Warning, TEXT("🔄 Updated coordinates for building: %s (cached as %s)"), *BuildingId, *UniqueCacheKey);
+					CoordinatesData = JsonObject->GetStringField(TEXT("coordinates"));
 				}
 				else if (JsonObject->HasField(TEXT("geom")))
 				{
 					TSharedPtr<FJsonObject> GeomObject = JsonObject->GetObjectField(TEXT("geom"));
 					if (GeomObject.IsValid())
 					{
-						FString GeomString;
-						TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&GeomString);
+						TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&CoordinatesData);
 						FJsonSerializer::Serialize(GeomObject.ToSharedRef(), Writer);
-
-						FString UniqueCacheKey = BuildingId;
-						if (JsonObject->HasField(TEXT("id")))
-						{
-							double NumericIdD = 0.0;
-							if (JsonObject->TryGetNumberField(TEXT("id"), NumericIdD))
-							{
-								int32 NumericId = (int32)NumericIdD;
-								UniqueCacheKey = FString::Printf(TEXT("%s#%d"), *BuildingId, NumericId);
-							}
-						}
-
-						StoreBuildingCoordinates(UniqueCacheKey, GeomString);
-						UE_LOG(LogTemp, Warning, TEXT("🔄 Updated geom coordinates for building: %s (cached as %s)"), *BuildingId, *UniqueCacheKey);
 					}
 				}
 				else if (JsonObject->HasField(TEXT("position")))
 				{
-					FString PositionData = JsonObject->GetStringField(TEXT("position"));
-
-					FString UniqueCacheKey = BuildingId;
-					if (JsonObject->HasField(TEXT("id")))
-					{
-						double NumericIdD = 0.0;
-						if (JsonObject->TryGetNumberField(TEXT("id"), NumericIdD))
-						{
-							int32 NumericId = (int32)NumericIdD;
-							UniqueCacheKey = FString::Printf(TEXT("%s#%d"), *BuildingId, NumericId);
-						}
-					}
-
-					StoreBuildingCoordinates(UniqueCacheKey, PositionData);
-					UE_LOG(LogTemp, Warning, TEXT("🔄 Updated position coordinates for building: %s (cached as %s)"), *BuildingId, *UniqueCacheKey);
+					CoordinatesData = JsonObject->GetStringField(TEXT("position"));
+				}
+				
+				if (!CoordinatesData.IsEmpty())
+				{
+					StoreBuildingCoordinates(BuildingId, CoordinatesData);
+					UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 Updated coordinates for building: %s"), *BuildingId);
 				}
 				
-				// Update specific building in cache
-				BuildingDataCache.Add(BuildingId, EnergyData);
+				// Update specific building in the store
+				BuildingStore.DisplayTextOverrides.Add(BuildingStore.FindOrAddBuilding(BuildingId), EnergyData);
 				
 				// If this building is currently displayed, update the display immediately
 				if (BuildingId == CurrentlyDisplayedBuildingId)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("🔄 Updating displayed building with fresh WebSocket data"));
+					UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 Updating displayed building with fresh WebSocket data"));
 					ShowBuildingInfoWidget(BuildingId, EnergyData);
 					
 					if (GEngine)
@@ -6551,25 +6843,27 @@ void ABuildingEnergyDisplay::ProcessEnergyWebSocketUpdate(const FString& JsonDat
 				}
 			}
 			
-			// Mark data as loaded and up-to-date
-			bDataLoaded = true;
-			bIsLoading = false;
+			// Mark data as up-to-date unless a background ingest is still pending
+			if (!bIsLoading)
+			{
+				bDataLoaded = true;
+			}
 			
-			UE_LOG(LogTemp, Warning, TEXT("✅ WebSocket energy update processed successfully"));
+			UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("✅ WebSocket energy update processed successfully"));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Received unknown WebSocket message type"));
+			UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 Received unknown WebSocket message type"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("❌ Failed to parse WebSocket energy update JSON"));
+		UE_LOG(LogBuildingEnergyUpdates, Warning, TEXT("❌ Failed to parse WebSocket energy update JSON"));
 		
 		// Fallback: treat the entire message as energy data and try to parse it
 		if (JsonData.Contains("gml_id") && JsonData.Contains("energy"))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🔄 Fallback: Processing entire message as energy data"));
+			UE_LOG(LogBuildingEnergyUpdates, Log, TEXT("🔄 Fallback: Processing entire message as energy data"));
 			ParseAndCacheAllBuildings(JsonData);
 		}
 	}
@@ -6588,35 +6882,24 @@ bool ABuildingEnergyDisplay::IsPointInBuildingBounds(const FVector& Point, const
 
 bool ABuildingEnergyDisplay::ValidateBuildingPosition(const FVector& ClickPosition, const FString& GmlId)
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔍 === VALIDATING BUILDING POSITION ==="));
-	UE_LOG(LogTemp, Warning, TEXT("🔍 Building ID: %s"), *GmlId);
-	UE_LOG(LogTemp, Warning, TEXT("🔍 Click Position: X=%.2f, Y=%.2f, Z=%.2f"), ClickPosition.X, ClickPosition.Y, ClickPosition.Z);
+	BUILDING_ENERGY_SCOPE(HitTest);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 === VALIDATING BUILDING POSITION ==="));
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 Building ID: %s"), *GmlId);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 Click Position: X=%.2f, Y=%.2f, Z=%.2f"), ClickPosition.X, ClickPosition.Y, ClickPosition.Z);
 	
 	// 📦 CREATE BOUNDING BOX FOR BUILDING
-	UE_LOG(LogTemp, Warning, TEXT("📦 === CREATING BOUNDING BOX FOR BUILDING %s ==="), *GmlId);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦 === CREATING BOUNDING BOX FOR BUILDING %s ==="), *GmlId);
 	FBuildingBoundingBox BuildingBounds = CreateBuildingBoundingBox(GmlId);
 	
-	// Check if building has coordinate data in cache. Support multiple cached geometries for the same GML id
-	TArray<FVector> BuildingCoordinates;
-	if (BuildingCoordinatesCache.Contains(GmlId))
-	{
-		BuildingCoordinates = BuildingCoordinatesCache[GmlId];
-	}
-	else
-	{
-		// Collect all cached entries that start with the base GmlId (e.g. GMLID#123)
-		for (const auto& Entry : BuildingCoordinatesCache)
-		{
-			if (Entry.Key.StartsWith(GmlId))
-			{
-				BuildingCoordinates.Append(Entry.Value);
-			}
-		}
-	}
+	// Check if building has coordinate data in the store. All geometries of a building share its index
+	const int32 BuildingIndex = BuildingStore.FindIndex(GmlId);
+	const TArrayView<const FVector> BuildingCoordinates = BuildingIndex != INDEX_NONE
+		? BuildingStore.GetBuildingVertices(BuildingIndex)
+		: TArrayView<const FVector>();
 
 	if (BuildingCoordinates.Num() < 3)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🔍 ❌ Building %s has insufficient coordinates (%d points)"), *GmlId, BuildingCoordinates.Num());
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("🔍 ❌ Building %s has insufficient coordinates (%d points)"), *GmlId, BuildingCoordinates.Num());
 		return false;
 	}
 	
@@ -6625,52 +6908,45 @@ bool ABuildingEnergyDisplay::ValidateBuildingPosition(const FVector& ClickPositi
 	
 	if (!bInBoundingBox)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔍 ❌ Click position is outside building bounding box"));
-		UE_LOG(LogTemp, Warning, TEXT("🔍 Click distance from center: %.2f"), FVector::Dist2D(ClickPosition, BuildingBounds.Center));
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 ❌ Click position is outside building bounding box"));
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 Click distance from center: %.2f"), FVector::Dist2D(ClickPosition, BuildingBounds.Center));
 		return false;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔍 ✅ Click position is within bounding box"));
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 ✅ Click position is within bounding box"));
 	
 	// Second check: Precise point-in-polygon test
 	
-	// Use point-in-polygon test
-	bool bIsInside = IsPointInPolygon(ClickPosition, BuildingCoordinates);
+	// Use point-in-polygon test; the click only has to hit one of the building's polygons
+	bool bIsInside = false;
+	for (int32 PolygonIndex = BuildingStore.PolygonOffsets[BuildingIndex]; PolygonIndex < BuildingStore.PolygonOffsets[BuildingIndex + 1] && !bIsInside; ++PolygonIndex)
+	{
+		bIsInside = IsPointInPolygon(ClickPosition, BuildingStore.GetPolygon(PolygonIndex));
+	}
 	
 	if (bIsInside)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔍 ✅ Position validation PASSED - click is inside building polygon"));
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 ✅ Position validation PASSED - click is inside building polygon"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🔍 ❌ Position validation FAILED - click is outside building polygon"));
-		
-		// 📦 CREATE AND LOG BUILDING BOUNDING BOX FOR DEBUGGING
-		FVector MinBounds(FLT_MAX, FLT_MAX, FLT_MAX);
-		FVector MaxBounds(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 ❌ Position validation FAILED - click is outside building polygon"));
 		
-		for (const FVector& Point : BuildingCoordinates)
-		{
-			MinBounds.X = FMath::Min(MinBounds.X, Point.X);
-			MinBounds.Y = FMath::Min(MinBounds.Y, Point.Y);
-			MinBounds.Z = FMath::Min(MinBounds.Z, Point.Z);
-			MaxBounds.X = FMath::Max(MaxBounds.X, Point.X);
-			MaxBounds.Y = FMath::Max(MaxBounds.Y, Point.Y);
-			MaxBounds.Z = FMath::Max(MaxBounds.Z, Point.Z);
-		}
+		// 📦 LOG BUILDING BOUNDING BOX FOR DEBUGGING
+		const FVector MinBounds = BuildingBounds.MinBounds;
+		const FVector MaxBounds = BuildingBounds.MaxBounds;
+		const FVector BoundingBoxSize = BuildingBounds.Size;
+		const FVector BoundingBoxCenter = BuildingBounds.Center;
 		
-		FVector BoundingBoxSize = MaxBounds - MinBounds;
-		FVector BoundingBoxCenter = (MinBounds + MaxBounds) * 0.5f;
-		
-		UE_LOG(LogTemp, Warning, TEXT("📦 BUILDING BOUNDING BOX:"));
-		UE_LOG(LogTemp, Warning, TEXT("📦   Min Bounds: (%.2f, %.2f, %.2f)"), MinBounds.X, MinBounds.Y, MinBounds.Z);
-		UE_LOG(LogTemp, Warning, TEXT("📦   Max Bounds: (%.2f, %.2f, %.2f)"), MaxBounds.X, MaxBounds.Y, MaxBounds.Z);
-		UE_LOG(LogTemp, Warning, TEXT("📦   Size: (%.2f, %.2f, %.2f)"), BoundingBoxSize.X, BoundingBoxSize.Y, BoundingBoxSize.Z);
-		UE_LOG(LogTemp, Warning, TEXT("📦   Center: (%.2f, %.2f, %.2f)"), BoundingBoxCenter.X, BoundingBoxCenter.Y, BoundingBoxCenter.Z);
-		UE_LOG(LogTemp, Warning, TEXT("📦   Click Distance from Center: %.2f"), FVector::Dist2D(ClickPosition, BoundingBoxCenter));
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦 BUILDING BOUNDING BOX:"));
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Min Bounds: (%.2f, %.2f, %.2f)"), MinBounds.X, MinBounds.Y, MinBounds.Z);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Max Bounds: (%.2f, %.2f, %.2f)"), MaxBounds.X, MaxBounds.Y, MaxBounds.Z);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Size: (%.2f, %.2f, %.2f)"), BoundingBoxSize.X, BoundingBoxSize.Y, BoundingBoxSize.Z);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Center: (%.2f, %.2f, %.2f)"), BoundingBoxCenter.X, BoundingBoxCenter.Y, BoundingBoxCenter.Z);
+		UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Click Distance from Center: %.2f"), FVector::Dist2D(ClickPosition, BoundingBoxCenter));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔍 === VALIDATION RESULT: %s ==="), bIsInside ? TEXT("VALID") : TEXT("INVALID"));
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🔍 === VALIDATION RESULT: %s ==="), bIsInside ? TEXT("VALID") : TEXT("INVALID"));
 	return bIsInside;
 }
 
@@ -6678,62 +6954,28 @@ FBuildingBoundingBox ABuildingEnergyDisplay::CreateBuildingBoundingBox(const FSt
 {
 	FBuildingBoundingBox BoundingBox;
 	
-	UE_LOG(LogTemp, Warning, TEXT("📦 === CREATING BOUNDING BOX FOR BUILDING %s ==="), *GmlId);
-	
-	if (!BuildingCoordinatesCache.Contains(GmlId))
-	{
-		UE_LOG(LogTemp, Error, TEXT("📦 ❌ No coordinates found for building: %s"), *GmlId);
-		return BoundingBox;
-	}
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦 === CREATING BOUNDING BOX FOR BUILDING %s ==="), *GmlId);
 	
-	// Support combined coordinate sets when multiple entries exist for same base GML id
-	TArray<FVector> CombinedCoordinates;
-	if (BuildingCoordinatesCache.Contains(GmlId))
-	{
-		CombinedCoordinates = BuildingCoordinatesCache[GmlId];
-	}
-	else
-	{
-		for (const auto& Entry : BuildingCoordinatesCache)
-		{
-			if (Entry.Key.StartsWith(GmlId))
-			{
-				CombinedCoordinates.Append(Entry.Value);
-			}
-		}
-	}
-
-	if (CombinedCoordinates.Num() == 0)
+	// Bounds are kept per building by the store and cover all of its geometries
+	const int32 BuildingIndex = BuildingStore.FindIndex(GmlId);
+	if (BuildingIndex == INDEX_NONE || !BuildingStore.Bounds[BuildingIndex].IsValid)
 	{
-		UE_LOG(LogTemp, Error, TEXT("📦 ❌ No coordinates found for building: %s"), *GmlId);
+		UE_LOG(LogBuildingEnergyPicking, Error, TEXT("📦 ❌ No coordinates found for building: %s"), *GmlId);
 		return BoundingBox;
 	}
 	
-	// Initialize bounds with first point
-	BoundingBox.MinBounds = CombinedCoordinates[0];
-	BoundingBox.MaxBounds = CombinedCoordinates[0];
-    
-	// Find min/max bounds
-	for (const FVector& Point : CombinedCoordinates)
-	{
-		BoundingBox.MinBounds.X = FMath::Min(BoundingBox.MinBounds.X, Point.X);
-		BoundingBox.MinBounds.Y = FMath::Min(BoundingBox.MinBounds.Y, Point.Y);
-		BoundingBox.MinBounds.Z = FMath::Min(BoundingBox.MinBounds.Z, Point.Z);
-		
-		BoundingBox.MaxBounds.X = FMath::Max(BoundingBox.MaxBounds.X, Point.X);
-		BoundingBox.MaxBounds.Y = FMath::Max(BoundingBox.MaxBounds.Y, Point.Y);
-		BoundingBox.MaxBounds.Z = FMath::Max(BoundingBox.MaxBounds.Z, Point.Z);
-	}
+	BoundingBox.MinBounds = BuildingStore.Bounds[BuildingIndex].Min;
+	BoundingBox.MaxBounds = BuildingStore.Bounds[BuildingIndex].Max;
 	
 	// Calculate derived properties
 	BoundingBox.Size = BoundingBox.MaxBounds - BoundingBox.MinBounds;
 	BoundingBox.Center = (BoundingBox.MinBounds + BoundingBox.MaxBounds) * 0.5f;
 	
-	UE_LOG(LogTemp, Warning, TEXT("📦 BOUNDING BOX CREATED:"));
-	UE_LOG(LogTemp, Warning, TEXT("📦   Min: (%.2f, %.2f, %.2f)"), BoundingBox.MinBounds.X, BoundingBox.MinBounds.Y, BoundingBox.MinBounds.Z);
-	UE_LOG(LogTemp, Warning, TEXT("📦   Max: (%.2f, %.2f, %.2f)"), BoundingBox.MaxBounds.X, BoundingBox.MaxBounds.Y, BoundingBox.MaxBounds.Z);
-	UE_LOG(LogTemp, Warning, TEXT("📦   Size: (%.2f, %.2f, %.2f)"), BoundingBox.Size.X, BoundingBox.Size.Y, BoundingBox.Size.Z);
-	UE_LOG(LogTemp, Warning, TEXT("📦   Center: (%.2f, %.2f, %.2f)"), BoundingBox.Center.X, BoundingBox.Center.Y, BoundingBox.Center.Z);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦 BOUNDING BOX CREATED:"));
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Min: (%.2f, %.2f, %.2f)"), BoundingBox.MinBounds.X, BoundingBox.MinBounds.Y, BoundingBox.MinBounds.Z);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Max: (%.2f, %.2f, %.2f)"), BoundingBox.MaxBounds.X, BoundingBox.MaxBounds.Y, BoundingBox.MaxBounds.Z);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Size: (%.2f, %.2f, %.2f)"), BoundingBox.Size.X, BoundingBox.Size.Y, BoundingBox.Size.Z);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("📦   Center: (%.2f, %.2f, %.2f)"), BoundingBox.Center.X, BoundingBox.Center.Y, BoundingBox.Center.Z);
 	
 	return BoundingBox;
 }
@@ -6744,7 +6986,7 @@ bool ABuildingEnergyDisplay::IsPointInBoundingBox(const FVector& Point, const FB
 					  Point.Y >= BoundingBox.MinBounds.Y && Point.Y <= BoundingBox.MaxBounds.Y &&
 					  Point.Z >= BoundingBox.MinBounds.Z && Point.Z <= BoundingBox.MaxBounds.Z);
 	
-	UE_LOG(LogTemp, Verbose, TEXT("📦 Point (%.2f,%.2f,%.2f) in bounding box: %s"), 
+	UE_LOG(LogBuildingEnergyPicking, Verbose, TEXT("📦 Point (%.2f,%.2f,%.2f) in bounding box: %s"), 
 		Point.X, Point.Y, Point.Z, bInBounds ? TEXT("YES") : TEXT("NO"));
 	
 	return bInBounds;
@@ -6863,11 +7105,11 @@ bool ABuildingEnergyDisplay::ParseBuildingCoordinates(const FString& Coordinates
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🎯 Parsed %d coordinate points"), OutCoordinates.Num());
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🎯 Parsed %d coordinate points"), OutCoordinates.Num());
 	return OutCoordinates.Num() > 0;
 }
 
-bool ABuildingEnergyDisplay::IsPointInPolygon(const FVector& Point, const TArray<FVector>& PolygonVertices)
+bool ABuildingEnergyDisplay::IsPointInPolygon(const FVector& Point, TArrayView<const FVector> PolygonVertices)
 {
 	if (PolygonVertices.Num() < 3)
 	{
@@ -6895,7 +7137,7 @@ bool ABuildingEnergyDisplay::IsPointInPolygon(const FVector& Point, const TArray
 	// Point is inside if crossing count is odd
 	bool bIsInside = (CrossingCount % 2) == 1;
 	
-	UE_LOG(LogTemp, Verbose, TEXT("🎯 Point-in-polygon test: %s (crossings: %d)"), 
+	UE_LOG(LogBuildingEnergyPicking, Verbose, TEXT("🎯 Point-in-polygon test: %s (crossings: %d)"), 
 		bIsInside ? TEXT("INSIDE") : TEXT("OUTSIDE"), CrossingCount);
 	
 	return bIsInside;
@@ -6903,41 +7145,93 @@ bool ABuildingEnergyDisplay::IsPointInPolygon(const FVector& Point, const TArray
 
 FString ABuildingEnergyDisplay::GetBuildingByCoordinates(const FVector& ClickPosition)
 {
-	UE_LOG(LogTemp, Warning, TEXT("🎯 === FINDING BUILDING BY COORDINATES ==="));
-	UE_LOG(LogTemp, Warning, TEXT("🎯 Click Position: X=%.2f, Y=%.2f"), ClickPosition.X, ClickPosition.Y);
+	BUILDING_ENERGY_SCOPE(HitTest);
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🎯 === FINDING BUILDING BY COORDINATES ==="));
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🎯 Click Position: X=%.2f, Y=%.2f"), ClickPosition.X, ClickPosition.Y);
 	
-	// Search through all cached building coordinates
-	for (const auto& BuildingEntry : BuildingCoordinatesCache)
+	// Only polygons whose bounds contain the click need the exact test. Polygons are stored in
+	// building order, so sorting the candidates keeps the lowest building winning on overlaps
+	TArray<int32> CandidatePolygons;
+	BuildingStore.QueryPolygonsAtPoint(ClickPosition, CandidatePolygons);
+	Algo::Sort(CandidatePolygons);
+	
+	for (const int32 PolygonIndex : CandidatePolygons)
 	{
-		const FString& GmlId = BuildingEntry.Key;
-		const TArray<FVector>& Coordinates = BuildingEntry.Value;
-		
-		if (IsPointInPolygon(ClickPosition, Coordinates))
+		if (IsPointInPolygon(ClickPosition, BuildingStore.GetPolygon(PolygonIndex)))
 		{
-			// If the cached key contains a unique suffix (e.g. "GMLID#1234"), return the base GML id
-			FString BaseGmlId = GmlId;
-			int32 HashIndex = INDEX_NONE;
-			if (GmlId.FindChar(TEXT('#'), HashIndex))
-			{
-				BaseGmlId = GmlId.Left(HashIndex);
-			}
-			UE_LOG(LogTemp, Warning, TEXT("🎯 Found matching cached key: %s -> returning base id: %s"), *GmlId, *BaseGmlId);
-			return BaseGmlId;
+			const FString& GmlId = BuildingStore.ModifiedGmlIds[BuildingStore.GetPolygonOwner(PolygonIndex)];
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🎯 Found matching building: %s (polygon %d)"), *GmlId, PolygonIndex);
+			return GmlId;
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🎯 No building found at click position"));
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🎯 No building found at click position"));
 	return TEXT("");
 }
 
+TArray<FString> ABuildingEnergyDisplay::GetBuildingsInArea(const FVector& CornerA, const FVector& CornerB)
+{
+	BUILDING_ENERGY_SCOPE(HitTest);
+	TArray<FString> BuildingIds;
+	
+	const FBox2D Area(FVector2D(FMath::Min(CornerA.X, CornerB.X), FMath::Min(CornerA.Y, CornerB.Y)),
+		FVector2D(FMath::Max(CornerA.X, CornerB.X), FMath::Max(CornerA.Y, CornerB.Y)));
+	
+	TArray<int32> CandidatePolygons;
+	BuildingStore.QueryPolygonsInArea(Area, CandidatePolygons);
+	
+	// A building with several polygons in the area is reported once
+	TBitArray<> Selected(false, BuildingStore.Num());
+	for (const int32 PolygonIndex : CandidatePolygons)
+	{
+		const int32 BuildingIndex = BuildingStore.GetPolygonOwner(PolygonIndex);
+		if (!Selected[BuildingIndex])
+		{
+			Selected[BuildingIndex] = true;
+			BuildingIds.Add(BuildingStore.ModifiedGmlIds[BuildingIndex]);
+		}
+	}
+	
+	UE_LOG_BUILDING_LOOP(LogBuildingEnergyPicking, Verbose, TEXT("🎯 Area selection (%.2f, %.2f) - (%.2f, %.2f): %d buildings"),
+		Area.Min.X, Area.Min.Y, Area.Max.X, Area.Max.Y, BuildingIds.Num());
+	return BuildingIds;
+}
+
 void ABuildingEnergyDisplay::StoreBuildingCoordinates(const FString& GmlId, const FString& CoordinatesData)
 {
 	TArray<FVector> Coordinates;
 	if (ParseBuildingCoordinates(CoordinatesData, Coordinates))
 	{
-		BuildingCoordinatesCache.Add(GmlId, Coordinates);
-		UE_LOG(LogTemp, Verbose, TEXT("🎯 Stored %d coordinates for building: %s"), Coordinates.Num(), *GmlId);
+		// The update replaces whatever geometry the building had
+		const int32 BuildingIndex = BuildingStore.FindOrAddBuilding(GmlId);
+		BuildingStore.RemoveGeometry(BuildingIndex);
+		BuildingStore.AddPolygon(BuildingIndex, Coordinates);
+		BuildingStore.FinalizeGeometry();
+		UE_LOG(LogBuildingEnergyPicking, Verbose, TEXT("🎯 Stored %d coordinates for building: %s"), Coordinates.Num(), *GmlId);
+	}
+}
+
+void ABuildingEnergyDisplay::UpdateMemoryStats()
+{
+#if STATS
+	SET_DWORD_STAT(STAT_BuildingEnergy_NumBuildings, BuildingStore.Num());
+	SET_DWORD_STAT(STAT_BuildingEnergy_NumChunks, ChunkCache.Num());
+	SET_MEMORY_STAT(STAT_BuildingEnergy_StoreMemory, BuildingStore.GetAllocatedSize());
+	SET_MEMORY_STAT(STAT_BuildingEnergy_ChunkMemory, ChunkCache.GetAllocatedSize());
+	SET_MEMORY_STAT(STAT_BuildingEnergy_StyleMemory, BuildingStyleState.GetAllocatedSize());
+	SET_MEMORY_STAT(STAT_BuildingEnergy_ColorLutMemory, BuildingColorLutPixels.GetAllocatedSize());
+
+	// Merge workers only read the shard stores, so summing them here is safe while a merge runs
+	SIZE_T ShardBytes = 0;
+	for (const TPair<FString, FCommunityShard>& Pair : CommunityShards)
+	{
+		if (Pair.Value.Store.IsValid())
+		{
+			ShardBytes += Pair.Value.Store->GetAllocatedSize();
+		}
 	}
+	SET_MEMORY_STAT(STAT_BuildingEnergy_ShardMemory, ShardBytes);
+#endif
 }
 
 void ABuildingEnergyDisplay::LogCacheStatistics()
@@ -6945,35 +7239,41 @@ void ABuildingEnergyDisplay::LogCacheStatistics()
 	// Get static counters (note: these may be 0 if no operations happened yet)
 	// This is a summary function that logs current statistics
 	
-	UE_LOG(LogTemp, Warning, TEXT(""));
-	UE_LOG(LogTemp, Warning, TEXT("📊 ===== CACHE STATISTICS SUMMARY ====="));
-	UE_LOG(LogTemp, Warning, TEXT("📊 Current Cache State:"));
-	UE_LOG(LogTemp, Warning, TEXT("📊   Building Data Cache: %d entries"), BuildingDataCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("📊   GML ID Cache: %d mappings"), GmlIdCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("📊   Data Loaded: %s"), bDataLoaded ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("📊   Currently Loading: %s"), bIsLoading ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("📊   Last Displayed Building: %s"), CurrentlyDisplayedBuildingId.IsEmpty() ? TEXT("NONE") : *CurrentlyDisplayedBuildingId);
-	UE_LOG(LogTemp, Warning, TEXT("📊"));
-	UE_LOG(LogTemp, Warning, TEXT("📊 Note: Detailed update/access/hit/miss counters are shown in real-time during operations"));
-	UE_LOG(LogTemp, Warning, TEXT("📊 =========================================="));
-	UE_LOG(LogTemp, Warning, TEXT(""));
+	UE_LOG(LogBuildingEnergy, Log, TEXT(""));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊 ===== CACHE STATISTICS SUMMARY ====="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊 Current Cache State:"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Buildings: %d (%d colored, %d palette colors)"), BuildingStore.Num(), BuildingStore.NumColoredBuildings(), BuildingStore.Palette.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Geometry: %d polygons, %d vertices"), BuildingStore.GetNumPolygons(), BuildingStore.Vertices.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Store Memory: %.2f MB"), BuildingStore.GetAllocatedSize() / (1024.0 * 1024.0));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Chunk Cache: %d chunks, %.2f MB"), ChunkCache.Num(), ChunkCache.GetAllocatedSize() / (1024.0 * 1024.0));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Community Shards: %d"), CommunityShards.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Style State: %.2f MB"), BuildingStyleState.GetAllocatedSize() / (1024.0 * 1024.0));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Color LUT (CPU copy): %.2f MB"), BuildingColorLutPixels.GetAllocatedSize() / (1024.0 * 1024.0));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Queued Updates: %d"), PendingBuildingPatches.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Data Loaded: %s"), bDataLoaded ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Currently Loading: %s"), bIsLoading ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Last Displayed Building: %s"), CurrentlyDisplayedBuildingId.IsEmpty() ? TEXT("NONE") : *CurrentlyDisplayedBuildingId);
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊 Note: Per-frame timings and the same memory counters are live under `stat BuildingEnergy`"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊 =========================================="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT(""));
 }
 
 void ABuildingEnergyDisplay::ValidateGmlIdCaseSensitivity()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔍 ===== GML ID CASE SENSITIVITY VALIDATION ====="));
-	UE_LOG(LogTemp, Warning, TEXT("🔍 Validating that gml_id and modified_gml_id fields maintain proper case sensitivity"));
-	UE_LOG(LogTemp, Warning, TEXT("🔍 REQUIREMENT: 'G' must be different from 'g' in all GML ID operations"));
-	UE_LOG(LogTemp, Warning, TEXT(""));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 ===== GML ID CASE SENSITIVITY VALIDATION ====="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 Validating that gml_id and modified_gml_id fields maintain proper case sensitivity"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 REQUIREMENT: 'G' must be different from 'g' in all GML ID operations"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT(""));
 	
 	int32 CaseSensitiveCount = 0;
 	int32 PotentialIssues = 0;
 	
-	// Check all cached GML IDs for case sensitivity compliance
-	for (const auto& Entry : GmlIdCache)
+	// Check all stored GML IDs for case sensitivity compliance
+	for (int32 Index = 0; Index < BuildingStore.Num(); ++Index)
 	{
-		const FString& CachedModifiedGmlId = Entry.Key;
-		const FString& CachedActualGmlId = Entry.Value;
+		const FString& CachedModifiedGmlId = BuildingStore.ModifiedGmlIds[Index];
+		const FString& CachedActualGmlId = BuildingStore.ActualGmlIds[Index];
 		
 		bool bIsModifiedCaseSensitive = IsGmlIdCaseSensitive(CachedModifiedGmlId);
 		bool bIsActualCaseSensitive = IsGmlIdCaseSensitive(CachedActualGmlId);
@@ -6985,164 +7285,157 @@ void ABuildingEnergyDisplay::ValidateGmlIdCaseSensitivity()
 		else
 		{
 			PotentialIssues++;
-			UE_LOG(LogTemp, Warning, TEXT("⚠️ POTENTIAL ISSUE: Modified='%s' (case-sensitive:%s) -> Actual='%s' (case-sensitive:%s)"), 
-				*CachedModifiedGmlId, bIsModifiedCaseSensitive ? TEXT("YES") : TEXT("NO"),
-				*CachedActualGmlId, bIsActualCaseSensitive ? TEXT("YES") : TEXT("NO"));
-		}
-	}
-	
-	// Check BuildingDataCache keys
-	for (const auto& Entry : BuildingDataCache)
-	{
-		const FString& GmlId = Entry.Key;
-		if (!IsGmlIdCaseSensitive(GmlId))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("⚠️ BuildingDataCache key not case-sensitive: '%s'"), *GmlId);
+			if (PotentialIssues <= 5)
+			{
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Warning, TEXT("⚠️ POTENTIAL ISSUE: Modified='%s' (case-sensitive:%s) -> Actual='%s' (case-sensitive:%s)"), 
+					*CachedModifiedGmlId, bIsModifiedCaseSensitive ? TEXT("YES") : TEXT("NO"),
+					*CachedActualGmlId, bIsActualCaseSensitive ? TEXT("YES") : TEXT("NO"));
+			}
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT(""));
-	UE_LOG(LogTemp, Warning, TEXT("📊 VALIDATION RESULTS:"));
-	UE_LOG(LogTemp, Warning, TEXT("📊   Case-Sensitive GML IDs: %d"), CaseSensitiveCount);
-	UE_LOG(LogTemp, Warning, TEXT("📊   Potential Issues: %d"), PotentialIssues);
-	UE_LOG(LogTemp, Warning, TEXT("📊   GML ID Cache Size: %d"), GmlIdCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("📊   Building Data Cache Size: %d"), BuildingDataCache.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT(""));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊 VALIDATION RESULTS:"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Case-Sensitive GML IDs: %d"), CaseSensitiveCount);
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Potential Issues: %d"), PotentialIssues);
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Building Store Size: %d"), BuildingStore.Num());
 	
 	if (PotentialIssues == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("✅ VALIDATION PASSED: All GML IDs maintain proper case sensitivity"));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("✅ VALIDATION PASSED: All GML IDs maintain proper case sensitivity"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ VALIDATION FAILED: %d GML IDs have potential case sensitivity issues"), PotentialIssues);
+		UE_LOG(LogBuildingEnergy, Error, TEXT("❌ VALIDATION FAILED: %d GML IDs have potential case sensitivity issues"), PotentialIssues);
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔍 ================================================"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 ================================================"));
 }
 
 void ABuildingEnergyDisplay::CleanDuplicateColorCacheEntries()
 {
-	UE_LOG(LogTemp, Warning, TEXT("🧹 ===== CLEANING DUPLICATE COLOR CACHE ENTRIES ====="));
-	UE_LOG(LogTemp, Warning, TEXT("🧹 Removing potential duplicates caused by old case-insensitive matching"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧹 ===== CLEANING DUPLICATE COLOR CACHE ENTRIES ====="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧹 Removing potential duplicates caused by old case-insensitive matching"));
 	
-	int32 OriginalSize = BuildingColorCache.Num();
-	TMap<FString, FLinearColor> CleanedColorCache;
+	// The store keeps exactly one color per building index, so duplicates can only show up as
+	// a gml_id that resolves to a different building than the modified_gml_id it belongs to
+	int32 OriginalSize = BuildingStore.NumColoredBuildings();
 	TArray<FString> DuplicatesFound;
 	
-	// Create a clean cache with case-sensitive deduplication
-	for (const auto& Entry : BuildingColorCache)
+	for (int32 Index = 0; Index < BuildingStore.Num(); ++Index)
 	{
-		const FString& GmlId = Entry.Key;
-		const FLinearColor& Color = Entry.Value;
-		
-		// Check if we already have this exact GML ID (case-sensitive)
-		if (CleanedColorCache.Contains(GmlId))
+		const FString& ActualGmlId = BuildingStore.ActualGmlIds[Index];
+		if (BuildingStore.FindIndex(ActualGmlId) != Index)
 		{
-			DuplicatesFound.Add(GmlId);
-			UE_LOG(LogTemp, Warning, TEXT("🔍 DUPLICATE FOUND: '%s' - keeping first occurrence"), *GmlId);
-			continue;
+			DuplicatesFound.Add(ActualGmlId); // Listed (first 5) below instead of one line each
 		}
-		
-		// Add to cleaned cache
-		CleanedColorCache.Add(GmlId, Color);
 	}
 	
-	// Replace the original cache with the cleaned version
-	BuildingColorCache = CleanedColorCache;
-	
-	int32 CleanedSize = BuildingColorCache.Num();
-	int32 RemovedEntries = OriginalSize - CleanedSize;
+	int32 CleanedSize = BuildingStore.NumColoredBuildings();
+	int32 RemovedEntries = DuplicatesFound.Num();
 	
-	UE_LOG(LogTemp, Warning, TEXT(""));
-	UE_LOG(LogTemp, Warning, TEXT("📊 CLEANING RESULTS:"));
-	UE_LOG(LogTemp, Warning, TEXT("📊   Original Cache Size: %d"), OriginalSize);
-	UE_LOG(LogTemp, Warning, TEXT("📊   Cleaned Cache Size: %d"), CleanedSize);
-	UE_LOG(LogTemp, Warning, TEXT("📊   Duplicates Removed: %d"), RemovedEntries);
+	UE_LOG(LogBuildingEnergy, Log, TEXT(""));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊 CLEANING RESULTS:"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Original Cache Size: %d"), OriginalSize);
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Cleaned Cache Size: %d"), CleanedSize);
+	UE_LOG(LogBuildingEnergy, Log, TEXT("📊   Duplicates Removed: %d"), RemovedEntries);
 	
 	if (RemovedEntries > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("✅ CACHE CLEANED: Removed %d duplicate entries"), RemovedEntries);
-		UE_LOG(LogTemp, Warning, TEXT("💡 This should improve color application reliability"));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("✅ CACHE CLEANED: Removed %d duplicate entries"), RemovedEntries);
+		UE_LOG(LogBuildingEnergy, Log, TEXT("💡 This should improve color application reliability"));
 		
 		// Log some of the duplicates found
-		UE_LOG(LogTemp, Warning, TEXT("🔍 Sample duplicates removed:"));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 Sample duplicates removed:"));
 		int32 LogCount = 0;
 		for (const FString& Duplicate : DuplicatesFound)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("   %d: '%s'"), LogCount + 1, *Duplicate);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Warning, TEXT("   %d: '%s'"), LogCount + 1, *Duplicate);
 			if (++LogCount >= 5) break; // Show first 5
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("✅ CACHE ALREADY CLEAN: No duplicate entries found"));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("✅ CACHE ALREADY CLEAN: No duplicate entries found"));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🧹 =========================================="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧹 =========================================="));
 }
 
 void ABuildingEnergyDisplay::TestColorRetrieval(const FString& TestGmlId)
 {
-	UE_LOG(LogTemp, Warning, TEXT("🔍 ===== COLOR RETRIEVAL TEST ====="));
-	UE_LOG(LogTemp, Warning, TEXT("🔍 Testing color retrieval for: '%s'"), *TestGmlId);
-	UE_LOG(LogTemp, Warning, TEXT("🔍 BuildingColorCache size: %d"), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 ===== COLOR RETRIEVAL TEST ====="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 Testing color retrieval for: '%s'"), *TestGmlId);
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 Colored buildings: %d"), BuildingStore.NumColoredBuildings());
 	
 	// Test exact match (case-sensitive)
-	if (BuildingColorCache.Contains(TestGmlId))
+	const int32 TestIndex = BuildingStore.FindIndex(TestGmlId);
+	if (TestIndex != INDEX_NONE && BuildingStore.HasColor(TestIndex))
 	{
-		FLinearColor Color = BuildingColorCache[TestGmlId];
+		FLinearColor Color = BuildingStore.GetColor(TestIndex);
 		FColor SRGBColor = Color.ToFColor(true);
 		FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
 		
-		UE_LOG(LogTemp, Warning, TEXT("✅ EXACT MATCH FOUND: '%s' -> %s"), *TestGmlId, *HexColor);
-		UE_LOG(LogTemp, Warning, TEXT("   LinearColor: R:%.3f G:%.3f B:%.3f A:%.3f"), 
+		UE_LOG(LogBuildingEnergy, Log, TEXT("✅ EXACT MATCH FOUND: '%s' -> %s"), *TestGmlId, *HexColor);
+		UE_LOG(LogBuildingEnergy, Log, TEXT("   LinearColor: R:%.3f G:%.3f B:%.3f A:%.3f"), 
 			Color.R, Color.G, Color.B, Color.A);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ NO EXACT MATCH: '%s' not found in color cache"), *TestGmlId);
+		UE_LOG(LogBuildingEnergy, Error, TEXT("❌ NO EXACT MATCH: '%s' not found in color cache"), *TestGmlId);
 		
 		// Search for similar IDs (case-sensitive partial matching)
-		UE_LOG(LogTemp, Warning, TEXT("🔍 Searching for similar IDs..."));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 Searching for similar IDs..."));
 		TArray<FString> SimilarIds;
+		TArray<int32> SimilarIndices;
 		
-		for (const auto& Entry : BuildingColorCache)
+		for (int32 Index = 0; Index < BuildingStore.Num(); ++Index)
 		{
-			const FString& CacheId = Entry.Key;
+			if (!BuildingStore.HasColor(Index))
+			{
+				continue;
+			}
 			
-			// Case-sensitive contains check
-			if (CacheId.Contains(TestGmlId) || TestGmlId.Contains(CacheId))
+			// Case-sensitive contains check against both ids
+			for (const FString* CacheId : { &BuildingStore.ModifiedGmlIds[Index], &BuildingStore.ActualGmlIds[Index] })
 			{
-				SimilarIds.Add(CacheId);
+				if (CacheId->Contains(TestGmlId) || TestGmlId.Contains(*CacheId))
+				{
+					SimilarIds.Add(*CacheId);
+					SimilarIndices.Add(Index);
+					break;
+				}
 			}
 		}
 		
 		if (SimilarIds.Num() > 0)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🎯 Found %d similar IDs:"), SimilarIds.Num());
+			UE_LOG(LogBuildingEnergy, Log, TEXT("🎯 Found %d similar IDs:"), SimilarIds.Num());
 			for (int32 i = 0; i < FMath::Min(SimilarIds.Num(), 5); i++)
 			{
-				FLinearColor Color = BuildingColorCache[SimilarIds[i]];
-				UE_LOG(LogTemp, Warning, TEXT("   %d: '%s' (R:%.2f G:%.2f B:%.2f)"), 
+				FLinearColor Color = BuildingStore.GetColor(SimilarIndices[i]);
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("   %d: '%s' (R:%.2f G:%.2f B:%.2f)"), 
 					i + 1, *SimilarIds[i], Color.R, Color.G, Color.B);
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("❌ No similar IDs found"));
+			UE_LOG(LogBuildingEnergy, Warning, TEXT("❌ No similar IDs found"));
 			
 			// Show some sample cache entries for comparison
-			UE_LOG(LogTemp, Warning, TEXT("📝 Sample cache entries for comparison:"));
+			UE_LOG(LogBuildingEnergy, Log, TEXT("📝 Sample cache entries for comparison:"));
 			int32 SampleCount = 0;
-			for (const auto& Entry : BuildingColorCache)
+			for (int32 Index = 0; Index < BuildingStore.Num() && SampleCount < 5; ++Index)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("   %d: '%s'"), SampleCount + 1, *Entry.Key);
-				if (++SampleCount >= 5) break;
+				if (BuildingStore.HasColor(Index))
+				{
+					UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("   %d: '%s'"), ++SampleCount, *BuildingStore.ModifiedGmlIds[Index]);
+				}
 			}
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🔍 ===================================="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🔍 ===================================="));
 }
 
 bool ABuildingEnergyDisplay::IsGmlIdCaseSensitive(const FString& GmlId)
@@ -7181,7 +7474,7 @@ bool ABuildingEnergyDisplay::IsGmlIdCaseSensitive(const FString& GmlId)
 	else if (bHasLowercase && !bHasUppercase)
 	{
 		// All lowercase - this is suspicious for GML IDs
-		UE_LOG(LogTemp, Warning, TEXT("⚠️ GML ID appears to be all lowercase: '%s'"), *GmlId);
+		UE_LOG(LogBuildingEnergy, Warning, TEXT("⚠️ GML ID appears to be all lowercase: '%s'"), *GmlId);
 		return false;
 	}
 	
@@ -7196,20 +7489,28 @@ void ABuildingEnergyDisplay::ApplyCesiumTilesetStyling(AActor* CesiumActor)
 
 	if (!CesiumActor)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 CESIUM COLORS: Cannot apply styling to null actor"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 CESIUM COLORS: Cannot apply styling to null actor"));
 		return;
 	}
 
 	ACesium3DTileset* Tileset = Cast<ACesium3DTileset>(CesiumActor);
 	if (!Tileset)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM COLORS: Actor '%s' is not an ACesium3DTileset (skipping)"), *CesiumActor->GetName());
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 CESIUM COLORS: Actor '%s' is not an ACesium3DTileset (skipping)"), *CesiumActor->GetName());
 		return;
 	}
 
 	if (!bEnableCesiumPerFeatureStyling)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM COLORS: Auto-apply disabled (Enable Cesium Per Feature Styling = false)."));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM COLORS: Auto-apply disabled (Enable Cesium Per Feature Styling = false)."));
+		return;
+	}
+
+	const uint64 ColorMapHash = BuildingStore.GetColorMapHash();
+	if (!bDebugForceRedStyle && !BuildingStyleState.NeedsApply(Tileset, ColorMapHash))
+	{
+		UE_LOG(LogBuildingEnergyStyle, Verbose, TEXT("🎨 CESIUM COLORS: Style unchanged for '%s' - skipping reapply"), *Tileset->GetName());
+		bCesiumStyleApplied = true;
 		return;
 	}
 
@@ -7217,17 +7518,28 @@ void ABuildingEnergyDisplay::ApplyCesiumTilesetStyling(AActor* CesiumActor)
 		? TEXT("{\"color\":{\"evaluate\":\"color('red')\"}}")
 		: CreateCesiumColorExpression();
 
-	ApplyColorLookupMaterialToTileset(Tileset);
+	if (!ApplyColorLookupMaterialToTileset(Tileset))
+	{
+		return; // Not marked applied, so the next update retries
+	}
 	bCesiumStyleApplied = true;
+	if (bDebugForceRedStyle)
+	{
+		BuildingStyleState.InvalidateApplied(); // The debug style is not the color map
+	}
+	else
+	{
+		BuildingStyleState.MarkApplied(Tileset, ColorMapHash);
+	}
 
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM COLORS: Applied style to tileset '%s' via ApplyCesiumTilesetStyling"), *Tileset->GetName());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM COLORS: Applied style to tileset '%s' via ApplyCesiumTilesetStyling"), *Tileset->GetName());
 }
 
 
 
 void ABuildingEnergyDisplay::ApplyFallbackMaterialStyling(AActor* CesiumActor)
 {
-	UE_LOG(LogTemp, Warning, TEXT("STYLE Applying fallback material-based styling"));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("STYLE Applying fallback material-based styling"));
 	
 	// Get all mesh components and try to apply materials directly
 	TArray<UMeshComponent*> MeshComponents;
@@ -7237,7 +7549,7 @@ void ABuildingEnergyDisplay::ApplyFallbackMaterialStyling(AActor* CesiumActor)
 	{
 		if (MeshComp)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("STYLE Found mesh component: %s"), *MeshComp->GetName());
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("STYLE Found mesh component: %s"), *MeshComp->GetName());
 			
 			// Check if it's a static mesh component specifically
 			if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(MeshComp))
@@ -7246,9 +7558,13 @@ void ABuildingEnergyDisplay::ApplyFallbackMaterialStyling(AActor* CesiumActor)
 				{
 					// Try to create dynamic material instances for each building
 					int32 MaterialIndex = 0;
-					for (const auto& BuildingColor : BuildingColorCache)
+					for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
 					{
-						FLinearColor Color = BuildingColor.Value;
+						if (!BuildingStore.HasColor(BuildingIndex))
+						{
+							continue;
+						}
+						FLinearColor Color = BuildingStore.GetColor(BuildingIndex);
 						
 						// Create dynamic material instance
 						UMaterialInterface* BaseMaterial = StaticMeshComp->GetMaterial(0);
@@ -7266,7 +7582,7 @@ void ABuildingEnergyDisplay::ApplyFallbackMaterialStyling(AActor* CesiumActor)
 								// Apply to mesh (this will affect all buildings, but it's a fallback)
 								StaticMeshComp->SetMaterial(MaterialIndex, DynamicMat);
 								
-								UE_LOG(LogTemp, Warning, TEXT("STYLE Applied dynamic material with color R:%.2f G:%.2f B:%.2f"), Color.R, Color.G, Color.B);
+								UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("STYLE Applied dynamic material with color R:%.2f G:%.2f B:%.2f"), Color.R, Color.G, Color.B);
 								break; // Only apply first color as fallback
 							}
 						}
@@ -7277,26 +7593,30 @@ void ABuildingEnergyDisplay::ApplyFallbackMaterialStyling(AActor* CesiumActor)
 	}
 }
 
-bool ABuildingEnergyDisplay::ApplyCesiumStyleJsonToTileset(ACesium3DTileset* Tileset, const FString& StyleJson) const
+bool ABuildingEnergyDisplay::ApplyCesiumStyleJsonToTileset(ACesium3DTileset* Tileset, const FString& StyleJson)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(BuildingEnergy_SetTilesetStyle); // Counted under StyleApplication by the caller
 	if (!Tileset)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 CESIUM STYLE: Cannot apply style - tileset is null"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 CESIUM STYLE: Cannot apply style - tileset is null"));
 		return false;
 	}
 
 	if (StyleJson.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM STYLE: Style JSON is empty - nothing to apply"));
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM STYLE: Style JSON is empty - nothing to apply"));
 		return false;
 	}
 
 	// 🎨 APPLY STYLE: Use the available material-based approach in this Cesium version
-	// This applies per-building colors using the BuildingColorCache
-	UE_LOG(LogTemp, Warning, TEXT("🎨 CESIUM STYLE: Applying per-building colors using material lookup..."));
-	ApplyColorLookupMaterialToTileset(Tileset);
+	// This applies per-building colors using the building store
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 CESIUM STYLE: Applying per-building colors using material lookup..."));
+	if (!ApplyColorLookupMaterialToTileset(Tileset))
+	{
+		return false;
+	}
 
-	UE_LOG(LogTemp, Warning, TEXT("✅ CESIUM STYLE: Applied color lookup to '%s' for per-building visualization"), *Tileset->GetName());
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("✅ CESIUM STYLE: Applied color lookup to '%s' for per-building visualization"), *Tileset->GetName());
 	return true;
 }
 
@@ -7337,170 +7657,308 @@ TArray<FString> ABuildingEnergyDisplay::MakeIdVariants(const FString& InId) cons
 	return Variants;
 }
 
-void ABuildingEnergyDisplay::ApplyColorLookupMaterialToTileset(ACesium3DTileset* Tileset) const
+bool ABuildingEnergyDisplay::ApplyColorLookupMaterialToTileset(ACesium3DTileset* Tileset)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(BuildingEnergy_ApplyColorLookupMaterial);
 	if (!Tileset)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 MATERIAL: Cannot apply color lookup - tileset is null"));
-		return;
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 MATERIAL: Cannot apply color lookup - tileset is null"));
+		return false;
+	}
+
+	if (BuildingStore.NumColoredBuildings() == 0)
+	{
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 MATERIAL: Building store has no colors - nothing to apply"));
+		return false;
 	}
 
-	if (BuildingColorCache.Num() == 0)
+	// Only a material that samples the lookup textures may replace the tileset's: anything else shows no colors,
+	// and SetMaterial reloads every tile
+	if (!BuildingColorLutBaseMaterial)
+	{
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 MATERIAL: BuildingColorLutBaseMaterial is not set - keeping the material of '%s'"), *Tileset->GetName());
+		return false;
+	}
+
+	UpdateBuildingColorLut();
+	UpdateBuildingFeatureIndexLut();
+
+	// The shared instance is created once; later recolors only touch the texture
+	if (!BuildingColorLutMaterial || BuildingColorLutMaterial->Parent != BuildingColorLutBaseMaterial)
+	{
+		BuildingColorLutMaterial = UMaterialInstanceDynamic::Create(BuildingColorLutBaseMaterial, this);
+		if (!BuildingColorLutMaterial)
+		{
+			UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 MATERIAL: Failed to create color lookup material from '%s'"), *BuildingColorLutBaseMaterial->GetName());
+			return false;
+		}
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 MATERIAL: Created shared color lookup material from '%s'"), *BuildingColorLutBaseMaterial->GetName());
+	}
+
+	// The textures are recreated when the store outgrows them, so rebind every time
+	BuildingColorLutMaterial->SetTextureParameterValue(TEXT("BuildingColorLUT"), BuildingColorLut);
+	BuildingColorLutMaterial->SetScalarParameterValue(TEXT("BuildingColorLUTWidth"), static_cast<float>(BuildingColorLutWidth));
+	BuildingColorLutMaterial->SetTextureParameterValue(TEXT("BuildingFeatureIndexLUT"), BuildingFeatureIndexLut);
+	BuildingColorLutMaterial->SetScalarParameterValue(TEXT("BuildingFeatureIndexLUTWidth"), static_cast<float>(BuildingColorLutWidth));
+
+	// Changing the tileset material reloads its tiles, so only do it the first time
+	if (Tileset->GetMaterial() != BuildingColorLutMaterial)
+	{
+		Tileset->SetMaterial(BuildingColorLutMaterial);
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 MATERIAL: Bound color lookup material to tileset '%s' (%d building colors, %d feature keys)"),
+			*Tileset->GetName(), BuildingStore.NumColoredBuildings(), BuildingStore.FeatureIdToIndex.Num());
+	}
+	return true;
+}
+
+void ABuildingEnergyDisplay::UpdateBuildingFeatureIndexLut()
+{
+	BUILDING_ENERGY_SCOPE(ColorLut);
+	if (BuildingFeatureIndexLut && BuildingFeatureIndexLutRevision == BuildingStore.GetFeatureIdRevision())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL: BuildingColorCache is empty - no colors to apply"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL: Applying color lookup material to tileset '%s' with %d building colors"), 
-		*Tileset->GetName(), BuildingColorCache.Num());
+	int32 MaxFeatureId = 0;
+	int32 NumOutOfRange = 0;
+	for (const TPair<int32, int32>& Feature : BuildingStore.FeatureIdToIndex)
+	{
+		if (Feature.Key > MaxLutFeatureId)
+		{
+			++NumOutOfRange;
+			continue;
+		}
+		MaxFeatureId = FMath::Max(MaxFeatureId, Feature.Key);
+	}
+	if (NumOutOfRange > 0)
+	{
+		UE_LOG(LogBuildingEnergyStyle, Warning, TEXT("🎨 MATERIAL: %d feature keys are above %d and stay uncolored"), NumOutOfRange, MaxLutFeatureId);
+	}
 
-	// Create a dynamic material instance if we have a base material
-	if (BuildingEnergyMaterial)
+	// Keys only change with ingests and merges, so the map is uploaded whole
+	const int32 Rows = FMath::RoundUpToPowerOfTwo(MaxFeatureId / BuildingColorLutWidth + 1);
+	if (!BuildingFeatureIndexLut || BuildingFeatureIndexLut->GetSizeY() != Rows)
 	{
-		// Find all primitive components in the tileset
-		TArray<UPrimitiveComponent*> PrimitiveComponents;
-		for (UActorComponent* Component : Tileset->GetComponents())
+		BuildingFeatureIndexLut = UTexture2D::CreateTransient(BuildingColorLutWidth, Rows, PF_B8G8R8A8, TEXT("BuildingFeatureIndexLUT"));
+		if (!BuildingFeatureIndexLut)
 		{
-			if (UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(Component))
-			{
-				PrimitiveComponents.Add(PrimComp);
-			}
+			UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 MATERIAL: Failed to create %dx%d feature index texture"), BuildingColorLutWidth, Rows);
+			return;
 		}
+		BuildingFeatureIndexLut->SRGB = false; // Bytes of an index, not a color
+		BuildingFeatureIndexLut->Filter = TF_Nearest;
+		BuildingFeatureIndexLut->AddressX = TA_Clamp;
+		BuildingFeatureIndexLut->AddressY = TA_Clamp;
+		BuildingFeatureIndexLut->NeverStream = true;
+		BuildingFeatureIndexLut->UpdateResource();
+	}
 
-		UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL: Found %d primitive components in tileset"), PrimitiveComponents.Num());
+	uint8* PixelData = static_cast<uint8*>(FMemory::MallocZeroed(BuildingColorLutWidth * Rows * sizeof(FColor)));
+	FColor* Pixels = reinterpret_cast<FColor*>(PixelData);
+	for (const TPair<int32, int32>& Feature : BuildingStore.FeatureIdToIndex)
+	{
+		if (Feature.Key <= MaxLutFeatureId)
+		{
+			const uint32 Entry = static_cast<uint32>(Feature.Value) + 1;
+			Pixels[Feature.Key] = FColor(Entry & 0xFF, (Entry >> 8) & 0xFF, (Entry >> 16) & 0xFF, 255);
+		}
+	}
 
-		// Apply the material to each primitive component
-		for (UPrimitiveComponent* PrimComp : PrimitiveComponents)
+	FUpdateTextureRegion2D* RegionData = new FUpdateTextureRegion2D(0, 0, 0, 0, BuildingColorLutWidth, Rows);
+	BuildingFeatureIndexLut->UpdateTextureRegions(0, 1, RegionData, BuildingColorLutWidth * sizeof(FColor), sizeof(FColor), PixelData,
+		[](uint8* SrcData, const FUpdateTextureRegion2D* SrcRegions)
 		{
-			if (PrimComp)
-			{
-				// Create a dynamic material instance from the base material
-				UMaterialInstanceDynamic* DynMaterial = UMaterialInstanceDynamic::Create(BuildingEnergyMaterial, PrimComp);
-				if (DynMaterial)
-				{
-					// Set material on the component
-					PrimComp->SetMaterial(0, DynMaterial);
+			FMemory::Free(SrcData);
+			delete SrcRegions;
+		});
+	BuildingFeatureIndexLutRevision = BuildingStore.GetFeatureIdRevision();
 
-					// Try to set scalar and vector parameters for the color data
-					// This is a fallback approach - the material needs to handle the color lookup logic
-					
-					// Log the cache for reference by the material
-					int32 BuildingCount = 0;
-					for (const auto& BuildingColor : BuildingColorCache)
-					{
-						if (BuildingCount < 5) // Log first 5 for debugging
-						{
-							FColor Col = BuildingColor.Value.ToFColor(true);
-							UE_LOG(LogTemp, Log, TEXT("🎨 MATERIAL: Mapping %s -> RGB(#%02X%02X%02X)"), 
-								*BuildingColor.Key, Col.R, Col.G, Col.B);
-						}
-						BuildingCount++;
-					}
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 MATERIAL: Uploaded %d feature keys in a %dx%d index texture"), BuildingStore.FeatureIdToIndex.Num(), BuildingColorLutWidth, Rows);
+}
 
-					if (BuildingCount > 5)
-					{
-						UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL: ... and %d more building mappings"), BuildingCount - 5);
-					}
+void ABuildingEnergyDisplay::UpdateBuildingColorLut()
+{
+	BUILDING_ENERGY_SCOPE(ColorLut);
+	const int32 RequiredRows = FMath::Max(1, FMath::DivideAndRoundUp(BuildingStore.Num(), BuildingColorLutWidth));
 
-					UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL: Applied dynamic material to component '%s'"), *PrimComp->GetName());
-				}
-			}
+	TArray<int32> ChangedIndices;
+	const bool bListed = BuildingStore.GetColorChangesSince(BuildingColorLutCursor, ChangedIndices);
+
+	const auto GetLutColor = [this](int32 BuildingIndex)
+	{
+		return BuildingStore.HasColor(BuildingIndex) ? BuildingStore.GetColor(BuildingIndex).ToFColor(true) : FColor(0, 0, 0, 0);
+	};
+
+	// Grow in powers of two so a growing store does not recreate the texture on every poll
+	const bool bRecreate = !BuildingColorLut || BuildingColorLut->GetSizeY() < RequiredRows;
+	if (bRecreate)
+	{
+		const int32 Rows = FMath::RoundUpToPowerOfTwo(RequiredRows);
+		BuildingColorLut = UTexture2D::CreateTransient(BuildingColorLutWidth, Rows, PF_B8G8R8A8, TEXT("BuildingColorLUT"));
+		if (!BuildingColorLut)
+		{
+			UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🎨 MATERIAL: Failed to create %dx%d color lookup texture"), BuildingColorLutWidth, Rows);
+			return;
+		}
+		BuildingColorLut->SRGB = true;
+		BuildingColorLut->Filter = TF_Nearest;
+		BuildingColorLut->AddressX = TA_Clamp;
+		BuildingColorLut->AddressY = TA_Clamp;
+		BuildingColorLut->NeverStream = true;
+		BuildingColorLut->UpdateResource();
+	}
+
+	const int32 Rows = BuildingColorLut->GetSizeY();
+	TArray<FUpdateTextureRegion2D> Regions;
+	TArray<FColor> UploadPixels;
+
+	if (bRecreate || !bListed || BuildingColorLutPixels.Num() != BuildingColorLutWidth * Rows)
+	{
+		BuildingColorLutPixels.SetNumZeroed(BuildingColorLutWidth * Rows);
+		SET_MEMORY_STAT(STAT_BuildingEnergy_ColorLutMemory, BuildingColorLutPixels.GetAllocatedSize());
+		for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
+		{
+			BuildingColorLutPixels[BuildingIndex] = GetLutColor(BuildingIndex);
 		}
 
-		UE_LOG(LogTemp, Warning, TEXT("🎨 MATERIAL: Color lookup material application complete"));
-		Tileset->MarkComponentsRenderStateDirty();
+		Regions.Emplace(0, 0, 0, 0, BuildingColorLutWidth, Rows);
+		UploadPixels = BuildingColorLutPixels;
 	}
-	else
+	else if (ChangedIndices.Num() > 0)
+	{
+		TArray<int32> DirtyRows;
+		DirtyRows.Reserve(ChangedIndices.Num());
+		for (const int32 BuildingIndex : ChangedIndices)
+		{
+			BuildingColorLutPixels[BuildingIndex] = GetLutColor(BuildingIndex);
+			DirtyRows.Add(BuildingIndex / BuildingColorLutWidth);
+		}
+		Algo::Sort(DirtyRows);
+
+		// One region per run of consecutive dirty rows, packed back to back in the upload buffer
+		for (int32 RunStart = 0; RunStart < DirtyRows.Num();)
+		{
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < DirtyRows.Num() && DirtyRows[RunEnd] - DirtyRows[RunEnd - 1] <= 1)
+			{
+				++RunEnd;
+			}
+
+			const int32 FirstRow = DirtyRows[RunStart];
+			const int32 NumRows = DirtyRows[RunEnd - 1] - FirstRow + 1;
+			Regions.Emplace(0, FirstRow, 0, UploadPixels.Num() / BuildingColorLutWidth, BuildingColorLutWidth, NumRows);
+			UploadPixels.Append(BuildingColorLutPixels.GetData() + FirstRow * BuildingColorLutWidth, NumRows * BuildingColorLutWidth);
+			RunStart = RunEnd;
+		}
+	}
+
+	if (Regions.Num() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎨 MATERIAL: BuildingEnergyMaterial is not set! Create a material first using CreateBuildingEnergyMaterial()"));
+		return;
 	}
+
+	// The render thread reads both buffers later, so hand it heap copies it frees itself
+	FUpdateTextureRegion2D* RegionData = new FUpdateTextureRegion2D[Regions.Num()];
+	FMemory::Memcpy(RegionData, Regions.GetData(), Regions.Num() * sizeof(FUpdateTextureRegion2D));
+	uint8* PixelData = static_cast<uint8*>(FMemory::Malloc(UploadPixels.Num() * sizeof(FColor)));
+	FMemory::Memcpy(PixelData, UploadPixels.GetData(), UploadPixels.Num() * sizeof(FColor));
+
+	BuildingColorLut->UpdateTextureRegions(0, Regions.Num(), RegionData, BuildingColorLutWidth * sizeof(FColor), sizeof(FColor), PixelData,
+		[](uint8* SrcData, const FUpdateTextureRegion2D* SrcRegions)
+		{
+			FMemory::Free(SrcData);
+			delete[] SrcRegions;
+		});
+
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🎨 MATERIAL: Uploaded %d color lookup row(s) in %d region(s)"), UploadPixels.Num() / BuildingColorLutWidth, Regions.Num());
 }
 
 // Debug and test functions
 void ABuildingEnergyDisplay::TestColorSystem()
 {
-	UE_LOG(LogTemp, Warning, TEXT(""));
-	UE_LOG(LogTemp, Warning, TEXT("🧪 ===== TESTING COLOR SYSTEM ====="));
-	UE_LOG(LogTemp, Warning, TEXT("🧪 Data loaded: %s"), bDataLoaded ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("🧪 Building data cache entries: %d"), BuildingDataCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("🧪 Building color cache entries: %d"), BuildingColorCache.Num());
-	UE_LOG(LogTemp, Warning, TEXT("🧪 Currently loading: %s"), bIsLoading ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("🧪 Access token length: %d"), AccessToken.Len());
+	UE_LOG(LogBuildingEnergy, Log, TEXT(""));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 ===== TESTING COLOR SYSTEM ====="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 Data loaded: %s"), bDataLoaded ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 Building store entries: %d"), BuildingStore.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 Building color cache entries: %d"), BuildingStore.NumColoredBuildings());
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 Currently loading: %s"), bIsLoading ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 Access token length: %d"), AccessToken.Len());
 	
 	// Test authentication if no data
 	if (!bDataLoaded && !bIsLoading)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧪 No data loaded - triggering authentication"));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 No data loaded - triggering authentication"));
 		AuthenticateAndLoadData();
 	}
 	
 	// Test color application if we have colors
-	if (BuildingColorCache.Num() > 0)
+	if (BuildingStore.NumColoredBuildings() > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🧪 Colors available - testing application"));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 Colors available - testing application"));
 		ForceApplyColors();
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🧪 =================================="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🧪 =================================="));
 }
 
 void ABuildingEnergyDisplay::LogColorCacheStatus()
 {
-	UE_LOG(LogTemp, Warning, TEXT(""));
-	UE_LOG(LogTemp, Warning, TEXT("🎯 ===== COLOR CACHE STATUS ====="));
-	UE_LOG(LogTemp, Warning, TEXT("🎯 BuildingColorCache entries: %d"), BuildingColorCache.Num());
+	UE_LOG(LogBuildingEnergy, Log, TEXT(""));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🎯 ===== COLOR CACHE STATUS ====="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🎯 Colored buildings: %d"), BuildingStore.NumColoredBuildings());
 	
-	if (BuildingColorCache.Num() > 0)
+	if (BuildingStore.NumColoredBuildings() > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("🎯 Sample cached colors:"));
+		UE_LOG(LogBuildingEnergy, Log, TEXT("🎯 Sample cached colors:"));
 		int32 Count = 0;
-		for (const auto& Entry : BuildingColorCache)
+		for (int32 BuildingIndex = 0; BuildingIndex < BuildingStore.Num(); ++BuildingIndex)
 		{
-			FLinearColor Color = Entry.Value;
-			FColor SRGBColor = Color.ToFColor(true);
-			FString HexColor = FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B);
+			if (!BuildingStore.HasColor(BuildingIndex))
+			{
+				continue;
+			}
 			
-			UE_LOG(LogTemp, Warning, TEXT("🎯   %s -> %s"), *Entry.Key, *HexColor);
+			UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("🎯   %s -> %s"), *BuildingStore.ModifiedGmlIds[BuildingIndex], *BuildingStore.GetColorHex(BuildingIndex));
 			
 			if (++Count >= 3) // Show only first 3
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🎯   ... and %d more"), BuildingColorCache.Num() - 3);
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergy, Verbose, TEXT("🎯   ... and %d more"), BuildingStore.NumColoredBuildings() - 3);
 				break;
 			}
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("🎯 No colors cached! Possible issues:"));
-		UE_LOG(LogTemp, Error, TEXT("🎯   1. API authentication failed"));
-		UE_LOG(LogTemp, Error, TEXT("🎯   2. JSON parsing failed"));
-		UE_LOG(LogTemp, Error, TEXT("🎯   3. Color extraction failed"));
+		UE_LOG(LogBuildingEnergy, Error, TEXT("🎯 No colors cached! Possible issues:"));
+		UE_LOG(LogBuildingEnergy, Error, TEXT("🎯   1. API authentication failed"));
+		UE_LOG(LogBuildingEnergy, Error, TEXT("🎯   2. JSON parsing failed"));
+		UE_LOG(LogBuildingEnergy, Error, TEXT("🎯   3. Color extraction failed"));
 	}
-	UE_LOG(LogTemp, Warning, TEXT("🎯 ==============================="));
+	UE_LOG(LogBuildingEnergy, Log, TEXT("🎯 ==============================="));
 }
 
 void ABuildingEnergyDisplay::ForceApplyColors()
 {
-	UE_LOG(LogTemp, Warning, TEXT(""));
-	UE_LOG(LogTemp, Warning, TEXT("🚀 ===== FORCING COLOR APPLICATION ====="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT(""));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 ===== FORCING COLOR APPLICATION ====="));
 	
-	if (BuildingColorCache.Num() == 0)
+	if (BuildingStore.NumColoredBuildings() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚀 Cannot apply colors - cache is empty!"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🚀 Cannot apply colors - cache is empty!"));
 		
 		// Try to create test colors for debugging
-		UE_LOG(LogTemp, Warning, TEXT("🚀 Creating test colors for debugging"));
-		BuildingColorCache.Add(TEXT("DEBW_0010008"), FLinearColor(1.0f, 0.0f, 0.0f, 1.0f)); // Red
-		BuildingColorCache.Add(TEXT("DEBW_0010009"), FLinearColor(0.0f, 1.0f, 0.0f, 1.0f)); // Green
-		BuildingColorCache.Add(TEXT("DEBW_0010010"), FLinearColor(0.0f, 0.0f, 1.0f, 1.0f)); // Blue
-		UE_LOG(LogTemp, Warning, TEXT("🚀 Created %d test colors"), BuildingColorCache.Num());
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 Creating test colors for debugging"));
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("DEBW_0010008")), FLinearColor(1.0f, 0.0f, 0.0f, 1.0f)); // Red
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("DEBW_0010009")), FLinearColor(0.0f, 1.0f, 0.0f, 1.0f)); // Green
+		BuildingStore.SetColor(BuildingStore.FindOrAddBuilding(TEXT("DEBW_0010010")), FLinearColor(0.0f, 0.0f, 1.0f, 1.0f)); // Blue
+		UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 Created %d test colors"), BuildingStore.NumColoredBuildings());
 	}
 	
 	// Try to find and apply colors to Cesium tileset
 	UWorld* World = GetWorld();
 	if (!World)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚀 Cannot apply colors - no world reference!"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🚀 Cannot apply colors - no world reference!"));
 		return;
 	}
 	
@@ -7511,11 +7969,11 @@ void ABuildingEnergyDisplay::ForceApplyColors()
 		if (Actor)
 		{
 			FString ActorName = Actor->GetName();
-			UE_LOG(LogTemp, Log, TEXT("🚀 Found actor: %s"), *ActorName);
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 Found actor: %s"), *ActorName);
 			
 			if (ActorName.Contains(TEXT("bisingen")) || ActorName.Contains(TEXT("Cesium")) || ActorName.Contains(TEXT("Tileset")))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🚀 Found potential Cesium tileset: %s"), *ActorName);
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🚀 Found potential Cesium tileset: %s"), *ActorName);
 				TilesetCount++;
 				
 				// Apply styling
@@ -7524,25 +7982,25 @@ void ABuildingEnergyDisplay::ForceApplyColors()
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🚀 Found %d potential Cesium tilesets"), TilesetCount);
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 Found %d potential Cesium tilesets"), TilesetCount);
 	
 	if (TilesetCount == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("🚀 No Cesium tilesets found! Available actors:"));
+		UE_LOG(LogBuildingEnergyStyle, Error, TEXT("🚀 No Cesium tilesets found! Available actors:"));
 		int32 ActorCount = 0;
 		for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
 		{
 			AActor* Actor = *ActorItr;
 			if (Actor && ++ActorCount <= 10) // Show first 10 actors
 			{
-				UE_LOG(LogTemp, Warning, TEXT("🚀   Actor[%d]: %s"), ActorCount, *Actor->GetName());
+				UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("🚀   Actor[%d]: %s"), ActorCount, *Actor->GetName());
 			}
 		}
 		if (ActorCount > 10)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("🚀   ... and %d more actors"), ActorCount - 10);
+			UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀   ... and %d more actors"), ActorCount - 10);
 		}
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("🚀 ===================================="));
+	UE_LOG(LogBuildingEnergyStyle, Log, TEXT("🚀 ===================================="));
 }
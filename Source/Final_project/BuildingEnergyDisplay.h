@@ -14,12 +14,19 @@
 #include "Engine/GameViewportClient.h"
 #include "WebSocketsModule.h"
 #include "IWebSocket.h"
+#include "BuildingStore.h"
+#include "BuildingStyleState.h"
+#include "BuildingEnergyPatch.h"
+#include "BuildingChunkCache.h"
 #include "BuildingEnergyDisplay.generated.h"
 
 // Forward declarations for UMG widgets
 class UUserWidget;
 class UTextBlock;
 class ACesium3DTileset;
+class UTexture2D;
+struct FBuildingEnergyRecord;
+struct FBuildingIngestResult;
 
 USTRUCT(BlueprintType)
 struct FBuildingBoundingBox
@@ -51,12 +58,18 @@ UCLASS(Blueprintable)
 class FINAL_PROJECT_API ABuildingEnergyDisplay : public AActor
 {
 	GENERATED_BODY()
-	
+
+	// Drives ingest, change detection and the update queue headless
+	friend class UBuildingEnergyBenchmarkCommandlet;
+	// Shared by the BuildingEnergy.* automation tests (BuildingEnergyTestAccess.h)
+	friend struct FBuildingEnergyTestAccess;
+
 public:
 	ABuildingEnergyDisplay();
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -79,6 +92,102 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Cesium")
 	TArray<FString> CandidateGmlIdPropertyKeys;
 
+	// Tileset material that colors buildings from the lookup textures (e.g. one built on ML_Cesium3DTileset_3_FeaturesMetadata).
+	// Per pixel it reads the feature's numeric "id" property (encoded through the tileset's features metadata component), then
+	//   texel id of BuildingFeatureIndexLUT  -> building index + 1 as R + 256 G + 65536 B (0: unknown feature)
+	//   texel index of BuildingColorLUT      -> sRGB color, alpha 0 when the building has none
+	// with texel n at (n % width, n / width); the widths come as BuildingFeatureIndexLUTWidth and BuildingColorLUTWidth.
+	// When unset the tileset keeps its material: any other material ignores the textures, and replacing it reloads every tile.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Cesium")
+	UMaterialInterface* BuildingColorLutBaseMaterial = nullptr;
+
+	// ================= REAL-TIME DELTA SYNC =================
+	// Once the server hands out a change cursor, real-time polls only request buildings changed since it.
+	// Responses without a cursor keep polling the full community.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Real-Time")
+	bool bUseDeltaSync = true;
+
+	// Query parameter that carries the cursor (a server change token or timestamp)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Real-Time")
+	FString DeltaSyncQueryParameter = TEXT("changed_since");
+
+	// Response header holding the cursor for the next poll
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Real-Time")
+	FString DeltaSyncCursorHeader = TEXT("X-Change-Cursor");
+
+	// Push mode: WebSocket that streams binary patch frames (see FBuildingPatchCodec).
+	// Empty keeps the REST polling fallback; REST real-time polls pause while the push socket is connected.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Real-Time")
+	FString EnergyWebSocketURL;
+
+	// Upper bound of the exponential reconnect backoff, in seconds
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Real-Time", meta=(ClampMin="1.0"))
+	float PushReconnectMaxInterval = 60.0f;
+
+	// Game thread time per frame for applying queued building changes, in milliseconds.
+	// Changes from polls and push frames are coalesced per building and restyled once the queue drains.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Real-Time", meta=(ClampMin="0.1"))
+	float UpdateFrameBudgetMs = 2.0f;
+
+	// ================= TOKEN LIFETIME =================
+	// The access token is refreshed this many seconds before the exp claim of the JWT, so polls never run into an expired token.
+	// Requests that still get a 401 are parked by the API broker and replayed with the new token.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Authentication", meta=(ClampMin="0.0"))
+	float TokenRefreshLeadTime = 60.0f;
+
+	// ================= VIEWPORT LOADING =================
+	// Instead of downloading the whole community, PreloadAllBuildingData starts loading the geographic tiles
+	// (Cesium's tiling scheme) around the camera; the display store is rebuilt from the chunks in an LRU cache.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Viewport Loading")
+	bool bLoadByViewport = false;
+
+	// Tile level of a chunk; 14 is about 1.2 km north-south
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Viewport Loading", meta=(ClampMin="8", ClampMax="18"))
+	int32 ViewportChunkLevel = 14;
+
+	// Chunks within this distance of the camera (or its height, when higher) are loaded, in meters
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Viewport Loading", meta=(ClampMin="100.0"))
+	float ViewportLoadRadius = 2000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Viewport Loading", meta=(ClampMin="1"))
+	int32 MaxCachedChunks = 64;
+
+	// Record memory of the cached chunks; 0 limits by chunk count only
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Viewport Loading", meta=(ClampMin="0.0"))
+	float ChunkCacheBudgetMB = 256.0f;
+
+	// Query parameter that restricts the buildings-energy list to west,south,east,north in degrees
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Viewport Loading")
+	FString ChunkBoundsQueryParameter = TEXT("bbox");
+
+	// ================= COMMUNITIES =================
+	// Communities loaded by PreloadAllBuildingData. Each one is a shard: requested in parallel, parsed on its own
+	// worker and merged into the display store, so a single community can be refreshed without reloading the rest.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Communities")
+	TArray<FString> CommunityIds = { TEXT("08417008") };
+
+	// ================= PAGINATED PRELOAD =================
+	// Buildings per preload page; 0 requests each community in one response (a "next" link sent anyway is still followed).
+	// Each page is parsed on a worker as it arrives and its buildings are colored right away; the complete store
+	// with geometry is published once every page of every community is in.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Communities", meta=(ClampMin="0"))
+	int32 PreloadPageSize = 0;
+
+	// Page requests of one community on the wire at once, once the first page's "count" tells how many there are.
+	// Without a count, pages follow the "next" link one after another.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Communities", meta=(ClampMin="1", ClampMax="16"))
+	int32 MaxPreloadPagesInFlight = 4;
+
+	// Query parameter that selects a page: the 1-based page number, or the record offset with bPreloadPageByOffset
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Communities")
+	FString PreloadPageQueryParameter = TEXT("page");
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Communities")
+	FString PreloadPageSizeQueryParameter = TEXT("page_size");
+
+	// Limit/offset pagination (e.g. "offset" and "limit" as the two parameters above)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Building Energy|Communities")
+	bool bPreloadPageByOffset = false;
 
 	UPROPERTY(BlueprintReadWrite, Category = "Building Energy")
 	FString AccessToken;
@@ -100,6 +209,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Building Energy")
 	void RefreshBuildingCache();
 
+	// Reloads one shard and merges it with the other communities' last loaded data
+	UFUNCTION(BlueprintCallable, Category = "Building Energy|Communities")
+	void RefreshCommunity(const FString& CommunityId);
+
+	// Community whose shard holds the building; the first configured community when it is not loaded
+	UFUNCTION(BlueprintCallable, Category = "Building Energy|Communities")
+	FString GetCommunityOfBuilding(const FString& GmlId) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Building Energy")
 	void AuthenticateAndLoadData();
 	
@@ -230,6 +347,8 @@ public:
 	void OnEnergyWebSocketConnectionError(const FString& Error);
 	void OnEnergyWebSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
 	void OnEnergyWebSocketMessage(const FString& Message);
+	void OnEnergyWebSocketBinaryMessage(const void* Data, SIZE_T Size, bool bIsLastFragment);
+	void ApplyPushFrame(const FBuildingPatchFrame& Frame);
 	void ProcessEnergyWebSocketUpdate(const FString& JsonData);
 	
 	// Coordinate-Based Building Validation Functions
@@ -239,9 +358,13 @@ public:
 	FBuildingBoundingBox CreateBuildingBoundingBox(const FString& GmlId);
 	bool IsPointInBoundingBox(const FVector& Point, const FBuildingBoundingBox& BoundingBox);
 	bool IsPointInBuildingBounds(const FVector& Point, const FString& BuildingCoordinates);
-	bool ParseBuildingCoordinates(const FString& CoordinatesString, TArray<FVector>& OutCoordinates);
-	bool IsPointInPolygon(const FVector& Point, const TArray<FVector>& PolygonVertices);
+	static bool ParseBuildingCoordinates(const FString& CoordinatesString, TArray<FVector>& OutCoordinates);
+	bool IsPointInPolygon(const FVector& Point, TArrayView<const FVector> PolygonVertices);
 	FString GetBuildingByCoordinates(const FVector& ClickPosition);
+
+	// Drag-select: modified ids of buildings with a polygon whose XY bounds overlap the rectangle spanned by the corners
+	UFUNCTION(BlueprintCallable, Category = "Coordinate Validation")
+	TArray<FString> GetBuildingsInArea(const FVector& CornerA, const FVector& CornerB);
 	void StoreBuildingCoordinates(const FString& GmlId, const FString& CoordinatesData);
 	
 	void TestBuildingAttributesAPI();
@@ -311,12 +434,19 @@ public:
 	// New Cesium styling functions
 	void ApplyCesiumTilesetStyling(AActor* CesiumActor);
 	void ApplyFallbackMaterialStyling(AActor* CesiumActor);
-	bool ApplyCesiumStyleJsonToTileset(ACesium3DTileset* Tileset, const FString& StyleJson) const;
+	bool ApplyCesiumStyleJsonToTileset(ACesium3DTileset* Tileset, const FString& StyleJson);
 	TArray<FString> MakeIdVariants(const FString& InId) const;
-	void ApplyColorLookupMaterialToTileset(ACesium3DTileset* Tileset) const;
+	// False when the tileset was left alone: no LUT-aware BuildingColorLutBaseMaterial or no colors yet
+	bool ApplyColorLookupMaterialToTileset(ACesium3DTileset* Tileset);
+
+	// Uploads building colors to BuildingColorLut; only the rows of recolored buildings when possible
+	void UpdateBuildingColorLut();
+
+	// Uploads the feature key -> building index map whenever the store's feature keys changed
+	void UpdateBuildingFeatureIndexLut();
 
 private:
-	FLinearColor ConvertHexToLinearColor(const FString& HexColor);
+	static FLinearColor ConvertHexToLinearColor(const FString& HexColor);
 
 	FString ConvertGmlIdToBuildingKey(const FString& GmlId);
 	
@@ -324,7 +454,7 @@ private:
 
 	void OnResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
-	void OnPreloadResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+	void OnPreloadResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FString CommunityId, uint32 LoadGeneration, int32 PageIndex);
 
 	void OnAuthResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 	
@@ -334,7 +464,84 @@ private:
 	void FetchUpdatedEnergyData(); // Fetch fresh energy data using REST API
 	void OnEnergyUpdateResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
-	void ParseAndCacheAllBuildings(const FString& JsonResponse);
+	// Parses on a background task and publishes the result on the game thread.
+	// bIsFullPreload marks a complete community response, which also refreshes the warm start snapshot.
+	void ParseAndCacheAllBuildings(FString JsonResponse, bool bIsFullPreload = false);
+	// Same, from the UTF-8 response bytes - the path the paged preload takes, without a UTF-16 copy of the body
+	void ParseAndCacheAllBuildings(TArray<uint8> Utf8Json, bool bIsFullPreload = false);
+	// Shared by both overloads: runs ReadBuildings (the stream reader over the moved-in body) on a worker
+	void LaunchIngest(TUniqueFunction<bool(TFunctionRef<void(FBuildingEnergyRecord&)>, FString*)>&& ReadBuildings, bool bIsFullPreload);
+
+	// Warm start: loads the last preload from Saved/BuildingEnergy/ on a background task
+	void LoadBuildingSnapshot();
+
+	// Adds one streamed building to a store; returns false when it has no usable energy data.
+	// Called from the ingest worker, so it must not touch actor state.
+	static bool CacheBuildingRecord(FBuildingStore& Store, const FBuildingEnergyRecord& Record);
+
+	// Energy values and end color of a complete record as a store patch; false when the record lacks begin/end.
+	// A record without an end color gets the #66b032 fallback only with bFallbackColor, otherwise its patch leaves the color alone
+	static bool MakeBuildingPatch(FBuildingStore& Store, int32 BuildingIndex, const FBuildingEnergyRecord& Record, FBuildingPatch& OutPatch, bool bFallbackColor = true);
+
+	// True when a patch would write a value or color the store does not hold yet
+	static bool PatchChangesStore(const FBuildingStore& Store, const FBuildingPatch& Patch);
+
+	// Swaps a finished store into the actor; bDataLoaded flips only after the swap
+	void PublishBuildingStore(FBuildingIngestResult&& Result);
+
+	// Refreshes the `stat BuildingEnergy` memory and count stats; walks every store, so only called when they change
+	void UpdateMemoryStats();
+
+	// Incremented per ingest so results from superseded parses are dropped
+	uint32 IngestGeneration = 0;
+
+	// === Viewport chunk loading ===
+	FBuildingChunkCache ChunkCache;
+	TSet<FBuildingChunkKey> PendingChunks; // Requested, not yet cached
+	float ViewportChunkTimer = 0.0f;
+	bool bChunkStoreDirty = false; // Cached chunks changed since the store was last rebuilt
+	bool bChunkLimitWarned = false;
+	void UpdateViewportChunks();
+	void RequestChunk(const FBuildingChunkKey& Key);
+	void OnChunkResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FBuildingChunkKey Key);
+	void RebuildChunkStore(); // Ingests the resident chunks into a new store on a worker
+
+	// === Community shards ===
+	struct FCommunityShard
+	{
+		TSharedPtr<FBuildingStore> Store; // Last loaded data; handed to the display store when there is only one community
+		uint32 Generation = 0; // Incremented per load so pages of an older load are dropped
+		bool bRequestPending = false; // Pages left to request or answer
+
+		// === Load in progress ===
+		TArray<TSharedPtr<FBuildingStore>> Pages; // Parsed pages in page order, null while pending or empty
+		int32 NumPages = 1; // The first page's "count" tells the rest
+		int32 NumPagesRequested = 0;
+		int32 NumPagesInFlight = 0;
+		int32 NumPagesParsing = 0;
+		int32 FirstPageSize = 0; // Entries per page, from page_size or the first page's results; the stride of offset pagination
+		FString NextPageUrl; // Cursor pagination: "next" of the last page read
+		bool bLoadFailed = false; // A page failed; the shard keeps its last data
+		bool bCombiningPages = false;
+
+		bool IsLoading() const { return bRequestPending || NumPagesParsing > 0 || bCombiningPages; }
+	};
+	TMap<FString, FCommunityShard> CommunityShards;
+	bool bCommunityShardsChanged = false; // A shard was loaded since the last merge
+	int32 NumCommunityMergesPending = 0; // Workers reading the shard stores; polls leave the stores alone meanwhile
+	void RequestCommunityShard(const FString& CommunityId);
+	void RequestCommunityPage(const FString& CommunityId, const FString& URL);
+	FString MakeCommunityPageUrl(const FString& CommunityId, int32 PageIndex, int32 PageStride) const;
+	void IngestCommunityPage(const FString& CommunityId, uint32 LoadGeneration, int32 PageIndex, FHttpResponsePtr Response);
+	void PumpCommunityPages(const FString& CommunityId); // Requests the next pages and combines them once the last is parsed
+	void MergeCommunityShards(); // Once no shard is loading, merges them into a new display store on a worker
+	const FString& GetPrimaryCommunityId() const;
+	FString GetCommunitySetKey() const; // Names the snapshot file of the configured communities
+
+	// Snapshot hash of the published store and its color map hash at that time; a preload that
+	// brings back the same content while no live update recolored anything is not swapped in
+	uint64 PublishedContentHash = 0;
+	uint64 PublishedColorMapHash = 0;
 	
 	void OnGetBuildingAttributesResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
@@ -342,14 +549,50 @@ private:
 	
 	void OnRealTimeEnergyDataResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
 
-	TMap<FString, FString> BuildingDataCache;
-	
-	TMap<FString, FLinearColor> BuildingColorCache;
+	// Every loaded building: ids, energy values, colors and geometry addressed by one dense index
+	FBuildingStore BuildingStore;
+
+	// Cached style arms and the color map hash last applied to each tileset
+	FBuildingStyleState BuildingStyleState;
+
+	// === Buildings tileset ===
+	// The ACesium3DTileset whose name contains BuildingsTilesetName, or the only tileset in the world.
+	// Resolved once and held weakly; the world is only rescanned after a spawn or level streaming event.
+	ACesium3DTileset* GetBuildingsTileset();
+	bool IsBuildingsTileset(const ACesium3DTileset* Tileset) const;
+	void InvalidateBuildingsTileset();
+	void OnWorldActorSpawned(AActor* SpawnedActor);
+	void OnLevelStreamingChanged(ULevel* Level, UWorld* World);
+
+	TWeakObjectPtr<ACesium3DTileset> CachedBuildingsTileset;
+	FString CachedBuildingsTilesetName; // BuildingsTilesetName the cache was resolved for
+	bool bBuildingsTilesetResolved = false; // A miss is not rescanned until this is cleared
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	// === Color lookup texture ===
+	// Texel (Index % Width, Index / Width) holds the sRGB color of building Index, alpha 0 when it has none
+	static constexpr int32 BuildingColorLutWidth = 1024;
+
+	UPROPERTY(Transient)
+	UTexture2D* BuildingColorLut = nullptr;
+
+	// One instance shared by every tileset so a recolor never creates materials
+	UPROPERTY(Transient)
+	UMaterialInstanceDynamic* BuildingColorLutMaterial = nullptr;
 
-	// NEW: Store full JSON objects for color extraction
-	TMap<FString, TSharedPtr<FJsonObject>> BuildingJsonCache;
+	TArray<FColor> BuildingColorLutPixels; // CPU copy of the whole texture
+	FBuildingStore::FColorChangeCursor BuildingColorLutCursor;
 
-	TMap<FString, FString> GmlIdCache;
+	// Texel (Key % Width, Key / Width) holds building index + 1 of tileset feature key Key, 0 when unknown.
+	// Keys above MaxLutFeatureId do not fit a texture and leave their features uncolored
+	static constexpr int32 MaxLutFeatureId = BuildingColorLutWidth * 16384 - 1;
+
+	UPROPERTY(Transient)
+	UTexture2D* BuildingFeatureIndexLut = nullptr;
+
+	uint32 BuildingFeatureIndexLutRevision = 0; // FBuildingStore::GetFeatureIdRevision of the uploaded map
 	
 	FString CurrentRequestedBuildingKey;
 	FString CurrentRequestedCommunityId;
@@ -358,6 +601,10 @@ private:
 
 	bool bIsLoading;
 	
+	// Set while the request is with the API broker; its response handler always runs and clears it
+	bool bPreloadRequestPending = false;
+	bool bAuthRequestPending = false;
+	
 	float RealTimeMonitoringTimer = 0.0f;
 	float RealTimeUpdateInterval = 2.0f;
 	
@@ -369,28 +616,59 @@ private:
 	// WebSocket Real-Time Energy Variables
 	TSharedPtr<IWebSocket> EnergyWebSocket;
 	bool bEnergyWebSocketConnected = false;
-	FString EnergyWebSocketURL;
 	float WebSocketReconnectTimer = 0.0f;
-	float WebSocketReconnectInterval = 5.0f;
+	float WebSocketReconnectInterval = 5.0f; // Polling interval, and the first push reconnect delay
 	bool bAutoReconnectWebSocket = true;
+	
+	// Push mode state
+	bool bEnergyWebSocketConnecting = false;
+	float PushReconnectBackoff = 0.0f; // Doubles per failed attempt up to PushReconnectMaxInterval, 0 after a connect
+	float PushReconnectDelay = 0.0f; // Backoff with jitter for the next attempt
+	TArray<uint8> PushFrameBuffer; // Fragments of the binary frame being received
+	TMap<uint16, FColor> PushPalette; // Server color class -> sRGB, mapped into the current store when patches arrive
+	uint64 LastPushSequence = 0;
+	bool bPushSequenceKnown = false;
+	bool bPushResyncPending = false; // Next Tick polls REST once even though push is connected
+	uint64 PushSubscribedIdOrderHash = 0; // Store id order hash sent with the last subscription
+	void SendPushSubscription();
+	bool IsPushModeConnected() const { return bEnergyWebSocketConnected && !EnergyWebSocketURL.IsEmpty(); }
+	void ReleaseEnergyWebSocket();
+	
+	// === Building update queue ===
+	TMap<int32, FBuildingPatch> PendingBuildingPatches; // Store patches coalesced per building, applied under UpdateFrameBudgetMs
+	TArray<int32> PendingAppliedIndices; // Applied but not yet restyled
+	void QueueBuildingPatch(const FBuildingPatch& Patch);
+	void ProcessPendingBuildingUpdates();
+	void SchedulePushReconnect();
+	void RequestPushResync(const TCHAR* Reason);
 	bool bAuthenticationMessageShown = false; // Flag to prevent authentication spam
 	int32 EnergyUpdateCounter = 0;
 	
 	// Token Management Variables
 	FString RefreshToken; // Store refresh token for automatic token renewal
+	float TokenRefreshCountdown = -1.0f; // Seconds until the proactive refresh, negative when none is scheduled
+	bool bTokenRefreshPending = false; // Refresh request with the API broker
+	void ApplyAccessToken(const FString& NewToken); // Adopt a new access token everywhere and schedule its refresh
+	void OnApiTokenRejected(); // The API broker parked a request on 401
+	static bool DecodeTokenExpiry(const FString& Jwt, int64& OutUnixExpiry); // exp claim of a JWT
 	
 	// Coordinate-Based Building Validation Variables
-	TMap<FString, TArray<FVector>> BuildingCoordinatesCache; // Cache of building coordinates for validation
-	TMap<FString, FString> CoordinateToGmlIdMap; // Map coordinates to correct gml_id
 	float CoordinateValidationTolerance = 10.0f; // Tolerance for coordinate matching in meters
 	int32 SlowDownThreshold = 10;
 	
-	TMap<FString, FString> PreviousBuildingDataSnapshot;
-	TMap<FString, FLinearColor> PreviousColorSnapshot;
-	
 	bool bRealTimeMonitoringEnabled = true;
 	bool bIsPerformingRealTimeUpdate = false;
 	
+	// === Delta sync ===
+	TMap<FString, FString> DeltaSyncCursors; // Per community; missing until the server hands one out, and after it rejects one
+	bool bRealTimeRequestUsedCursor = false; // The poll in flight asked for changes since its community's cursor
+	FString RealTimeRequestCommunityId; // Community of the poll in flight
+	uint32 RealTimeRequestChunkRebuild = 0; // NumChunkStoreRebuilds when the poll in flight was sent
+	int32 NextRealTimeCommunity = 0; // Polls visit the communities round-robin
+	TSet<FString> FullResyncCommunities; // Polled without cursor or validators until a full response was applied
+	uint32 NumChunkStoreRebuilds = 0; // Viewport stores published from cached chunk records
+	void ResetDeltaSync(const FString& CommunityId, const TCHAR* Reason);
+	
 	UFUNCTION(BlueprintCallable, Category = "Real-Time")
 	void StartRealTimeMonitoring();
 	
@@ -404,8 +682,9 @@ private:
 	void EnableEnhancedPolling(bool bEnable);
 	
 	void PerformRealTimeDataCheck();
+	void PollRealTimeCommunity(const FString& CommunityId);
 	void OnRealTimeDataResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
-	void DetectAndApplyChanges(const FString& NewJsonData);
+	bool DetectAndApplyChanges(const FString& NewJsonData, const FString& CommunityId = FString()); // False when the response could not be parsed
 	void NotifyRealTimeChanges(const TArray<FString>& ChangedBuildings);
 	void UpdatePollingStrategy(bool bChangesDetected);
 	
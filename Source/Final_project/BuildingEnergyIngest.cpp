@@ -0,0 +1,556 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingEnergyIngest.h"
+#include "Containers/StringView.h"
+#include "Hash/CityHash.h"
+#include "Serialization/JsonReader.h"
+
+namespace BuildingEnergyIngest
+{
+	// Every reader is a template over the character type, so UTF-8 response bytes parse without a UTF-16 copy
+	// Skips the value whose opening token was just read
+	template <typename CharType>
+	static bool SkipValue(TJsonReader<CharType>& Reader, EJsonNotation Notation)
+	{
+		switch (Notation)
+		{
+		case EJsonNotation::ObjectStart:
+			return Reader.SkipObject();
+		case EJsonNotation::ArrayStart:
+			return Reader.SkipArray();
+		case EJsonNotation::Error:
+			return false;
+		default:
+			return true; // Scalars are fully consumed by ReadNext
+		}
+	}
+
+	// Reads { "value": N } or { "value": "N" } - a null or non-numeric value leaves the field unset
+	template <typename CharType>
+	static bool ReadValueObject(TJsonReader<CharType>& Reader, TOptional<int32>& OutValue)
+	{
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return true;
+			}
+			if (Notation == EJsonNotation::Number && Reader.GetIdentifier() == TEXT("value"))
+			{
+				OutValue = static_cast<int32>(Reader.GetValueAsNumber());
+			}
+			else if (Notation == EJsonNotation::String && Reader.GetIdentifier() == TEXT("value"))
+			{
+				// Some backends serialize decimals as strings; parse like a number so "812.6" still reads as 812
+				const FString& Text = Reader.GetValueAsString();
+				double Parsed = 0.0;
+				if (!Text.IsEmpty() && LexTryParseString(Parsed, *Text))
+				{
+					OutValue = static_cast<int32>(Parsed);
+				}
+			}
+			else if (!SkipValue(Reader, Notation))
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	// Reads { "energy_demand_specific_color": "#hex", ... }
+	template <typename CharType>
+	static bool ReadColorObject(TJsonReader<CharType>& Reader, FString& OutColor)
+	{
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return true;
+			}
+			if (Notation == EJsonNotation::String && Reader.GetIdentifier() == TEXT("energy_demand_specific_color"))
+			{
+				OutColor = Reader.GetValueAsString();
+			}
+			else if (!SkipValue(Reader, Notation))
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	// Reads the members of a phase "result" object (or of the phase itself when "result" is missing)
+	template <typename CharType>
+	static bool ReadResultMember(TJsonReader<CharType>& Reader, EJsonNotation Notation, FBuildingEnergyPhase& OutValues, FString& OutColor)
+	{
+		if (Notation == EJsonNotation::ObjectStart)
+		{
+			const FString& Key = Reader.GetIdentifier();
+			if (Key == TEXT("energy_demand_specific"))
+			{
+				return ReadValueObject(Reader, OutValues.EnergyDemandSpecific);
+			}
+			if (Key == TEXT("co2_from_energy_demand"))
+			{
+				return ReadValueObject(Reader, OutValues.CO2FromEnergyDemand);
+			}
+			if (Key == TEXT("color"))
+			{
+				return ReadColorObject(Reader, OutColor);
+			}
+		}
+		return SkipValue(Reader, Notation);
+	}
+
+	template <typename CharType>
+	static bool ReadResultObject(TJsonReader<CharType>& Reader, FBuildingEnergyPhase& OutValues, FString& OutColor)
+	{
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return true;
+			}
+			if (!ReadResultMember(Reader, Notation, OutValues, OutColor))
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	// Reads a "begin"/"end" object. Values come from its "result" object, falling back to the
+	// phase object itself; the color comes from the phase "color", falling back to "result.color".
+	template <typename CharType>
+	static bool ReadPhaseObject(TJsonReader<CharType>& Reader, FBuildingEnergyPhase& OutPhase)
+	{
+		FBuildingEnergyPhase ResultValues;
+		FBuildingEnergyPhase DirectValues;
+		FString ResultColor;
+		FString PhaseColor;
+		bool bHasResult = false;
+
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				OutPhase = bHasResult ? ResultValues : DirectValues;
+				OutPhase.EnergyDemandSpecificColor = !PhaseColor.IsEmpty() ? PhaseColor : ResultColor;
+				return true;
+			}
+
+			bool bOk = true;
+			if (Notation == EJsonNotation::ObjectStart && Reader.GetIdentifier() == TEXT("result"))
+			{
+				bHasResult = true;
+				bOk = ReadResultObject(Reader, ResultValues, ResultColor);
+			}
+			else if (Notation == EJsonNotation::ObjectStart && Reader.GetIdentifier() == TEXT("color"))
+			{
+				bOk = ReadColorObject(Reader, PhaseColor);
+			}
+			else
+			{
+				FString IgnoredColor;
+				bOk = ReadResultMember(Reader, Notation, DirectValues, IgnoredColor);
+			}
+
+			if (!bOk)
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	// Reads energy_result: "begin"/"end" are preferred over "before"/"after"
+	template <typename CharType>
+	static bool ReadEnergyResultObject(TJsonReader<CharType>& Reader, FBuildingEnergyRecord& Record)
+	{
+		bool bBeginFromPrimary = false;
+		bool bEndFromPrimary = false;
+
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return true;
+			}
+
+			bool bOk = true;
+			if (Notation == EJsonNotation::ObjectStart)
+			{
+				const FString& Key = Reader.GetIdentifier();
+				const bool bIsBegin = Key == TEXT("begin");
+				const bool bIsEnd = Key == TEXT("end");
+
+				if (bIsBegin || (Key == TEXT("before") && !bBeginFromPrimary))
+				{
+					bOk = ReadPhaseObject(Reader, Record.Begin);
+					Record.bHasBegin = true;
+					bBeginFromPrimary |= bIsBegin;
+				}
+				else if (bIsEnd || (Key == TEXT("after") && !bEndFromPrimary))
+				{
+					bOk = ReadPhaseObject(Reader, Record.End);
+					Record.bHasEnd = true;
+					bEndFromPrimary |= bIsEnd;
+				}
+				else
+				{
+					bOk = Reader.SkipObject();
+				}
+			}
+			else
+			{
+				bOk = SkipValue(Reader, Notation);
+			}
+
+			if (!bOk)
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	// Collects every innermost [x, y(, z)] array below the array that was just opened.
+	// Handles Polygon, MultiPolygon and plain point lists the same way; every array that
+	// directly holds points closes a ring, whose end offset is appended to OutRingEnds.
+	template <typename CharType>
+	static bool ReadCoordinateArray(TJsonReader<CharType>& Reader, TArray<FVector>& OutPoints, TArray<int32>& OutRingEnds, bool& bOutIsPoint)
+	{
+		double Components[3] = { 0.0, 0.0, 0.0 };
+		int32 NumComponents = 0;
+		bool bHoldsPoints = false;
+
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			switch (Notation)
+			{
+			case EJsonNotation::ArrayEnd:
+				bOutIsPoint = NumComponents >= 2;
+				if (bOutIsPoint)
+				{
+					OutPoints.Emplace(Components[0], Components[1], NumComponents > 2 ? Components[2] : 0.0);
+				}
+				else if (bHoldsPoints)
+				{
+					OutRingEnds.Add(OutPoints.Num());
+				}
+				return true;
+			case EJsonNotation::ArrayStart:
+			{
+				bool bChildIsPoint = false;
+				if (!ReadCoordinateArray(Reader, OutPoints, OutRingEnds, bChildIsPoint))
+				{
+					return false;
+				}
+				bHoldsPoints |= bChildIsPoint;
+				break;
+			}
+			case EJsonNotation::Number:
+				if (NumComponents < 3)
+				{
+					Components[NumComponents] = Reader.GetValueAsNumber();
+				}
+				++NumComponents;
+				break;
+			default:
+				if (!SkipValue(Reader, Notation))
+				{
+					return false;
+				}
+				break;
+			}
+		}
+		return false;
+	}
+
+	template <typename CharType>
+	static bool ReadCoordinateArray(TJsonReader<CharType>& Reader, FBuildingEnergyRecord& Record)
+	{
+		bool bIsPoint = false;
+		return ReadCoordinateArray(Reader, Record.Coordinates, Record.RingEnds, bIsPoint);
+	}
+
+	// Reads a GeoJSON geometry object ("coordinates", or "geometries" for collections)
+	template <typename CharType>
+	static bool ReadGeometryObject(TJsonReader<CharType>& Reader, FBuildingEnergyRecord& Record)
+	{
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return true;
+			}
+
+			bool bOk = true;
+			if (Notation == EJsonNotation::ArrayStart && Reader.GetIdentifier() == TEXT("coordinates"))
+			{
+				bOk = ReadCoordinateArray(Reader, Record);
+			}
+			else if (Notation == EJsonNotation::ArrayStart && Reader.GetIdentifier() == TEXT("geometries"))
+			{
+				while (bOk && Reader.ReadNext(Notation) && Notation != EJsonNotation::ArrayEnd)
+				{
+					bOk = Notation == EJsonNotation::ObjectStart ? ReadGeometryObject(Reader, Record) : SkipValue(Reader, Notation);
+				}
+				bOk = bOk && Notation == EJsonNotation::ArrayEnd;
+			}
+			else
+			{
+				bOk = SkipValue(Reader, Notation);
+			}
+
+			if (!bOk)
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	template <typename CharType>
+	static bool ReadBuildingObject(TJsonReader<CharType>& Reader, FBuildingEnergyRecord& Record)
+	{
+		// energy_result is preferred over energy_data, which is preferred over result
+		int32 EnergySourceRank = MAX_int32;
+		FString CoordinatesString;
+		FString PositionString;
+
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				// Geometry priority matches the DOM parser: "coordinates" string, then "geom", then "position"
+				if (!CoordinatesString.IsEmpty())
+				{
+					Record.Coordinates.Reset();
+					Record.RingEnds.Reset();
+					Record.CoordinatesText = MoveTemp(CoordinatesString);
+				}
+				else if (Record.Coordinates.Num() == 0 && !PositionString.IsEmpty())
+				{
+					Record.CoordinatesText = MoveTemp(PositionString);
+				}
+				return true;
+			}
+
+			const FString& Key = Reader.GetIdentifier();
+			bool bOk = true;
+
+			switch (Notation)
+			{
+			case EJsonNotation::String:
+				if (Key == TEXT("modified_gml_id"))
+				{
+					Record.ModifiedGmlId = Reader.GetValueAsString(); // CASE SENSITIVE: 'G' != 'g'
+				}
+				else if (Key == TEXT("gml_id"))
+				{
+					Record.ActualGmlId = Reader.GetValueAsString(); // CASE SENSITIVE: 'G' != 'g'
+				}
+				else if (Key == TEXT("coordinates"))
+				{
+					CoordinatesString = Reader.GetValueAsString();
+				}
+				else if (Key == TEXT("position"))
+				{
+					PositionString = Reader.GetValueAsString();
+				}
+				break;
+
+			case EJsonNotation::Number:
+				if (Key == TEXT("id"))
+				{
+					Record.NumericId = static_cast<int32>(Reader.GetValueAsNumber());
+				}
+				break;
+
+			case EJsonNotation::ObjectStart:
+			{
+				const int32 Rank = Key == TEXT("energy_result") ? 0 : Key == TEXT("energy_data") ? 1 : Key == TEXT("result") ? 2 : INDEX_NONE;
+				if (Rank != INDEX_NONE && Rank < EnergySourceRank)
+				{
+					EnergySourceRank = Rank;
+					Record.bHasEnergyResult = true;
+					Record.bHasBegin = false;
+					Record.bHasEnd = false;
+					Record.Begin = FBuildingEnergyPhase();
+					Record.End = FBuildingEnergyPhase();
+					bOk = ReadEnergyResultObject(Reader, Record);
+				}
+				else if (Key == TEXT("geom"))
+				{
+					bOk = ReadGeometryObject(Reader, Record);
+				}
+				else
+				{
+					bOk = Reader.SkipObject();
+				}
+				break;
+			}
+
+			case EJsonNotation::ArrayStart:
+				if (Key == TEXT("coordinates"))
+				{
+					bOk = ReadCoordinateArray(Reader, Record);
+				}
+				else
+				{
+					bOk = Reader.SkipArray();
+				}
+				break;
+
+			default:
+				bOk = SkipValue(Reader, Notation);
+				break;
+			}
+
+			if (!bOk)
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	template <typename CharType>
+	static bool ReadBuildingArray(TJsonReader<CharType>& Reader, TFunctionRef<void(FBuildingEnergyRecord&)> OnBuilding, int32* OutNumEntries = nullptr)
+	{
+		FBuildingEnergyRecord Record;
+
+		EJsonNotation Notation;
+		while (Reader.ReadNext(Notation))
+		{
+			if (Notation == EJsonNotation::ArrayEnd)
+			{
+				return true;
+			}
+			if (OutNumEntries)
+			{
+				++*OutNumEntries;
+			}
+
+			if (Notation == EJsonNotation::ObjectStart)
+			{
+				Record.Reset();
+				if (!ReadBuildingObject(Reader, Record))
+				{
+					return false;
+				}
+				if (!Record.ModifiedGmlId.IsEmpty())
+				{
+					OnBuilding(Record);
+				}
+			}
+			else if (!SkipValue(Reader, Notation))
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	// Accepts a top-level array of buildings or a { "count", "next", "results" } envelope
+	template <typename CharType>
+	static bool ReadResponse(TJsonReader<CharType>& Reader, TFunctionRef<void(FBuildingEnergyRecord&)> OnBuilding, FString* OutError, FBuildingPageInfo* OutPageInfo)
+	{
+		EJsonNotation Notation;
+		bool bOk = Reader.ReadNext(Notation);
+
+		if (bOk && Notation == EJsonNotation::ArrayStart)
+		{
+			bOk = ReadBuildingArray(Reader, OnBuilding);
+		}
+		else if (bOk && Notation == EJsonNotation::ObjectStart)
+		{
+			// Envelope form used by the real-time endpoint and paginated lists: { "count": n, "next": url, "results": [ ... ] }
+			bool bFoundResults = false;
+			while (bOk && Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+			{
+				if (Notation == EJsonNotation::ArrayStart && Reader.GetIdentifier() == TEXT("results"))
+				{
+					bOk = ReadBuildingArray(Reader, OnBuilding, OutPageInfo ? &OutPageInfo->NumResults : nullptr);
+					bFoundResults = true;
+				}
+				else if (OutPageInfo && Notation == EJsonNotation::Number && Reader.GetIdentifier() == TEXT("count"))
+				{
+					OutPageInfo->TotalCount = static_cast<int32>(Reader.GetValueAsNumber());
+				}
+				else if (OutPageInfo && Notation == EJsonNotation::String && Reader.GetIdentifier() == TEXT("next"))
+				{
+					OutPageInfo->Next = Reader.GetValueAsString();
+				}
+				else
+				{
+					bOk = SkipValue(Reader, Notation);
+				}
+			}
+			bOk = bOk && bFoundResults && Notation == EJsonNotation::ObjectEnd;
+		}
+		else
+		{
+			bOk = false;
+		}
+
+		if (!bOk && OutError)
+		{
+			*OutError = Reader.GetErrorMessage().IsEmpty() ? FString(TEXT("Expected a buildings array")) : Reader.GetErrorMessage();
+		}
+		return bOk;
+	}
+}
+
+void FBuildingEnergyRecord::Reset()
+{
+	ModifiedGmlId.Reset();
+	ActualGmlId.Reset();
+	NumericId.Reset();
+	bHasEnergyResult = false;
+	bHasBegin = false;
+	bHasEnd = false;
+	Begin = FBuildingEnergyPhase();
+	End = FBuildingEnergyPhase();
+	Coordinates.Reset();
+	RingEnds.Reset();
+	CoordinatesText.Reset();
+}
+
+uint64 FBuildingEnergyRecord::ComputeFingerprint() const
+{
+	const int32 Values[] =
+	{
+		(bHasEnergyResult ? 1 : 0) | (bHasBegin ? 2 : 0) | (bHasEnd ? 4 : 0),
+		Begin.CO2FromEnergyDemand.Get(FBuildingStore::MissingValue),
+		End.CO2FromEnergyDemand.Get(FBuildingStore::MissingValue),
+		Begin.EnergyDemandSpecific.Get(FBuildingStore::MissingValue),
+		End.EnergyDemandSpecific.Get(FBuildingStore::MissingValue)
+	};
+	const uint64 ValuesHash = CityHash64(reinterpret_cast<const char*>(Values), sizeof(Values));
+	const uint64 Fingerprint = CityHash64WithSeed(reinterpret_cast<const char*>(*End.EnergyDemandSpecificColor),
+		End.EnergyDemandSpecificColor.Len() * sizeof(TCHAR), ValuesHash);
+	return Fingerprint != 0 ? Fingerprint : 1; // 0 marks buildings that were never fingerprinted
+}
+
+bool FBuildingEnergyStreamReader::ReadBuildings(const FString& JsonResponse, TFunctionRef<void(FBuildingEnergyRecord&)> OnBuilding, FString* OutError, FBuildingPageInfo* OutPageInfo)
+{
+	TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JsonResponse);
+	return BuildingEnergyIngest::ReadResponse(*Reader, OnBuilding, OutError, OutPageInfo);
+}
+
+bool FBuildingEnergyStreamReader::ReadBuildings(TConstArrayView<uint8> Utf8Json, TFunctionRef<void(FBuildingEnergyRecord&)> OnBuilding, FString* OutError, FBuildingPageInfo* OutPageInfo)
+{
+	const FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(Utf8Json.GetData()), Utf8Json.Num());
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonView);
+	return BuildingEnergyIngest::ReadResponse(*Reader, OnBuilding, OutError, OutPageInfo);
+}
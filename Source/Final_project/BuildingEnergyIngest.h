@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Optional.h"
+#include "BuildingStore.h"
+
+// Energy values for one renovation phase ("begin"/"before" or "end"/"after")
+struct FBuildingEnergyPhase
+{
+	TOptional<int32> CO2FromEnergyDemand; // kg CO2 per year
+	TOptional<int32> EnergyDemandSpecific; // kWh/m²a
+	FString EnergyDemandSpecificColor; // Hex color from the phase (or its result) color object
+};
+
+// Only the fields we render for one building of the buildings-energy response.
+// Reused between buildings by the stream reader so ingest never holds more than one building.
+struct FBuildingEnergyRecord
+{
+	FString ModifiedGmlId; // modified_gml_id (with '_') - CASE SENSITIVE
+	FString ActualGmlId; // gml_id (with 'L') - CASE SENSITIVE, may be empty
+	TOptional<int32> NumericId; // Optional numeric "id" used to keep multi-geometry buildings apart
+
+	bool bHasEnergyResult = false;
+	bool bHasBegin = false;
+	bool bHasEnd = false;
+	FBuildingEnergyPhase Begin;
+	FBuildingEnergyPhase End;
+
+	// Geometry: either points read directly from "geom"/"coordinates" arrays,
+	// or a raw "coordinates"/"position" string for ParseBuildingCoordinates.
+	TArray<FVector> Coordinates;
+	TArray<int32> RingEnds; // End offset into Coordinates of each ring; trailing points form one more ring
+	FString CoordinatesText;
+
+	// 64-bit hash of the rendered fields (energy structure, values and end color); never 0.
+	// Geometry is left out: polls compare it against FBuildingStore::Fingerprints and never move buildings.
+	uint64 ComputeFingerprint() const;
+
+	void Reset();
+};
+
+// One complete building store produced by an ingest pass.
+// Built on a worker thread and swapped into ABuildingEnergyDisplay on the game thread.
+struct FBuildingIngestResult
+{
+	FBuildingStore Store;
+
+	int32 BuildingCount = 0;
+	bool bParsed = false;
+	FString ParseError;
+
+	// Warm start: the store came from the on-disk snapshot rather than the API
+	bool bFromSnapshot = false;
+	uint64 ContentHash = 0; // FBuildingStoreSnapshot hash of Store, 0 when not computed
+	TArray<uint8> SnapshotBytes; // Serialized Store, set when a full preload should replace the snapshot
+};
+
+// Pagination fields of a { "count", "next", "results" } envelope
+struct FBuildingPageInfo
+{
+	int32 TotalCount = INDEX_NONE; // "count": buildings over all pages, INDEX_NONE when absent
+	FString Next; // "next": URL of the following page, empty on the last page or when absent
+	int32 NumResults = 0; // Entries of the "results" array read, including those without an id or energy
+};
+
+// Pull parser for /geospatial/buildings-energy/ responses.
+// Walks the JSON with TJsonReader tokens instead of building a FJsonValue DOM, so parsing
+// holds one building on top of the response text regardless of community size. Pass the
+// response bytes where possible: the FString overload needs a UTF-16 copy of the whole body.
+class FINAL_PROJECT_API FBuildingEnergyStreamReader
+{
+public:
+	// Accepts either a top-level array of buildings or an object with a "results" array.
+	// OnBuilding is called once per building that has a modified_gml_id; the record is
+	// reused afterwards, so move out anything that should be kept.
+	static bool ReadBuildings(const FString& JsonResponse, TFunctionRef<void(FBuildingEnergyRecord&)> OnBuilding, FString* OutError = nullptr, FBuildingPageInfo* OutPageInfo = nullptr);
+
+	// Same, straight from UTF-8 bytes such as IHttpResponse::GetContent()
+	static bool ReadBuildings(TConstArrayView<uint8> Utf8Json, TFunctionRef<void(FBuildingEnergyRecord&)> OnBuilding, FString* OutError = nullptr, FBuildingPageInfo* OutPageInfo = nullptr);
+};
@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BuildingEnergyIngest.h"
+
+// Stream reader edge cases that the synthetic city never produces, read through both the FString and the UTF-8 overload.
+//
+// UnrealEditor-Cmd.exe <Project>.uproject -ExecCmds="Automation RunTests BuildingEnergy.Ingest; Quit" -nullrhi -unattended
+
+namespace BuildingEnergyIngestTests
+{
+	// One building whose "end" phase carries the given JSON literal as energy_demand_specific.value
+	FString MakeBuildingJson(const TCHAR* ValueLiteral)
+	{
+		return FString::Printf(TEXT("{\"results\":[{\"modified_gml_id\":\"DEBW_0010001\",\"energy_result\":{")
+			TEXT("\"end\":{\"result\":{\"energy_demand_specific\":{\"value\":%s},\"co2_from_energy_demand\":{\"value\":42}}}}}]}"),
+			ValueLiteral);
+	}
+
+	// Reads the building through both overloads; false when either fails or they disagree
+	bool ReadEndDemand(FAutomationTestBase& Test, const TCHAR* ValueLiteral, TOptional<int32>& OutDemand)
+	{
+		const FString Json = MakeBuildingJson(ValueLiteral);
+		const FTCHARToUTF8 Utf8(*Json);
+		const TConstArrayView<uint8> Utf8Json(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+		TOptional<int32> FromString;
+		TOptional<int32> FromBytes;
+		int32 NumBuildings = 0;
+		const bool bStringOk = FBuildingEnergyStreamReader::ReadBuildings(Json, [&](FBuildingEnergyRecord& Record)
+		{
+			FromString = Record.End.EnergyDemandSpecific;
+			Test.TestEqual(FString::Printf(TEXT("%s: CO2 next to it"), ValueLiteral), Record.End.CO2FromEnergyDemand.Get(0), 42);
+			++NumBuildings;
+		});
+		const bool bBytesOk = FBuildingEnergyStreamReader::ReadBuildings(Utf8Json, [&](FBuildingEnergyRecord& Record)
+		{
+			FromBytes = Record.End.EnergyDemandSpecific;
+			++NumBuildings;
+		});
+
+		OutDemand = FromString;
+		return Test.TestTrue(FString::Printf(TEXT("%s: parsed"), ValueLiteral), bStringOk && bBytesOk)
+			&& Test.TestEqual(FString::Printf(TEXT("%s: buildings"), ValueLiteral), NumBuildings, 2)
+			&& Test.TestTrue(FString::Printf(TEXT("%s: both overloads agree"), ValueLiteral), FromString == FromBytes);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyIngestValueTest, "BuildingEnergy.Ingest.Value",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FBuildingEnergyIngestValueTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyIngestTests;
+
+	struct FCase
+	{
+		const TCHAR* ValueLiteral;
+		TOptional<int32> Expected;
+	};
+	const FCase Cases[] =
+	{
+		{ TEXT("123"), 123 },
+		{ TEXT("123.9"), 123 },
+		{ TEXT("\"123\""), 123 },
+		{ TEXT("\"812.6\""), 812 },
+		{ TEXT("\"-5\""), -5 },
+		{ TEXT("null"), {} },
+		{ TEXT("\"\""), {} },
+		{ TEXT("\"n/a\""), {} },
+	};
+
+	for (const FCase& Case : Cases)
+	{
+		TOptional<int32> Demand;
+		if (ReadEndDemand(*this, Case.ValueLiteral, Demand))
+		{
+			TestTrue(FString::Printf(TEXT("%s: value set"), Case.ValueLiteral), Demand.IsSet() == Case.Expected.IsSet());
+			if (Demand.IsSet() && Case.Expected.IsSet())
+			{
+				TestEqual(FString::Printf(TEXT("%s: value"), Case.ValueLiteral), Demand.GetValue(), Case.Expected.GetValue());
+			}
+		}
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
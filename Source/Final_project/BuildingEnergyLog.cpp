@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingEnergyLog.h"
+
+DEFINE_LOG_CATEGORY(LogBuildingEnergy);
+DEFINE_LOG_CATEGORY(LogBuildingEnergyIngest);
+DEFINE_LOG_CATEGORY(LogBuildingEnergyStyle);
+DEFINE_LOG_CATEGORY(LogBuildingEnergyNet);
+DEFINE_LOG_CATEGORY(LogBuildingEnergyUpdates);
+DEFINE_LOG_CATEGORY(LogBuildingEnergyPicking);
+DEFINE_LOG_CATEGORY(LogBuildingEnergyUI);
+
+namespace BuildingEnergyLog
+{
+	static FLogCategoryBase* const AllCategories[] =
+	{
+		&LogBuildingEnergy, &LogBuildingEnergyIngest, &LogBuildingEnergyStyle, &LogBuildingEnergyNet,
+		&LogBuildingEnergyUpdates, &LogBuildingEnergyPicking, &LogBuildingEnergyUI
+	};
+}
+
+void FBuildingLogSampler::Tally(const TCHAR* Name)
+{
+	// A handful of outcomes per loop; a linear scan over pointers beats hashing strings
+	for (TPair<const TCHAR*, int32>& Entry : Tallies)
+	{
+		if (Entry.Key == Name)
+		{
+			++Entry.Value;
+			return;
+		}
+	}
+	Tallies.Emplace(Name, 1);
+}
+
+void FBuildingLogSampler::Flush()
+{
+	if (NumSeen == 0 && Tallies.Num() == 0)
+	{
+		return;
+	}
+
+	FString TallyText;
+	for (const TPair<const TCHAR*, int32>& Entry : Tallies)
+	{
+		TallyText += FString::Printf(TEXT(", %d %s"), Entry.Value, Entry.Key);
+	}
+
+#if BUILDING_ENERGY_LOOP_LOGGING
+	const int32 NumLogged = FMath::Min(NumSeen, MaxLines);
+#else
+	const int32 NumLogged = 0;
+#endif
+	UE_LOG_REF(Category, Log, TEXT("📋 %d %s (%d logged, %d suppressed)%s"), NumSeen, What, NumLogged, NumSeen - NumLogged, *TallyText);
+
+	NumSeen = 0;
+	Tallies.Reset();
+}
+
+FBuildingLogSilenceScope::FBuildingLogSilenceScope()
+{
+	for (FLogCategoryBase* Category : BuildingEnergyLog::AllCategories)
+	{
+		PreviousVerbosity.Add(Category->GetVerbosity());
+		Category->SetVerbosity(ELogVerbosity::Error);
+	}
+}
+
+FBuildingLogSilenceScope::~FBuildingLogSilenceScope()
+{
+	for (int32 CategoryIndex = 0; CategoryIndex < UE_ARRAY_COUNT(BuildingEnergyLog::AllCategories); ++CategoryIndex)
+	{
+		BuildingEnergyLog::AllCategories[CategoryIndex]->SetVerbosity(PreviousVerbosity[CategoryIndex]);
+	}
+}
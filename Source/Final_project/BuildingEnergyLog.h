@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+// Per-building and per-material loop logging exists for development only; Shipping and Test compile it out
+#ifndef BUILDING_ENERGY_LOOP_LOGGING
+	#define BUILDING_ENERGY_LOOP_LOGGING !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+// Production builds keep warnings and errors only; everything chattier is stripped at compile time
+#if BUILDING_ENERGY_LOOP_LOGGING
+	#define BUILDING_ENERGY_LOG_COMPILE_VERBOSITY All
+#else
+	#define BUILDING_ENERGY_LOG_COMPILE_VERBOSITY Warning
+#endif
+
+// One category per subsystem, so e.g. `Log LogBuildingEnergyStyle Verbose` opens up styling alone
+FINAL_PROJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogBuildingEnergy, Log, BUILDING_ENERGY_LOG_COMPILE_VERBOSITY); // Lifecycle, diagnostics, tests
+FINAL_PROJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogBuildingEnergyIngest, Log, BUILDING_ENERGY_LOG_COMPILE_VERBOSITY); // Preload, pages, shards, chunks, snapshots, publish
+FINAL_PROJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogBuildingEnergyStyle, Log, BUILDING_ENERGY_LOG_COMPILE_VERBOSITY); // Cesium styles, materials, color lookup
+FINAL_PROJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogBuildingEnergyNet, Log, BUILDING_ENERGY_LOG_COMPILE_VERBOSITY); // Authentication, API broker, WebSocket connection
+FINAL_PROJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogBuildingEnergyUpdates, Log, BUILDING_ENERGY_LOG_COMPILE_VERBOSITY); // Polling, change detection, push patches
+FINAL_PROJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogBuildingEnergyPicking, Log, BUILDING_ENERGY_LOG_COMPILE_VERBOSITY); // Clicks and hit-testing
+FINAL_PROJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogBuildingEnergyUI, Log, BUILDING_ENERGY_LOG_COMPILE_VERBOSITY); // Info widget and attributes form
+
+// UE_LOG for hot loops: the arguments are not even evaluated when loop logging is compiled out
+#if BUILDING_ENERGY_LOOP_LOGGING
+	#define UE_LOG_BUILDING_LOOP(CategoryName, Verbosity, Format, ...) UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__)
+#else
+	#define UE_LOG_BUILDING_LOOP(CategoryName, Verbosity, Format, ...) do { } while (0)
+#endif
+
+// Sampled logging for loops: the first MaxLines occurrences are logged in full, the rest only counted,
+// and one summary line with the totals is written when the sampler goes out of scope.
+//
+//	FBuildingLogSampler Sampler(LogBuildingEnergyStyle, TEXT("materials colored"));
+//	for (...)
+//	{
+//		if (Sampler.Sample())
+//		{
+//			UE_LOG_BUILDING_LOOP(LogBuildingEnergyStyle, Verbose, TEXT("..."), ...);
+//		}
+//	}
+class FINAL_PROJECT_API FBuildingLogSampler
+{
+public:
+	FBuildingLogSampler(const FLogCategoryBase& InCategory, const TCHAR* InWhat, int32 InMaxLines = 5)
+		: Category(InCategory), What(InWhat), MaxLines(InMaxLines)
+	{
+	}
+
+	~FBuildingLogSampler() { Flush(); }
+
+	FBuildingLogSampler(const FBuildingLogSampler&) = delete;
+	FBuildingLogSampler& operator=(const FBuildingLogSampler&) = delete;
+
+	// Counts one occurrence; true while it should still be logged in full
+	bool Sample()
+	{
+		++NumSeen;
+#if BUILDING_ENERGY_LOOP_LOGGING
+		return NumSeen <= MaxLines;
+#else
+		return false;
+#endif
+	}
+
+	// Counts an occurrence of a named outcome (e.g. "no color", "no geometry") for the summary; Name must outlive the sampler
+	void Tally(const TCHAR* Name);
+
+	int32 GetNumSeen() const { return NumSeen; }
+
+	// Writes the summary now instead of at scope exit; nothing is written when nothing was sampled
+	void Flush();
+
+private:
+	const FLogCategoryBase& Category;
+	const TCHAR* What;
+	int32 MaxLines;
+	int32 NumSeen = 0;
+	TArray<TPair<const TCHAR*, int32>, TInlineAllocator<4>> Tallies;
+};
+
+// Lowers every LogBuildingEnergy* category to Error while in scope and restores them afterwards.
+// For benchmarks and perf tests: the per-building log lines would otherwise dominate their timings.
+class FINAL_PROJECT_API FBuildingLogSilenceScope
+{
+public:
+	FBuildingLogSilenceScope();
+	~FBuildingLogSilenceScope();
+
+	FBuildingLogSilenceScope(const FBuildingLogSilenceScope&) = delete;
+	FBuildingLogSilenceScope& operator=(const FBuildingLogSilenceScope&) = delete;
+
+private:
+	TArray<ELogVerbosity::Type, TInlineAllocator<8>> PreviousVerbosity;
+};
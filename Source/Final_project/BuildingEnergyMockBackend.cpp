@@ -0,0 +1,679 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingEnergyMockBackend.h"
+#include "BuildingEnergyApiSubsystem.h"
+#include "BuildingEnergyLog.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "HttpPath.h"
+#include "IHttpRouter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace BuildingEnergyMockBackend
+{
+	static const TCHAR* TokenPath = TEXT("/api/token");
+	static const TCHAR* TokenRefreshPath = TEXT("/api/token/refresh");
+	static const TCHAR* BuildingsEnergyPath = TEXT("/geospatial/buildings-energy");
+
+	static FString BodyToString(const FHttpServerRequest& Request)
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Request.Body.GetData()), Request.Body.Num());
+		return FString(Converted.Length(), Converted.Get());
+	}
+
+	static TSharedPtr<FJsonObject> ParseBody(const FHttpServerRequest& Request)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BodyToString(Request));
+		FJsonSerializer::Deserialize(Reader, JsonObject);
+		return JsonObject;
+	}
+
+	static FString ToJson(const TSharedRef<FJsonObject>& JsonObject)
+	{
+		FString Output;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		FJsonSerializer::Serialize(JsonObject, Writer);
+		return Output;
+	}
+
+	// Records of a recorded listing, either a page object with "results" or a bare array
+	static bool ReadResults(const FString& Json, TArray<TSharedPtr<FJsonValue>>& OutResults)
+	{
+		TSharedPtr<FJsonValue> Root;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+		{
+			return false;
+		}
+		const TArray<TSharedPtr<FJsonValue>>* Results = nullptr;
+		const TSharedPtr<FJsonObject>* Page = nullptr;
+		if (!Root->TryGetArray(Results) && !(Root->TryGetObject(Page) && (*Page)->TryGetArrayField(TEXT("results"), Results)))
+		{
+			return false;
+		}
+		OutResults = *Results;
+		return true;
+	}
+
+	// A changed record replaces the one with the same modified_gml_id (or gml_id)
+	static FString GetRecordKey(const TSharedPtr<FJsonValue>& Record)
+	{
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		FString Key;
+		if (Record.IsValid() && Record->TryGetObject(Object) && !(*Object)->TryGetStringField(TEXT("modified_gml_id"), Key))
+		{
+			(*Object)->TryGetStringField(TEXT("gml_id"), Key);
+		}
+		return Key;
+	}
+
+	// Unpaged listing in the backend's page format
+	static FString MakeListJson(const TArray<TSharedPtr<FJsonValue>>& Results)
+	{
+		TSharedRef<FJsonObject> Page = MakeShared<FJsonObject>();
+		Page->SetNumberField(TEXT("count"), Results.Num());
+		Page->SetField(TEXT("next"), MakeShared<FJsonValueNull>());
+		Page->SetField(TEXT("previous"), MakeShared<FJsonValueNull>());
+		Page->SetArrayField(TEXT("results"), Results);
+		return ToJson(Page);
+	}
+
+	// Attribute fields read by the attributes form, picked from the id so a building always shows the same
+	static FString MakeSyntheticDetail(const FString& GmlId)
+	{
+		static const TCHAR* const YearClasses[] = { TEXT("before 1919"), TEXT("1919-1948"), TEXT("1949-1957"), TEXT("1958-1968"), TEXT("1969-1978"), TEXT("1979-1983"), TEXT("1984-1994"), TEXT("1995-2001") };
+		static const TCHAR* const HeatingSystems[] = { TEXT("gas_boiler"), TEXT("oil_boiler"), TEXT("district_heating"), TEXT("heat_pump"), TEXT("wood_pellets") };
+		const uint32 Hash = FCrc::StrCrc32(*GmlId);
+
+		TSharedRef<FJsonObject> Detail = MakeShared<FJsonObject>();
+		Detail->SetStringField(TEXT("gml_id"), GmlId);
+		Detail->SetStringField(TEXT("construction_year_class"), YearClasses[Hash % UE_ARRAY_COUNT(YearClasses)]);
+		Detail->SetStringField(TEXT("storey"), FString::FromInt(1 + (Hash >> 4) % 6));
+		Detail->SetStringField(TEXT("roof_storey"), (Hash >> 8) % 2 ? TEXT("yes") : TEXT("no"));
+		Detail->SetStringField(TEXT("begin_heating_system_type_1"), HeatingSystems[(Hash >> 12) % 3]);
+		Detail->SetStringField(TEXT("end_heating_system_type_1"), HeatingSystems[2 + (Hash >> 16) % 3]);
+		return ToJson(Detail);
+	}
+}
+
+FBuildingEnergyMockBackendSettings FBuildingEnergyMockBackendSettings::FromCommandLine(const TCHAR* CommandLine)
+{
+	FBuildingEnergyMockBackendSettings Settings;
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockPort="), Settings.Port);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockPayloads="), Settings.RecordedPayloadDirectory);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockBuildings="), Settings.NumSyntheticBuildings);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockPageSize="), Settings.DefaultPageSize);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockLatencyMs="), Settings.LatencyMs);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockJitterMs="), Settings.LatencyJitterMs);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockErrorRate="), Settings.ErrorRate);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockErrorCode="), Settings.ErrorStatusCode);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockRequestsPerSecond="), Settings.MaxRequestsPerSecond);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockChangeInterval="), Settings.ChangeIntervalSeconds);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockChangeFraction="), Settings.ChangeFraction);
+	FParse::Value(CommandLine, TEXT("BuildingEnergyMockTokenLifetime="), Settings.TokenLifetimeSeconds);
+	return Settings;
+}
+
+FBuildingEnergyMockBackend::FBuildingEnergyMockBackend(const FBuildingEnergyMockBackendSettings& InSettings)
+	: Settings(InSettings)
+	, Random(InSettings.Seed)
+{
+	City.NumBuildings = FMath::Max(0, Settings.NumSyntheticBuildings);
+	City.Seed = Settings.Seed;
+}
+
+FBuildingEnergyMockBackend::~FBuildingEnergyMockBackend()
+{
+	Stop();
+}
+
+bool FBuildingEnergyMockBackend::Start()
+{
+	using namespace BuildingEnergyMockBackend;
+
+	if (IsRunning())
+	{
+		return true;
+	}
+
+	RecordedList.Reset();
+	if (!Settings.RecordedPayloadDirectory.IsEmpty())
+	{
+		const FString RecordedListPath = Settings.RecordedPayloadDirectory / TEXT("buildings-energy.json");
+		if (FFileHelper::LoadFileToString(RecordedList, *RecordedListPath))
+		{
+			UE_LOG(LogBuildingEnergyNet, Log, TEXT("🧪 MOCK BACKEND: Serving the recorded list %s (%d characters)"), *RecordedListPath, RecordedList.Len());
+			LoadRecordedChanges();
+		}
+	}
+
+	// Listeners started from here on bind as their router is created, so a taken port fails right away
+	FHttpServerModule::Get().StartAllListeners();
+	if (Settings.Port != 0)
+	{
+		Listen(Settings.Port);
+	}
+	for (uint32 Port = FirstAutomaticPort; Settings.Port == 0 && !IsRunning() && Port < FirstAutomaticPort + NumAutomaticPorts; ++Port)
+	{
+		Listen(Port);
+	}
+	if (!IsRunning())
+	{
+		UE_LOG(LogBuildingEnergyNet, Error, TEXT("❌ MOCK BACKEND: Could not listen on %s"),
+			Settings.Port != 0 ? *FString::Printf(TEXT("port %u"), Settings.Port) : *FString::Printf(TEXT("any port from %u to %u"), FirstAutomaticPort, FirstAutomaticPort + NumAutomaticPorts - 1));
+		return false;
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	if (Settings.bRedirectClient)
+	{
+		UBuildingEnergyApiSubsystem::SetApiBaseUrlOverride(GetBaseUrl());
+	}
+	UE_LOG(LogBuildingEnergyNet, Log, TEXT("🧪 MOCK BACKEND: Serving %s (%d synthetic buildings, latency %.0f+%.0f ms, error rate %.2f, %d requests/s)"),
+		*GetBaseUrl(), City.NumBuildings, Settings.LatencyMs, Settings.LatencyJitterMs, Settings.ErrorRate, Settings.MaxRequestsPerSecond);
+	return true;
+}
+
+bool FBuildingEnergyMockBackend::Listen(uint32 Port)
+{
+	using namespace BuildingEnergyMockBackend;
+
+	TSharedPtr<IHttpRouter> PortRouter = FHttpServerModule::Get().GetHttpRouter(Port, true);
+	if (!PortRouter.IsValid())
+	{
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🧪 MOCK BACKEND: Port %u is taken"), Port);
+		return false;
+	}
+
+	struct FRoute
+	{
+		const TCHAR* Path;
+		EHttpServerRequestVerbs Verbs;
+	};
+	const FRoute Routes[] =
+	{
+		{ TokenPath, EHttpServerRequestVerbs::VERB_POST },
+		{ TokenRefreshPath, EHttpServerRequestVerbs::VERB_POST },
+		{ BuildingsEnergyPath, EHttpServerRequestVerbs::VERB_GET | EHttpServerRequestVerbs::VERB_PUT }
+	};
+	TArray<FHttpRouteHandle> Handles;
+	for (const FRoute& Route : Routes)
+	{
+		const FString RoutePath = Route.Path;
+		FHttpRouteHandle Handle = PortRouter->BindRoute(FHttpPath(RoutePath), Route.Verbs,
+			FHttpRequestHandler::CreateLambda([this, RoutePath](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+			{
+				return HandleRequest(Request, OnComplete, RoutePath);
+			}));
+		if (!Handle.IsValid())
+		{
+			// Another mock (or anything else) already serves this path on the port
+			UE_LOG(LogBuildingEnergyNet, Log, TEXT("🧪 MOCK BACKEND: %s is already bound on port %u"), *RoutePath, Port);
+			for (const FHttpRouteHandle& BoundHandle : Handles)
+			{
+				PortRouter->UnbindRoute(BoundHandle);
+			}
+			return false;
+		}
+		Handles.Add(Handle);
+	}
+
+	Router = PortRouter;
+	RouteHandles = MoveTemp(Handles);
+	ListenPort = Port;
+	return true;
+}
+
+void FBuildingEnergyMockBackend::Stop()
+{
+	for (const FTSTicker::FDelegateHandle& DelayedResponse : DelayedResponses)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DelayedResponse);
+	}
+	DelayedResponses.Reset();
+
+	if (Router.IsValid())
+	{
+		// The listener stays up for whoever else uses the port; without routes it answers 404
+		for (const FHttpRouteHandle& Handle : RouteHandles)
+		{
+			Router->UnbindRoute(Handle);
+		}
+		RouteHandles.Reset();
+		Router.Reset();
+
+		if (Settings.bRedirectClient && UBuildingEnergyApiSubsystem::GetApiBaseUrl() == GetBaseUrl())
+		{
+			UBuildingEnergyApiSubsystem::SetApiBaseUrlOverride(FString());
+		}
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🧪 MOCK BACKEND: Stopped after %d requests"), NumRequests);
+	}
+}
+
+FString FBuildingEnergyMockBackend::GetBaseUrl() const
+{
+	return FString::Printf(TEXT("http://127.0.0.1:%u"), ListenPort);
+}
+
+void FBuildingEnergyMockBackend::FailNextRequests(int32 StatusCode, int32 Count, const FString& PathPrefix)
+{
+	FInjectedFailure& Failure = InjectedFailures.AddDefaulted_GetRef();
+	Failure.StatusCode = StatusCode;
+	Failure.Remaining = Count;
+	Failure.PathPrefix = PathPrefix;
+}
+
+void FBuildingEnergyMockBackend::ExpireAccessTokens()
+{
+	AccessTokenExpiry.Reset();
+}
+
+int32 FBuildingEnergyMockBackend::GetChangeGeneration() const
+{
+	int32 Generation = ManualChangeGeneration;
+	if (Settings.ChangeIntervalSeconds > 0.0f && StartTime > 0.0)
+	{
+		Generation += FMath::FloorToInt32((FPlatformTime::Seconds() - StartTime) / Settings.ChangeIntervalSeconds);
+	}
+	return RecordedList.IsEmpty() ? Generation : FMath::Min(Generation, RecordedChanges.Num());
+}
+
+void FBuildingEnergyMockBackend::LoadRecordedChanges()
+{
+	using namespace BuildingEnergyMockBackend;
+
+	RecordedRecords.Reset();
+	RecordedChanges.Reset();
+	if (!ReadResults(RecordedList, RecordedRecords))
+	{
+		UE_LOG(LogBuildingEnergyNet, Warning, TEXT("🧪 MOCK BACKEND: The recorded list has no results array - changes are not replayed"));
+		return;
+	}
+
+	// changes/1.json, changes/2.json, ... up to the first missing or unreadable cursor
+	const FString ChangesDirectory = Settings.RecordedPayloadDirectory / TEXT("changes");
+	for (int32 Cursor = 1; ; ++Cursor)
+	{
+		const FString ChangesPath = ChangesDirectory / FString::Printf(TEXT("%d.json"), Cursor);
+		FString ChangesJson;
+		if (!FFileHelper::LoadFileToString(ChangesJson, *ChangesPath))
+		{
+			break;
+		}
+		if (!ReadResults(ChangesJson, RecordedChanges.AddDefaulted_GetRef()))
+		{
+			UE_LOG(LogBuildingEnergyNet, Warning, TEXT("🧪 MOCK BACKEND: %s has no results array - the change log ends before it"), *ChangesPath);
+			RecordedChanges.Pop();
+			break;
+		}
+	}
+	if (RecordedChanges.Num() > 0)
+	{
+		UE_LOG(LogBuildingEnergyNet, Log, TEXT("🧪 MOCK BACKEND: Replaying %d recorded change sets from %s"), RecordedChanges.Num(), *ChangesDirectory);
+	}
+}
+
+FString FBuildingEnergyMockBackend::MakeRecordedListJson(int32 Generation) const
+{
+	using namespace BuildingEnergyMockBackend;
+
+	if (Generation == 0)
+	{
+		return RecordedList; // As recorded, byte for byte
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Results = RecordedRecords;
+	TMap<FString, int32> KeyToResult;
+	for (int32 ResultIndex = 0; ResultIndex < Results.Num(); ++ResultIndex)
+	{
+		KeyToResult.Add(GetRecordKey(Results[ResultIndex]), ResultIndex);
+	}
+	for (int32 Cursor = 1; Cursor <= Generation; ++Cursor)
+	{
+		for (const TSharedPtr<FJsonValue>& Change : RecordedChanges[Cursor - 1])
+		{
+			if (const int32* ResultIndex = KeyToResult.Find(GetRecordKey(Change)))
+			{
+				Results[*ResultIndex] = Change;
+			}
+			else
+			{
+				KeyToResult.Add(GetRecordKey(Change), Results.Add(Change));
+			}
+		}
+	}
+	return MakeListJson(Results);
+}
+
+FString FBuildingEnergyMockBackend::MakeRecordedChangesJson(int32 SinceGeneration, int32 Generation) const
+{
+	// Later change sets go last, so a building changed twice ends on its newest record
+	TArray<TSharedPtr<FJsonValue>> Results;
+	for (int32 Cursor = SinceGeneration + 1; Cursor <= Generation; ++Cursor)
+	{
+		Results.Append(RecordedChanges[Cursor - 1]);
+	}
+	return BuildingEnergyMockBackend::MakeListJson(Results);
+}
+
+void FBuildingEnergyMockBackend::ResetStatistics()
+{
+	RequestCounts.Reset();
+	NumRequests = 0;
+	NumThrottled = 0;
+	NumInjectedErrors = 0;
+}
+
+bool FBuildingEnergyMockBackend::HandleRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete, const FString& RoutePath)
+{
+	using namespace BuildingEnergyMockBackend;
+
+	// The building id is whatever follows the route, e.g. "DEBWL00100000abc" of /geospatial/buildings-energy/DEBWL00100000abc/
+	FString GmlId = Request.RelativePath.GetPath();
+	GmlId.TrimCharInline(TEXT('/'), nullptr);
+
+	const TCHAR* Route = TEXT("token");
+	if (RoutePath == TokenRefreshPath)
+	{
+		Route = TEXT("token_refresh");
+	}
+	else if (RoutePath == BuildingsEnergyPath)
+	{
+		Route = GmlId.IsEmpty() ? TEXT("list") : Request.Verb == EHttpServerRequestVerbs::VERB_PUT ? TEXT("update") : TEXT("detail");
+	}
+	++NumRequests;
+	++RequestCounts.FindOrAdd(Route);
+
+	FMockResponse Response;
+	const FString Path = GmlId.IsEmpty() ? RoutePath + TEXT("/") : FString::Printf(TEXT("%s/%s/"), *RoutePath, *GmlId);
+	if (PassesFaultInjection(Path, Response))
+	{
+		if (RoutePath == TokenPath)
+		{
+			Response = HandleToken(Request);
+		}
+		else if (RoutePath == TokenRefreshPath)
+		{
+			Response = HandleTokenRefresh(Request);
+		}
+		else if (!IsAuthorized(Request))
+		{
+			// Same body as the real backend, which the client treats as an expired token
+			Response = MakeError(401, TEXT("Given token not valid for any token type"));
+		}
+		else if (GmlId.IsEmpty())
+		{
+			Response = HandleList(Request);
+		}
+		else if (Request.Verb == EHttpServerRequestVerbs::VERB_PUT)
+		{
+			Response = HandleUpdate(GmlId, Request);
+		}
+		else
+		{
+			Response = HandleDetail(GmlId);
+		}
+	}
+
+	Respond(MoveTemp(Response), OnComplete);
+	return true;
+}
+
+bool FBuildingEnergyMockBackend::PassesFaultInjection(const FString& Path, FMockResponse& Response)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (Settings.MaxRequestsPerSecond > 0)
+	{
+		RecentRequestTimes.RemoveAll([Now](double RequestTime) { return RequestTime <= Now - 1.0; });
+		if (RecentRequestTimes.Num() >= Settings.MaxRequestsPerSecond)
+		{
+			++NumThrottled;
+			Response = MakeError(429, TEXT("Request was throttled."));
+			Response.Headers.Add(TEXT("Retry-After"), TEXT("1"));
+			return false;
+		}
+		RecentRequestTimes.Add(Now);
+	}
+
+	for (int32 FailureIndex = 0; FailureIndex < InjectedFailures.Num(); ++FailureIndex)
+	{
+		FInjectedFailure& Failure = InjectedFailures[FailureIndex];
+		if (Path.StartsWith(Failure.PathPrefix))
+		{
+			++NumInjectedErrors;
+			Response = MakeError(Failure.StatusCode, TEXT("Injected failure"));
+			if (--Failure.Remaining <= 0)
+			{
+				InjectedFailures.RemoveAt(FailureIndex);
+			}
+			return false;
+		}
+	}
+
+	if (Settings.ErrorRate > 0.0f && Random.FRand() < Settings.ErrorRate)
+	{
+		++NumInjectedErrors;
+		Response = MakeError(Settings.ErrorStatusCode, TEXT("Injected failure"));
+		return false;
+	}
+	return true;
+}
+
+bool FBuildingEnergyMockBackend::IsAuthorized(const FHttpServerRequest& Request) const
+{
+	const TArray<FString>* Authorization = Request.Headers.Find(TEXT("Authorization"));
+	if (!Authorization || Authorization->Num() == 0)
+	{
+		return false;
+	}
+
+	FString Token = (*Authorization)[0];
+	if (!Token.RemoveFromStart(TEXT("Bearer ")))
+	{
+		return false;
+	}
+	const double* Expiry = AccessTokenExpiry.Find(Token.TrimStartAndEnd());
+	return Expiry && FPlatformTime::Seconds() < *Expiry;
+}
+
+FBuildingEnergyMockBackend::FMockResponse FBuildingEnergyMockBackend::HandleToken(const FHttpServerRequest& Request)
+{
+	// Any credentials are accepted; they are neither checked nor kept
+	const TSharedPtr<FJsonObject> Credentials = BuildingEnergyMockBackend::ParseBody(Request);
+	if (!Credentials.IsValid() || !Credentials->HasField(TEXT("username")))
+	{
+		return MakeError(400, TEXT("username and password are required"));
+	}
+
+	const FString RefreshToken = FString::Printf(TEXT("mock-refresh-%d"), NumTokensIssued);
+	RefreshTokens.Add(RefreshToken);
+
+	TSharedRef<FJsonObject> Tokens = MakeShared<FJsonObject>();
+	Tokens->SetStringField(TEXT("access"), IssueAccessToken());
+	Tokens->SetStringField(TEXT("refresh"), RefreshToken);
+
+	FMockResponse Response;
+	Response.Body = BuildingEnergyMockBackend::ToJson(Tokens);
+	return Response;
+}
+
+FBuildingEnergyMockBackend::FMockResponse FBuildingEnergyMockBackend::HandleTokenRefresh(const FHttpServerRequest& Request)
+{
+	const TSharedPtr<FJsonObject> Body = BuildingEnergyMockBackend::ParseBody(Request);
+	FString RefreshToken;
+	if (!Body.IsValid() || !Body->TryGetStringField(TEXT("refresh"), RefreshToken) || !RefreshTokens.Contains(RefreshToken))
+	{
+		return MakeError(401, TEXT("Token is invalid or expired"));
+	}
+
+	TSharedRef<FJsonObject> Tokens = MakeShared<FJsonObject>();
+	Tokens->SetStringField(TEXT("access"), IssueAccessToken());
+
+	FMockResponse Response;
+	Response.Body = BuildingEnergyMockBackend::ToJson(Tokens);
+	return Response;
+}
+
+FBuildingEnergyMockBackend::FMockResponse FBuildingEnergyMockBackend::HandleList(const FHttpServerRequest& Request)
+{
+	using namespace BuildingEnergyMockBackend;
+
+	FMockResponse Response;
+	const bool bRecorded = !RecordedList.IsEmpty();
+
+	// Change stream: the generation is both the delta sync cursor and the entity tag
+	const int32 Generation = GetChangeGeneration();
+	const FString Cursor = FString::FromInt(Generation);
+	Response.Headers.Add(TEXT("X-Change-Cursor"), Cursor);
+
+	if (const FString* ChangedSince = Request.QueryParams.Find(TEXT("changed_since")))
+	{
+		const int32 SinceGeneration = FCString::Atoi(**ChangedSince);
+		if (!ChangedSince->IsNumeric() || SinceGeneration < OldestChangeCursor || SinceGeneration > Generation)
+		{
+			return MakeError(410, TEXT("Unknown change cursor"));
+		}
+		Response.Body = bRecorded
+			? MakeRecordedChangesJson(SinceGeneration, Generation)
+			: City.GenerateChangesJson(SinceGeneration, Generation, Settings.ChangeFraction);
+		return Response;
+	}
+
+	// Page number pagination like the backend: page is 1-based, page_size caps the results
+	const FString* PageSizeParam = Request.QueryParams.Find(TEXT("page_size"));
+	const FString* PageParam = Request.QueryParams.Find(TEXT("page"));
+	const int32 PageSize = PageSizeParam ? FCString::Atoi(**PageSizeParam) : Settings.DefaultPageSize;
+	const int32 Page = PageParam ? FMath::Max(1, FCString::Atoi(**PageParam)) : 1;
+
+	const FString ETag = FString::Printf(TEXT("\"mock-%d-%d-%d\""), Generation, Page, PageSize);
+	const TArray<FString>* IfNoneMatch = Request.Headers.Find(TEXT("If-None-Match"));
+	if (IfNoneMatch && IfNoneMatch->Contains(ETag))
+	{
+		Response.StatusCode = 304;
+		Response.Headers.Add(TEXT("ETag"), ETag);
+		return Response;
+	}
+	Response.Headers.Add(TEXT("ETag"), ETag);
+
+	// Recordings are served whole, page parameters or not
+	if (bRecorded)
+	{
+		Response.Body = MakeRecordedListJson(Generation);
+		return Response;
+	}
+
+	if (PageSize <= 0)
+	{
+		Response.Body = City.GenerateJson(Generation, Settings.ChangeFraction);
+		return Response;
+	}
+
+	const int64 FirstIndex = static_cast<int64>(Page - 1) * PageSize;
+	if (FirstIndex > 0 && FirstIndex >= City.NumBuildings)
+	{
+		return MakeError(404, TEXT("Invalid page."));
+	}
+
+	FString NextUrl;
+	if (FirstIndex + PageSize < City.NumBuildings)
+	{
+		NextUrl = GetBaseUrl() + BuildingsEnergyPath + TEXT("/?");
+		for (const TPair<FString, FString>& Param : Request.QueryParams)
+		{
+			if (Param.Key != TEXT("page"))
+			{
+				NextUrl += FString::Printf(TEXT("%s=%s&"), *Param.Key, *Param.Value);
+			}
+		}
+		NextUrl += FString::Printf(TEXT("page=%d"), Page + 1);
+	}
+	Response.Body = City.GeneratePageJson(static_cast<int32>(FirstIndex), PageSize, NextUrl, Generation, Settings.ChangeFraction);
+	return Response;
+}
+
+FBuildingEnergyMockBackend::FMockResponse FBuildingEnergyMockBackend::HandleDetail(const FString& GmlId)
+{
+	FMockResponse Response;
+	if (const FString* UpdatedDetail = UpdatedDetails.Find(GmlId))
+	{
+		Response.Body = *UpdatedDetail;
+		return Response;
+	}
+
+	if (!Settings.RecordedPayloadDirectory.IsEmpty() && !GmlId.Contains(TEXT("..")) &&
+		FFileHelper::LoadFileToString(Response.Body, *(Settings.RecordedPayloadDirectory / TEXT("buildings-energy") / GmlId + TEXT(".json"))))
+	{
+		return Response;
+	}
+
+	Response.Body = BuildingEnergyMockBackend::MakeSyntheticDetail(GmlId);
+	return Response;
+}
+
+FBuildingEnergyMockBackend::FMockResponse FBuildingEnergyMockBackend::HandleUpdate(const FString& GmlId, const FHttpServerRequest& Request)
+{
+	const FString Body = BuildingEnergyMockBackend::BodyToString(Request);
+	if (!BuildingEnergyMockBackend::ParseBody(Request).IsValid())
+	{
+		return MakeError(400, TEXT("JSON parse error"));
+	}
+
+	UpdatedDetails.Add(GmlId, Body);
+
+	FMockResponse Response;
+	Response.Body = Body;
+	return Response;
+}
+
+FString FBuildingEnergyMockBackend::IssueAccessToken()
+{
+	const FString AccessToken = FString::Printf(TEXT("mock-access-%d-%08x"), NumTokensIssued++, Random.GetUnsignedInt());
+	AccessTokenExpiry.Add(AccessToken, FPlatformTime::Seconds() + Settings.TokenLifetimeSeconds);
+	return AccessToken;
+}
+
+void FBuildingEnergyMockBackend::Respond(FMockResponse&& Response, const FHttpResultCallback& OnComplete)
+{
+	auto Send = [](const FMockResponse& MockResponse, const FHttpResultCallback& Callback)
+	{
+		TUniquePtr<FHttpServerResponse> ServerResponse = FHttpServerResponse::Create(MockResponse.Body, TEXT("application/json"));
+		ServerResponse->Code = static_cast<EHttpServerResponseCodes>(MockResponse.StatusCode);
+		for (const TPair<FString, FString>& Header : MockResponse.Headers)
+		{
+			ServerResponse->Headers.FindOrAdd(Header.Key).Add(Header.Value);
+		}
+		Callback(MoveTemp(ServerResponse));
+	};
+
+	const float DelayMs = Settings.LatencyMs + (Settings.LatencyJitterMs > 0.0f ? Random.FRandRange(0.0f, Settings.LatencyJitterMs) : 0.0f);
+	if (DelayMs <= 0.0f)
+	{
+		Send(Response, OnComplete);
+		return;
+	}
+
+	DelayedResponses.RemoveAll([](const FTSTicker::FDelegateHandle& Handle) { return !Handle.IsValid(); });
+	DelayedResponses.Add(FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Send, Response = MoveTemp(Response), OnComplete](float)
+	{
+		Send(Response, OnComplete);
+		return false; // One shot
+	}), DelayMs / 1000.0f));
+}
+
+FBuildingEnergyMockBackend::FMockResponse FBuildingEnergyMockBackend::MakeError(int32 StatusCode, const FString& Detail)
+{
+	TSharedRef<FJsonObject> Error = MakeShared<FJsonObject>();
+	Error->SetStringField(TEXT("detail"), Detail);
+
+	FMockResponse Response;
+	Response.StatusCode = StatusCode;
+	Response.Body = BuildingEnergyMockBackend::ToJson(Error);
+	return Response;
+}
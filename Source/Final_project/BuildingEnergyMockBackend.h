@@ -0,0 +1,185 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Math/RandomStream.h"
+#include "HttpRouteHandle.h"
+#include "HttpResultCallback.h"
+#include "BuildingEnergySyntheticCity.h"
+
+class IHttpRouter;
+class FJsonValue;
+struct FHttpServerRequest;
+
+struct FINAL_PROJECT_API FBuildingEnergyMockBackendSettings
+{
+	// 0 listens on the first free port from FBuildingEnergyMockBackend::FirstAutomaticPort on, e.g. in automation tests
+	uint32 Port = 8765;
+
+	// Served instead of synthetic data when present: buildings-energy.json for the list at change cursor 0,
+	// changes/<cursor>.json for the records that changed to reach cursor 1, 2, ... (replayed as the change
+	// generation advances), buildings-energy/<gml_id>.json for the detail of a building
+	FString RecordedPayloadDirectory;
+
+	// Synthetic city behind the list and detail endpoints
+	int32 NumSyntheticBuildings = 1000;
+	int32 Seed = 1;
+
+	// Page size of list responses without a page_size parameter; 0 lists everything at once
+	int32 DefaultPageSize = 0;
+
+	// Every response is held back LatencyMs plus up to LatencyJitterMs
+	float LatencyMs = 0.0f;
+	float LatencyJitterMs = 0.0f;
+
+	// Share of requests answered with ErrorStatusCode instead of their payload
+	float ErrorRate = 0.0f;
+	int32 ErrorStatusCode = 503;
+
+	// Requests above this rate within one second get a 429 with Retry-After; 0 disables throttling
+	int32 MaxRequestsPerSecond = 0;
+
+	// Change stream: every ChangeIntervalSeconds the list recolors ChangeFraction of the buildings; 0 keeps it static
+	float ChangeIntervalSeconds = 0.0f;
+	float ChangeFraction = 0.01f;
+
+	// Access tokens are refused with a 401 after this long, refresh tokens never expire
+	float TokenLifetimeSeconds = 300.0f;
+
+	// Point UBuildingEnergyApiSubsystem::GetApiBaseUrl at the mock while it runs
+	bool bRedirectClient = true;
+
+	// -BuildingEnergyMockPort= -BuildingEnergyMockPayloads= -BuildingEnergyMockBuildings= -BuildingEnergyMockLatencyMs=
+	// -BuildingEnergyMockJitterMs= -BuildingEnergyMockErrorRate= -BuildingEnergyMockErrorCode= -BuildingEnergyMockRequestsPerSecond=
+	// -BuildingEnergyMockChangeInterval= -BuildingEnergyMockChangeFraction= -BuildingEnergyMockTokenLifetime= -BuildingEnergyMockPageSize=
+	static FBuildingEnergyMockBackendSettings FromCommandLine(const TCHAR* CommandLine);
+};
+
+// Local stand-in for the backend, served by the engine's HTTPServer module on 127.0.0.1:
+//   POST /api/token/                            any credentials, issues an access and a refresh token
+//   POST /api/token/refresh/                    exchanges a refresh token for a new access token
+//   GET  /geospatial/buildings-energy/          recorded or synthetic list, synthetic ones paginated with page / page_size;
+//                                               both carry an ETag and an X-Change-Cursor for changed_since
+//   GET  /geospatial/buildings-energy/<id>/     recorded, previously PUT or synthetic attributes
+//   PUT  /geospatial/buildings-energy/<id>/     stores the body, later GETs of that building return it
+// Latency, error codes, throttling and the change stream are injected per the settings and the controls below,
+// so polling, token refresh and ingest can be measured offline and reproducibly. Game thread only.
+class FINAL_PROJECT_API FBuildingEnergyMockBackend
+{
+public:
+	explicit FBuildingEnergyMockBackend(const FBuildingEnergyMockBackendSettings& InSettings = FBuildingEnergyMockBackendSettings());
+	~FBuildingEnergyMockBackend();
+
+	FBuildingEnergyMockBackend(const FBuildingEnergyMockBackend&) = delete;
+	FBuildingEnergyMockBackend& operator=(const FBuildingEnergyMockBackend&) = delete;
+
+	// False when the port could not be bound
+	bool Start();
+	void Stop();
+	bool IsRunning() const { return Router.IsValid(); }
+
+	static constexpr uint32 FirstAutomaticPort = 18765;
+	static constexpr uint32 NumAutomaticPorts = 64;
+
+	// "http://127.0.0.1:<port>", with the port actually listened on
+	FString GetBaseUrl() const;
+	uint32 GetPort() const { return ListenPort; }
+
+	const FBuildingEnergyMockBackendSettings& GetSettings() const { return Settings; }
+	const FBuildingEnergySyntheticCity& GetCity() const { return City; }
+
+	// === Controls ===
+
+	// The next Count requests whose path starts with PathPrefix (every path when empty) get StatusCode
+	void FailNextRequests(int32 StatusCode, int32 Count = 1, const FString& PathPrefix = FString());
+
+	// Refuses every access token issued so far, as if they all expired now
+	void ExpireAccessTokens();
+
+	// Steps the change stream once, on top of ChangeIntervalSeconds
+	void AdvanceChangeGeneration() { ++ManualChangeGeneration; }
+
+	// Cursor handed out now; a recorded change log stops at its last file
+	int32 GetChangeGeneration() const;
+
+	// Answers changed_since with a 410 for every cursor handed out so far, as if the change log was pruned
+	void ExpireChangeCursors() { OldestChangeCursor = GetChangeGeneration(); }
+
+	// === Statistics ===
+
+	// Requests received per route: "token", "token_refresh", "list", "detail", "update"
+	int32 GetNumRequests(const FString& Route) const { return RequestCounts.FindRef(Route); }
+	int32 GetNumRequests() const { return NumRequests; }
+	int32 GetNumThrottled() const { return NumThrottled; }
+	int32 GetNumInjectedErrors() const { return NumInjectedErrors; }
+	void ResetStatistics();
+
+private:
+	struct FMockResponse
+	{
+		int32 StatusCode = 200;
+		FString Body;
+		TMap<FString, FString> Headers;
+	};
+
+	struct FInjectedFailure
+	{
+		int32 StatusCode = 0;
+		int32 Remaining = 0;
+		FString PathPrefix;
+	};
+
+	// Binds every route on Port; false (and nothing bound) when the port or a route is taken
+	bool Listen(uint32 Port);
+
+	bool HandleRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete, const FString& RoutePath);
+
+	// Throttling and injected errors; false when Response already holds the answer
+	bool PassesFaultInjection(const FString& Path, FMockResponse& Response);
+	bool IsAuthorized(const FHttpServerRequest& Request) const;
+
+	FMockResponse HandleToken(const FHttpServerRequest& Request);
+	FMockResponse HandleTokenRefresh(const FHttpServerRequest& Request);
+	FMockResponse HandleList(const FHttpServerRequest& Request);
+	FMockResponse HandleDetail(const FString& GmlId);
+	FMockResponse HandleUpdate(const FString& GmlId, const FHttpServerRequest& Request);
+
+	FString IssueAccessToken();
+	void Respond(FMockResponse&& Response, const FHttpResultCallback& OnComplete);
+	static FMockResponse MakeError(int32 StatusCode, const FString& Detail);
+
+	FBuildingEnergyMockBackendSettings Settings;
+	FBuildingEnergySyntheticCity City;
+	FString RecordedList; // Empty when the list is synthetic
+	TArray<TSharedPtr<FJsonValue>> RecordedRecords; // Results of RecordedList
+	TArray<TArray<TSharedPtr<FJsonValue>>> RecordedChanges; // [Cursor - 1]: records changed to reach Cursor
+
+	void LoadRecordedChanges();
+
+	// The recorded list with the changes up to Generation applied, and the changes after SinceGeneration
+	FString MakeRecordedListJson(int32 Generation) const;
+	FString MakeRecordedChangesJson(int32 SinceGeneration, int32 Generation) const;
+
+	TSharedPtr<IHttpRouter> Router;
+	uint32 ListenPort = 0;
+	TArray<FHttpRouteHandle> RouteHandles;
+	TArray<FTSTicker::FDelegateHandle> DelayedResponses; // Removed on Stop, their callbacks die with the listener
+	FRandomStream Random;
+	double StartTime = 0.0;
+
+	TMap<FString, double> AccessTokenExpiry; // Token -> FPlatformTime::Seconds it expires at
+	TSet<FString> RefreshTokens;
+	int32 NumTokensIssued = 0;
+	int32 ManualChangeGeneration = 0;
+	int32 OldestChangeCursor = 0; // changed_since below this gets a 410
+	TMap<FString, FString> UpdatedDetails; // Bodies PUT per gml_id
+	TArray<FInjectedFailure> InjectedFailures;
+	TArray<double> RecentRequestTimes; // Within the last second, for throttling
+
+	TMap<FString, int32> RequestCounts;
+	int32 NumRequests = 0;
+	int32 NumThrottled = 0;
+	int32 NumInjectedErrors = 0;
+};
@@ -0,0 +1,340 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BuildingEnergyApiSubsystem.h"
+#include "BuildingEnergyDisplay.h"
+#include "BuildingEnergyIngest.h"
+#include "BuildingEnergyMockBackend.h"
+#include "BuildingEnergySyntheticCity.h"
+#include "BuildingEnergyTestAccess.h"
+#include "BuildingStore.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// End-to-end runs of the display against FBuildingEnergyMockBackend on a free local port: real HTTP, the API
+// broker of a standalone game instance, and the display's own request and response handlers. Latent, so the
+// engine ticks the HTTP module, the listener and the ingest tasks between the steps.
+//
+// UnrealEditor-Cmd.exe <Project>.uproject -ExecCmds="Automation RunTests BuildingEnergy.MockBackend; Quit" -nullrhi -unattended
+
+namespace BuildingEnergyMockBackendTests
+{
+	static constexpr double TimeoutSeconds = 30.0;
+	static const TCHAR* const CommunityId = TEXT("mock");
+
+	static int32 CountRecords(const FString& Json)
+	{
+		int32 NumRecords = 0;
+		FBuildingEnergyStreamReader::ReadBuildings(Json, [&NumRecords](FBuildingEnergyRecord&) { ++NumRecords; });
+		return NumRecords;
+	}
+
+	// A standalone game instance (so requests go through the API broker) with one display, and a mock backend
+	// the client is redirected to. Steps are latent commands that run in order; after a failed wait only
+	// Finish still runs, so one timeout does not cascade into a page of errors.
+	class FMockSession : public TSharedFromThis<FMockSession>
+	{
+	public:
+		FMockSession(FAutomationTestBase& InTest, const FBuildingEnergyMockBackendSettings& Settings)
+			: Test(InTest)
+			, Mock(MakeUnique<FBuildingEnergyMockBackend>(Settings))
+		{
+		}
+
+		~FMockSession()
+		{
+			Shutdown();
+		}
+
+		// False when the mock found no free port or the display could not be spawned
+		bool Start()
+		{
+			if (!Test.TestTrue(TEXT("Mock backend listens"), Mock->Start()))
+			{
+				return false;
+			}
+			Test.AddInfo(FString::Printf(TEXT("Mock backend at %s"), *Mock->GetBaseUrl()));
+			Test.TestEqual(TEXT("Client base URL"), UBuildingEnergyApiSubsystem::GetApiBaseUrl(), Mock->GetBaseUrl());
+
+			GameInstance = NewObject<UGameInstance>(GEngine);
+			GameInstance->AddToRoot();
+			GameInstance->InitializeStandalone(TEXT("BuildingEnergyMockBackendTests"));
+
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.ObjectFlags |= RF_Transient;
+			Display = GameInstance->GetWorld()->SpawnActor<ABuildingEnergyDisplay>(SpawnParams);
+			if (!Test.TestNotNull(TEXT("Display"), Display.Get()))
+			{
+				return false;
+			}
+			Display->SetActorTickEnabled(false); // Polls are driven by the test, not by Tick
+			FBuildingEnergyTestAccess::SetCommunity(*Display, CommunityId);
+
+			Api = UBuildingEnergyApiSubsystem::Get(Display.Get());
+			if (!Test.TestNotNull(TEXT("API broker"), Api.Get()))
+			{
+				return false;
+			}
+			FBuildingEnergyTestAccess::BindTokenRejected(*Display, *Api);
+			return true;
+		}
+
+		// Runs Step once the previous commands are done
+		void Then(TFunction<void(FMockSession&)> Step)
+		{
+			ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Session = AsShared(), Step = MoveTemp(Step)]()
+			{
+				if (!Session->bAborted && Session->Display.IsValid())
+				{
+					Step(*Session);
+				}
+				return true;
+			}));
+		}
+
+		// Waits until Condition holds, failing the test after TimeoutSeconds
+		void WaitUntil(const FString& What, TFunction<bool(FMockSession&)> Condition)
+		{
+			ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Session = AsShared(), What, Condition = MoveTemp(Condition), Deadline = 0.0]() mutable
+			{
+				if (Session->bAborted || !Session->Display.IsValid())
+				{
+					return true;
+				}
+				if (Deadline == 0.0)
+				{
+					Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+				}
+				if (Condition(*Session))
+				{
+					return true;
+				}
+				if (FPlatformTime::Seconds() > Deadline)
+				{
+					Session->Test.AddError(FString::Printf(TEXT("Timed out after %.0f s waiting for %s"), TimeoutSeconds, *What));
+					Session->bAborted = true;
+					return true;
+				}
+				return false;
+			}));
+		}
+
+		// Last command of every test: stops the mock and tears the world down, failed waits or not
+		void Finish()
+		{
+			ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Session = AsShared()]()
+			{
+				Session->Shutdown();
+				return true;
+			}));
+		}
+
+		// Waits for the poll in flight, including the full poll a rejected cursor starts from its handler
+		void WaitForPoll()
+		{
+			WaitUntil(TEXT("the poll"), [](FMockSession& Session) { return !FBuildingEnergyTestAccess::IsPolling(*Session.Display); });
+		}
+
+		FAutomationTestBase& Test;
+		TUniquePtr<FBuildingEnergyMockBackend> Mock;
+		TWeakObjectPtr<ABuildingEnergyDisplay> Display;
+		TWeakObjectPtr<UBuildingEnergyApiSubsystem> Api;
+		bool bAborted = false;
+
+	private:
+		void Shutdown()
+		{
+			Mock->Stop();
+			if (ABuildingEnergyDisplay* SpawnedDisplay = Display.Get())
+			{
+				SpawnedDisplay->Destroy();
+			}
+			Display.Reset();
+			if (GameInstance)
+			{
+				UWorld* World = GameInstance->GetWorld();
+				GameInstance->Shutdown();
+				if (World)
+				{
+					GEngine->DestroyWorldContext(World);
+					World->DestroyWorld(false);
+				}
+				GameInstance->RemoveFromRoot();
+				GameInstance = nullptr;
+			}
+		}
+
+		UGameInstance* GameInstance = nullptr; // Rooted while the session runs
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyMockBackendDeltaSyncTest, "BuildingEnergy.MockBackend.DeltaSync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FBuildingEnergyMockBackendDeltaSyncTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyMockBackendTests;
+
+	// Record a city and two change sets for the mock to replay: full list at cursor 0, changes to reach 1 and 2
+	FBuildingEnergySyntheticCity City;
+	City.NumBuildings = 200;
+	const float ChangeFraction = 0.05f;
+	const FString RecordingDirectory = FPaths::AutomationTransientDir() / TEXT("BuildingEnergyMockBackend") / TEXT("DeltaSync");
+	IFileManager::Get().DeleteDirectory(*RecordingDirectory, false, true);
+	const FString Changes[] = { City.GenerateChangesJson(0, 1, ChangeFraction), City.GenerateChangesJson(1, 2, ChangeFraction) };
+	if (!TestTrue(TEXT("Recording written"),
+		FFileHelper::SaveStringToFile(City.GenerateJson(), *(RecordingDirectory / TEXT("buildings-energy.json"))) &&
+		FFileHelper::SaveStringToFile(Changes[0], *(RecordingDirectory / TEXT("changes") / TEXT("1.json"))) &&
+		FFileHelper::SaveStringToFile(Changes[1], *(RecordingDirectory / TEXT("changes") / TEXT("2.json")))))
+	{
+		return false;
+	}
+	const int32 NumChanged[] = { CountRecords(Changes[0]), CountRecords(Changes[1]) };
+	TestTrue(TEXT("Every change set changes something"), NumChanged[0] > 0 && NumChanged[1] > 0);
+
+	FBuildingEnergyMockBackendSettings Settings;
+	Settings.Port = 0;
+	Settings.RecordedPayloadDirectory = RecordingDirectory;
+	const TSharedRef<FMockSession> MockSession = MakeShared<FMockSession>(*this, Settings);
+	if (!MockSession->Start())
+	{
+		return false;
+	}
+
+	MockSession->Then([](FMockSession& Session) { FBuildingEnergyTestAccess::Login(*Session.Display); });
+	MockSession->WaitUntil(TEXT("the preload"), [](FMockSession& Session) { return FBuildingEnergyTestAccess::IsLoaded(*Session.Display); });
+
+	// Full: the first poll has no cursor, gets the whole list and cursor 0; nothing differs from the preload
+	MockSession->Then([NumBuildings = City.NumBuildings](FMockSession& Session)
+	{
+		Session.Test.TestEqual(TEXT("Preloaded buildings"), FBuildingEnergyTestAccess::GetStore(*Session.Display).Num(), NumBuildings);
+		Session.Test.TestEqual(TEXT("Cursor before the first poll"), FBuildingEnergyTestAccess::GetCursor(*Session.Display), FString());
+		FBuildingEnergyTestAccess::Poll(*Session.Display);
+	});
+	MockSession->WaitForPoll();
+	MockSession->Then([](FMockSession& Session)
+	{
+		Session.Test.TestEqual(TEXT("Cursor after the full poll"), FBuildingEnergyTestAccess::GetCursor(*Session.Display), FString(TEXT("0")));
+		Session.Test.TestEqual(TEXT("Patches from the full poll"), FBuildingEnergyTestAccess::TakeQueuedPatches(*Session.Display), 0);
+
+		// A poll that fails keeps its cursor, so the same changes are asked for again
+		Session.Mock->AdvanceChangeGeneration();
+		Session.Mock->FailNextRequests(503, 1, TEXT("/geospatial/buildings-energy/"));
+		FBuildingEnergyTestAccess::Poll(*Session.Display);
+	});
+	MockSession->WaitForPoll();
+	MockSession->Then([](FMockSession& Session)
+	{
+		Session.Test.TestEqual(TEXT("Cursor after a failed poll"), FBuildingEnergyTestAccess::GetCursor(*Session.Display), FString(TEXT("0")));
+		Session.Test.TestEqual(TEXT("Patches from a failed poll"), FBuildingEnergyTestAccess::TakeQueuedPatches(*Session.Display), 0);
+		FBuildingEnergyTestAccess::Poll(*Session.Display);
+	});
+
+	// Delta: changed_since=0 brings the first change set, and the cursor advances once it is applied
+	MockSession->WaitForPoll();
+	MockSession->Then([Expected = NumChanged[0]](FMockSession& Session)
+	{
+		Session.Test.TestEqual(TEXT("Cursor after the delta poll"), FBuildingEnergyTestAccess::GetCursor(*Session.Display), FString(TEXT("1")));
+		Session.Test.TestEqual(TEXT("Patches from the delta poll"), FBuildingEnergyTestAccess::TakeQueuedPatches(*Session.Display), Expected);
+
+		// 410: the server forgets cursor 1 while the second change set lands
+		Session.Mock->AdvanceChangeGeneration();
+		Session.Mock->ExpireChangeCursors();
+		Session.Mock->ResetStatistics();
+		FBuildingEnergyTestAccess::Poll(*Session.Display);
+	});
+
+	// Full again: the rejected cursor is dropped and the community refetched right away
+	MockSession->WaitForPoll();
+	MockSession->Then([Expected = NumChanged[1]](FMockSession& Session)
+	{
+		Session.Test.TestEqual(TEXT("List requests for the rejected cursor and the refetch"), Session.Mock->GetNumRequests(TEXT("list")), 2);
+		Session.Test.TestEqual(TEXT("Cursor after the refetch"), FBuildingEnergyTestAccess::GetCursor(*Session.Display), FString(TEXT("2")));
+		Session.Test.TestEqual(TEXT("Patches from the refetch"), FBuildingEnergyTestAccess::TakeQueuedPatches(*Session.Display), Expected);
+	});
+	MockSession->Finish();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyMockBackendSessionTest, "BuildingEnergy.MockBackend.Session",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FBuildingEnergyMockBackendSessionTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyMockBackendTests;
+
+	// Login, a preload in three pages, a poll, then a poll whose token the server refuses
+	FBuildingEnergyMockBackendSettings Settings;
+	Settings.Port = 0;
+	Settings.NumSyntheticBuildings = 250;
+	Settings.ChangeFraction = 0.05f;
+	static constexpr int32 PageSize = 100;
+	static constexpr int32 NumPages = 3;
+
+	const TSharedRef<FMockSession> MockSession = MakeShared<FMockSession>(*this, Settings);
+	if (!MockSession->Start())
+	{
+		return false;
+	}
+	const int32 NumChanged = CountRecords(MockSession->Mock->GetCity().GenerateChangesJson(0, 1, Settings.ChangeFraction));
+
+	MockSession->Then([](FMockSession& Session)
+	{
+		FBuildingEnergyTestAccess::SetPreloadPageSize(*Session.Display, PageSize);
+		FBuildingEnergyTestAccess::Login(*Session.Display);
+	});
+	MockSession->WaitUntil(TEXT("the login and the paged preload"), [](FMockSession& Session) { return FBuildingEnergyTestAccess::IsLoaded(*Session.Display); });
+	MockSession->Then([NumBuildings = Settings.NumSyntheticBuildings](FMockSession& Session)
+	{
+		Session.Test.TestEqual(TEXT("Logins"), Session.Mock->GetNumRequests(TEXT("token")), 1);
+		Session.Test.TestEqual(TEXT("Preload pages"), Session.Mock->GetNumRequests(TEXT("list")), NumPages);
+		Session.Test.TestEqual(TEXT("Preloaded buildings"), FBuildingEnergyTestAccess::GetStore(*Session.Display).Num(), NumBuildings);
+
+		Session.Mock->ResetStatistics();
+		FBuildingEnergyTestAccess::Poll(*Session.Display);
+	});
+	MockSession->WaitForPoll();
+
+	// Every token issued so far is refused: the broker parks the poll, the display renews the token
+	// with its refresh token and the poll is replayed with the new one
+	const TSharedRef<FString> RejectedToken = MakeShared<FString>();
+	MockSession->Then([RejectedToken](FMockSession& Session)
+	{
+		Session.Test.TestEqual(TEXT("Poll requests"), Session.Mock->GetNumRequests(TEXT("list")), 1);
+		Session.Test.TestEqual(TEXT("Cursor after the first poll"), FBuildingEnergyTestAccess::GetCursor(*Session.Display), FString(TEXT("0")));
+
+		*RejectedToken = FBuildingEnergyTestAccess::GetAccessToken(*Session.Display);
+		Session.Mock->ExpireAccessTokens();
+		Session.Mock->AdvanceChangeGeneration();
+		Session.Mock->ResetStatistics();
+		FBuildingEnergyTestAccess::Poll(*Session.Display);
+	});
+	MockSession->WaitForPoll();
+	MockSession->Then([RejectedToken, NumChanged](FMockSession& Session)
+	{
+		Session.Test.TestEqual(TEXT("Token refreshes"), Session.Mock->GetNumRequests(TEXT("token_refresh")), 1);
+		Session.Test.TestEqual(TEXT("Logins after the 401"), Session.Mock->GetNumRequests(TEXT("token")), 0);
+		Session.Test.TestEqual(TEXT("Rejected and replayed poll requests"), Session.Mock->GetNumRequests(TEXT("list")), 2);
+		Session.Test.TestEqual(TEXT("Requests still parked"), Session.Api.IsValid() ? Session.Api->GetNumParked() : -1, 0);
+		Session.Test.TestTrue(TEXT("Access token renewed"), FBuildingEnergyTestAccess::GetAccessToken(*Session.Display) != *RejectedToken);
+		Session.Test.TestEqual(TEXT("Cursor after the replayed poll"), FBuildingEnergyTestAccess::GetCursor(*Session.Display), FString(TEXT("1")));
+		Session.Test.TestEqual(TEXT("Patches from the replayed poll"), FBuildingEnergyTestAccess::TakeQueuedPatches(*Session.Display), NumChanged);
+
+		// Stopping the mock hands the client back its configured backend
+		const FString MockUrl = Session.Mock->GetBaseUrl();
+		Session.Mock->Stop();
+		Session.Test.TestNotEqual(TEXT("Client base URL after Stop"), UBuildingEnergyApiSubsystem::GetApiBaseUrl(), MockUrl);
+	});
+	MockSession->Finish();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,233 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingEnergyPatch.h"
+#include "BuildingStore.h"
+
+namespace
+{
+	class FPatchReader
+	{
+	public:
+		explicit FPatchReader(TArrayView<const uint8> InBytes) : Bytes(InBytes) {}
+
+		template <typename T>
+		T Read()
+		{
+			T Value{};
+			if (Offset + static_cast<int32>(sizeof(T)) > Bytes.Num())
+			{
+				bOverrun = true;
+				return Value;
+			}
+			FMemory::Memcpy(&Value, Bytes.GetData() + Offset, sizeof(T));
+			Offset += sizeof(T);
+			return Value;
+		}
+
+		bool HasOverrun() const { return bOverrun; }
+		bool IsAtEnd() const { return Offset == Bytes.Num(); }
+
+	private:
+		TArrayView<const uint8> Bytes;
+		int32 Offset = 0;
+		bool bOverrun = false;
+	};
+
+	template <typename T>
+	void Write(TArray<uint8>& Bytes, T Value)
+	{
+		Bytes.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	bool Fail(FString* OutError, const TCHAR* Message)
+	{
+		if (OutError)
+		{
+			*OutError = Message;
+		}
+		return false;
+	}
+}
+
+bool FBuildingPatchCodec::Decode(TArrayView<const uint8> Bytes, FBuildingPatchFrame& OutFrame, FString* OutError)
+{
+	FPatchReader Reader(Bytes);
+	const uint32 FrameMagic = Reader.Read<uint32>();
+	const uint8 FrameVersion = Reader.Read<uint8>();
+	const uint8 Kind = Reader.Read<uint8>();
+	const uint16 NumEntries = Reader.Read<uint16>();
+	OutFrame.NumBuildings = Reader.Read<int32>();
+	OutFrame.IdOrderHash = Reader.Read<uint64>();
+	OutFrame.Sequence = Reader.Read<uint64>();
+	if (Reader.HasOverrun())
+	{
+		return Fail(OutError, TEXT("Frame is shorter than its header"));
+	}
+	if (FrameMagic != Magic || FrameVersion != Version)
+	{
+		return Fail(OutError, TEXT("Frame has an unknown format or version"));
+	}
+
+	OutFrame.Patches.Reset();
+	OutFrame.PaletteEntries.Reset();
+	switch (Kind)
+	{
+	case static_cast<uint8>(FBuildingPatchFrame::EKind::Palette):
+		OutFrame.Kind = FBuildingPatchFrame::EKind::Palette;
+		OutFrame.PaletteEntries.Reserve(NumEntries);
+		for (int32 Entry = 0; Entry < NumEntries; ++Entry)
+		{
+			const uint16 ColorClass = Reader.Read<uint16>();
+			const uint8 R = Reader.Read<uint8>();
+			const uint8 G = Reader.Read<uint8>();
+			const uint8 B = Reader.Read<uint8>();
+			OutFrame.PaletteEntries.Emplace(ColorClass, FColor(R, G, B));
+		}
+		break;
+
+	case static_cast<uint8>(FBuildingPatchFrame::EKind::Patches):
+		OutFrame.Kind = FBuildingPatchFrame::EKind::Patches;
+		OutFrame.Patches.SetNum(NumEntries);
+		for (FBuildingPatch& Patch : OutFrame.Patches)
+		{
+			Patch.BuildingIndex = Reader.Read<int32>();
+			Patch.Fields = static_cast<EBuildingPatchField>(Reader.Read<uint8>());
+			if (EnumHasAnyFlags(Patch.Fields, ~EBuildingPatchField::All))
+			{
+				return Fail(OutError, TEXT("Patch has unknown field bits"));
+			}
+			for (int32 Field = 0; Field < UE_ARRAY_COUNT(Patch.Values); ++Field)
+			{
+				if (EnumHasAnyFlags(Patch.Fields, static_cast<EBuildingPatchField>(1 << Field)))
+				{
+					Patch.Values[Field] = Reader.Read<int32>();
+				}
+			}
+			if (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::ColorClass))
+			{
+				Patch.ColorClass = Reader.Read<uint16>();
+			}
+		}
+		break;
+
+	default:
+		return Fail(OutError, TEXT("Frame has an unknown kind"));
+	}
+
+	if (Reader.HasOverrun() || !Reader.IsAtEnd())
+	{
+		return Fail(OutError, TEXT("Frame size does not match its entries"));
+	}
+	return true;
+}
+
+TArray<uint8> FBuildingPatchCodec::Encode(const FBuildingPatchFrame& Frame)
+{
+	const bool bPalette = Frame.Kind == FBuildingPatchFrame::EKind::Palette;
+	const int32 NumEntries = bPalette ? Frame.PaletteEntries.Num() : Frame.Patches.Num();
+	check(NumEntries <= MAX_uint16);
+
+	TArray<uint8> Bytes;
+	Bytes.Reserve(HeaderSize + NumEntries * (bPalette ? 5 : 23));
+	Write<uint32>(Bytes, Magic);
+	Write<uint8>(Bytes, Version);
+	Write<uint8>(Bytes, static_cast<uint8>(Frame.Kind));
+	Write<uint16>(Bytes, static_cast<uint16>(NumEntries));
+	Write<int32>(Bytes, Frame.NumBuildings);
+	Write<uint64>(Bytes, Frame.IdOrderHash);
+	Write<uint64>(Bytes, Frame.Sequence);
+
+	if (bPalette)
+	{
+		for (const TPair<uint16, FColor>& Entry : Frame.PaletteEntries)
+		{
+			Write<uint16>(Bytes, Entry.Key);
+			Write<uint8>(Bytes, Entry.Value.R);
+			Write<uint8>(Bytes, Entry.Value.G);
+			Write<uint8>(Bytes, Entry.Value.B);
+		}
+		return Bytes;
+	}
+
+	for (const FBuildingPatch& Patch : Frame.Patches)
+	{
+		Write<int32>(Bytes, Patch.BuildingIndex);
+		Write<uint8>(Bytes, static_cast<uint8>(Patch.Fields));
+		for (int32 Field = 0; Field < UE_ARRAY_COUNT(Patch.Values); ++Field)
+		{
+			if (EnumHasAnyFlags(Patch.Fields, static_cast<EBuildingPatchField>(1 << Field)))
+			{
+				Write<int32>(Bytes, Patch.Values[Field]);
+			}
+		}
+		if (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::ColorClass))
+		{
+			Write<uint16>(Bytes, Patch.ColorClass);
+		}
+	}
+	return Bytes;
+}
+
+bool FBuildingPatchCodec::Localize(FBuildingPatch& Patch, const TMap<uint16, int32>& ColorClassMap, const FBuildingStore& Store)
+{
+	if (!Store.IsValidIndex(Patch.BuildingIndex))
+	{
+		return false;
+	}
+	if (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::ColorClass))
+	{
+		const int32* MappedClass = ColorClassMap.Find(Patch.ColorClass);
+		if (!MappedClass)
+		{
+			return false;
+		}
+		Patch.ColorClass = static_cast<uint16>(*MappedClass);
+	}
+	return true;
+}
+
+void FBuildingPatchCodec::Merge(FBuildingPatch& Into, const FBuildingPatch& From)
+{
+	Into.BuildingIndex = From.BuildingIndex;
+	for (int32 Field = 0; Field < UE_ARRAY_COUNT(From.Values); ++Field)
+	{
+		if (EnumHasAnyFlags(From.Fields, static_cast<EBuildingPatchField>(1 << Field)))
+		{
+			Into.Values[Field] = From.Values[Field];
+		}
+	}
+	if (EnumHasAnyFlags(From.Fields, EBuildingPatchField::ColorClass))
+	{
+		Into.ColorClass = From.ColorClass;
+	}
+	Into.Fields |= From.Fields;
+}
+
+bool FBuildingPatchCodec::Apply(const FBuildingPatch& Patch, FBuildingStore& Store)
+{
+	const int32 Index = Patch.BuildingIndex;
+	if (!Store.IsValidIndex(Index))
+	{
+		return false;
+	}
+
+	if (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::EnergyValues))
+	{
+		int32 Values[] = { Store.BeginCO2[Index], Store.EndCO2[Index], Store.BeginSpecificDemand[Index], Store.EndSpecificDemand[Index] };
+		for (int32 Field = 0; Field < UE_ARRAY_COUNT(Values); ++Field)
+		{
+			if (EnumHasAnyFlags(Patch.Fields, static_cast<EBuildingPatchField>(1 << Field)))
+			{
+				Values[Field] = Patch.Values[Field];
+			}
+		}
+		Store.SetEnergyValues(Index, Values[0], Values[1], Values[2], Values[3]);
+	}
+	if (EnumHasAnyFlags(Patch.Fields, EBuildingPatchField::ColorClass) && Patch.ColorClass < Store.Palette.Num())
+	{
+		Store.SetColorClass(Index, Patch.ColorClass);
+	}
+
+	Store.DisplayTextOverrides.Remove(Index);
+	return true;
+}
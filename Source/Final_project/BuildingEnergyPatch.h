@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FBuildingStore;
+
+// Fields carried by one building patch
+enum class EBuildingPatchField : uint8
+{
+	None = 0,
+	BeginCO2 = 1 << 0,
+	EndCO2 = 1 << 1,
+	BeginSpecificDemand = 1 << 2,
+	EndSpecificDemand = 1 << 3,
+	ColorClass = 1 << 4,
+
+	EnergyValues = BeginCO2 | EndCO2 | BeginSpecificDemand | EndSpecificDemand,
+	All = EnergyValues | ColorClass
+};
+ENUM_CLASS_FLAGS(EBuildingPatchField)
+
+// In-place update of one building, addressed by its dense store index
+struct FBuildingPatch
+{
+	int32 BuildingIndex = INDEX_NONE;
+	EBuildingPatchField Fields = EBuildingPatchField::None;
+	int32 Values[4] = {}; // BeginCO2, EndCO2, BeginSpecificDemand, EndSpecificDemand; only the masked ones are meaningful
+	uint16 ColorClass = 0; // Server palette class, mapped through the palette frames
+};
+
+// One decoded push frame
+struct FBuildingPatchFrame
+{
+	enum class EKind : uint8
+	{
+		Patches = 0,
+		Palette = 1
+	};
+
+	EKind Kind = EKind::Patches;
+	uint64 Sequence = 0; // Consecutive over every frame of a connection
+	int32 NumBuildings = 0; // Server's building count
+	uint64 IdOrderHash = 0; // FBuildingStore::GetIdOrderHash of the server's order; indices are only valid against a store with the same hash
+	TArray<FBuildingPatch> Patches;
+	TArray<TPair<uint16, FColor>> PaletteEntries; // Server class -> sRGB color
+};
+
+// Binary frames of the energy push WebSocket, read without any JSON.
+// Little-endian, packed:
+//   header  : uint32 magic "BEPF", uint8 version, uint8 kind, uint16 entry count, int32 building count,
+//             uint64 id order hash, uint64 sequence
+//   palette : per entry uint16 server color class, uint8 R, G, B (sRGB)
+//   patches : per entry int32 building index, uint8 field mask, then one int32 per energy bit in mask order
+//             and a uint16 color class when the color bit is set
+class FINAL_PROJECT_API FBuildingPatchCodec
+{
+public:
+	static constexpr uint32 Magic = 0x46504542; // "BEPF"
+	static constexpr uint8 Version = 2; // 2: id order hash
+	static constexpr int32 HeaderSize = 28;
+
+	static bool Decode(TArrayView<const uint8> Bytes, FBuildingPatchFrame& OutFrame, FString* OutError = nullptr);
+
+	// Inverse of Decode, used by the automation tests; the push server implements the same layout
+	static TArray<uint8> Encode(const FBuildingPatchFrame& Frame);
+
+	// Turns a server patch into a store patch: checks the index and maps the server color class
+	// through ColorClassMap. False when either does not resolve.
+	static bool Localize(FBuildingPatch& Patch, const TMap<uint16, int32>& ColorClassMap, const FBuildingStore& Store);
+
+	// Coalesces two patches of one building; fields set in From win
+	static void Merge(FBuildingPatch& Into, const FBuildingPatch& From);
+
+	// Writes a store patch in place and drops the building's display text override, so the info
+	// widget shows the new values. False when the index is out of range.
+	static bool Apply(const FBuildingPatch& Patch, FBuildingStore& Store);
+};
@@ -0,0 +1,208 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BuildingEnergyPatch.h"
+#include "BuildingStore.h"
+
+// Binary push frames: Encode/Decode round trips, and frames cut short or padded must be rejected.
+// These cover the codec only; the socket path (reconnect, sequence gaps, resync) still awaits a WebSocket stand-in.
+//
+// UnrealEditor-Cmd.exe <Project>.uproject -ExecCmds="Automation RunTests BuildingEnergy.Patch; Quit" -nullrhi -unattended
+
+namespace BuildingEnergyPatchTests
+{
+	FBuildingPatchFrame MakePatchFrame()
+	{
+		FBuildingPatchFrame Frame;
+		Frame.Kind = FBuildingPatchFrame::EKind::Patches;
+		Frame.Sequence = 0x0102030405060708ull;
+		Frame.NumBuildings = 3;
+		Frame.IdOrderHash = 0xfedcba9876543210ull;
+
+		FBuildingPatch& Full = Frame.Patches.AddDefaulted_GetRef();
+		Full.BuildingIndex = 0;
+		Full.Fields = EBuildingPatchField::All;
+		Full.Values[0] = 1200;
+		Full.Values[1] = 800;
+		Full.Values[2] = -5;
+		Full.Values[3] = MIN_int32;
+		Full.ColorClass = 7;
+
+		FBuildingPatch& ColorOnly = Frame.Patches.AddDefaulted_GetRef();
+		ColorOnly.BuildingIndex = 2;
+		ColorOnly.Fields = EBuildingPatchField::ColorClass;
+		ColorOnly.ColorClass = MAX_uint16 - 1;
+
+		FBuildingPatch& Sparse = Frame.Patches.AddDefaulted_GetRef();
+		Sparse.BuildingIndex = 1;
+		Sparse.Fields = EBuildingPatchField::EndCO2 | EBuildingPatchField::EndSpecificDemand;
+		Sparse.Values[1] = 42;
+		Sparse.Values[3] = 17;
+		return Frame;
+	}
+
+	FBuildingPatchFrame MakePaletteFrame()
+	{
+		FBuildingPatchFrame Frame;
+		Frame.Kind = FBuildingPatchFrame::EKind::Palette;
+		Frame.Sequence = 1;
+		Frame.NumBuildings = 3;
+		Frame.IdOrderHash = 0xfedcba9876543210ull;
+		Frame.PaletteEntries.Emplace(0, FColor(0x66, 0xb0, 0x32));
+		Frame.PaletteEntries.Emplace(7, FColor(0xff, 0x57, 0x33));
+		return Frame;
+	}
+
+	bool DecodeBytes(const TArray<uint8>& Bytes, FBuildingPatchFrame& OutFrame)
+	{
+		return FBuildingPatchCodec::Decode(Bytes, OutFrame);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyPatchRoundTripTest, "BuildingEnergy.Patch.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FBuildingEnergyPatchRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyPatchTests;
+
+	const FBuildingPatchFrame Patches = MakePatchFrame();
+	FBuildingPatchFrame Decoded;
+	FString Error;
+	TestTrue(TEXT("Patch frame decodes"), FBuildingPatchCodec::Decode(FBuildingPatchCodec::Encode(Patches), Decoded, &Error));
+	TestEqual(TEXT("Decode error"), Error, FString());
+	TestTrue(TEXT("Kind"), Decoded.Kind == Patches.Kind);
+	TestEqual(TEXT("Sequence"), Decoded.Sequence, Patches.Sequence);
+	TestEqual(TEXT("Building count"), Decoded.NumBuildings, Patches.NumBuildings);
+	TestEqual(TEXT("Id order hash"), Decoded.IdOrderHash, Patches.IdOrderHash);
+	if (TestEqual(TEXT("Patch count"), Decoded.Patches.Num(), Patches.Patches.Num()))
+	{
+		for (int32 Index = 0; Index < Patches.Patches.Num(); ++Index)
+		{
+			const FBuildingPatch& Expected = Patches.Patches[Index];
+			const FBuildingPatch& Actual = Decoded.Patches[Index];
+			TestEqual(TEXT("Building index"), Actual.BuildingIndex, Expected.BuildingIndex);
+			TestTrue(TEXT("Field mask"), Actual.Fields == Expected.Fields);
+			for (int32 Field = 0; Field < UE_ARRAY_COUNT(Expected.Values); ++Field)
+			{
+				if (EnumHasAnyFlags(Expected.Fields, static_cast<EBuildingPatchField>(1 << Field)))
+				{
+					TestEqual(FString::Printf(TEXT("Value %d of patch %d"), Field, Index), Actual.Values[Field], Expected.Values[Field]);
+				}
+			}
+			if (EnumHasAnyFlags(Expected.Fields, EBuildingPatchField::ColorClass))
+			{
+				TestEqual(TEXT("Color class"), Actual.ColorClass, Expected.ColorClass);
+			}
+		}
+	}
+
+	const FBuildingPatchFrame Palette = MakePaletteFrame();
+	TestTrue(TEXT("Palette frame decodes"), DecodeBytes(FBuildingPatchCodec::Encode(Palette), Decoded));
+	TestTrue(TEXT("Palette kind"), Decoded.Kind == FBuildingPatchFrame::EKind::Palette);
+	TestEqual(TEXT("Palette patches"), Decoded.Patches.Num(), 0);
+	if (TestEqual(TEXT("Palette entries"), Decoded.PaletteEntries.Num(), Palette.PaletteEntries.Num()))
+	{
+		for (int32 Index = 0; Index < Palette.PaletteEntries.Num(); ++Index)
+		{
+			TestEqual(TEXT("Palette class"), Decoded.PaletteEntries[Index].Key, Palette.PaletteEntries[Index].Key);
+			TestTrue(TEXT("Palette color"), Decoded.PaletteEntries[Index].Value == Palette.PaletteEntries[Index].Value);
+		}
+	}
+
+	FBuildingPatchFrame Empty;
+	Empty.Sequence = 9;
+	TestEqual(TEXT("Empty frame is a bare header"), FBuildingPatchCodec::Encode(Empty).Num(), FBuildingPatchCodec::HeaderSize);
+	TestTrue(TEXT("Empty frame decodes"), DecodeBytes(FBuildingPatchCodec::Encode(Empty), Decoded) && Decoded.Patches.Num() == 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyPatchMalformedTest, "BuildingEnergy.Patch.Malformed",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FBuildingEnergyPatchMalformedTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyPatchTests;
+
+	FBuildingPatchFrame Decoded;
+	for (const FBuildingPatchFrame& Frame : { MakePatchFrame(), MakePaletteFrame() })
+	{
+		const TArray<uint8> Bytes = FBuildingPatchCodec::Encode(Frame);
+
+		// Every cut, inside the header or inside an entry
+		int32 NumTruncatedAccepted = 0;
+		for (int32 Length = 0; Length < Bytes.Num(); ++Length)
+		{
+			NumTruncatedAccepted += FBuildingPatchCodec::Decode(MakeArrayView(Bytes.GetData(), Length), Decoded) ? 1 : 0;
+		}
+		TestEqual(TEXT("Truncated frames accepted"), NumTruncatedAccepted, 0);
+
+		TArray<uint8> Oversized = Bytes;
+		Oversized.Add(0);
+		TestFalse(TEXT("Frame with a trailing byte"), DecodeBytes(Oversized, Decoded));
+
+		// One entry more than the bytes hold
+		TArray<uint8> Overcounted = Bytes;
+		const uint16 NumEntries = Overcounted[6] | (Overcounted[7] << 8);
+		Overcounted[6] = static_cast<uint8>(NumEntries + 1);
+		Overcounted[7] = static_cast<uint8>((NumEntries + 1) >> 8);
+		TestFalse(TEXT("Frame claiming an extra entry"), DecodeBytes(Overcounted, Decoded));
+	}
+
+	TArray<uint8> Bytes = FBuildingPatchCodec::Encode(MakePatchFrame());
+	TArray<uint8> BadMagic = Bytes;
+	BadMagic[0] ^= 0xFF;
+	TestFalse(TEXT("Unknown magic"), DecodeBytes(BadMagic, Decoded));
+
+	TArray<uint8> BadVersion = Bytes;
+	BadVersion[4] = FBuildingPatchCodec::Version + 1;
+	TestFalse(TEXT("Unknown version"), DecodeBytes(BadVersion, Decoded));
+
+	TArray<uint8> BadKind = Bytes;
+	BadKind[5] = 0xFF;
+	TestFalse(TEXT("Unknown kind"), DecodeBytes(BadKind, Decoded));
+
+	// The first patch's field mask follows its int32 building index
+	TArray<uint8> BadFields = Bytes;
+	BadFields[FBuildingPatchCodec::HeaderSize + 4] |= 0x80;
+	TestFalse(TEXT("Unknown field bits"), DecodeBytes(BadFields, Decoded));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyPatchIdOrderTest, "BuildingEnergy.Patch.IdOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FBuildingEnergyPatchIdOrderTest::RunTest(const FString& Parameters)
+{
+	// Same buildings, same count, different order: index-addressed patches must not line up
+	FBuildingStore Forward;
+	Forward.FindOrAddBuilding(TEXT("DEBW_A"));
+	Forward.FindOrAddBuilding(TEXT("DEBW_B"));
+
+	FBuildingStore Backward;
+	Backward.FindOrAddBuilding(TEXT("DEBW_B"));
+	Backward.FindOrAddBuilding(TEXT("DEBW_A"));
+	TestNotEqual(TEXT("Order hash of swapped buildings"), Forward.GetIdOrderHash(), Backward.GetIdOrderHash());
+
+	// Known ids do not change the order
+	FBuildingStore Again;
+	Again.FindOrAddBuilding(TEXT("DEBW_A"));
+	Again.FindOrAddBuilding(TEXT("DEBW_B"));
+	Again.FindOrAddBuilding(TEXT("DEBW_A"));
+	TestEqual(TEXT("Order hash after a repeated id"), Again.GetIdOrderHash(), Forward.GetIdOrderHash());
+
+	// FNV-1a 64 of "a\n", so a server in any language can reproduce it
+	FBuildingStore Single;
+	Single.FindOrAddBuilding(TEXT("a"));
+	TestEqual(TEXT("Documented hash"), Single.GetIdOrderHash(), 0x089bdc07b544e7b2ull);
+
+	Forward.Reset();
+	TestEqual(TEXT("Order hash of an empty store"), Forward.GetIdOrderHash(), FBuildingStore().GetIdOrderHash());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,486 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BuildingEnergyDisplay.h"
+#include "BuildingEnergyIngest.h"
+#include "BuildingEnergyLog.h"
+#include "BuildingEnergySyntheticCity.h"
+#include "BuildingEnergyTestAccess.h"
+#include "BuildingStore.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ConfigCacheIni.h"
+#include <atomic>
+
+// Performance regression suite: every pipeline runs on the same synthetic city and fails when it needs more
+// time, allocations or peak memory per building than the budgets in [BuildingEnergy.Perf] of DefaultGame.ini.
+// The allocation budgets are the tight ones - e.g. a TJsonWriter round-trip per building during style
+// generation multiplies StyleAllocationsPerBuilding long before it shows up in the timings.
+//
+// UnrealEditor-Cmd.exe <Project>.uproject -ExecCmds="Automation RunTests BuildingEnergy.Perf; Quit" -nullrhi -unattended
+
+namespace BuildingEnergyPerfTests
+{
+	static const TCHAR* const BudgetSection = TEXT("BuildingEnergy.Perf");
+
+	// The fixed dataset every budget refers to; changing it means re-baselining all of them
+	static constexpr int32 NumBuildings = 5000;
+	static constexpr int32 Seed = 1;
+	static constexpr float ChangeFraction = 0.01f;
+	static constexpr int32 Repeats = 3;
+
+	// Forwards to the engine allocator and counts what the measuring thread allocates between Start() and Stop().
+	// Installed once, on first use, and never removed: GMalloc is published with a single atomic exchange and
+	// every call made through a stale pointer still reaches the allocator underneath.
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		static FCountingMalloc& Get()
+		{
+			static FCountingMalloc* const Instance = []()
+			{
+				FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+				FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), CountingMalloc);
+				return CountingMalloc;
+			}();
+			return *Instance;
+		}
+
+		// Only the calling thread is counted; render, task graph and editor threads allocate concurrently
+		void Start()
+		{
+			NumAllocations = 0;
+			LiveBytes = 0;
+			PeakBytes = 0;
+			CountingThreadId = FPlatformTLS::GetCurrentThreadId();
+		}
+
+		void Stop()
+		{
+			CountingThreadId = 0;
+		}
+
+		int64 GetNumAllocations() const { return NumAllocations; }
+		int64 GetPeakBytes() const { return PeakBytes; }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			void* Result = Inner->Malloc(Count, Alignment);
+			if (IsCounting())
+			{
+				++NumAllocations;
+				AddLiveBytes(static_cast<int64>(SizeOf(Result, Count)));
+			}
+			return Result;
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			void* Result = Inner->TryMalloc(Count, Alignment);
+			if (Result && IsCounting())
+			{
+				++NumAllocations;
+				AddLiveBytes(static_cast<int64>(SizeOf(Result, Count)));
+			}
+			return Result;
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (!IsCounting())
+			{
+				return Inner->Realloc(Original, Count, Alignment);
+			}
+			const int64 OldBytes = Original ? static_cast<int64>(SizeOf(Original, 0)) : 0;
+			void* Result = Inner->Realloc(Original, Count, Alignment);
+			NumAllocations += Count > 0 ? 1 : 0; // Every growth of a container counts, shrinking to zero is a free
+			AddLiveBytes((Result ? static_cast<int64>(SizeOf(Result, Count)) : 0) - OldBytes);
+			return Result;
+		}
+
+		virtual void Free(void* Original) override
+		{
+			if (Original && IsCounting())
+			{
+				AddLiveBytes(-static_cast<int64>(SizeOf(Original, 0)));
+			}
+			Inner->Free(Original);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+		explicit FCountingMalloc(FMalloc* InInner)
+			: Inner(InInner)
+		{
+		}
+
+		bool IsCounting() const { return CountingThreadId != 0 && FPlatformTLS::GetCurrentThreadId() == CountingThreadId; }
+
+		// Allocators that cannot report block sizes (the ANSI one) are counted at the requested size, frees at zero
+		SIZE_T SizeOf(void* Block, SIZE_T RequestedSize) const
+		{
+			SIZE_T BlockSize = 0;
+			return Block && Inner->GetAllocationSize(Block, BlockSize) ? BlockSize : RequestedSize;
+		}
+
+		void AddLiveBytes(int64 Bytes)
+		{
+			LiveBytes += Bytes;
+			PeakBytes = FMath::Max(PeakBytes, LiveBytes);
+		}
+
+		FMalloc* const Inner;
+		std::atomic<uint32> CountingThreadId = 0;
+		int64 NumAllocations = 0; // Written by the counting thread only
+		int64 LiveBytes = 0; // Relative to Start(), negative after freeing older blocks
+		int64 PeakBytes = 0;
+	};
+
+	// Fastest time, most allocations and highest peak over the repeats of one pipeline
+	struct FPerfSample
+	{
+		double Seconds = TNumericLimits<double>::Max();
+		int64 NumAllocations = 0;
+		int64 PeakBytes = 0;
+	};
+
+	// Measures the test thread between Begin() and End(); everything else on the thread stays outside the pair
+	class FPerfProbe
+	{
+	public:
+		explicit FPerfProbe(FAutomationTestBase& InTest)
+			: Test(InTest)
+		{
+			// A build whose FMemory bypasses GMalloc would report zero allocations and pass every budget
+			FCountingMalloc& CountingMalloc = FCountingMalloc::Get();
+			CountingMalloc.Start();
+			FMemory::Free(FMemory::Malloc(64));
+			CountingMalloc.Stop();
+			if (CountingMalloc.GetNumAllocations() == 0)
+			{
+				Test.AddError(TEXT("Allocations are not routed through GMalloc in this build, so the allocation and memory budgets cannot be checked"));
+			}
+		}
+
+		void Begin()
+		{
+			FCountingMalloc::Get().Start();
+			StartTime = FPlatformTime::Seconds();
+		}
+
+		void End()
+		{
+			const double Seconds = FPlatformTime::Seconds() - StartTime;
+			FCountingMalloc& CountingMalloc = FCountingMalloc::Get();
+			CountingMalloc.Stop();
+			Sample.Seconds = FMath::Min(Sample.Seconds, Seconds);
+			Sample.NumAllocations = FMath::Max(Sample.NumAllocations, CountingMalloc.GetNumAllocations());
+			Sample.PeakBytes = FMath::Max(Sample.PeakBytes, CountingMalloc.GetPeakBytes());
+		}
+
+		// Fails the test for every per-building metric above its <Pipeline><Metric> budget, or without a budget
+		void CheckBudgets(const TCHAR* Pipeline, int32 NumItems) const
+		{
+			const double Items = FMath::Max(1, NumItems);
+#if UE_BUILD_DEBUG
+			Test.AddInfo(FString::Printf(TEXT("%s: %.3f us per building, time budget skipped in Debug builds"), Pipeline, Sample.Seconds * 1.0e6 / Items));
+#else
+			CheckBudget(Pipeline, TEXT("MicrosecondsPerBuilding"), Sample.Seconds * 1.0e6 / Items);
+#endif
+			CheckBudget(Pipeline, TEXT("AllocationsPerBuilding"), Sample.NumAllocations / Items);
+			CheckBudget(Pipeline, TEXT("PeakBytesPerBuilding"), Sample.PeakBytes / Items);
+			Test.AddInfo(FString::Printf(TEXT("%s: peak used physical %.1f MB"), Pipeline, FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0)));
+		}
+
+		FPerfSample Sample;
+
+	private:
+		void CheckBudget(const TCHAR* Pipeline, const TCHAR* Metric, double Measured) const
+		{
+			const FString Key = FString::Printf(TEXT("%s%s"), Pipeline, Metric);
+			double Budget = 0.0;
+			if (!GConfig->GetDouble(BudgetSection, *Key, Budget, GGameIni))
+			{
+				Test.AddError(FString::Printf(TEXT("No budget %s in [%s] of DefaultGame.ini (measured %.3f)"), *Key, BudgetSection, Measured));
+			}
+			else if (Measured > Budget)
+			{
+				Test.AddError(FString::Printf(TEXT("%s: %.3f exceeds the budget of %.3f"), *Key, Measured, Budget));
+			}
+			else
+			{
+				Test.AddInfo(FString::Printf(TEXT("%s: %.3f (budget %.3f)"), *Key, Measured, Budget));
+			}
+		}
+
+		FAutomationTestBase& Test;
+		double StartTime = 0.0;
+	};
+
+	static FBuildingEnergySyntheticCity MakeCity()
+	{
+		FBuildingEnergySyntheticCity City;
+		City.NumBuildings = NumBuildings;
+		City.Seed = Seed;
+		return City;
+	}
+
+	// Pages reach the ingest as the UTF-8 bytes of the HTTP response
+	static TArray<uint8> ToUtf8(const FString& Json)
+	{
+		const FTCHARToUTF8 Converted(*Json, Json.Len());
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	// The worker half of IngestCommunityPage, run on the calling thread so the probe sees its allocations
+	static int32 IngestInto(FBuildingStore& Store, TConstArrayView<uint8> Utf8Json)
+	{
+		int32 NumCached = 0;
+		FBuildingEnergyStreamReader::ReadBuildings(Utf8Json, [&Store, &NumCached](FBuildingEnergyRecord& Record)
+		{
+			if (FBuildingEnergyTestAccess::CacheBuildingRecord(Store, Record))
+			{
+				++NumCached;
+			}
+		});
+		Store.FinalizeGeometry();
+		Store.FinalizeIdIndex();
+		return NumCached;
+	}
+
+	// A display in a transient world holding the ingested city; BeginPlay never runs, so nothing is fetched
+	class FPerfDisplay
+	{
+	public:
+		explicit FPerfDisplay(const FString& Json)
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("BuildingEnergyPerfTests"));
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.ObjectFlags |= RF_Transient;
+			Display = World->SpawnActor<ABuildingEnergyDisplay>(SpawnParams);
+			if (Display)
+			{
+				Display->SetActorTickEnabled(false);
+				IngestInto(FBuildingEnergyTestAccess::GetStore(*Display), ToUtf8(Json));
+			}
+		}
+
+		~FPerfDisplay()
+		{
+			if (Display)
+			{
+				Display->Destroy();
+			}
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		ABuildingEnergyDisplay* Get() const { return Display; }
+
+	private:
+		UWorld* World = nullptr;
+		ABuildingEnergyDisplay* Display = nullptr;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyPerfIngestTest, "BuildingEnergy.Perf.Ingest",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FBuildingEnergyPerfIngestTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyPerfTests;
+	FBuildingLogSilenceScope SilencedLogs;
+
+	const FBuildingEnergySyntheticCity City = MakeCity();
+	const TArray<uint8> Json = ToUtf8(City.GenerateJson());
+
+	FPerfProbe Probe(*this);
+	for (int32 Repeat = 0; Repeat < Repeats; ++Repeat)
+	{
+		FBuildingStore Store;
+		Probe.Begin();
+		const int32 NumCached = IngestInto(Store, Json);
+		Probe.End();
+
+		TestEqual(TEXT("Cached buildings"), NumCached, City.NumBuildings);
+		TestEqual(TEXT("Stored buildings"), Store.Num(), City.NumBuildings);
+	}
+	Probe.CheckBudgets(TEXT("Ingest"), City.NumBuildings);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyPerfStyleJsonTest, "BuildingEnergy.Perf.StyleJson",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FBuildingEnergyPerfStyleJsonTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyPerfTests;
+	FBuildingLogSilenceScope SilencedLogs;
+
+	const FBuildingEnergySyntheticCity City = MakeCity();
+	FPerfDisplay PerfDisplay(City.GenerateJson());
+	ABuildingEnergyDisplay* Display = PerfDisplay.Get();
+	if (!TestNotNull(TEXT("Display"), Display))
+	{
+		return false;
+	}
+
+	// The full rebuild from an empty style state, as after a preload
+	FPerfProbe Probe(*this);
+	for (int32 Repeat = 0; Repeat < Repeats; ++Repeat)
+	{
+		FBuildingEnergyTestAccess::ResetStyleState(*Display);
+		Probe.Begin();
+		const FString StyleJson = Display->CreateCesiumColorExpression();
+		Probe.End();
+
+		TestTrue(TEXT("Style colors the generated buildings"), StyleJson.Contains(City.GetModifiedGmlId(City.NumBuildings - 1)));
+	}
+	Probe.CheckBudgets(TEXT("Style"), City.NumBuildings);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyPerfIdResolutionTest, "BuildingEnergy.Perf.IdResolution",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FBuildingEnergyPerfIdResolutionTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyPerfTests;
+	FBuildingLogSilenceScope SilencedLogs;
+
+	const FBuildingEnergySyntheticCity City = MakeCity();
+	FBuildingStore Store;
+	IngestInto(Store, ToUtf8(City.GenerateJson()));
+
+	// Both exact ids and a variant (lower case) per building, built outside the probe
+	TArray<FString> Queries;
+	Queries.Reserve(City.NumBuildings * 3);
+	for (int32 Index = 0; Index < City.NumBuildings; ++Index)
+	{
+		Queries.Add(City.GetModifiedGmlId(Index));
+		Queries.Add(City.GetActualGmlId(Index));
+		Queries.Add(City.GetModifiedGmlId(Index).ToLower());
+	}
+	TArray<int32> Resolved;
+	Resolved.SetNumUninitialized(Queries.Num());
+
+	FPerfProbe Probe(*this);
+	for (int32 Repeat = 0; Repeat < Repeats; ++Repeat)
+	{
+		Probe.Begin();
+		for (int32 QueryIndex = 0; QueryIndex < Queries.Num(); ++QueryIndex)
+		{
+			Resolved[QueryIndex] = Store.ResolveIndex(Queries[QueryIndex]);
+		}
+		Probe.End();
+	}
+
+	int32 NumMisses = 0;
+	for (int32 QueryIndex = 0; QueryIndex < Queries.Num(); QueryIndex += 3)
+	{
+		const int32 Expected = Resolved[QueryIndex];
+		NumMisses += (Expected == INDEX_NONE || Resolved[QueryIndex + 1] != Expected || Resolved[QueryIndex + 2] != Expected) ? 1 : 0;
+	}
+	TestEqual(TEXT("Buildings whose ids did not all resolve to it"), NumMisses, 0);
+	Probe.CheckBudgets(TEXT("IdResolution"), City.NumBuildings);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyPerfPickingTest, "BuildingEnergy.Perf.Picking",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FBuildingEnergyPerfPickingTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyPerfTests;
+	FBuildingLogSilenceScope SilencedLogs;
+
+	const FBuildingEnergySyntheticCity City = MakeCity();
+	FPerfDisplay PerfDisplay(City.GenerateJson());
+	ABuildingEnergyDisplay* Display = PerfDisplay.Get();
+	if (!TestNotNull(TEXT("Display"), Display))
+	{
+		return false;
+	}
+
+	// One click at the center of every footprint
+	TArray<FString> Picked;
+	Picked.SetNum(City.NumBuildings);
+
+	FPerfProbe Probe(*this);
+	for (int32 Repeat = 0; Repeat < Repeats; ++Repeat)
+	{
+		Probe.Begin();
+		for (int32 Index = 0; Index < City.NumBuildings; ++Index)
+		{
+			Picked[Index] = Display->GetBuildingByCoordinates(City.GetCenter(Index));
+		}
+		Probe.End();
+	}
+
+	int32 NumMisses = 0;
+	for (int32 Index = 0; Index < City.NumBuildings; ++Index)
+	{
+		NumMisses += Picked[Index].Equals(City.GetModifiedGmlId(Index), ESearchCase::CaseSensitive) ? 0 : 1;
+	}
+	TestEqual(TEXT("Clicks that missed their building"), NumMisses, 0);
+	Probe.CheckBudgets(TEXT("Picking"), City.NumBuildings);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuildingEnergyPerfPollingDiffTest, "BuildingEnergy.Perf.PollingDiff",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FBuildingEnergyPerfPollingDiffTest::RunTest(const FString& Parameters)
+{
+	using namespace BuildingEnergyPerfTests;
+	FBuildingLogSilenceScope SilencedLogs;
+
+	const FBuildingEnergySyntheticCity City = MakeCity();
+	FPerfDisplay PerfDisplay(City.GenerateJson());
+	ABuildingEnergyDisplay* Display = PerfDisplay.Get();
+	if (!TestNotNull(TEXT("Display"), Display))
+	{
+		return false;
+	}
+
+	// Polls alternate between the first change generation and the ingested one, so each recolors the same buildings
+	const FString PollJsons[2] = { City.GenerateJson(1, ChangeFraction), City.GenerateJson(0, ChangeFraction) };
+	const int32 ExpectedChanges = City.CountChangedBuildings(1, ChangeFraction);
+
+	FPerfProbe Probe(*this);
+	for (int32 Repeat = 0; Repeat < Repeats * 2; ++Repeat)
+	{
+		Probe.Begin();
+		const bool bParsed = FBuildingEnergyTestAccess::DetectAndApplyChanges(*Display, PollJsons[Repeat % 2]);
+		Probe.End();
+
+		TestTrue(TEXT("Poll parsed"), bParsed);
+		TestEqual(TEXT("Patches queued by the poll"), FBuildingEnergyTestAccess::TakeQueuedPatches(*Display), ExpectedChanges);
+	}
+	Probe.CheckBudgets(TEXT("PollingDiff"), City.NumBuildings);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,26 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingEnergyStats.h"
+
+DEFINE_STAT(STAT_BuildingEnergy_Ingest);
+DEFINE_STAT(STAT_BuildingEnergy_Merge);
+DEFINE_STAT(STAT_BuildingEnergy_SnapshotLoad);
+DEFINE_STAT(STAT_BuildingEnergy_Publish);
+DEFINE_STAT(STAT_BuildingEnergy_StyleGeneration);
+DEFINE_STAT(STAT_BuildingEnergy_StyleApplication);
+DEFINE_STAT(STAT_BuildingEnergy_ColorLut);
+DEFINE_STAT(STAT_BuildingEnergy_ClickResolution);
+DEFINE_STAT(STAT_BuildingEnergy_HitTest);
+DEFINE_STAT(STAT_BuildingEnergy_ChangeDetection);
+DEFINE_STAT(STAT_BuildingEnergy_ApplyUpdates);
+DEFINE_STAT(STAT_BuildingEnergy_WidgetPopulation);
+
+DEFINE_STAT(STAT_BuildingEnergy_NumBuildings);
+DEFINE_STAT(STAT_BuildingEnergy_NumQueuedUpdates);
+DEFINE_STAT(STAT_BuildingEnergy_NumChunks);
+
+DEFINE_STAT(STAT_BuildingEnergy_StoreMemory);
+DEFINE_STAT(STAT_BuildingEnergy_ShardMemory);
+DEFINE_STAT(STAT_BuildingEnergy_ChunkMemory);
+DEFINE_STAT(STAT_BuildingEnergy_StyleMemory);
+DEFINE_STAT(STAT_BuildingEnergy_ColorLutMemory);
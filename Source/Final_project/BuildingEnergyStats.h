@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// `stat BuildingEnergy` in the console; the same scopes show up as BuildingEnergy_* timers in Unreal Insights
+DECLARE_STATS_GROUP(TEXT("BuildingEnergy"), STATGROUP_BuildingEnergy, STATCAT_Advanced);
+
+// === Cycle counters ===
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ingest (parse)"), STAT_BuildingEnergy_Ingest, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ingest (merge)"), STAT_BuildingEnergy_Merge, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Snapshot load"), STAT_BuildingEnergy_SnapshotLoad, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Publish store"), STAT_BuildingEnergy_Publish, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Style generation"), STAT_BuildingEnergy_StyleGeneration, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Style application"), STAT_BuildingEnergy_StyleApplication, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Color LUT upload"), STAT_BuildingEnergy_ColorLut, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Click resolution"), STAT_BuildingEnergy_ClickResolution, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hit-testing"), STAT_BuildingEnergy_HitTest, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Change detection"), STAT_BuildingEnergy_ChangeDetection, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply updates"), STAT_BuildingEnergy_ApplyUpdates, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Widget population"), STAT_BuildingEnergy_WidgetPopulation, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+
+// === Counters (kept between frames) ===
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Buildings"), STAT_BuildingEnergy_NumBuildings, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Queued updates"), STAT_BuildingEnergy_NumQueuedUpdates, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Resident chunks"), STAT_BuildingEnergy_NumChunks, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+
+// === Memory per cache ===
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Building store"), STAT_BuildingEnergy_StoreMemory, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Community shards"), STAT_BuildingEnergy_ShardMemory, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Chunk cache"), STAT_BuildingEnergy_ChunkMemory, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Style state"), STAT_BuildingEnergy_StyleMemory, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Color LUT (CPU copy)"), STAT_BuildingEnergy_ColorLutMemory, STATGROUP_BuildingEnergy, FINAL_PROJECT_API);
+
+// Cycle counter plus a CPU profiler scope of the same name, e.g. BUILDING_ENERGY_SCOPE(Ingest)
+#define BUILDING_ENERGY_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_BuildingEnergy_##Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(BuildingEnergy_##Name)
@@ -0,0 +1,200 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingEnergySyntheticCity.h"
+#include "Math/RandomStream.h"
+
+const TCHAR* const FBuildingEnergySyntheticCity::EnergyClassColors[NumEnergyClasses] =
+{
+	TEXT("#00a651"), TEXT("#4cb848"), TEXT("#bed630"), TEXT("#fff200"),
+	TEXT("#fdb913"), TEXT("#f37021"), TEXT("#ed1c24"), TEXT("#be1e2d")
+};
+
+namespace BuildingEnergySyntheticCity
+{
+	// Share of the stock per class before renovation, most buildings sit in the middle classes
+	static const float ClassWeights[FBuildingEnergySyntheticCity::NumEnergyClasses] = { 2.0f, 5.0f, 10.0f, 16.0f, 22.0f, 20.0f, 15.0f, 10.0f };
+
+	// Typical specific demand of each class in kWh/m²a
+	static const int32 ClassDemand[FBuildingEnergySyntheticCity::NumEnergyClasses] = { 20, 40, 65, 90, 120, 150, 190, 240 };
+
+	static int32 PickEnergyClass(FRandomStream& Stream)
+	{
+		float Total = 0.0f;
+		for (const float Weight : ClassWeights)
+		{
+			Total += Weight;
+		}
+
+		float Pick = Stream.FRand() * Total;
+		for (int32 Class = 0; Class < FBuildingEnergySyntheticCity::NumEnergyClasses; ++Class)
+		{
+			Pick -= ClassWeights[Class];
+			if (Pick <= 0.0f)
+			{
+				return Class;
+			}
+		}
+		return FBuildingEnergySyntheticCity::NumEnergyClasses - 1;
+	}
+
+	static void AppendPhase(FString& Json, const TCHAR* Name, int32 Demand, int32 CO2, int32 Class)
+	{
+		Json.Appendf(TEXT("\"%s\":{\"result\":{\"energy_demand_specific\":{\"value\":%d},\"co2_from_energy_demand\":{\"value\":%d}},\"color\":{\"energy_demand_specific_color\":\"%s\"}}"),
+			Name, Demand, CO2, FBuildingEnergySyntheticCity::EnergyClassColors[Class]);
+	}
+}
+
+FString FBuildingEnergySyntheticCity::GenerateJson(int32 ChangeGeneration, float ChangeFraction) const
+{
+	return GeneratePageJson(0, NumBuildings, FString(), ChangeGeneration, ChangeFraction);
+}
+
+FString FBuildingEnergySyntheticCity::GeneratePageJson(int32 FirstIndex, int32 MaxResults, const FString& NextUrl, int32 ChangeGeneration, float ChangeFraction) const
+{
+	const int32 BeginIndex = FMath::Clamp(FirstIndex, 0, NumBuildings);
+	const int32 EndIndex = BeginIndex + FMath::Min(FMath::Max(0, MaxResults), NumBuildings - BeginIndex);
+
+	FString Json;
+	Json.Reserve(128 + NextUrl.Len() + (EndIndex - BeginIndex) * (420 + MaxVertices * 36));
+	Json.Appendf(TEXT("{\"count\":%d,\"next\":"), NumBuildings);
+	if (NextUrl.IsEmpty())
+	{
+		Json.Append(TEXT("null"));
+	}
+	else
+	{
+		Json.Appendf(TEXT("\"%s\""), *NextUrl.ReplaceCharWithEscapedChar());
+	}
+	Json.Append(TEXT(",\"results\":["));
+	for (int32 Index = BeginIndex; Index < EndIndex; ++Index)
+	{
+		if (Index > BeginIndex)
+		{
+			Json.AppendChar(TEXT(','));
+		}
+		AppendBuilding(Json, Index, ChangeGeneration, ChangeFraction);
+	}
+	Json.Append(TEXT("]}"));
+	return Json;
+}
+
+FString FBuildingEnergySyntheticCity::GenerateChangesJson(int32 SinceGeneration, int32 ChangeGeneration, float ChangeFraction) const
+{
+	FString Results;
+	int32 NumChanged = 0;
+	for (int32 Index = 0; Index < NumBuildings && SinceGeneration != ChangeGeneration; ++Index)
+	{
+		// A building recolored in either generation reads differently in the other one
+		if (IsChanged(Index, SinceGeneration, ChangeFraction) || IsChanged(Index, ChangeGeneration, ChangeFraction))
+		{
+			if (NumChanged++ > 0)
+			{
+				Results.AppendChar(TEXT(','));
+			}
+			AppendBuilding(Results, Index, ChangeGeneration, ChangeFraction);
+		}
+	}
+	return FString::Printf(TEXT("{\"count\":%d,\"next\":null,\"results\":[%s]}"), NumChanged, *Results);
+}
+
+FString FBuildingEnergySyntheticCity::GetModifiedGmlId(int32 Index) const
+{
+	// DEBW_ + 11 characters like the real ids; the last six encode the index in base 62
+	static const TCHAR Digits[] = TEXT("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ");
+	TCHAR Suffix[7];
+	uint32 Value = static_cast<uint32>(Index);
+	for (int32 Position = 5; Position >= 0; --Position)
+	{
+		Suffix[Position] = Digits[Value % 62];
+		Value /= 62;
+	}
+	Suffix[6] = TEXT('\0');
+	return FString::Printf(TEXT("DEBW_00100%s"), Suffix);
+}
+
+FString FBuildingEnergySyntheticCity::GetActualGmlId(int32 Index) const
+{
+	FString ActualGmlId = GetModifiedGmlId(Index);
+	ActualGmlId[4] = TEXT('L');
+	return ActualGmlId;
+}
+
+FVector FBuildingEnergySyntheticCity::GetCenter(int32 Index) const
+{
+	const int32 Side = GetGridSide();
+	return FVector((Index % Side) * Spacing, (Index / Side) * Spacing, 0.0);
+}
+
+int32 FBuildingEnergySyntheticCity::CountChangedBuildings(int32 ChangeGeneration, float ChangeFraction) const
+{
+	int32 NumChanged = 0;
+	for (int32 Index = 0; Index < NumBuildings; ++Index)
+	{
+		NumChanged += IsChanged(Index, ChangeGeneration, ChangeFraction) ? 1 : 0;
+	}
+	return NumChanged;
+}
+
+int32 FBuildingEnergySyntheticCity::GetGridSide() const
+{
+	return FMath::Max(1, FMath::CeilToInt32(FMath::Sqrt(static_cast<double>(NumBuildings))));
+}
+
+bool FBuildingEnergySyntheticCity::IsChanged(int32 Index, int32 ChangeGeneration, float ChangeFraction) const
+{
+	if (ChangeGeneration <= 0 || ChangeFraction <= 0.0f)
+	{
+		return false;
+	}
+	FRandomStream Stream(HashCombine(HashCombine(GetTypeHash(Seed), GetTypeHash(Index)), GetTypeHash(ChangeGeneration)));
+	return Stream.FRand() < ChangeFraction;
+}
+
+void FBuildingEnergySyntheticCity::AppendBuilding(FString& Json, int32 Index, int32 ChangeGeneration, float ChangeFraction) const
+{
+	using namespace BuildingEnergySyntheticCity;
+
+	// Everything but the change below derives from (Seed, Index), so every generation lists the same city
+	FRandomStream Stream(HashCombine(GetTypeHash(Seed), GetTypeHash(Index)));
+
+	// === Footprint: a convex polygon around the grid cell center, closed like GeoJSON rings ===
+	const float VertexPick = Stream.FRand();
+	const int32 MaxCorners = FMath::Max(4, MaxVertices);
+	const int32 NumCorners = FMath::Min(MaxCorners, VertexPick < 0.4f ? 4 : VertexPick < 0.6f ? 5 : VertexPick < 0.75f ? 6 : Stream.RandRange(7, FMath::Max(7, MaxCorners)));
+	const double Radius = Stream.FRandRange(0.1f, 0.28f) * Spacing; // Stretched at most to 0.45 * Spacing, so neighbors never overlap
+	const double Stretch = Stream.FRandRange(1.0f, 1.6f);
+	const double Rotation = Stream.FRandRange(0.0f, UE_PI);
+	const double Elevation = Stream.FRandRange(45000.0f, 52000.0f);
+	const FVector Center = GetCenter(Index);
+
+	// === Energy: a class before renovation and an equal or better one after ===
+	const int32 BeginClass = PickEnergyClass(Stream);
+	int32 EndClass = FMath::Max(0, BeginClass - Stream.RandRange(0, 3));
+	const int32 FloorArea = Stream.RandRange(80, 900);
+	const int32 BeginDemand = ClassDemand[BeginClass] + Stream.RandRange(-8, 8);
+	int32 EndDemand = ClassDemand[EndClass] + Stream.RandRange(-8, 8);
+	if (IsChanged(Index, ChangeGeneration, ChangeFraction))
+	{
+		EndClass = (EndClass + 1 + ChangeGeneration % (NumEnergyClasses - 1)) % NumEnergyClasses;
+		EndDemand = ClassDemand[EndClass] + ChangeGeneration % 7;
+	}
+
+	Json.Appendf(TEXT("{\"id\":%d,\"gml_id\":\"%s\",\"modified_gml_id\":\"%s\",\"geom\":{\"type\":\"Polygon\",\"coordinates\":[["),
+		Index + 1, *GetActualGmlId(Index), *GetModifiedGmlId(Index));
+	const double AngleStep = 2.0 * UE_DOUBLE_PI / NumCorners;
+	for (int32 Corner = 0; Corner <= NumCorners; ++Corner)
+	{
+		// Corners on an ellipse stay convex whatever the spacing of their angles
+		const double Angle = (Corner % NumCorners) * AngleStep;
+		const double LocalX = FMath::Cos(Angle) * Radius * Stretch;
+		const double LocalY = FMath::Sin(Angle) * Radius;
+		const double X = Center.X + LocalX * FMath::Cos(Rotation) - LocalY * FMath::Sin(Rotation);
+		const double Y = Center.Y + LocalX * FMath::Sin(Rotation) + LocalY * FMath::Cos(Rotation);
+		Json.Appendf(TEXT("%s[%.2f,%.2f,%.2f]"), Corner > 0 ? TEXT(",") : TEXT(""), X, Y, Elevation);
+	}
+	Json.Append(TEXT("]]},\"energy_result\":{"));
+	AppendPhase(Json, TEXT("begin"), BeginDemand, BeginDemand * FloorArea / 4, BeginClass);
+	Json.AppendChar(TEXT(','));
+	AppendPhase(Json, TEXT("end"), EndDemand, EndDemand * FloorArea / 4, EndClass);
+	Json.Append(TEXT("}}"));
+}
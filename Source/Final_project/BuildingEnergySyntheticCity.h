@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Deterministic buildings-energy responses for benchmarks and tests, shaped like the
+// /geospatial/buildings-energy/ API: DEBW_ ids, GeoJSON footprints and begin/end energy results.
+// Footprints are convex polygons on a square grid, so the center of every building hits it.
+class FINAL_PROJECT_API FBuildingEnergySyntheticCity
+{
+public:
+	// Energy label palette (A+ .. H) used for the "energy_demand_specific_color" of each phase
+	static constexpr int32 NumEnergyClasses = 8;
+	static const TCHAR* const EnergyClassColors[NumEnergyClasses];
+
+	int32 NumBuildings = 1000;
+	int32 Seed = 1;
+	double Spacing = 4000.0; // Distance between footprint centers, in the units of the coordinates
+	int32 MaxVertices = 12; // Footprints have 4 to MaxVertices corners, most of them 4 to 6
+
+	// { "count", "next", "results" } envelope with every building.
+	// A ChangeGeneration above 0 recolors ChangeFraction of the buildings (different ones per generation);
+	// ids and geometry never change, so the result can be fed to change detection.
+	FString GenerateJson(int32 ChangeGeneration = 0, float ChangeFraction = 0.0f) const;
+
+	// One page of the same listing: buildings [FirstIndex, FirstIndex + MaxResults) under a "count" of every
+	// building and a "next" of NextUrl (null when empty)
+	FString GeneratePageJson(int32 FirstIndex, int32 MaxResults, const FString& NextUrl, int32 ChangeGeneration = 0, float ChangeFraction = 0.0f) const;
+
+	// Delta listing: only the buildings whose record differs between the two generations, without paging
+	FString GenerateChangesJson(int32 SinceGeneration, int32 ChangeGeneration, float ChangeFraction) const;
+
+	// modified_gml_id (with '_') and gml_id (with 'L') of a building
+	FString GetModifiedGmlId(int32 Index) const;
+	FString GetActualGmlId(int32 Index) const;
+
+	// Footprint center; always inside the building's polygon
+	FVector GetCenter(int32 Index) const;
+
+	// Number of buildings that GenerateJson(ChangeGeneration, ChangeFraction) recolors
+	int32 CountChangedBuildings(int32 ChangeGeneration, float ChangeFraction) const;
+
+private:
+	int32 GetGridSide() const;
+	bool IsChanged(int32 Index, int32 ChangeGeneration, float ChangeFraction) const;
+	void AppendBuilding(FString& Json, int32 Index, int32 ChangeGeneration, float ChangeFraction) const;
+};
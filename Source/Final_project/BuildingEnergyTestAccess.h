@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "BuildingEnergyApiSubsystem.h"
+#include "BuildingEnergyDisplay.h"
+#include "BuildingStore.h"
+
+// The one way the BuildingEnergy.* automation tests reach into ABuildingEnergyDisplay: the perf suite runs
+// the pipeline steps on the test thread, the mock backend suite drives logins and polls over real HTTP.
+struct FBuildingEnergyTestAccess
+{
+	static bool CacheBuildingRecord(FBuildingStore& Store, const FBuildingEnergyRecord& Record)
+	{
+		return ABuildingEnergyDisplay::CacheBuildingRecord(Store, Record);
+	}
+
+	static FBuildingStore& GetStore(ABuildingEnergyDisplay& Display) { return Display.BuildingStore; }
+	static const FBuildingStore& GetStore(const ABuildingEnergyDisplay& Display) { return Display.BuildingStore; }
+	static void ResetStyleState(ABuildingEnergyDisplay& Display) { Display.BuildingStyleState.Reset(); }
+
+	static bool DetectAndApplyChanges(ABuildingEnergyDisplay& Display, const FString& Json)
+	{
+		return Display.DetectAndApplyChanges(Json);
+	}
+
+	static void SetCommunity(ABuildingEnergyDisplay& Display, const FString& CommunityId) { Display.CommunityIds = { CommunityId }; }
+	static void SetPreloadPageSize(ABuildingEnergyDisplay& Display, int32 PageSize) { Display.PreloadPageSize = PageSize; }
+	static const FString& GetAccessToken(const ABuildingEnergyDisplay& Display) { return Display.AccessToken; }
+	static void Login(ABuildingEnergyDisplay& Display) { Display.AuthenticateAndLoadData(); }
+	static void Poll(ABuildingEnergyDisplay& Display) { Display.PollRealTimeCommunity(Display.CommunityIds[0]); }
+
+	static bool IsLoaded(const ABuildingEnergyDisplay& Display)
+	{
+		return Display.bDataLoaded && !Display.bIsLoading && !Display.bPreloadRequestPending && !Display.bAuthRequestPending;
+	}
+
+	static bool IsPolling(const ABuildingEnergyDisplay& Display) { return Display.bIsPerformingRealTimeUpdate; }
+
+	// Delta sync cursor of the display's only community, empty without one
+	static FString GetCursor(const ABuildingEnergyDisplay& Display) { return Display.DeltaSyncCursors.FindRef(Display.CommunityIds[0]); }
+
+	// Returns the patches queued so far and drops them, so every poll starts from an empty queue
+	static int32 TakeQueuedPatches(ABuildingEnergyDisplay& Display)
+	{
+		const int32 NumQueued = Display.PendingBuildingPatches.Num();
+		Display.PendingBuildingPatches.Reset();
+		return NumQueued;
+	}
+
+	// BeginPlay never runs in the test world, so hook the display to the broker like it would
+	static void BindTokenRejected(ABuildingEnergyDisplay& Display, UBuildingEnergyApiSubsystem& Api)
+	{
+		Api.OnTokenRejected.AddUObject(&Display, &ABuildingEnergyDisplay::OnApiTokenRejected);
+	}
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
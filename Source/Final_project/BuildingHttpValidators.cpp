@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingHttpValidators.h"
+
+FBuildingHttpValidators& FBuildingHttpValidators::Get()
+{
+	static FBuildingHttpValidators Instance;
+	return Instance;
+}
+
+void FBuildingHttpValidators::ApplyTo(IHttpRequest& Request) const
+{
+	check(IsInGameThread());
+	Request.SetHeader(TEXT("Cache-Control"), TEXT("no-cache"));
+
+	const FValidators* Validators = ValidatorsByUrl.Find(Request.GetURL());
+	if (!Validators)
+	{
+		return;
+	}
+	if (!Validators->ETag.IsEmpty())
+	{
+		Request.SetHeader(TEXT("If-None-Match"), Validators->ETag);
+	}
+	if (!Validators->LastModified.IsEmpty())
+	{
+		Request.SetHeader(TEXT("If-Modified-Since"), Validators->LastModified);
+	}
+}
+
+void FBuildingHttpValidators::Record(const IHttpRequest& Request, const IHttpResponse& Response)
+{
+	check(IsInGameThread());
+	if (Response.GetResponseCode() != EHttpResponseCodes::Ok)
+	{
+		return; // A 304 keeps the validators it was answered for
+	}
+
+	FValidators Validators;
+	Validators.ETag = Response.GetHeader(TEXT("ETag"));
+	Validators.LastModified = Response.GetHeader(TEXT("Last-Modified"));
+	if (Validators.ETag.IsEmpty() && Validators.LastModified.IsEmpty())
+	{
+		ValidatorsByUrl.Remove(Request.GetURL());
+		return;
+	}
+	ValidatorsByUrl.Add(Request.GetURL(), MoveTemp(Validators));
+}
@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+
+// Conditional GET for the polling endpoints.
+// Remembers the ETag / Last-Modified validators of the last 200 response per URL and sends them back
+// as If-None-Match / If-Modified-Since, so an unchanged resource costs a bodiless 304.
+// Shared by every poller in the process; HTTP callbacks run on the game thread, so is this.
+class FINAL_PROJECT_API FBuildingHttpValidators
+{
+public:
+	static FBuildingHttpValidators& Get();
+
+	// Adds the validators known for the request URL; call after SetURL.
+	// Cache-Control: no-cache still makes intermediaries revalidate instead of answering from their cache.
+	void ApplyTo(IHttpRequest& Request) const;
+
+	// Remembers the validators of a 200 response (or forgets them when the server sent none)
+	void Record(const IHttpRequest& Request, const IHttpResponse& Response);
+
+	static bool IsNotModified(const IHttpResponse& Response) { return Response.GetResponseCode() == EHttpResponseCodes::NotModified; }
+
+	void Reset() { ValidatorsByUrl.Reset(); }
+
+private:
+	struct FValidators
+	{
+		FString ETag;
+		FString LastModified;
+	};
+
+	TMap<FString, FValidators> ValidatorsByUrl;
+};
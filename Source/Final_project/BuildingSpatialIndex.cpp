@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingSpatialIndex.h"
+#include "Algo/Sort.h"
+
+void FBuildingSpatialIndex::Build(TArrayView<const FBox2D> ItemBounds)
+{
+	Reset();
+
+	ItemIds.Reserve(ItemBounds.Num());
+	for (int32 Item = 0; Item < ItemBounds.Num(); ++Item)
+	{
+		if (ItemBounds[Item].bIsValid)
+		{
+			ItemIds.Add(Item);
+		}
+	}
+
+	const int32 NumLeaves = ItemIds.Num();
+	if (NumLeaves == 0)
+	{
+		return;
+	}
+
+	// Sort-Tile-Recursive: cut the items into vertical slices by center X, then order each slice by
+	// center Y so every run of NodeCapacity leaves covers a compact tile
+	Algo::Sort(ItemIds, [&ItemBounds](int32 A, int32 B)
+	{
+		return ItemBounds[A].Min.X + ItemBounds[A].Max.X < ItemBounds[B].Min.X + ItemBounds[B].Max.X;
+	});
+
+	const int32 NumLeafNodes = FMath::DivideAndRoundUp(NumLeaves, NodeCapacity);
+	const int32 NumSlices = FMath::CeilToInt(FMath::Sqrt(static_cast<double>(NumLeafNodes)));
+	const int32 SliceSize = NumSlices * NodeCapacity;
+	for (int32 SliceStart = 0; SliceStart < NumLeaves; SliceStart += SliceSize)
+	{
+		TArrayView<int32> Slice(ItemIds.GetData() + SliceStart, FMath::Min(SliceSize, NumLeaves - SliceStart));
+		Algo::Sort(Slice, [&ItemBounds](int32 A, int32 B)
+		{
+			return ItemBounds[A].Min.Y + ItemBounds[A].Max.Y < ItemBounds[B].Min.Y + ItemBounds[B].Max.Y;
+		});
+	}
+
+	// Every level has at most 1/NodeCapacity of the entries of the one below
+	Boxes.Reserve(NumLeaves + NumLeaves / (NodeCapacity - 1) + 1);
+	for (const int32 Item : ItemIds)
+	{
+		Boxes.Add(ItemBounds[Item]);
+	}
+
+	LevelOffsets.Add(0);
+	int32 LevelStart = 0;
+	int32 LevelEnd = Boxes.Num();
+	while (LevelEnd - LevelStart > 1)
+	{
+		LevelOffsets.Add(LevelEnd);
+		for (int32 FirstChild = LevelStart; FirstChild < LevelEnd; FirstChild += NodeCapacity)
+		{
+			FBox2D NodeBox(ForceInit);
+			const int32 ChildEnd = FMath::Min(FirstChild + NodeCapacity, LevelEnd);
+			for (int32 Child = FirstChild; Child < ChildEnd; ++Child)
+			{
+				NodeBox += Boxes[Child];
+			}
+			Boxes.Add(NodeBox);
+		}
+		LevelStart = LevelEnd;
+		LevelEnd = Boxes.Num();
+	}
+	LevelOffsets.Add(LevelEnd);
+}
+
+void FBuildingSpatialIndex::Reset()
+{
+	Boxes.Reset();
+	LevelOffsets.Reset();
+	ItemIds.Reset();
+}
+
+template <typename OverlapFunc>
+void FBuildingSpatialIndex::Query(OverlapFunc Overlaps, TArray<int32>& OutItems) const
+{
+	OutItems.Reset();
+	if (ItemIds.Num() == 0)
+	{
+		return;
+	}
+
+	// (level, index within the level) of nodes still to visit; depth stays at log16 of the item count
+	TArray<TPair<int32, int32>, TInlineAllocator<64>> Stack;
+	Stack.Emplace(LevelOffsets.Num() - 2, 0);
+	while (Stack.Num() > 0)
+	{
+		const TPair<int32, int32> Node = Stack.Pop(EAllowShrinking::No);
+		const int32 Level = Node.Key;
+		const int32 Index = Node.Value;
+		if (!Overlaps(Boxes[LevelOffsets[Level] + Index]))
+		{
+			continue;
+		}
+
+		if (Level == 0)
+		{
+			OutItems.Add(ItemIds[Index]);
+			continue;
+		}
+
+		const int32 FirstChild = Index * NodeCapacity;
+		const int32 ChildEnd = FMath::Min(FirstChild + NodeCapacity, LevelOffsets[Level] - LevelOffsets[Level - 1]);
+		for (int32 Child = FirstChild; Child < ChildEnd; ++Child)
+		{
+			Stack.Emplace(Level - 1, Child);
+		}
+	}
+}
+
+void FBuildingSpatialIndex::QueryPoint(const FVector2D& Point, TArray<int32>& OutItems) const
+{
+	Query([&Point](const FBox2D& Box)
+	{
+		return Point.X >= Box.Min.X && Point.X <= Box.Max.X && Point.Y >= Box.Min.Y && Point.Y <= Box.Max.Y;
+	}, OutItems);
+}
+
+void FBuildingSpatialIndex::QueryBox(const FBox2D& Area, TArray<int32>& OutItems) const
+{
+	Query([&Area](const FBox2D& Box)
+	{
+		return Area.Intersect(Box);
+	}, OutItems);
+}
+
+SIZE_T FBuildingSpatialIndex::GetAllocatedSize() const
+{
+	return Boxes.GetAllocatedSize() + LevelOffsets.GetAllocatedSize() + ItemIds.GetAllocatedSize();
+}
@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Packed 2D R-tree over a static set of boxes, bulk loaded with Sort-Tile-Recursive.
+// The leaf level holds the item boxes in STR order and every level above groups NodeCapacity
+// consecutive entries of the level below, so children are found by arithmetic and no node
+// pointers are stored. Rebuilt from scratch whenever the boxes change.
+class FINAL_PROJECT_API FBuildingSpatialIndex
+{
+public:
+	static constexpr int32 NodeCapacity = 16;
+
+	// Item i is ItemBounds[i]; invalid boxes are left out
+	void Build(TArrayView<const FBox2D> ItemBounds);
+	void Reset();
+
+	// Items whose box contains Point (edges included), in no particular order
+	void QueryPoint(const FVector2D& Point, TArray<int32>& OutItems) const;
+
+	// Items whose box overlaps Area (edges included), in no particular order
+	void QueryBox(const FBox2D& Area, TArray<int32>& OutItems) const;
+
+	int32 NumItems() const { return ItemIds.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	template <typename OverlapFunc>
+	void Query(OverlapFunc Overlaps, TArray<int32>& OutItems) const;
+
+	TArray<FBox2D> Boxes; // Leaf level first, then each level above it, the root last
+	TArray<int32> LevelOffsets; // Start of each level in Boxes, followed by Boxes.Num()
+	TArray<int32> ItemIds; // Item of each leaf box
+};
@@ -0,0 +1,634 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingStore.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include <atomic>
+
+namespace
+{
+	// Orders strings by their characters read from the end, for the suffix index
+	bool ReversedLess(const FString& A, const FString& B)
+	{
+		int32 IndexA = A.Len() - 1;
+		int32 IndexB = B.Len() - 1;
+		for (; IndexA >= 0 && IndexB >= 0; --IndexA, --IndexB)
+		{
+			if (A[IndexA] != B[IndexB])
+			{
+				return A[IndexA] < B[IndexB];
+			}
+		}
+		return IndexA < IndexB; // The shorter string is a suffix of the longer one
+	}
+
+	bool ForwardLess(const FString& A, const FString& B)
+	{
+		return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+	}
+
+	constexpr uint64 FnvOffsetBasis = 0xcbf29ce484222325ull;
+	constexpr uint64 FnvPrime = 0x100000001b3ull;
+
+	uint64 AppendToIdOrderHash(uint64 Hash, const FString& Id)
+	{
+		const FTCHARToUTF8 Utf8(*Id);
+		for (int32 Byte = 0; Byte < Utf8.Length(); ++Byte)
+		{
+			Hash = (Hash ^ static_cast<uint8>(Utf8.Get()[Byte])) * FnvPrime;
+		}
+		return (Hash ^ static_cast<uint8>('\n')) * FnvPrime;
+	}
+}
+
+FBuildingStore::FBuildingStore()
+{
+	Reset();
+}
+
+int32 FBuildingStore::FindIndex(const FString& GmlId) const
+{
+	const int32* Index = IdToIndex.Find(GmlId);
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 FBuildingStore::FindOrAddBuilding(const FString& ModifiedGmlId, const FString& ActualGmlId)
+{
+	int32 Index = FindIndex(ModifiedGmlId);
+	if (Index == INDEX_NONE && !ActualGmlId.IsEmpty())
+	{
+		Index = FindIndex(ActualGmlId);
+	}
+	if (Index != INDEX_NONE)
+	{
+		return Index;
+	}
+
+	Index = ModifiedGmlIds.Add(ModifiedGmlId);
+	IdOrderHash = AppendToIdOrderHash(IdOrderHash, ModifiedGmlId);
+	ActualGmlIds.Add(ActualGmlId.IsEmpty() ? ModifiedGmlId.Replace(TEXT("_"), TEXT("L")) : ActualGmlId);
+	HasEnergyData.Add(false);
+	BeginCO2.Add(MissingValue);
+	EndCO2.Add(MissingValue);
+	BeginSpecificDemand.Add(MissingValue);
+	EndSpecificDemand.Add(MissingValue);
+	Fingerprints.Add(0);
+	ColorClasses.Add(NoColorClass);
+	Bounds.Add(FBox(ForceInit));
+	PolygonOffsets.Add(PolygonOffsets.Last()); // New buildings start without polygons
+
+	// The modified id wins if another building already uses it as its gml_id
+	IdToIndex.Add(ModifiedGmlId, Index);
+	IdToIndex.FindOrAdd(ActualGmlIds[Index], Index);
+
+	// Variants are computed once here so click resolution never scans the store
+	CanonicalIds.Add(MakeCanonicalId(ModifiedGmlId));
+	AddVariant(CanonicalIds[Index], Index);
+	AddVariant(MakeCanonicalId(ActualGmlIds[Index]), Index);
+	if (!bIdOrderDirty)
+	{
+		InsertIntoIdOrder(Index);
+	}
+	return Index;
+}
+
+int32 FBuildingStore::FindVariantIndex(const FString& GmlId) const
+{
+	const int32* Index = VariantToIndex.Find(MakeCanonicalId(GmlId));
+	return Index ? *Index : INDEX_NONE;
+}
+
+void FBuildingStore::AddVariant(const FString& Canonical, int32 Index)
+{
+	// An empty id would be "contained" in every query
+	if (!Canonical.IsEmpty())
+	{
+		VariantToIndex.FindOrAdd(Canonical, Index);
+		MinCanonicalIdLength = FMath::Min(MinCanonicalIdLength, Canonical.Len());
+	}
+}
+
+int32 FBuildingStore::FindPartialMatchIndex(const FString& GmlId) const
+{
+	const FString Query = MakeCanonicalId(GmlId);
+	if (Query.Len() < MinPartialMatchLength)
+	{
+		return INDEX_NONE;
+	}
+
+	// A known id inside the query: hash lookups of views of its substrings, longest first
+	const FStringView QueryView(Query);
+	const int32 MinLength = FMath::Max(MinCanonicalIdLength, MinPartialMatchLength);
+	for (int32 Length = Query.Len(); Length >= MinLength; --Length)
+	{
+		for (int32 Start = 0; Start + Length <= Query.Len(); ++Start)
+		{
+			const FStringView Substring = QueryView.Mid(Start, Length);
+			if (const int32* Index = VariantToIndex.FindByHash(FCanonicalIdKeyFuncs::GetKeyHash(Substring), Substring))
+			{
+				return *Index;
+			}
+		}
+	}
+
+	// The query inside a known id
+	if (bIdOrderDirty)
+	{
+		// Only reachable between a bulk load and FinalizeIdIndex
+		for (int32 Index = 0; Index < Num(); ++Index)
+		{
+			if (CanonicalIds[Index].Contains(Query, ESearchCase::CaseSensitive))
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	const int32 PrefixPosition = Algo::LowerBound(PrefixOrder, Query, [this](int32 Index, const FString& Value)
+	{
+		return ForwardLess(CanonicalIds[Index], Value);
+	});
+	if (PrefixOrder.IsValidIndex(PrefixPosition) && CanonicalIds[PrefixOrder[PrefixPosition]].StartsWith(Query, ESearchCase::CaseSensitive))
+	{
+		return PrefixOrder[PrefixPosition];
+	}
+
+	const int32 SuffixPosition = Algo::LowerBound(SuffixOrder, Query, [this](int32 Index, const FString& Value)
+	{
+		return ReversedLess(CanonicalIds[Index], Value);
+	});
+	if (SuffixOrder.IsValidIndex(SuffixPosition) && CanonicalIds[SuffixOrder[SuffixPosition]].EndsWith(Query, ESearchCase::CaseSensitive))
+	{
+		return SuffixOrder[SuffixPosition];
+	}
+	return INDEX_NONE;
+}
+
+int32 FBuildingStore::ResolveIndex(const FString& GmlId) const
+{
+	int32 Index = FindIndex(GmlId);
+	if (Index == INDEX_NONE)
+	{
+		Index = FindVariantIndex(GmlId);
+	}
+	if (Index == INDEX_NONE)
+	{
+		Index = FindPartialMatchIndex(GmlId);
+	}
+	return Index;
+}
+
+FString FBuildingStore::MakeCanonicalId(const FString& GmlId)
+{
+	// Folds every difference ConvertGmlIdToBuildingKey, ConvertActualGmlIdToModified and
+	// MakeIdVariants produce; after lowering, the 'L' of a gml_id is an 'l'
+	FString Canonical = GmlId.ToLower();
+	for (TCHAR& Char : Canonical.GetCharArray())
+	{
+		if (Char == TEXT('l') || Char == TEXT('-'))
+		{
+			Char = TEXT('_');
+		}
+	}
+	return Canonical;
+}
+
+void FBuildingStore::FinalizeIdIndex()
+{
+	if (!bIdOrderDirty)
+	{
+		return;
+	}
+
+	PrefixOrder.SetNumUninitialized(Num());
+	for (int32 Index = 0; Index < Num(); ++Index)
+	{
+		PrefixOrder[Index] = Index;
+	}
+	SuffixOrder = PrefixOrder;
+
+	Algo::Sort(PrefixOrder, [this](int32 A, int32 B) { return ForwardLess(CanonicalIds[A], CanonicalIds[B]); });
+	Algo::Sort(SuffixOrder, [this](int32 A, int32 B) { return ReversedLess(CanonicalIds[A], CanonicalIds[B]); });
+	bIdOrderDirty = false;
+}
+
+void FBuildingStore::InsertIntoIdOrder(int32 Index)
+{
+	const FString& Canonical = CanonicalIds[Index];
+	PrefixOrder.Insert(Index, Algo::LowerBound(PrefixOrder, Canonical, [this](int32 Element, const FString& Value)
+	{
+		return ForwardLess(CanonicalIds[Element], Value);
+	}));
+	SuffixOrder.Insert(Index, Algo::LowerBound(SuffixOrder, Canonical, [this](int32 Element, const FString& Value)
+	{
+		return ReversedLess(CanonicalIds[Element], Value);
+	}));
+}
+
+void FBuildingStore::SetEnergyValues(int32 Index, int32 InBeginCO2, int32 InEndCO2, int32 InBeginSpecific, int32 InEndSpecific)
+{
+	HasEnergyData[Index] = true;
+	BeginCO2[Index] = InBeginCO2;
+	EndCO2[Index] = InEndCO2;
+	BeginSpecificDemand[Index] = InBeginSpecific;
+	EndSpecificDemand[Index] = InEndSpecific;
+}
+
+int32 FBuildingStore::FindOrAddColorClass(const FLinearColor& Color)
+{
+	const FColor SRGBColor = Color.ToFColor(true);
+	if (const uint16* ColorClass = ColorToClass.Find(SRGBColor.DWColor()))
+	{
+		return *ColorClass;
+	}
+
+	check(Palette.Num() < NoColorClass);
+	const uint16 ColorClass = static_cast<uint16>(Palette.Add(Color));
+	PaletteHex.Add(FString::Printf(TEXT("#%02X%02X%02X"), SRGBColor.R, SRGBColor.G, SRGBColor.B));
+	ColorToClass.Add(SRGBColor.DWColor(), ColorClass);
+	return ColorClass;
+}
+
+int32 FBuildingStore::FindColorClassByHex(const FString& Hex) const
+{
+	const uint16* ColorClass = HexToClass.Find(Hex);
+	return ColorClass ? *ColorClass : INDEX_NONE;
+}
+
+int32 FBuildingStore::AddColorClassForHex(const FString& Hex, const FLinearColor& Color)
+{
+	const int32 ColorClass = FindOrAddColorClass(Color);
+	HexToClass.Add(Hex, static_cast<uint16>(ColorClass));
+	return ColorClass;
+}
+
+void FBuildingStore::SetColorClass(int32 Index, int32 ColorClass)
+{
+	uint16& Current = ColorClasses[Index];
+	if (Current == ColorClass)
+	{
+		return;
+	}
+
+	NumColored += (Current == NoColorClass ? 1 : 0) - (ColorClass == NoColorClass ? 1 : 0);
+	ColorMapHash += GetColorContribution(Index, ColorClass) - GetColorContribution(Index, Current);
+	Current = static_cast<uint16>(ColorClass);
+
+	// Past this many changes a full rebuild is as cheap for consumers as an incremental one
+	if (ColorChangeLog.Num() >= FMath::Max(64, Num() / 8))
+	{
+		RestartColorChangeLog();
+	}
+	else
+	{
+		ColorChangeLog.Add(Index);
+	}
+}
+
+bool FBuildingStore::GetColorChangesSince(FColorChangeCursor& Cursor, TArray<int32>& OutChangedIndices) const
+{
+	OutChangedIndices.Reset();
+	if (Cursor.Epoch != ColorChangeEpoch)
+	{
+		Cursor.Epoch = ColorChangeEpoch;
+		Cursor.Position = ColorChangeLog.Num();
+		return false;
+	}
+
+	OutChangedIndices.Append(ColorChangeLog.GetData() + Cursor.Position, ColorChangeLog.Num() - Cursor.Position);
+	Cursor.Position = ColorChangeLog.Num();
+	return true;
+}
+
+void FBuildingStore::RestartColorChangeLog()
+{
+	// Epochs are unique across stores so a cursor never matches a store it was not taken from
+	static std::atomic<uint32> NextColorChangeEpoch{ 1 };
+	ColorChangeEpoch = NextColorChangeEpoch++;
+	ColorChangeLog.Reset();
+}
+
+void FBuildingStore::AddFeatureId(int32 FeatureId, int32 Index)
+{
+	if (FeatureId >= 0 && !FeatureIdToIndex.Contains(FeatureId))
+	{
+		FeatureIdToIndex.Add(FeatureId, Index);
+		BumpFeatureIdRevision();
+	}
+}
+
+void FBuildingStore::BumpFeatureIdRevision()
+{
+	// Unique across stores like the color log epochs
+	static std::atomic<uint32> NextFeatureIdRevision{ 1 };
+	FeatureIdRevision = NextFeatureIdRevision++;
+}
+
+uint64 FBuildingStore::GetColorContribution(int32 Index, int32 ColorClass) const
+{
+	if (ColorClass == NoColorClass)
+	{
+		return 0;
+	}
+
+	// splitmix64 finalizer over (id crc, packed sRGB color); summing keeps the map hash order independent
+	uint64 Mixed = (static_cast<uint64>(FCrc::StrCrc32(*ModifiedGmlIds[Index])) << 32) | Palette[ColorClass].ToFColor(true).DWColor();
+	Mixed = (Mixed ^ (Mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	Mixed = (Mixed ^ (Mixed >> 27)) * 0x94d049bb133111ebULL;
+	return Mixed ^ (Mixed >> 31);
+}
+
+TArray<int32> FBuildingStore::CountBuildingsPerColorClass() const
+{
+	TArray<int32> Counts;
+	Counts.SetNumZeroed(Palette.Num());
+	for (const uint16 ColorClass : ColorClasses)
+	{
+		if (ColorClass != NoColorClass)
+		{
+			++Counts[ColorClass];
+		}
+	}
+	return Counts;
+}
+
+FString FBuildingStore::GetDisplayText(int32 Index) const
+{
+	if (const FString* Override = DisplayTextOverrides.Find(Index))
+	{
+		return *Override;
+	}
+	return FormatDisplayMessage(Index);
+}
+
+FString FBuildingStore::FormatDisplayMessage(int32 Index) const
+{
+	FString DisplayMessage = FString::Printf(TEXT("Building ID: %s\n\n"), *ModifiedGmlIds[Index]);
+
+	// CO2 values arrive in kg and are shown in tonnes with 3 decimal places
+	DisplayMessage += TEXT("CO2 [t CO2/a]\n");
+	DisplayMessage += BeginCO2[Index] != MissingValue
+		? FString::Printf(TEXT("Before Renovation: %.3f\n"), BeginCO2[Index] / 1000.0f)
+		: FString(TEXT("Before Renovation: No data\n"));
+	DisplayMessage += EndCO2[Index] != MissingValue
+		? FString::Printf(TEXT("After Renovation: %.3f\n\n"), EndCO2[Index] / 1000.0f)
+		: FString(TEXT("After Renovation: No data\n\n"));
+
+	DisplayMessage += TEXT("Energy Demand Specific [kWh/m²a]\n");
+	DisplayMessage += BeginSpecificDemand[Index] != MissingValue
+		? FString::Printf(TEXT("Before Renovation: %d\n"), BeginSpecificDemand[Index])
+		: FString(TEXT("Before Renovation: No data\n"));
+	DisplayMessage += EndSpecificDemand[Index] != MissingValue
+		? FString::Printf(TEXT("After Renovation: %d"), EndSpecificDemand[Index])
+		: FString(TEXT("After Renovation: No data"));
+
+	return DisplayMessage;
+}
+
+void FBuildingStore::AddPolygon(int32 Index, TArrayView<const FVector> Points)
+{
+	if (Points.Num() == 0)
+	{
+		return;
+	}
+
+	Vertices.Append(Points.GetData(), Points.Num());
+	VertexOffsets.Add(Vertices.Num());
+	PolygonOwners.Add(Index);
+	bGeometryDirty = true;
+}
+
+void FBuildingStore::RemoveGeometry(int32 Index)
+{
+	for (int32& Owner : PolygonOwners)
+	{
+		if (Owner == Index)
+		{
+			Owner = INDEX_NONE;
+			bGeometryDirty = true;
+		}
+	}
+}
+
+void FBuildingStore::FinalizeGeometry()
+{
+	if (!bGeometryDirty)
+	{
+		return;
+	}
+
+	// Counting sort of polygons by owning building; removed polygons are dropped
+	PolygonOffsets.Init(0, Num() + 1);
+	for (const int32 Owner : PolygonOwners)
+	{
+		if (Owner != INDEX_NONE)
+		{
+			++PolygonOffsets[Owner + 1];
+		}
+	}
+	for (int32 BuildingIndex = 0; BuildingIndex < Num(); ++BuildingIndex)
+	{
+		PolygonOffsets[BuildingIndex + 1] += PolygonOffsets[BuildingIndex];
+	}
+
+	const int32 NumPolygons = PolygonOffsets.Last();
+	TArray<int32> Order;
+	Order.SetNumUninitialized(NumPolygons);
+	TArray<int32> Cursor(PolygonOffsets.GetData(), Num());
+	for (int32 PolygonIndex = 0; PolygonIndex < PolygonOwners.Num(); ++PolygonIndex)
+	{
+		const int32 Owner = PolygonOwners[PolygonIndex];
+		if (Owner != INDEX_NONE)
+		{
+			Order[Cursor[Owner]++] = PolygonIndex;
+		}
+	}
+
+	TArray<FVector> SortedVertices;
+	TArray<int32> SortedVertexOffsets;
+	TArray<int32> SortedOwners;
+	SortedVertices.Reserve(Vertices.Num());
+	SortedVertexOffsets.Reserve(NumPolygons + 1);
+	SortedOwners.Reserve(NumPolygons);
+	SortedVertexOffsets.Add(0);
+	for (const int32 PolygonIndex : Order)
+	{
+		const TArrayView<const FVector> Polygon = GetPolygon(PolygonIndex);
+		SortedVertices.Append(Polygon.GetData(), Polygon.Num());
+		SortedVertexOffsets.Add(SortedVertices.Num());
+		SortedOwners.Add(PolygonOwners[PolygonIndex]);
+	}
+
+	Vertices = MoveTemp(SortedVertices);
+	VertexOffsets = MoveTemp(SortedVertexOffsets);
+	PolygonOwners = MoveTemp(SortedOwners);
+	bGeometryDirty = false;
+
+	// Building bounds cover all of its polygons; the footprint of each polygon goes into the R-tree
+	TArray<FBox2D> PolygonBounds;
+	PolygonBounds.SetNumUninitialized(NumPolygons);
+	for (int32 BuildingIndex = 0; BuildingIndex < Num(); ++BuildingIndex)
+	{
+		FBox Box(ForceInit);
+		for (int32 Polygon = PolygonOffsets[BuildingIndex]; Polygon < PolygonOffsets[BuildingIndex + 1]; ++Polygon)
+		{
+			FBox2D Footprint(ForceInit);
+			for (const FVector& Vertex : GetPolygon(Polygon))
+			{
+				Box += Vertex;
+				Footprint += FVector2D(Vertex);
+			}
+			PolygonBounds[Polygon] = Footprint;
+		}
+		Bounds[BuildingIndex] = Box;
+	}
+	PolygonTree.Build(PolygonBounds);
+}
+
+void FBuildingStore::QueryPolygonsAtPoint(const FVector& Point, TArray<int32>& OutPolygons) const
+{
+	PolygonTree.QueryPoint(FVector2D(Point), OutPolygons);
+}
+
+void FBuildingStore::QueryPolygonsInArea(const FBox2D& Area, TArray<int32>& OutPolygons) const
+{
+	PolygonTree.QueryBox(Area, OutPolygons);
+}
+
+TArrayView<const FVector> FBuildingStore::GetPolygon(int32 PolygonIndex) const
+{
+	const int32 First = VertexOffsets[PolygonIndex];
+	return TArrayView<const FVector>(Vertices.GetData() + First, VertexOffsets[PolygonIndex + 1] - First);
+}
+
+TArrayView<const FVector> FBuildingStore::GetBuildingVertices(int32 Index) const
+{
+	// Polygons of one building are contiguous, and so are their vertices
+	const int32 First = VertexOffsets[PolygonOffsets[Index]];
+	return TArrayView<const FVector>(Vertices.GetData() + First, VertexOffsets[PolygonOffsets[Index + 1]] - First);
+}
+
+int32 FBuildingStore::Append(const FBuildingStore& Other, bool bWithGeometry)
+{
+	check(Other.IsGeometryFinalized());
+
+	int32 NumAdded = 0;
+	TMap<int32, int32> OtherIndicesAdded; // Other's index -> ours, for the feature keys
+	for (int32 OtherIndex = 0; OtherIndex < Other.Num(); ++OtherIndex)
+	{
+		// A building listed by two communities keeps the data of the first
+		if (FindIndex(Other.ModifiedGmlIds[OtherIndex]) != INDEX_NONE || FindIndex(Other.ActualGmlIds[OtherIndex]) != INDEX_NONE)
+		{
+			continue;
+		}
+
+		const int32 Index = FindOrAddBuilding(Other.ModifiedGmlIds[OtherIndex], Other.ActualGmlIds[OtherIndex]);
+		if (Other.HasEnergy(OtherIndex))
+		{
+			SetEnergyValues(Index, Other.BeginCO2[OtherIndex], Other.EndCO2[OtherIndex], Other.BeginSpecificDemand[OtherIndex], Other.EndSpecificDemand[OtherIndex]);
+		}
+		Fingerprints[Index] = Other.Fingerprints[OtherIndex];
+		if (Other.HasColor(OtherIndex))
+		{
+			SetColor(Index, Other.GetColor(OtherIndex)); // Palettes differ between stores, the sRGB color does not
+		}
+		if (const FString* DisplayText = Other.DisplayTextOverrides.Find(OtherIndex))
+		{
+			DisplayTextOverrides.Add(Index, *DisplayText);
+		}
+		OtherIndicesAdded.Add(OtherIndex, Index);
+		for (int32 PolygonIndex = Other.PolygonOffsets[OtherIndex]; bWithGeometry && PolygonIndex < Other.PolygonOffsets[OtherIndex + 1]; ++PolygonIndex)
+		{
+			AddPolygon(Index, Other.GetPolygon(PolygonIndex));
+		}
+		++NumAdded;
+	}
+	for (const TPair<int32, int32>& Feature : Other.FeatureIdToIndex)
+	{
+		if (const int32* Index = OtherIndicesAdded.Find(Feature.Value))
+		{
+			AddFeatureId(Feature.Key, *Index);
+		}
+	}
+	return NumAdded;
+}
+
+void FBuildingStore::Reset()
+{
+	ModifiedGmlIds.Reset();
+	ActualGmlIds.Reset();
+	HasEnergyData.Reset();
+	BeginCO2.Reset();
+	EndCO2.Reset();
+	BeginSpecificDemand.Reset();
+	EndSpecificDemand.Reset();
+	Fingerprints.Reset();
+	ColorClasses.Reset();
+	Palette.Reset();
+	PaletteHex.Reset();
+	Bounds.Reset();
+	PolygonOffsets.Reset();
+	PolygonOffsets.Add(0);
+	VertexOffsets.Reset();
+	VertexOffsets.Add(0);
+	Vertices.Reset();
+	DisplayTextOverrides.Reset();
+	FeatureIdToIndex.Reset();
+	BumpFeatureIdRevision();
+	IdToIndex.Reset();
+	CanonicalIds.Reset();
+	VariantToIndex.Reset();
+	PrefixOrder.Reset();
+	SuffixOrder.Reset();
+	MinCanonicalIdLength = MAX_int32;
+	bIdOrderDirty = true;
+	IdOrderHash = FnvOffsetBasis;
+	ColorToClass.Reset();
+	HexToClass.Reset();
+	NumColored = 0;
+	ColorMapHash = 0;
+	RestartColorChangeLog();
+	PolygonOwners.Reset();
+	PolygonTree.Reset();
+	bGeometryDirty = false;
+}
+
+SIZE_T FBuildingStore::GetAllocatedSize() const
+{
+	SIZE_T Size = ModifiedGmlIds.GetAllocatedSize() + ActualGmlIds.GetAllocatedSize();
+	for (int32 Index = 0; Index < Num(); ++Index)
+	{
+		Size += ModifiedGmlIds[Index].GetAllocatedSize() + ActualGmlIds[Index].GetAllocatedSize();
+	}
+
+	Size += HasEnergyData.GetAllocatedSize();
+	Size += BeginCO2.GetAllocatedSize() + EndCO2.GetAllocatedSize();
+	Size += BeginSpecificDemand.GetAllocatedSize() + EndSpecificDemand.GetAllocatedSize();
+	Size += Fingerprints.GetAllocatedSize();
+	Size += ColorClasses.GetAllocatedSize() + Palette.GetAllocatedSize() + PaletteHex.GetAllocatedSize();
+	Size += Bounds.GetAllocatedSize() + PolygonOffsets.GetAllocatedSize();
+	Size += VertexOffsets.GetAllocatedSize() + Vertices.GetAllocatedSize() + PolygonOwners.GetAllocatedSize();
+	Size += PolygonTree.GetAllocatedSize();
+	Size += DisplayTextOverrides.GetAllocatedSize() + FeatureIdToIndex.GetAllocatedSize();
+
+	// Key strings in IdToIndex are copies of the id columns
+	Size += IdToIndex.GetAllocatedSize();
+	for (const TPair<FString, int32>& Pair : IdToIndex)
+	{
+		Size += Pair.Key.GetAllocatedSize();
+	}
+	Size += CanonicalIds.GetAllocatedSize() + VariantToIndex.GetAllocatedSize();
+	for (const TPair<FString, int32>& Pair : VariantToIndex)
+	{
+		Size += Pair.Key.GetAllocatedSize();
+	}
+	for (const FString& Canonical : CanonicalIds)
+	{
+		Size += Canonical.GetAllocatedSize();
+	}
+	Size += PrefixOrder.GetAllocatedSize() + SuffixOrder.GetAllocatedSize();
+	Size += ColorToClass.GetAllocatedSize() + HexToClass.GetAllocatedSize();
+	Size += ColorChangeLog.GetAllocatedSize();
+	return Size;
+}
@@ -0,0 +1,201 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "BuildingSpatialIndex.h"
+
+// Struct-of-arrays storage for every loaded building.
+// Each building owns one dense index; its modified_gml_id and gml_id both resolve to that
+// index through a single hash, and every attribute is a column addressed by it.
+// Ids are CASE SENSITIVE and stored exactly as received from the API.
+class FINAL_PROJECT_API FBuildingStore
+{
+public:
+	// Energy columns hold this when the API sent null or nothing
+	static constexpr int32 MissingValue = MIN_int32;
+
+	// Color class of buildings that have no color yet
+	static constexpr uint16 NoColorClass = MAX_uint16;
+
+	// === Identity ===
+	TArray<FString> ModifiedGmlIds; // modified_gml_id (with '_')
+	TArray<FString> ActualGmlIds; // gml_id (with 'L') used by the attributes API
+
+	// === Energy ===
+	TBitArray<> HasEnergyData; // Set once a full begin/end energy result was ingested
+	TArray<int32> BeginCO2; // kg CO2/a before renovation
+	TArray<int32> EndCO2; // kg CO2/a after renovation
+	TArray<int32> BeginSpecificDemand; // kWh/m²a before renovation
+	TArray<int32> EndSpecificDemand; // kWh/m²a after renovation
+
+	// === Change detection ===
+	TArray<uint64> Fingerprints; // FBuildingEnergyRecord::ComputeFingerprint of the last record applied, 0 when unknown
+
+	// === Tileset features ===
+	// Numeric feature key -> building. The key is the API's numeric "id", which the tileset carries as a feature property;
+	// multi-geometry buildings own several. Keys the feature index map next to the color lookup texture.
+	TMap<int32, int32> FeatureIdToIndex;
+
+	// === Color ===
+	// The API uses a handful of distinct colors, so buildings store a class into a shared palette
+	TArray<uint16> ColorClasses;
+	TArray<FLinearColor> Palette;
+	TArray<FString> PaletteHex; // "#RRGGBB" (sRGB) for each palette entry
+
+	// === Geometry ===
+	TArray<FBox> Bounds; // Invalid (IsValid == 0) for buildings without coordinates
+	TArray<int32> PolygonOffsets; // Building i owns polygons [PolygonOffsets[i], PolygonOffsets[i + 1]) after FinalizeGeometry
+	TArray<int32> VertexOffsets; // Polygon p owns vertices [VertexOffsets[p], VertexOffsets[p + 1])
+	TArray<FVector> Vertices;
+
+	// Display text pushed by update paths that do not carry the full energy structure
+	TMap<int32, FString> DisplayTextOverrides;
+
+	FBuildingStore();
+
+	int32 Num() const { return ModifiedGmlIds.Num(); }
+	bool IsValidIndex(int32 Index) const { return ModifiedGmlIds.IsValidIndex(Index); }
+
+	// Exact (case-sensitive) lookup of either id; INDEX_NONE when unknown
+	int32 FindIndex(const FString& GmlId) const;
+
+	// Lookup through the id variant index: ids that differ only in case, '_' vs 'L' or '_' vs '-'
+	int32 FindVariantIndex(const FString& GmlId) const;
+
+	// Partial match: a known id contained in GmlId, or GmlId being a prefix or suffix of a known id.
+	// Neither side may be shorter than MinPartialMatchLength canonical characters.
+	int32 FindPartialMatchIndex(const FString& GmlId) const;
+	static constexpr int32 MinPartialMatchLength = 8; // Shorter fragments of a gml id match too many buildings to mean one
+
+	// Exact, then variant, then partial match
+	int32 ResolveIndex(const FString& GmlId) const;
+
+	// Key of the variant index: lower case with '_', '-' and 'l' folded together
+	static FString MakeCanonicalId(const FString& GmlId);
+
+	// Sorts the prefix/suffix order once after a bulk load; buildings added later are inserted in place
+	void FinalizeIdIndex();
+
+	// Returns the building known under either id, adding it when neither is known.
+	// An empty ActualGmlId is derived from the modified id ('_' -> 'L').
+	int32 FindOrAddBuilding(const FString& ModifiedGmlId, const FString& ActualGmlId = FString());
+
+	// Energy values; MissingValue leaves the "No data" text in place
+	void SetEnergyValues(int32 Index, int32 InBeginCO2, int32 InEndCO2, int32 InBeginSpecific, int32 InEndSpecific);
+	bool HasEnergy(int32 Index) const { return HasEnergyData[Index]; }
+
+	// Palette classes are shared by every building with the same sRGB color
+	int32 FindOrAddColorClass(const FLinearColor& Color);
+	int32 FindColorClassByHex(const FString& Hex) const;
+	int32 AddColorClassForHex(const FString& Hex, const FLinearColor& Color);
+	void SetColor(int32 Index, const FLinearColor& Color) { SetColorClass(Index, FindOrAddColorClass(Color)); }
+	void SetColorClass(int32 Index, int32 ColorClass);
+	bool HasColor(int32 Index) const { return ColorClasses[Index] != NoColorClass; }
+	const FLinearColor& GetColor(int32 Index) const { return Palette[ColorClasses[Index]]; }
+	const FString& GetColorHex(int32 Index) const { return PaletteHex[ColorClasses[Index]]; }
+	int32 NumColoredBuildings() const { return NumColored; }
+	TArray<int32> CountBuildingsPerColorClass() const; // Indexed like Palette
+
+	// Order-independent hash of every (modified id, color) pair, kept up to date by SetColorClass
+	uint64 GetColorMapHash() const { return ColorMapHash; }
+
+	// Fingerprint of which building owns which index: 64-bit FNV-1a over the UTF-8 modified ids in index order,
+	// each followed by '\n'. Kept up to date by FindOrAddBuilding so a server can prove it indexes the same order.
+	uint64 GetIdOrderHash() const { return IdOrderHash; }
+
+	// Position in the color change log; every consumer (style arms, color LUT) keeps its own
+	struct FColorChangeCursor
+	{
+		uint32 Epoch = 0; // No store uses epoch 0, so a fresh cursor always starts with a full rebuild
+		int32 Position = 0;
+	};
+
+	// Dirty set: buildings whose color class changed since Cursor, which is advanced past them.
+	// Returns false when the log restarted in between (bulk loads, overflow, a different store); rebuild everything then.
+	bool GetColorChangesSince(FColorChangeCursor& Cursor, TArray<int32>& OutChangedIndices) const;
+
+	// Maps a tileset feature key to Index; the first building to claim a key keeps it
+	void AddFeatureId(int32 FeatureId, int32 Index);
+
+	// Globally unique per change of FeatureIdToIndex, so a consumer can tell a stale copy even across store swaps
+	uint32 GetFeatureIdRevision() const { return FeatureIdRevision; }
+
+	// Text shown in the info widget: an override when present, otherwise built from the energy columns
+	bool HasDisplayText(int32 Index) const { return HasEnergyData[Index] || DisplayTextOverrides.Contains(Index); }
+	FString GetDisplayText(int32 Index) const;
+	FString FormatDisplayMessage(int32 Index) const;
+
+	// Geometry may be added in any building order; FinalizeGeometry groups it per building and
+	// recomputes Bounds. The accessors below are only valid while no edit is pending.
+	void AddPolygon(int32 Index, TArrayView<const FVector> Points);
+	void RemoveGeometry(int32 Index);
+	void FinalizeGeometry();
+	bool IsGeometryFinalized() const { return !bGeometryDirty; }
+	bool HasGeometry(int32 Index) const { return PolygonOffsets[Index + 1] > PolygonOffsets[Index]; }
+	int32 GetNumPolygons() const { return VertexOffsets.Num() - 1; }
+	TArrayView<const FVector> GetPolygon(int32 PolygonIndex) const;
+	TArrayView<const FVector> GetBuildingVertices(int32 Index) const;
+	int32 GetPolygonOwner(int32 PolygonIndex) const { return PolygonOwners[PolygonIndex]; }
+
+	// R-tree lookups of polygons by their XY bounds; candidates still need a point-in-polygon test
+	void QueryPolygonsAtPoint(const FVector& Point, TArray<int32>& OutPolygons) const;
+	void QueryPolygonsInArea(const FBox2D& Area, TArray<int32>& OutPolygons) const;
+
+	// Copies every building of Other whose ids are not known yet; returns how many were added.
+	// Other must have finalized geometry; call FinalizeGeometry and FinalizeIdIndex after the last Append.
+	// Without geometry the store stays finalized, so buildings can be added to a live store for coloring.
+	int32 Append(const FBuildingStore& Other, bool bWithGeometry = true);
+
+	void Reset();
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	// FString map keys compare case-insensitively by default, gml ids must not
+	struct FCaseSensitiveIdKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	// Canonical ids are already folded; hashing the characters lets a view into the query find them without a copy
+	struct FCanonicalIdKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static bool Matches(const FString& A, FStringView B) { return FStringView(A).Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return GetKeyHash(FStringView(Key)); }
+		static uint32 GetKeyHash(FStringView Key) { return FCrc::MemCrc32(Key.GetData(), Key.Len() * sizeof(TCHAR)); }
+	};
+
+	void AddVariant(const FString& Canonical, int32 Index);
+	void InsertIntoIdOrder(int32 Index);
+
+	TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveIdKeyFuncs> IdToIndex; // Both ids of every building
+
+	// === Id variant index ===
+	TArray<FString> CanonicalIds; // MakeCanonicalId of each modified id
+	TMap<FString, int32, FDefaultSetAllocator, FCanonicalIdKeyFuncs> VariantToIndex; // Canonical form of both non-empty ids; the first building wins
+	TArray<int32> PrefixOrder; // Building indices sorted by canonical id
+	TArray<int32> SuffixOrder; // Building indices sorted by reversed canonical id
+	int32 MinCanonicalIdLength = MAX_int32; // Shortest non-empty key of VariantToIndex
+	bool bIdOrderDirty = true; // Set during bulk loads until FinalizeIdIndex
+	TMap<uint32, uint16> ColorToClass; // Packed sRGB FColor -> palette class
+	TMap<FString, uint16> HexToClass; // Raw API hex -> palette class, skips reconverting repeated colors
+
+	int32 NumColored = 0; // Buildings whose color class is set
+
+	uint64 GetColorContribution(int32 Index, int32 ColorClass) const;
+
+	void RestartColorChangeLog();
+	void BumpFeatureIdRevision();
+
+	uint64 ColorMapHash = 0;
+	uint64 IdOrderHash = 0;
+	TArray<int32> ColorChangeLog; // Buildings in change order, may repeat
+	uint32 ColorChangeEpoch = 0; // Globally unique per log restart
+	uint32 FeatureIdRevision = 0;
+	TArray<int32> PolygonOwners; // Building of each polygon, INDEX_NONE once removed
+	FBuildingSpatialIndex PolygonTree; // Polygon XY bounds, rebuilt by FinalizeGeometry
+	bool bGeometryDirty = false;
+};
@@ -0,0 +1,302 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingStoreSnapshot.h"
+#include "BuildingStore.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	struct FSnapshotHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 ContentHash; // CityHash64 of everything after the header
+		int32 NumBuildings;
+		int32 NumPaletteColors;
+		int32 NumPolygons;
+		int32 NumVertices; // FVector is three doubles
+		int32 NumIdBytes; // UTF-8 bytes of all ids
+		int32 NumFeatureIds; // (feature key, building) pairs
+	};
+	static_assert(sizeof(FSnapshotHeader) % 8 == 0, "Sections after the header must stay 8-byte aligned");
+
+	// Appends sections padded to 8 bytes so every section can be read in place from a mapping
+	void WriteSection(TArray<uint8>& Bytes, const void* Data, int64 NumBytes)
+	{
+		Bytes.Append(static_cast<const uint8*>(Data), NumBytes);
+		Bytes.AddZeroed(Align(Bytes.Num(), 8) - Bytes.Num());
+	}
+
+	class FSnapshotReader
+	{
+	public:
+		explicit FSnapshotReader(TArrayView<const uint8> InBytes, int64 InOffset) : Bytes(InBytes), Offset(InOffset) {}
+
+		template <typename T>
+		TArrayView<const T> ReadSection(int32 Count)
+		{
+			const int64 NumBytes = static_cast<int64>(Count) * sizeof(T);
+			if (Count < 0 || Offset + NumBytes > Bytes.Num())
+			{
+				bOverrun = true;
+				return TArrayView<const T>();
+			}
+			const TArrayView<const T> Section(reinterpret_cast<const T*>(Bytes.GetData() + Offset), Count);
+			Offset = Align(Offset + NumBytes, 8);
+			return Section;
+		}
+
+		bool HasOverrun() const { return bOverrun; }
+
+	private:
+		TArrayView<const uint8> Bytes;
+		int64 Offset;
+		bool bOverrun = false;
+	};
+
+	// Offsets must start at 0, never decrease and end at Limit
+	bool AreOffsetsValid(TArrayView<const int32> Offsets, int32 Limit)
+	{
+		if (Offsets.Num() == 0 || Offsets[0] != 0 || Offsets.Last() != Limit)
+		{
+			return false;
+		}
+		for (int32 Index = 1; Index < Offsets.Num(); ++Index)
+		{
+			if (Offsets[Index] < Offsets[Index - 1])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool Fail(FString* OutError, const TCHAR* Message)
+	{
+		if (OutError)
+		{
+			*OutError = Message;
+		}
+		return false;
+	}
+}
+
+TArray<uint8> FBuildingStoreSnapshot::Serialize(const FBuildingStore& Store, uint64* OutContentHash)
+{
+	check(Store.IsGeometryFinalized());
+	const int32 NumBuildings = Store.Num();
+
+	// Ids of building i are entries 2i (modified) and 2i + 1 (actual)
+	TArray<int32> IdOffsets;
+	TArray<uint8> IdBytes;
+	IdOffsets.Reserve(NumBuildings * 2 + 1);
+	IdOffsets.Add(0);
+	for (int32 Index = 0; Index < NumBuildings; ++Index)
+	{
+		for (const FString* GmlId : { &Store.ModifiedGmlIds[Index], &Store.ActualGmlIds[Index] })
+		{
+			const FTCHARToUTF8 Utf8(**GmlId);
+			IdBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			IdOffsets.Add(IdBytes.Num());
+		}
+	}
+
+	TArray<uint8> HasEnergy;
+	HasEnergy.SetNumUninitialized(NumBuildings);
+	for (int32 Index = 0; Index < NumBuildings; ++Index)
+	{
+		HasEnergy[Index] = Store.HasEnergy(Index) ? 1 : 0;
+	}
+
+	// Sorted, so equal stores write equal bytes whatever order their keys were added in
+	TArray<TPair<int32, int32>> FeatureIds = Store.FeatureIdToIndex.Array();
+	static_assert(sizeof(TPair<int32, int32>) == 2 * sizeof(int32), "Feature keys are written as packed int32 pairs");
+	FeatureIds.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+
+	FSnapshotHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.NumBuildings = NumBuildings;
+	Header.NumPaletteColors = Store.Palette.Num();
+	Header.NumPolygons = Store.GetNumPolygons();
+	Header.NumVertices = Store.Vertices.Num();
+	Header.NumIdBytes = IdBytes.Num();
+	Header.NumFeatureIds = Store.FeatureIdToIndex.Num();
+
+	TArray<uint8> Bytes;
+	Bytes.AddZeroed(sizeof(FSnapshotHeader));
+	WriteSection(Bytes, Store.Palette.GetData(), Store.Palette.Num() * sizeof(FLinearColor));
+	WriteSection(Bytes, Store.ColorClasses.GetData(), NumBuildings * sizeof(uint16));
+	WriteSection(Bytes, HasEnergy.GetData(), NumBuildings);
+	WriteSection(Bytes, Store.BeginCO2.GetData(), NumBuildings * sizeof(int32));
+	WriteSection(Bytes, Store.EndCO2.GetData(), NumBuildings * sizeof(int32));
+	WriteSection(Bytes, Store.BeginSpecificDemand.GetData(), NumBuildings * sizeof(int32));
+	WriteSection(Bytes, Store.EndSpecificDemand.GetData(), NumBuildings * sizeof(int32));
+	WriteSection(Bytes, Store.Fingerprints.GetData(), NumBuildings * sizeof(uint64));
+	WriteSection(Bytes, IdOffsets.GetData(), IdOffsets.Num() * sizeof(int32));
+	WriteSection(Bytes, IdBytes.GetData(), IdBytes.Num());
+	WriteSection(Bytes, Store.PolygonOffsets.GetData(), (NumBuildings + 1) * sizeof(int32));
+	WriteSection(Bytes, Store.VertexOffsets.GetData(), (Header.NumPolygons + 1) * sizeof(int32));
+	WriteSection(Bytes, Store.Vertices.GetData(), Store.Vertices.Num() * sizeof(FVector));
+	WriteSection(Bytes, FeatureIds.GetData(), FeatureIds.Num() * sizeof(TPair<int32, int32>));
+
+	Header.ContentHash = CityHash64(reinterpret_cast<const char*>(Bytes.GetData() + sizeof(FSnapshotHeader)), Bytes.Num() - sizeof(FSnapshotHeader));
+	FMemory::Memcpy(Bytes.GetData(), &Header, sizeof(FSnapshotHeader));
+
+	if (OutContentHash)
+	{
+		*OutContentHash = Header.ContentHash;
+	}
+	return Bytes;
+}
+
+bool FBuildingStoreSnapshot::Deserialize(TArrayView<const uint8> Bytes, FBuildingStore& OutStore, uint64* OutContentHash, FString* OutError)
+{
+	if (Bytes.Num() < static_cast<int32>(sizeof(FSnapshotHeader)))
+	{
+		return Fail(OutError, TEXT("Snapshot is truncated"));
+	}
+
+	FSnapshotHeader Header;
+	FMemory::Memcpy(&Header, Bytes.GetData(), sizeof(FSnapshotHeader));
+	if (Header.Magic != Magic || Header.Version != Version)
+	{
+		return Fail(OutError, TEXT("Snapshot has an unknown format or version"));
+	}
+
+	const uint64 ContentHash = CityHash64(reinterpret_cast<const char*>(Bytes.GetData() + sizeof(FSnapshotHeader)), Bytes.Num() - sizeof(FSnapshotHeader));
+	if (ContentHash != Header.ContentHash)
+	{
+		return Fail(OutError, TEXT("Snapshot content does not match its header hash"));
+	}
+
+	const int32 NumBuildings = Header.NumBuildings;
+	FSnapshotReader Reader(Bytes, sizeof(FSnapshotHeader));
+	const TArrayView<const FLinearColor> Palette = Reader.ReadSection<FLinearColor>(Header.NumPaletteColors);
+	const TArrayView<const uint16> ColorClasses = Reader.ReadSection<uint16>(NumBuildings);
+	const TArrayView<const uint8> HasEnergy = Reader.ReadSection<uint8>(NumBuildings);
+	const TArrayView<const int32> BeginCO2 = Reader.ReadSection<int32>(NumBuildings);
+	const TArrayView<const int32> EndCO2 = Reader.ReadSection<int32>(NumBuildings);
+	const TArrayView<const int32> BeginSpecific = Reader.ReadSection<int32>(NumBuildings);
+	const TArrayView<const int32> EndSpecific = Reader.ReadSection<int32>(NumBuildings);
+	const TArrayView<const uint64> Fingerprints = Reader.ReadSection<uint64>(NumBuildings);
+	const TArrayView<const int32> IdOffsets = Reader.ReadSection<int32>(NumBuildings * 2 + 1);
+	const TArrayView<const uint8> IdBytes = Reader.ReadSection<uint8>(Header.NumIdBytes);
+	const TArrayView<const int32> PolygonOffsets = Reader.ReadSection<int32>(NumBuildings + 1);
+	const TArrayView<const int32> VertexOffsets = Reader.ReadSection<int32>(Header.NumPolygons + 1);
+	const TArrayView<const FVector> Vertices = Reader.ReadSection<FVector>(Header.NumVertices);
+	const TArrayView<const int32> FeatureIds = Reader.ReadSection<int32>(Header.NumFeatureIds * 2);
+
+	if (Reader.HasOverrun() || !AreOffsetsValid(IdOffsets, Header.NumIdBytes) ||
+		!AreOffsetsValid(PolygonOffsets, Header.NumPolygons) || !AreOffsetsValid(VertexOffsets, Header.NumVertices))
+	{
+		return Fail(OutError, TEXT("Snapshot sections are inconsistent"));
+	}
+
+	// Rebuild through the store API so the id, color and spatial indices come back too
+	OutStore.Reset();
+	for (int32 ColorClass = 0; ColorClass < Palette.Num(); ++ColorClass)
+	{
+		if (OutStore.FindOrAddColorClass(Palette[ColorClass]) != ColorClass)
+		{
+			return Fail(OutError, TEXT("Snapshot palette has duplicate colors"));
+		}
+	}
+
+	const auto ReadId = [&IdOffsets, &IdBytes](int32 Entry)
+	{
+		return FString(IdOffsets[Entry + 1] - IdOffsets[Entry], reinterpret_cast<const UTF8CHAR*>(IdBytes.GetData() + IdOffsets[Entry]));
+	};
+
+	for (int32 Index = 0; Index < NumBuildings; ++Index)
+	{
+		if (OutStore.FindOrAddBuilding(ReadId(Index * 2), ReadId(Index * 2 + 1)) != Index)
+		{
+			return Fail(OutError, TEXT("Snapshot has duplicate building ids"));
+		}
+		OutStore.Fingerprints[Index] = Fingerprints[Index];
+
+		if (HasEnergy[Index])
+		{
+			OutStore.SetEnergyValues(Index, BeginCO2[Index], EndCO2[Index], BeginSpecific[Index], EndSpecific[Index]);
+		}
+
+		if (ColorClasses[Index] != FBuildingStore::NoColorClass)
+		{
+			if (ColorClasses[Index] >= Palette.Num())
+			{
+				return Fail(OutError, TEXT("Snapshot color class is out of range"));
+			}
+			OutStore.SetColorClass(Index, ColorClasses[Index]);
+		}
+
+		for (int32 Polygon = PolygonOffsets[Index]; Polygon < PolygonOffsets[Index + 1]; ++Polygon)
+		{
+			OutStore.AddPolygon(Index, Vertices.Slice(VertexOffsets[Polygon], VertexOffsets[Polygon + 1] - VertexOffsets[Polygon]));
+		}
+	}
+	for (int32 Entry = 0; Entry + 1 < FeatureIds.Num(); Entry += 2)
+	{
+		if (FeatureIds[Entry + 1] < 0 || FeatureIds[Entry + 1] >= NumBuildings)
+		{
+			return Fail(OutError, TEXT("Snapshot feature key points past the buildings"));
+		}
+		OutStore.AddFeatureId(FeatureIds[Entry], FeatureIds[Entry + 1]);
+	}
+	OutStore.FinalizeGeometry();
+	OutStore.FinalizeIdIndex();
+
+	if (OutContentHash)
+	{
+		*OutContentHash = ContentHash;
+	}
+	return true;
+}
+
+bool FBuildingStoreSnapshot::SaveToFile(const TArray<uint8>& Bytes, const FString& Path)
+{
+	// Write next to the target and move over it, so a crash never leaves a half-written snapshot
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.MakeDirectory(*FPaths::GetPath(Path), true);
+
+	const FString TempPath = Path + TEXT(".tmp");
+	return FFileHelper::SaveArrayToFile(Bytes, *TempPath) && FileManager.Move(*Path, *TempPath, true);
+}
+
+bool FBuildingStoreSnapshot::LoadFromFile(const FString& Path, FBuildingStore& OutStore, uint64* OutContentHash, FString* OutError)
+{
+	if (!FPaths::FileExists(Path))
+	{
+		return Fail(OutError, TEXT("No snapshot on disk"));
+	}
+
+	FOpenMappedResult MappedFile = FPlatformFileManager::Get().GetPlatformFile().OpenMappedEx(*Path);
+	if (MappedFile.HasValue())
+	{
+		TUniquePtr<IMappedFileHandle> Handle = MappedFile.StealValue();
+		TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion());
+		if (Region && Region->GetMappedSize() <= MAX_int32)
+		{
+			const TArrayView<const uint8> Bytes(Region->GetMappedPtr(), static_cast<int32>(Region->GetMappedSize()));
+			return Deserialize(Bytes, OutStore, OutContentHash, OutError);
+		}
+	}
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+	{
+		return Fail(OutError, TEXT("Snapshot could not be read"));
+	}
+	return Deserialize(Bytes, OutStore, OutContentHash, OutError);
+}
+
+FString FBuildingStoreSnapshot::GetSnapshotPath(const FString& CommunityId)
+{
+	return FPaths::ProjectSavedDir() / TEXT("BuildingEnergy") / FString::Printf(TEXT("Buildings_%s.bin"), *CommunityId);
+}
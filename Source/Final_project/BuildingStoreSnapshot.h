@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FBuildingStore;
+
+// Versioned binary image of a building store for warm starts.
+// A fixed header is followed by 8-byte aligned flat sections (palette, color classes, energy
+// columns, fingerprints, UTF-8 ids, polygon/vertex offsets, vertices and feature keys), so the file can be memory mapped and
+// read in place. The header carries a hash of the payload, which doubles as a content hash:
+// two stores built from the same API data serialize to the same bytes.
+class FINAL_PROJECT_API FBuildingStoreSnapshot
+{
+public:
+	static constexpr uint32 Magic = 0x4E534542; // "BESN"
+	static constexpr uint32 Version = 3; // 2: change detection fingerprints, 3: tileset feature keys
+
+	// Flat image of Store, whose geometry must be finalized. DisplayTextOverrides are live-update state and are not written
+	static TArray<uint8> Serialize(const FBuildingStore& Store, uint64* OutContentHash = nullptr);
+
+	// Rebuilds OutStore (ids, colors, energy, geometry and every index) from a snapshot image
+	static bool Deserialize(TArrayView<const uint8> Bytes, FBuildingStore& OutStore, uint64* OutContentHash = nullptr, FString* OutError = nullptr);
+
+	static bool SaveToFile(const TArray<uint8>& Bytes, const FString& Path);
+
+	// Maps the file when the platform supports it, otherwise reads it into memory
+	static bool LoadFromFile(const FString& Path, FBuildingStore& OutStore, uint64* OutContentHash = nullptr, FString* OutError = nullptr);
+
+	// Saved/BuildingEnergy/Buildings_<CommunityId>.bin
+	static FString GetSnapshotPath(const FString& CommunityId);
+};
@@ -0,0 +1,208 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingStyleState.h"
+#include "BuildingStore.h"
+#include "Misc/StringBuilder.h"
+
+bool FBuildingStyleState::NeedsApply(const UObject* Tileset, uint64 ColorMapHash) const
+{
+	const uint64* AppliedHash = AppliedHashes.Find(Tileset);
+	return !AppliedHash || *AppliedHash != ColorMapHash;
+}
+
+void FBuildingStyleState::MarkApplied(const UObject* Tileset, uint64 ColorMapHash)
+{
+	// Drop tilesets that were destroyed since they were styled
+	for (auto It = AppliedHashes.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	AppliedHashes.Add(Tileset, ColorMapHash);
+}
+
+void FBuildingStyleState::InvalidateApplied()
+{
+	AppliedHashes.Reset();
+}
+
+const FString& FBuildingStyleState::BuildStyleJson(FBuildingStore& Store, const FString& FeatureIdExpr)
+{
+	TArray<int32> ChangedIndices;
+	const bool bListed = Store.GetColorChangesSince(ColorChangeCursor, ChangedIndices);
+
+	if (!bListed || !bArmsValid || ClassOfBuilding.Num() > Store.Num())
+	{
+		RebuildAllArms(Store);
+	}
+	else if (ChangedIndices.Num() > 0)
+	{
+		// Buildings added since the last build start without a class
+		while (ClassOfBuilding.Num() < Store.Num())
+		{
+			ClassOfBuilding.Add(FBuildingStore::NoColorClass);
+		}
+		ClassMembers.SetNum(Store.Palette.Num());
+		ArmLabels.SetNum(Store.Palette.Num());
+
+		TBitArray<> DirtyClasses(false, Store.Palette.Num());
+		for (const int32 BuildingIndex : ChangedIndices)
+		{
+			const uint16 OldClass = ClassOfBuilding[BuildingIndex];
+			const uint16 NewClass = Store.ColorClasses[BuildingIndex];
+			if (OldClass == NewClass)
+			{
+				continue;
+			}
+
+			if (OldClass != FBuildingStore::NoColorClass)
+			{
+				ClassMembers[OldClass].RemoveSingleSwap(BuildingIndex, EAllowShrinking::No);
+				DirtyClasses[OldClass] = true;
+			}
+			if (NewClass != FBuildingStore::NoColorClass)
+			{
+				ClassMembers[NewClass].Add(BuildingIndex);
+				DirtyClasses[NewClass] = true;
+			}
+			ClassOfBuilding[BuildingIndex] = NewClass;
+		}
+
+		for (TConstSetBitIterator<> It(DirtyClasses); It; ++It)
+		{
+			RebuildArm(Store, It.GetIndex());
+		}
+	}
+	else if (FeatureIdExpr == CachedFeatureIdExpr && Store.GetColorMapHash() == CachedColorMapHash)
+	{
+		return CachedStyleJson;
+	}
+
+	// Arms are already formatted, so assembling the style is a handful of appends
+	int32 StyleLength = FeatureIdExpr.Len() + 64;
+	for (int32 ColorClass = 0; ColorClass < ArmLabels.Num(); ++ColorClass)
+	{
+		StyleLength += ArmLabels[ColorClass].Len() + 16;
+	}
+
+	TStringBuilder<1024> StyleBuilder;
+	StyleBuilder.Reserve(StyleLength);
+	StyleBuilder.Append(TEXT("{\"color\":[\"match\","));
+	StyleBuilder.Append(FeatureIdExpr);
+	StyleBuilder.AppendChar(TEXT(','));
+	for (int32 ColorClass = 0; ColorClass < ArmLabels.Num(); ++ColorClass)
+	{
+		if (ClassMembers[ColorClass].Num() == 0)
+		{
+			continue;
+		}
+
+		StyleBuilder.AppendChar(TEXT('['));
+		StyleBuilder.Append(ArmLabels[ColorClass]);
+		StyleBuilder.Append(TEXT("],\""));
+		StyleBuilder.Append(Store.PaletteHex[ColorClass]);
+		StyleBuilder.Append(TEXT("\","));
+	}
+	StyleBuilder.Append(TEXT("\"#ffffff\"]}")); // Default fallback color
+
+	CachedStyleJson = FString(StyleBuilder.ToView());
+	CachedFeatureIdExpr = FeatureIdExpr;
+	CachedColorMapHash = Store.GetColorMapHash();
+	return CachedStyleJson;
+}
+
+void FBuildingStyleState::Reset()
+{
+	AppliedHashes.Reset();
+	ClassMembers.Reset();
+	ArmLabels.Reset();
+	ClassOfBuilding.Reset();
+	CachedStyleJson.Reset();
+	CachedFeatureIdExpr.Reset();
+	CachedColorMapHash = 0;
+	ColorChangeCursor = FBuildingStore::FColorChangeCursor();
+	bArmsValid = false;
+}
+
+SIZE_T FBuildingStyleState::GetAllocatedSize() const
+{
+	SIZE_T Size = AppliedHashes.GetAllocatedSize() + ClassMembers.GetAllocatedSize() + ArmLabels.GetAllocatedSize();
+	for (const TArray<int32>& Members : ClassMembers)
+	{
+		Size += Members.GetAllocatedSize();
+	}
+	for (const FString& Label : ArmLabels)
+	{
+		Size += Label.GetAllocatedSize();
+	}
+	Size += ClassOfBuilding.GetAllocatedSize();
+	Size += CachedStyleJson.GetAllocatedSize() + CachedFeatureIdExpr.GetAllocatedSize();
+	return Size;
+}
+
+void FBuildingStyleState::RebuildAllArms(const FBuildingStore& Store)
+{
+	const TArray<int32> ClassCounts = Store.CountBuildingsPerColorClass();
+	ClassMembers.Reset();
+	ClassMembers.SetNum(ClassCounts.Num());
+	for (int32 ColorClass = 0; ColorClass < ClassCounts.Num(); ++ColorClass)
+	{
+		ClassMembers[ColorClass].Reserve(ClassCounts[ColorClass]);
+	}
+
+	ClassOfBuilding = Store.ColorClasses;
+	for (int32 BuildingIndex = 0; BuildingIndex < Store.Num(); ++BuildingIndex)
+	{
+		if (Store.HasColor(BuildingIndex))
+		{
+			ClassMembers[Store.ColorClasses[BuildingIndex]].Add(BuildingIndex);
+		}
+	}
+
+	ArmLabels.Reset();
+	ArmLabels.SetNum(ClassCounts.Num());
+	for (int32 ColorClass = 0; ColorClass < ClassCounts.Num(); ++ColorClass)
+	{
+		RebuildArm(Store, ColorClass);
+	}
+	bArmsValid = true;
+}
+
+void FBuildingStyleState::RebuildArm(const FBuildingStore& Store, int32 ColorClass)
+{
+	const TArray<int32>& Members = ClassMembers[ColorClass];
+
+	int32 LabelLength = 0;
+	for (const int32 BuildingIndex : Members)
+	{
+		LabelLength += Store.ModifiedGmlIds[BuildingIndex].Len() + Store.ActualGmlIds[BuildingIndex].Len() + 6;
+	}
+
+	// Both ids of each building are labels of the arm
+	TStringBuilder<256> LabelBuilder;
+	LabelBuilder.Reserve(LabelLength);
+	for (const int32 BuildingIndex : Members)
+	{
+		const FString& ModifiedId = Store.ModifiedGmlIds[BuildingIndex];
+		const FString& ActualId = Store.ActualGmlIds[BuildingIndex];
+
+		for (const FString* GmlId : { &ModifiedId, &ActualId })
+		{
+			if (GmlId == &ActualId && ActualId.Equals(ModifiedId)) continue;
+
+			if (LabelBuilder.Len() > 0)
+			{
+				LabelBuilder.AppendChar(TEXT(','));
+			}
+
+			// Escape quotes in GML ID for JSON
+			LabelBuilder.AppendChar(TEXT('"'));
+			int32 QuoteIndex = INDEX_NONE;
+			LabelBuilder.Append(GmlId->FindChar(TEXT('"'), QuoteIndex) ? GmlId->Replace(TEXT("\""), TEXT("\\\"")) : *GmlId);
+			LabelBuilder.AppendChar(TEXT('"'));
+		}
+	}
+	ArmLabels[ColorClass] = FString(LabelBuilder.ToView());
+}
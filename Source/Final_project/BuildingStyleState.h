@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "BuildingStore.h"
+
+// Cesium style generation state for one building store.
+// Keeps the style "match" arms per palette color so a poll that recolors a few buildings only
+// rebuilds the arms of the colors involved, and remembers which color map hash each tileset
+// was last styled with so unchanged colors are never reapplied.
+class FINAL_PROJECT_API FBuildingStyleState
+{
+public:
+	// True when Tileset has not been styled with this color map yet
+	bool NeedsApply(const UObject* Tileset, uint64 ColorMapHash) const;
+	void MarkApplied(const UObject* Tileset, uint64 ColorMapHash);
+
+	// Forget every applied hash so the next apply always goes through
+	void InvalidateApplied();
+
+	// Full 3D Tiles style JSON: {"color":["match",<FeatureIdExpr>,[ids...],"#HEX",...,"#ffffff"]}.
+	// Reads the store's color dirty set and only regenerates the arms it touched.
+	const FString& BuildStyleJson(FBuildingStore& Store, const FString& FeatureIdExpr);
+
+	void Reset();
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	void RebuildAllArms(const FBuildingStore& Store);
+	void RebuildArm(const FBuildingStore& Store, int32 ColorClass);
+
+	TMap<TWeakObjectPtr<const UObject>, uint64> AppliedHashes; // Per tileset, color map hash of the last applied style
+
+	TArray<TArray<int32>> ClassMembers; // Buildings in each palette class
+	TArray<FString> ArmLabels; // "ID","ID",... labels of each palette class
+	TArray<uint16> ClassOfBuilding; // Palette class each building had when the arms were built
+
+	FBuildingStore::FColorChangeCursor ColorChangeCursor;
+
+	FString CachedStyleJson;
+	FString CachedFeatureIdExpr;
+	uint64 CachedColorMapHash = 0;
+	bool bArmsValid = false;
+};
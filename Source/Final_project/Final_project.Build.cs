@@ -26,7 +26,8 @@ public class Final_project : ModuleRules // Define build rules class inheriting
         }); // End of public dependency modules array [PUBLIC DEPENDENCIES END]
 
 		PrivateDependencyModuleNames.AddRange(new string[] {  // Add private dependency modules [PRIVATE DEPENDENCIES START]
-			"ToolMenus" // Tool menus for editor integration [TOOL MENUS MODULE]
+			"ToolMenus", // Tool menus for editor integration [TOOL MENUS MODULE]
+			"HTTPServer" // Local HTTP listener behind the mock backend [HTTP SERVER MODULE]
 		}); // End of private dependency modules array [PRIVATE DEPENDENCIES END]
 		
 		// Note: Mixed Reality modules commented out for now - can be added back with proper setup